@@ -1,6 +1,8 @@
 // Full implementation ported from LilyGo's TouchClassCST226.cpp
 #include "cst226se.h"
+#include "cst226se_frame.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include <stdbool.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -16,7 +18,11 @@ static const char *TAG = "cst226se";
 
 #define CST226SE_I2C_ADDR      0x5A
 #define CST226SE_I2C_FREQ_HZ   400000
-#define CST226SE_BUFFER_NUM    28
+// Fm+ is only negotiated when every device sharing the bus accepts it;
+// the SY6970 is limited to 400 kHz, so on the stock board this stays at Fast-mode.
+#ifndef CST226SE_I2C_FMP_FREQ_HZ
+#define CST226SE_I2C_FMP_FREQ_HZ 1000000
+#endif
 #define CST226SE_CHIPTYPE      0xA8
 
 
@@ -44,9 +50,18 @@ static int16_t s_yMax = 450;
 static bool s_swapXY = false;
 static bool s_mirrorX = true;
 static bool s_mirrorY = true;
+static bool s_raw_output = false;   // Report native sensor coordinates; the caller transforms them
 static uint32_t s_chipID = 0;
 static cst226se_rotation_t s_current_rotation = CST226SE_ROTATION_270;
 
+// Bus speed and per-sample transfer accounting
+static cst226se_link_t s_link;
+static cst226se_stats_t s_stats;
+
+// Optional arbitration of the shared bus around each sample
+static cst226se_bus_hook_t s_bus_hook = NULL;
+static void *s_bus_hook_ctx = NULL;
+
 // --- Callback logic ---
 typedef void (*cst226se_event_callback_t)(const cst226se_data_t *data, void *user_ctx);
 static cst226se_event_callback_t s_touch_callback = NULL;
@@ -77,6 +92,17 @@ void cst226se_set_mirror_xy(bool mirror_x, bool mirror_y)
     s_mirrorY = mirror_y;
 }
 
+void cst226se_set_bus_hook(cst226se_bus_hook_t hook, void *user_ctx)
+{
+    s_bus_hook_ctx = user_ctx;
+    s_bus_hook = hook;
+}
+
+void cst226se_set_raw_output(bool raw)
+{
+    s_raw_output = raw;
+}
+
 void cst226se_set_max_coordinates(uint16_t x, uint16_t y)
 {
     s_xMax = x;
@@ -108,6 +134,29 @@ static esp_err_t write_then_read(const uint8_t *write_buf, size_t write_len, uin
     return i2c_master_transmit_receive(s_dev, (uint8_t *)write_buf, write_len, read_buf, read_len, -1);
 }
 
+static esp_err_t add_device(uint32_t freq_hz)
+{
+    i2c_device_config_t dev_config = {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address = CST226SE_I2C_ADDR,
+        .scl_speed_hz = freq_hz,
+    };
+    return i2c_master_bus_add_device(s_bus, &dev_config, &s_dev);
+}
+
+// Re-attach the device at the link's current rate (used on Fm+ fallback)
+static void apply_bus_speed(void)
+{
+    ESP_LOGW(TAG, "I2C errors at Fm+, falling back to %lu Hz", (unsigned long)s_link.freq_hz);
+    if (s_dev) {
+        i2c_master_bus_rm_device(s_dev);
+        s_dev = NULL;
+    }
+    if (add_device(s_link.freq_hz) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to re-add CST226SE device");
+    }
+}
+
 void cst226se_set_rotation(cst226se_rotation_t rotation)
 {
     s_current_rotation = rotation;
@@ -144,8 +193,13 @@ cst226se_rotation_t cst226se_get_rotation(void)
     return s_current_rotation;
 }
 
+// IRQ armed as a low-level light-sleep wake source (see cst226se_enable_wakeup())
+static volatile bool s_irq_wake = false;
+
 static void IRAM_ATTR cst226se_isr_handler(void *arg) {
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    // A level interrupt repeats while the line is low; masked until the next wait
+    if (s_irq_wake) gpio_intr_disable(CST226SE_IRQ_PIN);
     if (s_touch_sem) {
         xSemaphoreGiveFromISR(s_touch_sem, &xHigherPriorityTaskWoken);
     }
@@ -156,7 +210,17 @@ static void IRAM_ATTR cst226se_isr_handler(void *arg) {
 
 bool cst226se_wait_event(uint32_t timeout_ms) {
     if (!s_touch_sem) return false;
-    return xSemaphoreTake(s_touch_sem, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+    if (s_irq_wake) gpio_intr_enable(CST226SE_IRQ_PIN);
+    TickType_t ticks = (timeout_ms == CST226SE_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    return xSemaphoreTake(s_touch_sem, ticks) == pdTRUE;
+}
+
+esp_err_t cst226se_enable_wakeup(void) {
+    // gpio_wakeup_enable() switches the pin to a low-level interrupt, the only kind that
+    // wakes the chip from light sleep
+    esp_err_t ret = gpio_wakeup_enable(CST226SE_IRQ_PIN, GPIO_INTR_LOW_LEVEL);
+    if (ret == ESP_OK) s_irq_wake = true;
+    return ret;
 }
 
 void cst226se_reset(void)
@@ -187,15 +251,14 @@ esp_err_t cst226se_init(void)
     }
 
     if (!s_dev) {
-        i2c_device_config_t dev_config = {
-            .dev_addr_length = I2C_ADDR_BIT_LEN_7,
-            .device_address = CST226SE_I2C_ADDR,
-            .scl_speed_hz = CST226SE_I2C_FREQ_HZ,
-        };
-        if (i2c_master_bus_add_device(s_bus, &dev_config, &s_dev) != ESP_OK) {
+        uint32_t max_hz = CST226SE_I2C_FMP_FREQ_HZ;
+        if (max_hz > SY6970_I2C_MAX_FREQ_HZ) max_hz = SY6970_I2C_MAX_FREQ_HZ;
+        cst226se_link_init(&s_link, CST226SE_I2C_FREQ_HZ, max_hz);
+        if (add_device(s_link.freq_hz) != ESP_OK) {
             ESP_LOGE(TAG, "Failed to add CST226SE device");
             return ESP_FAIL;
         }
+        ESP_LOGI(TAG, "Touch I2C at %lu Hz", (unsigned long)s_link.freq_hz);
     }
 
     // Configure default rotation
@@ -276,6 +339,10 @@ void cst226se_set_i2c_bus(i2c_master_bus_handle_t bus)
 esp_err_t cst226se_deinit(void) {
     // Remove ISR handler
     gpio_isr_handler_remove(CST226SE_IRQ_PIN);
+    if (s_irq_wake) {
+        gpio_wakeup_disable(CST226SE_IRQ_PIN);
+        s_irq_wake = false;
+    }
     
     // Delete semaphore
     if (s_touch_sem) {
@@ -300,6 +367,68 @@ esp_err_t cst226se_deinit(void) {
     return ESP_OK;
 }
 
+// Rotation transform: swap, clamp to the active workspace, then mirror
+static void map_point(uint16_t x, uint16_t y, uint16_t *ox, uint16_t *oy)
+{
+    if (s_raw_output) {
+        *ox = x;
+        *oy = y;
+        return;
+    }
+
+    int16_t tx = x;
+    int16_t ty = y;
+    if (s_swapXY) {
+        int16_t tmp = tx; tx = ty; ty = tmp;
+    }
+
+    // Clamp to limits to avoid overflow/underflow during mirror or out-of-bounds errors
+    if (tx < 0) tx = 0;
+    if (s_xMax && tx > s_xMax) tx = s_xMax;
+    if (ty < 0) ty = 0;
+    if (s_yMax && ty > s_yMax) ty = s_yMax;
+
+    if (s_mirrorX && s_xMax) tx = s_xMax - tx;
+    if (s_mirrorY && s_yMax) ty = s_yMax - ty;
+
+    *ox = (uint16_t)tx;
+    *oy = (uint16_t)ty;
+}
+
+static bool frame_read(void *ctx, uint8_t reg, uint8_t *buf, size_t len)
+{
+    esp_err_t ret = read_reg(reg, buf, len);
+    if (cst226se_link_update(&s_link, ret == ESP_OK)) {
+        apply_bus_speed();
+    }
+    return ret == ESP_OK;
+}
+
+static bool frame_write(void *ctx, uint8_t reg, uint8_t val)
+{
+    return write_single(reg, val) == ESP_OK;
+}
+
+void cst226se_get_stats(cst226se_stats_t *stats)
+{
+    if (!stats) return;
+    *stats = s_stats;
+    stats->freq_hz = s_link.freq_hz;
+    stats->fmp_fallbacks = s_link.fallbacks;
+}
+
+static const char *frame_result_str(cst226se_frame_result_t res)
+{
+    switch (res) {
+    case CST226SE_FRAME_NO_TOUCH: return "no touch";
+    case CST226SE_FRAME_HOME:     return "home pattern";
+    case CST226SE_FRAME_INVALID:  return "sync marker missing";
+    case CST226SE_FRAME_RESYNC:   return "point count out of range, resync";
+    case CST226SE_FRAME_IO_ERROR: return "read error";
+    default:                      return "touch";
+    }
+}
+
 bool cst226se_read(cst226se_data_t *data)
 {
     // Log IRQ pin state for hardware diagnosis, but only periodically
@@ -314,98 +443,38 @@ bool cst226se_read(cst226se_data_t *data)
 
     static bool last_pressed = false;
 
-    uint8_t buffer[CST226SE_BUFFER_NUM];
-    esp_err_t reg_result = read_reg(0x00, buffer, CST226SE_BUFFER_NUM);
-    if (reg_result != ESP_OK) {
-        ESP_LOGE(TAG, "Touch read_reg failed: %d", reg_result);
-        if (last_pressed != false) {
-            data->pressed = false;
-            last_pressed = false;
-            ESP_LOGI(TAG, "Touch released (read error)");
-            if (s_touch_callback) s_touch_callback(data, s_touch_callback_ctx);
-            return true;
-        }
-        return false;
-    }
-
-    // Home button detection
-
-    if (buffer[0] == 0x83 && buffer[1] == 0x17 && buffer[5] == 0x80) {
-        ESP_LOGI(TAG, "Touch: Home button pattern detected, no touch");
-        data->pressed = false;
-        if (last_pressed != false) {
-            last_pressed = false;
-            ESP_LOGI(TAG, "Touch released (home pattern)");
-            if (s_touch_callback) s_touch_callback(data, s_touch_callback_ctx);
-            return true;
-        }
-        return false;
-    }
-
-
-    if (buffer[6] != 0xAB) {
-        ESP_LOGI(TAG, "Touch: buffer[6] != 0xAB, no valid touch");
-        if (last_pressed != false) {
-            data->pressed = false;
-            last_pressed = false;
-            ESP_LOGI(TAG, "Touch released (buffer[6] check)");
-            if (s_touch_callback) s_touch_callback(data, s_touch_callback_ctx);
-            return true;
-        }
-        return false;
-    }
-    if (buffer[0] == 0xAB) {
-        ESP_LOGI(TAG, "Touch: buffer[0] == 0xAB, no valid touch");
-        if (last_pressed != false) {
-            data->pressed = false;
-            last_pressed = false;
-            ESP_LOGI(TAG, "Touch released (buffer[0] check)");
-            if (s_touch_callback) s_touch_callback(data, s_touch_callback_ctx);
-            return true;
-        }
-        return false;
-    }
-    if (buffer[5] == 0x80) {
-        ESP_LOGI(TAG, "Touch: buffer[5] == 0x80, no valid touch");
-        if (last_pressed != false) {
-            data->pressed = false;
-            last_pressed = false;
-            ESP_LOGI(TAG, "Touch released (buffer[5] == 0x80)");
-            if (s_touch_callback) s_touch_callback(data, s_touch_callback_ctx);
-            return true;
+    cst226se_frame_t frame;
+    if (s_bus_hook) s_bus_hook(true, s_bus_hook_ctx);
+    int64_t t0 = esp_timer_get_time();
+    cst226se_frame_result_t res = cst226se_frame_fetch(frame_read, frame_write, NULL, &frame);
+    uint32_t dt = (uint32_t)(esp_timer_get_time() - t0);
+    if (s_bus_hook) s_bus_hook(false, s_bus_hook_ctx);
+
+    s_stats.samples++;
+    s_stats.bytes += frame.bytes;
+    s_stats.transactions += frame.transactions;
+    s_stats.busy_us += dt;
+    if (dt > s_stats.max_us) s_stats.max_us = dt;
+    if (res == CST226SE_FRAME_IO_ERROR) s_stats.errors++;
+    if (res == CST226SE_FRAME_RESYNC) s_stats.resyncs++;
+
+    if (res != CST226SE_FRAME_TOUCH) {
+        if (res == CST226SE_FRAME_IO_ERROR || res == CST226SE_FRAME_RESYNC) {
+            ESP_LOGW(TAG, "Touch: %s", frame_result_str(res));
         }
-        return false;
-    }
-
-
-    uint8_t point = buffer[5] & 0x7F;
-    // ESP_LOGI(TAG, "Touch: point count = %u", point);
-    if (point > 5 || point == 0) {
-        ESP_LOGI(TAG, "Touch: point out of range or zero, writing 0xAB");
-        write_single(0x00, 0xAB);
         if (last_pressed != false) {
             data->pressed = false;
+            data->count = 0;
             last_pressed = false;
-            ESP_LOGI(TAG, "Touch released (point out of range)");
+            ESP_LOGI(TAG, "Touch released (%s)", frame_result_str(res));
             if (s_touch_callback) s_touch_callback(data, s_touch_callback_ctx);
             return true;
         }
         return false;
     }
 
-
-    // Parse first point
-    uint8_t index = 0;
-    uint16_t x = 0, y = 0;
-    for (int i = 0; i < point; i++) {
-        // uint8_t id = buffer[index] >> 4;
-        // uint8_t status = buffer[index] & 0x0F;
-        uint16_t px = (uint16_t)((buffer[index + 1] << 4) | ((buffer[index + 3] >> 4) & 0x0F));
-        uint16_t py = (uint16_t)((buffer[index + 2] << 4) | (buffer[index + 3] & 0x0F));
-        // ESP_LOGI(TAG, "Touch: i=%d id=%u status=%u px=%u py=%u", i, id, status, px, py);
-        if (i == 0) { x = px; y = py; }
-        index = (i == 0) ? (index + 7) : (index + 5);
-    }
+    uint16_t x = frame.points[0].x;
+    uint16_t y = frame.points[0].y;
 
     // Filter out obviously bogus values (e.g., y=65504U) before transforms
 
@@ -413,6 +482,7 @@ bool cst226se_read(cst226se_data_t *data)
         ESP_LOGI(TAG, "Touch: y == 65504U, bogus value");
         if (last_pressed != false) {
             data->pressed = false;
+            data->count = 0;
             last_pressed = false;
             ESP_LOGI(TAG, "Touch released (bogus y)");
             if (s_touch_callback) s_touch_callback(data, s_touch_callback_ctx);
@@ -422,47 +492,27 @@ bool cst226se_read(cst226se_data_t *data)
     }
 
 
-    // Apply rotation transforms (chip reports native landscape 450x600)
-    int16_t tx = x;
-    int16_t ty = y;
-    if (s_swapXY) {
-        int16_t tmp = tx; tx = ty; ty = tmp;
-    }
-
-    // Clamp to limits to avoid overflow/underflow during mirror or out-of-bounds errors
-    if (tx < 0) tx = 0;
-    if (s_xMax && tx > s_xMax) tx = s_xMax;
-    if (ty < 0) ty = 0;
-    if (s_yMax && ty > s_yMax) ty = s_yMax;
+    // Apply rotation transforms to every reported point in the same pass
+    uint16_t tx, ty;
+    map_point(x, y, &tx, &ty);
 
-    if (s_mirrorX && s_xMax) tx = s_xMax - tx;
-    if (s_mirrorY && s_yMax) ty = s_yMax - ty;
-
-    // ESP_LOGI(TAG, "Touch: transformed tx=%d ty=%d", tx, ty);
-
-    // Filter out out-of-bounds values (Should be handled by clamp above, but keeping for safety)
-    if (tx < 0 || (s_xMax && tx > s_xMax) || ty < 0 || (s_yMax && ty > s_yMax)) {
-        ESP_LOGI(TAG, "Touch: out of bounds (tx,ty)=%d,%d", tx, ty);
-        // Instead of releasing, we just clamp (already done) or ignore.
-        // But if we are here, something is very wrong (e.g. negative after mirror?)
-        // Let's just clamp again to be safe and NOT release.
-        if (tx < 0) tx = 0;
-        if (s_xMax && tx > s_xMax) tx = s_xMax;
-        if (ty < 0) ty = 0;
-        if (s_yMax && ty > s_yMax) ty = s_yMax;
+    data->count = frame.count;
+    for (uint8_t i = 0; i < frame.count; i++) {
+        cst226se_point_t *pt = &data->points[i];
+        if (i == 0) {
+            pt->x = tx;
+            pt->y = ty;
+        } else {
+            map_point(frame.points[i].x, frame.points[i].y, &pt->x, &pt->y);
+        }
+        pt->id = frame.points[i].id;
+        pt->state = frame.points[i].status;
     }
 
-
-    // Only report if state or coordinates changed
-    // if (last_pressed == true && last_x == (uint16_t)tx && last_y == (uint16_t)ty) {
-    //     ESP_LOGI(TAG, "Touch: no change in position, skipping event");
-    //     return false;
-    // }
-
     data->pressed = true;
-    data->x = (uint16_t)tx;
-    data->y = (uint16_t)ty;
-    data->id = 0;
+    data->x = tx;
+    data->y = ty;
+    data->id = frame.points[0].id;
     last_pressed = true;
     // ESP_LOGI(TAG, "Touch: pressed at (%u, %u)", data->x, data->y);
     if (s_touch_callback) s_touch_callback(data, s_touch_callback_ctx);
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include "esp_err.h"
 #include "driver/i2c_master.h"
+#include "cst226se_frame.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -18,21 +19,57 @@ typedef enum {
     CST226SE_ROTATION_270 = 3,
 } cst226se_rotation_t;
 
+// Controller status nibble of a point that is in contact
+#define CST226SE_POINT_STATE_PRESSED 0x06
+
 typedef struct {
-    bool pressed;
+    uint8_t id;         // tracking ID, stable while the finger stays down
+    uint8_t state;      // raw status nibble (CST226SE_POINT_STATE_PRESSED = contact)
     uint16_t x;
     uint16_t y;
+} cst226se_point_t;
+
+typedef struct {
+    bool pressed;
+    uint16_t x;         // primary (first reported) point
+    uint16_t y;
     uint8_t id;
+    uint8_t count;      // number of valid entries in points[]
+    cst226se_point_t points[CST226SE_MAX_POINTS];
 } cst226se_data_t;
 
+// Bus cost of touch sampling, accumulated since init
+typedef struct {
+    uint32_t samples;
+    uint32_t transactions;
+    uint64_t bytes;         // register pointer + payload bytes
+    uint64_t busy_us;       // time spent inside cst226se_read() transfers
+    uint32_t max_us;
+    uint32_t errors;
+    uint32_t resyncs;       // corrupt point counts answered with 0xAB
+    uint32_t freq_hz;       // current SCL rate
+    uint32_t fmp_fallbacks;
+} cst226se_stats_t;
+
 typedef void (*cst226se_event_callback_t)(const cst226se_data_t *data, void *user_ctx);
 void cst226se_register_callback(cst226se_event_callback_t cb, void *user_ctx);
 void cst226se_set_rotation(cst226se_rotation_t rot);
 cst226se_rotation_t cst226se_get_rotation(void);
+// Optional bus arbitration around each sample read (acquire=true before, false after);
+// the frame's transactions are issued back to back inside one acquisition.
+typedef void (*cst226se_bus_hook_t)(bool acquire, void *user_ctx);
+void cst226se_set_bus_hook(cst226se_bus_hook_t hook, void *user_ctx);
+// Skip swap/mirror and report native 450x600 sensor coordinates (hal_mgr applies its own transform)
+void cst226se_set_raw_output(bool raw);
 void cst226se_set_max_coordinates(uint16_t x, uint16_t y);
 bool cst226se_get_resolution(int16_t *x, int16_t *y);
 bool cst226se_read(cst226se_data_t *data);
+// Block until the touch IRQ fires. Pass CST226SE_WAIT_FOREVER to wait without a timeout.
+#define CST226SE_WAIT_FOREVER UINT32_MAX
 bool cst226se_wait_event(uint32_t timeout_ms);
+// Let the touch IRQ wake the chip from light sleep (call after cst226se_init())
+esp_err_t cst226se_enable_wakeup(void);
+void cst226se_get_stats(cst226se_stats_t *stats);
 
 // Power management
 esp_err_t cst226se_init(void);
@@ -0,0 +1,99 @@
+#include "cst226se_frame.h"
+#include <string.h>
+
+static void decode_point(const uint8_t *p, cst226se_raw_point_t *pt)
+{
+    pt->id = p[0] >> 4;
+    pt->status = p[0] & 0x0F;
+    pt->x = (uint16_t)((p[1] << 4) | ((p[3] >> 4) & 0x0F));
+    pt->y = (uint16_t)((p[2] << 4) | (p[3] & 0x0F));
+}
+
+// Header checks shared by fetch and parse. Returns CST226SE_FRAME_TOUCH when
+// the header announces a plausible point count.
+static cst226se_frame_result_t check_header(const uint8_t *buf, uint8_t *count)
+{
+    if (buf[0] == 0x83 && buf[1] == 0x17 && buf[5] == 0x80) return CST226SE_FRAME_HOME;
+    if (buf[6] != CST226SE_FRAME_SYNC || buf[0] == CST226SE_FRAME_SYNC) return CST226SE_FRAME_INVALID;
+    if (buf[5] == 0x80) return CST226SE_FRAME_NO_TOUCH;
+
+    uint8_t n = buf[5] & 0x7F;
+    if (n == 0) return CST226SE_FRAME_NO_TOUCH;
+    if (n > CST226SE_MAX_POINTS) return CST226SE_FRAME_RESYNC;
+    *count = n;
+    return CST226SE_FRAME_TOUCH;
+}
+
+cst226se_frame_result_t cst226se_frame_parse(const uint8_t *buf, size_t len, cst226se_frame_t *out)
+{
+    out->count = 0;
+    if (len < CST226SE_FRAME_HDR_LEN) return CST226SE_FRAME_INVALID;
+
+    uint8_t n = 0;
+    cst226se_frame_result_t res = check_header(buf, &n);
+    if (res != CST226SE_FRAME_TOUCH) return res;
+    if (len < CST226SE_FRAME_HDR_LEN + (size_t)(n - 1) * CST226SE_FRAME_POINT_LEN) return CST226SE_FRAME_INVALID;
+
+    decode_point(buf, &out->points[0]);
+    for (uint8_t i = 1; i < n; i++) {
+        decode_point(buf + CST226SE_FRAME_HDR_LEN + (i - 1) * CST226SE_FRAME_POINT_LEN, &out->points[i]);
+    }
+    out->count = n;
+    return CST226SE_FRAME_TOUCH;
+}
+
+cst226se_frame_result_t cst226se_frame_fetch(cst226se_frame_read_fn read, cst226se_frame_write_fn write,
+                                             void *ctx, cst226se_frame_t *out)
+{
+    uint8_t buf[CST226SE_FRAME_MAX_LEN];
+    out->count = 0;
+    out->bytes = 0;
+    out->transactions = 0;
+
+    out->transactions++;
+    out->bytes += 1 + CST226SE_FRAME_HDR_LEN;
+    if (!read(ctx, 0x00, buf, CST226SE_FRAME_HDR_LEN)) return CST226SE_FRAME_IO_ERROR;
+
+    uint8_t n = 0;
+    cst226se_frame_result_t res = check_header(buf, &n);
+    if (res == CST226SE_FRAME_RESYNC) {
+        // Count is garbage: write the sync marker back so the controller restarts its report
+        out->transactions++;
+        out->bytes += 2;
+        if (write) write(ctx, 0x00, CST226SE_FRAME_SYNC);
+        return res;
+    }
+    if (res != CST226SE_FRAME_TOUCH) return res;
+
+    if (n > 1) {
+        size_t extra = (size_t)(n - 1) * CST226SE_FRAME_POINT_LEN;
+        out->transactions++;
+        out->bytes += 1 + extra;
+        if (!read(ctx, CST226SE_FRAME_HDR_LEN, buf + CST226SE_FRAME_HDR_LEN, extra)) return CST226SE_FRAME_IO_ERROR;
+    }
+    return cst226se_frame_parse(buf, sizeof(buf), out);
+}
+
+void cst226se_link_init(cst226se_link_t *link, uint32_t fast_hz, uint32_t max_hz)
+{
+    memset(link, 0, sizeof(*link));
+    link->fast_hz = fast_hz;
+    link->max_hz = max_hz > fast_hz ? max_hz : fast_hz;
+    link->freq_hz = link->max_hz;
+}
+
+bool cst226se_link_update(cst226se_link_t *link, bool ok)
+{
+    if (ok) {
+        link->err_streak = 0;
+        return false;
+    }
+    if (link->freq_hz <= link->fast_hz) return false;
+    if (++link->err_streak < CST226SE_FMP_FALLBACK_ERRORS) return false;
+
+    // Stay at Fast-mode for the rest of the session; marginal pull-ups do not recover on their own
+    link->freq_hz = link->fast_hz;
+    link->err_streak = 0;
+    link->fallbacks++;
+    return true;
+}
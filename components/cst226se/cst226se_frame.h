@@ -0,0 +1,86 @@
+#ifndef CST226SE_FRAME_H
+#define CST226SE_FRAME_H
+
+// Touch report framing for the CST226SE, kept free of IDF dependencies so it
+// can be exercised on the host against replayed register dumps.
+//
+// Report layout (register 0x00 onwards):
+//   [0]     point 0 id (hi nibble) / status (lo nibble)
+//   [1..3]  point 0 X/Y, 12 bits each
+//   [4]     point 0 pressure
+//   [5]     point count (bit 7 = key/home flag)
+//   [6]     0xAB sync marker
+//   [7..]   points 1..4, 5 bytes each (id/status, X/Y, pressure)
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CST226SE_MAX_POINTS        5
+#define CST226SE_FRAME_HDR_LEN     7
+#define CST226SE_FRAME_POINT_LEN   5
+#define CST226SE_FRAME_MAX_LEN     (CST226SE_FRAME_HDR_LEN + (CST226SE_MAX_POINTS - 1) * CST226SE_FRAME_POINT_LEN)
+#define CST226SE_FRAME_SYNC        0xAB
+
+// Consecutive bus errors tolerated at Fm+ before dropping back to Fast-mode
+#ifndef CST226SE_FMP_FALLBACK_ERRORS
+#define CST226SE_FMP_FALLBACK_ERRORS 3
+#endif
+
+// Bus accessors; return true on success.
+typedef bool (*cst226se_frame_read_fn)(void *ctx, uint8_t reg, uint8_t *buf, size_t len);
+typedef bool (*cst226se_frame_write_fn)(void *ctx, uint8_t reg, uint8_t val);
+
+typedef enum {
+    CST226SE_FRAME_TOUCH = 0,   // one or more valid points
+    CST226SE_FRAME_NO_TOUCH,    // count == 0 or release marker
+    CST226SE_FRAME_HOME,        // home key pattern
+    CST226SE_FRAME_INVALID,     // sync marker missing
+    CST226SE_FRAME_RESYNC,      // corrupt count, 0xAB written back
+    CST226SE_FRAME_IO_ERROR,
+} cst226se_frame_result_t;
+
+typedef struct {
+    uint8_t id;
+    uint8_t status;
+    uint16_t x;
+    uint16_t y;
+} cst226se_raw_point_t;
+
+typedef struct {
+    uint8_t count;
+    cst226se_raw_point_t points[CST226SE_MAX_POINTS];
+    uint16_t bytes;             // register pointer + payload bytes moved on the bus
+    uint8_t transactions;
+} cst226se_frame_t;
+
+// Read one report using the minimum number of bytes: the 7-byte header first,
+// then only the 5-byte records of any additional points.
+cst226se_frame_result_t cst226se_frame_fetch(cst226se_frame_read_fn read, cst226se_frame_write_fn write,
+                                             void *ctx, cst226se_frame_t *out);
+
+// Decode a complete report already in memory (len must cover all reported points).
+cst226se_frame_result_t cst226se_frame_parse(const uint8_t *buf, size_t len, cst226se_frame_t *out);
+
+// Bus speed negotiation with automatic fallback to Fast-mode on repeated errors.
+typedef struct {
+    uint32_t fast_hz;           // Fast-mode, always safe
+    uint32_t max_hz;            // highest rate every device on the bus accepts
+    uint32_t freq_hz;           // current rate
+    uint8_t err_streak;
+    uint32_t fallbacks;
+} cst226se_link_t;
+
+void cst226se_link_init(cst226se_link_t *link, uint32_t fast_hz, uint32_t max_hz);
+// Feed a transfer result; returns true when freq_hz changed and the device must be reconfigured.
+bool cst226se_link_update(cst226se_link_t *link, bool ok);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CST226SE_FRAME_H
@@ -0,0 +1,233 @@
+// Host-side test for the CST226SE report framing: replays register
+// dumps through a fake I2C bus and checks the decoded points and bus cost.
+//
+// gcc -std=gnu11 -Wall -I components/cst226se -o /tmp/cst226se_host_test components/cst226se/test/host_test.c components/cst226se/cst226se_frame.c
+// /tmp/cst226se_host_test
+
+#include <stdio.h>
+#include <string.h>
+#include "cst226se_frame.h"
+
+static int s_failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); s_failures++; } \
+} while (0)
+
+// Fake device: a flat register file with auto-increment, plus a transaction log
+typedef struct {
+    uint8_t regs[32];
+    int reads;
+    int writes;
+    size_t read_bytes;
+    uint8_t last_write_reg;
+    uint8_t last_write_val;
+    int fail_reads;             // number of upcoming reads that NACK
+} fake_bus_t;
+
+static bool fake_read(void *ctx, uint8_t reg, uint8_t *buf, size_t len)
+{
+    fake_bus_t *bus = ctx;
+    bus->reads++;
+    if (bus->fail_reads > 0) {
+        bus->fail_reads--;
+        return false;
+    }
+    if (reg + len > sizeof(bus->regs)) return false;
+    memcpy(buf, &bus->regs[reg], len);
+    bus->read_bytes += len;
+    return true;
+}
+
+static bool fake_write(void *ctx, uint8_t reg, uint8_t val)
+{
+    fake_bus_t *bus = ctx;
+    bus->writes++;
+    bus->last_write_reg = reg;
+    bus->last_write_val = val;
+    bus->regs[reg] = val;
+    return true;
+}
+
+static void load(fake_bus_t *bus, const uint8_t *dump, size_t len)
+{
+    memset(bus, 0, sizeof(*bus));
+    memcpy(bus->regs, dump, len);
+}
+
+// Register dumps (reg 0x00 .. 0x1B) in the layout reported by the T4-S3 panel
+static const uint8_t dump_idle[] = {
+    0xAB, 0x00, 0x00, 0x00, 0x00, 0x80, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t dump_one_finger[] = {
+    0x06, 0x0C, 0x1F, 0x4A, 0x21, 0x01, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t dump_two_fingers[] = {
+    0x06, 0x0C, 0x1F, 0x4A, 0x21, 0x02, 0xAB, 0x16, 0x15, 0x0B, 0x7C, 0x1D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t dump_five_fingers[] = {
+    0x06, 0x01, 0x02, 0x34, 0x10, 0x05, 0xAB, 0x16, 0x05, 0x06, 0x78, 0x11, 0x26, 0x09,
+    0x0A, 0xBC, 0x12, 0x36, 0x0D, 0x0E, 0xF0, 0x13, 0x46, 0x11, 0x12, 0x34, 0x14, 0x00,
+};
+static const uint8_t dump_home[] = {
+    0x83, 0x17, 0x00, 0x00, 0x00, 0x80, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t dump_corrupt_count[] = {
+    0x06, 0x0C, 0x1F, 0x4A, 0x21, 0x0E, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint8_t dump_no_sync[] = {
+    0x06, 0x0C, 0x1F, 0x4A, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void test_idle(void)
+{
+    fake_bus_t bus;
+    cst226se_frame_t f;
+    load(&bus, dump_idle, sizeof(dump_idle));
+    CHECK(cst226se_frame_fetch(fake_read, fake_write, &bus, &f) == CST226SE_FRAME_INVALID);
+    CHECK(bus.reads == 1 && bus.read_bytes == CST226SE_FRAME_HDR_LEN);
+    CHECK(bus.writes == 0);
+    CHECK(f.count == 0);
+}
+
+static void test_one_finger(void)
+{
+    fake_bus_t bus;
+    cst226se_frame_t f;
+    load(&bus, dump_one_finger, sizeof(dump_one_finger));
+    CHECK(cst226se_frame_fetch(fake_read, fake_write, &bus, &f) == CST226SE_FRAME_TOUCH);
+    CHECK(f.count == 1);
+    CHECK(f.points[0].id == 0 && f.points[0].status == 6);
+    CHECK(f.points[0].x == ((0x0C << 4) | 0x4));
+    CHECK(f.points[0].y == ((0x1F << 4) | 0xA));
+    CHECK(bus.reads == 1 && bus.read_bytes == 7);
+    CHECK(f.bytes == 8 && f.transactions == 1);
+    CHECK(bus.writes == 0);
+}
+
+static void test_two_fingers(void)
+{
+    fake_bus_t bus;
+    cst226se_frame_t f;
+    load(&bus, dump_two_fingers, sizeof(dump_two_fingers));
+    CHECK(cst226se_frame_fetch(fake_read, fake_write, &bus, &f) == CST226SE_FRAME_TOUCH);
+    CHECK(f.count == 2);
+    CHECK(f.points[1].id == 1 && f.points[1].status == 6);
+    CHECK(f.points[1].x == ((0x15 << 4) | 0x7));
+    CHECK(f.points[1].y == ((0x0B << 4) | 0xC));
+    CHECK(bus.reads == 2 && bus.read_bytes == 12);
+    CHECK(f.bytes == 8 + 6);
+}
+
+static void test_five_fingers(void)
+{
+    fake_bus_t bus;
+    cst226se_frame_t f;
+    load(&bus, dump_five_fingers, sizeof(dump_five_fingers));
+    CHECK(cst226se_frame_fetch(fake_read, fake_write, &bus, &f) == CST226SE_FRAME_TOUCH);
+    CHECK(f.count == 5);
+    for (int i = 0; i < 5; i++) CHECK(f.points[i].id == i);
+    CHECK(f.points[4].x == ((0x11 << 4) | 0x3));
+    CHECK(f.points[4].y == ((0x12 << 4) | 0x4));
+    CHECK(bus.read_bytes == CST226SE_FRAME_MAX_LEN);
+
+    // Parsing the full dump in one go gives the same result
+    cst226se_frame_t g;
+    CHECK(cst226se_frame_parse(dump_five_fingers, sizeof(dump_five_fingers), &g) == CST226SE_FRAME_TOUCH);
+    CHECK(g.count == 5 && memcmp(g.points, f.points, sizeof(g.points)) == 0);
+    // ...and a truncated buffer is rejected
+    CHECK(cst226se_frame_parse(dump_five_fingers, 20, &g) == CST226SE_FRAME_INVALID);
+}
+
+static void test_home_and_sync(void)
+{
+    fake_bus_t bus;
+    cst226se_frame_t f;
+    load(&bus, dump_home, sizeof(dump_home));
+    CHECK(cst226se_frame_fetch(fake_read, fake_write, &bus, &f) == CST226SE_FRAME_HOME);
+    CHECK(bus.writes == 0);
+
+    load(&bus, dump_no_sync, sizeof(dump_no_sync));
+    CHECK(cst226se_frame_fetch(fake_read, fake_write, &bus, &f) == CST226SE_FRAME_INVALID);
+    CHECK(bus.writes == 0);
+}
+
+static void test_corrupt_count_resyncs(void)
+{
+    fake_bus_t bus;
+    cst226se_frame_t f;
+    load(&bus, dump_corrupt_count, sizeof(dump_corrupt_count));
+    CHECK(cst226se_frame_fetch(fake_read, fake_write, &bus, &f) == CST226SE_FRAME_RESYNC);
+    CHECK(bus.writes == 1 && bus.last_write_reg == 0x00 && bus.last_write_val == 0xAB);
+    CHECK(bus.reads == 1);
+}
+
+static void test_io_error(void)
+{
+    fake_bus_t bus;
+    cst226se_frame_t f;
+    load(&bus, dump_two_fingers, sizeof(dump_two_fingers));
+    bus.fail_reads = 1;
+    CHECK(cst226se_frame_fetch(fake_read, fake_write, &bus, &f) == CST226SE_FRAME_IO_ERROR);
+    CHECK(bus.reads == 1);
+    CHECK(cst226se_frame_fetch(fake_read, fake_write, &bus, &f) == CST226SE_FRAME_TOUCH);
+}
+
+static void test_link_fallback(void)
+{
+    cst226se_link_t link;
+
+    // Bus limited by a 400 kHz device: never leaves Fast-mode
+    cst226se_link_init(&link, 400000, 400000);
+    CHECK(link.freq_hz == 400000);
+    for (int i = 0; i < 10; i++) CHECK(!cst226se_link_update(&link, false));
+
+    // Fm+ capable bus: isolated errors are tolerated, a streak falls back
+    cst226se_link_init(&link, 400000, 1000000);
+    CHECK(link.freq_hz == 1000000);
+    CHECK(!cst226se_link_update(&link, false));
+    CHECK(!cst226se_link_update(&link, true));
+    for (int i = 0; i < CST226SE_FMP_FALLBACK_ERRORS - 1; i++) CHECK(!cst226se_link_update(&link, false));
+    CHECK(cst226se_link_update(&link, false));
+    CHECK(link.freq_hz == 400000 && link.fallbacks == 1);
+    CHECK(!cst226se_link_update(&link, false));
+}
+
+// Bus cost of a single-finger drag, old fixed 28-byte read vs adaptive read
+static void report_cost(void)
+{
+    const double bit_us_fm = 1e6 / 400000.0;
+    const double bit_us_fmp = 1e6 / 1000000.0;
+    // 9 bits per byte, plus address bytes (one for write, one for read after repeated start)
+    int old_bytes = 1 + 1 + 1 + 28;
+    int new_bytes = 1 + 1 + 1 + 7;
+    printf("one finger: %d -> %d bytes/sample, %.1f -> %.1f us @400k, %.1f us @1M\n",
+           old_bytes, new_bytes, old_bytes * 9 * bit_us_fm, new_bytes * 9 * bit_us_fm,
+           new_bytes * 9 * bit_us_fmp);
+}
+
+int main(void)
+{
+    test_idle();
+    test_one_finger();
+    test_two_fingers();
+    test_five_fingers();
+    test_home_and_sync();
+    test_corrupt_count_resyncs();
+    test_io_error();
+    test_link_fallback();
+    report_cost();
+
+    if (s_failures) {
+        printf("%d check(s) failed\n", s_failures);
+        return 1;
+    }
+    printf("cst226se host tests passed\n");
+    return 0;
+}
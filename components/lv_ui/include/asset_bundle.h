@@ -0,0 +1,85 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Asset bundle: images pre-converted to LVGL's in-memory pixel formats, and LVGL binary
+// fonts, packed by tools/pack_assets.py into the `storage` partition. The device maps the
+// partition and points image descriptors straight at the pixel data (no copy, no decode).
+//
+// Layout (little-endian):
+//   header   "T4AB", u16 version, u16 count, u32 total size, u32 CRC-32 of the rest
+//   index    count entries, sorted by name (asset_entry_t)
+//   data     each asset ASSET_BUNDLE_ALIGN-byte aligned
+// No IDF or LVGL dependencies; the host test checks bundles made by the packing tool.
+
+#define ASSET_BUNDLE_MAGIC      0x42413454      // "T4AB"
+#define ASSET_BUNDLE_VERSION    1
+#define ASSET_BUNDLE_HEADER     16
+#define ASSET_BUNDLE_ALIGN      16              // ALIGN in tools/pack_assets.py
+#define ASSET_NAME_MAX          24
+
+typedef enum {
+    ASSET_TYPE_IMAGE = 1,
+    ASSET_TYPE_FONT = 2,
+} asset_type_t;
+
+typedef struct __attribute__((packed)) {
+    char name[ASSET_NAME_MAX];      // NUL padded
+    uint8_t type;                   // asset_type_t
+    uint8_t cf;                     // lv_color_format_t (images)
+    uint16_t w;
+    uint16_t h;
+    uint16_t stride;
+    uint32_t offset;                // from the start of the bundle
+    uint32_t size;
+} asset_entry_t;
+
+typedef enum {
+    ASSET_BUNDLE_OK = 0,
+    ASSET_BUNDLE_ERR_MAGIC,         // nothing flashed, or not a bundle
+    ASSET_BUNDLE_ERR_VERSION,
+    ASSET_BUNDLE_ERR_SIZE,          // truncated or larger than the partition
+    ASSET_BUNDLE_ERR_CRC,
+    ASSET_BUNDLE_ERR_INDEX,         // an entry outside the bundle, misaligned or out of order
+} asset_bundle_status_t;
+
+typedef struct {
+    const uint8_t *base;
+    uint32_t size;
+    const asset_entry_t *index;
+    uint16_t count;
+} asset_bundle_t;
+
+/**
+ * @brief Total bundle size from its header (to map exactly that much), 0 if not a bundle
+ */
+uint32_t asset_bundle_peek_size(const uint8_t *header);
+
+/**
+ * @brief Validate a bundle at `base` (`size` bytes available) and index it
+ * @param verify_crc Also check the CRC over the whole bundle
+ */
+asset_bundle_status_t asset_bundle_open(asset_bundle_t *b, const uint8_t *base, uint32_t size, bool verify_crc);
+
+/**
+ * @brief Binary search of the index
+ * @return The entry, NULL if there is no asset of that name and type
+ */
+const asset_entry_t *asset_bundle_find(const asset_bundle_t *b, const char *name, asset_type_t type);
+
+static inline const uint8_t *asset_bundle_data(const asset_bundle_t *b, const asset_entry_t *e) {
+    return b->base + e->offset;
+}
+
+// CRC-32 (IEEE, as zlib.crc32)
+uint32_t asset_bundle_crc32(uint32_t crc, const uint8_t *data, uint32_t len);
+
+const char *asset_bundle_status_str(asset_bundle_status_t status);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,112 @@
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// AVI frame index: the video frames of a file as a compact array of chunk offsets and
+// sizes, so seeking is a lookup instead of a walk over the movi list. Loaded from the
+// OpenDML super index (indx -> ix##) or the legacy idx1; files with neither get theirs
+// filled in by the player as it reads the frames the first time through.
+// No IDF or LVGL dependencies; the host test runs it over the sample AVIs in 4_sd_card/.
+
+#define AVI_ODML_MAX_IX     32          // standard index chunks kept from the super index
+
+/**
+ * @brief Read `len` bytes at file offset `offset`
+ * @return Bytes read (short at EOF), negative on error
+ */
+typedef int32_t (*avi_read_fn)(void *ctx, uint32_t offset, void *buf, uint32_t len);
+
+typedef struct {
+    uint32_t usec_per_frame;
+    uint32_t total_frames;              // as the header claims
+    uint32_t width;
+    uint32_t height;
+    uint16_t video_stream;              // stream number of the first video stream
+    uint32_t suggested_buffer;          // video stream's dwSuggestedBufferSize (else avih's), 0 if unset
+    uint32_t movi_start;                // first chunk of the movi list (after the FourCC)
+    uint32_t movi_end;                  // end of the movi list
+    uint32_t idx1_offset;               // payload, 0 if the file has no idx1
+    uint32_t idx1_size;
+    uint32_t odml_ix[AVI_ODML_MAX_IX];  // ix## chunks named by the video stream's indx
+    uint8_t odml_count;
+} avi_info_t;
+
+typedef struct {
+    uint32_t offset;                    // chunk header
+    uint32_t size;                      // payload
+} avi_frame_t;
+
+typedef enum {
+    AVI_INDEX_NONE = 0,                 // nothing in the file: built while playing
+    AVI_INDEX_IDX1,
+    AVI_INDEX_ODML,
+} avi_index_src_t;
+
+typedef void *(*avi_realloc_fn)(void *ptr, size_t size);
+
+typedef struct {
+    avi_frame_t *frames;                // ascending offsets
+    uint32_t count;
+    uint32_t capacity;
+    avi_index_src_t src;
+    bool complete;                      // every frame of the movi list is in
+    avi_realloc_fn realloc;
+} avi_index_t;
+
+/**
+ * @brief Walk the RIFF structure: header fields, the movi list and where the indexes are
+ * @param file_size Bytes in the file
+ * @return false if this is not an AVI with a movi list
+ */
+bool avi_parse(avi_read_fn read, void *ctx, uint32_t file_size, avi_info_t *info);
+
+/**
+ * @brief True if `id` is a video chunk (##dc / ##db) of the stream `info` plays
+ */
+bool avi_is_video_chunk(const avi_info_t *info, uint32_t id);
+
+/**
+ * @brief Empty index whose array grows through `realloc_fn` (PSRAM on the device)
+ */
+void avi_index_init(avi_index_t *ix, avi_realloc_fn realloc_fn);
+
+void avi_index_free(avi_index_t *ix);
+
+/**
+ * @brief Load the file's own index, OpenDML first, keeping video frames in the movi list
+ * @param buf Scratch for reading the index in blocks (a few KB is plenty)
+ * @return Where it came from; AVI_INDEX_NONE leaves an empty, incomplete index
+ */
+avi_index_src_t avi_index_load(avi_index_t *ix, const avi_info_t *info, avi_read_fn read, void *ctx,
+                               uint8_t *buf, uint32_t buf_size);
+
+/**
+ * @brief Record a frame seen while playing, if it is past the last one known
+ * @return false if the array could not grow
+ */
+bool avi_index_note(avi_index_t *ix, uint32_t offset, uint32_t size);
+
+/**
+ * @brief Frame whose chunk starts at or after `offset` (count if none), by binary search
+ */
+uint32_t avi_index_find(const avi_index_t *ix, uint32_t offset);
+
+/**
+ * @brief Frame shown at `ms`, clamped to the frames known
+ */
+uint32_t avi_index_frame_at(const avi_index_t *ix, const avi_info_t *info, uint32_t ms);
+
+static inline uint32_t avi_frame_ms(const avi_info_t *info, uint32_t frame) {
+    return (uint32_t)((uint64_t)frame * info->usec_per_frame / 1000);
+}
+
+const char *avi_index_src_str(avi_index_src_t src);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,55 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// What changed between two video frames, so the player redraws only that:
+//   - while a frame is decoded, each tile of its RGB565 rows gets a 32-bit hash (rows are
+//     hashed as the decoder writes them, still in cache, not read back from PSRAM)
+//   - the tiles whose hash differs from the frame on screen are merged into a few
+//     bounding boxes, which the player invalidates instead of the whole image
+// Tiles are 8 rows high: MCU rows are a multiple of that, so the two parts of a split
+// decode never hash the same tile. A tile whose pixels changed but whose hash did not
+// stays stale until it changes again; the player redraws whole frames now and then.
+// No IDF dependencies so the host test runs it on the sample clips.
+
+#ifndef FRAME_DIFF_TILE_W
+#define FRAME_DIFF_TILE_W       16
+#endif
+#define FRAME_DIFF_TILE_H       8
+
+#ifndef FRAME_DIFF_MAX_BOXES
+#define FRAME_DIFF_MAX_BOXES    8       // more changed areas are merged into these
+#endif
+
+typedef struct {
+    uint32_t x, y, w, h;
+} frame_diff_box_t;
+
+/**
+ * @brief Hashes in the grid of a `w` x `h` frame
+ */
+uint32_t frame_diff_grid_words(uint32_t w, uint32_t h);
+
+/**
+ * @brief Hash `rows` rows from row `y` of a frame `w` pixels wide, `stride` bytes apart at
+ * `px`. The rows of a tile come in order, from its first, in one call or several.
+ */
+void frame_diff_hash_rows(uint32_t *grid, uint32_t w, uint32_t y, uint32_t rows, const uint8_t *px,
+                          uint32_t stride);
+
+/**
+ * @brief Where `next` differs from `prev` (grids of frames of the same size), as at most
+ * `max` boxes in pixels, clipped to the frame
+ * @param changed Tiles that differ (may be NULL)
+ * @return Number of boxes, 0 when nothing changed
+ */
+uint32_t frame_diff_boxes(const uint32_t *prev, const uint32_t *next, uint32_t w, uint32_t h,
+                          frame_diff_box_t *boxes, uint32_t max, uint32_t *changed);
+
+#ifdef __cplusplus
+}
+#endif
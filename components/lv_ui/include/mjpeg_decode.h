@@ -0,0 +1,190 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// One MJPEG frame to RGB565 with libjpeg-turbo: into a frame buffer, only the part that is
+// visible, or out in bands of a few rows. Shared by the video decoder task and the host test, which links the system
+// libjpeg-turbo.
+// A player keeps one mjpeg_decoder_t for the whole stream instead of setting libjpeg up
+// for every frame:
+//   - the decompressor is created once and reset between frames
+//   - what libjpeg allocates for a frame comes from an arena sized by the first one, so
+//     a frame costs no heap allocations
+//   - DQT and DHT segments equal to the last frame's are not parsed again; libjpeg still
+//     holds those tables
+//   - a frame without a DHT gets the standard tables, as AVI MJPEG means it (also after
+//     a frame that had its own)
+// The decode calls take NULL for a one-off image, with a decoder for just that call.
+// A frame need not be in memory whole: given its first part, the decoder asks for the rest
+// as libjpeg gets to it (mjpeg_decoder_set_more()), so decoding overlaps reading and a
+// frame can be larger than any buffer.
+// Whole images of the usual 4:2:0, 4:2:2 and 4:4:4 layouts are read as raw YCbCr a row of
+// MCUs at a time and converted here, straight into the byte order wanted (the video
+// plane's bands big-endian, so nothing swaps them after). Everything else goes through
+// libjpeg's RGB565 output. Both replicate chroma and do not dither, so a frame decodes to
+// the same pixels whichever way, and whole or cropped.
+// A frame with restart markers can be decoded in two parts at once (mjpeg_decoder_set_worker()):
+// it is cut at the marker that starts the row of MCUs nearest its middle, the caller
+// decodes the rows above and a second decompressor on the worker the rows below, from a
+// copy of the frame's markers with the height cut to its part followed by the scan data
+// after that marker. Frames without restart markers are decoded in one part.
+
+typedef struct mjpeg_decoder mjpeg_decoder_t;
+
+// First part of a frame to hand the decode calls when the rest comes later: enough for its
+// markers up to the scan, so its tables can be compared and the standard DHT added
+#ifndef MJPEG_HEAD_BYTES
+#define MJPEG_HEAD_BYTES    2048
+#endif
+
+/**
+ * @brief Where the rest of a frame comes from
+ */
+typedef struct {
+    // The frame's next bytes, waiting for them if need be; the ones before are done with.
+    // 0 at its end or on an error (libjpeg then ends the image there).
+    uint32_t (*more)(void *ctx, const uint8_t **data);
+    void *ctx;
+} mjpeg_more_t;
+
+/**
+ * @brief Runs the bottom part of split decodes, e.g. a task on the other core
+ */
+typedef struct {
+    // Call fn(arg) there, without waiting for it
+    void (*start)(void *ctx, void (*fn)(void *arg), void *arg);
+    // Wait until that call has returned
+    void (*wait)(void *ctx);
+    void *ctx;
+} mjpeg_worker_t;
+
+/**
+ * @brief Sees the rows whole-frame decodes write, e.g. to hash them while they are in cache
+ */
+typedef struct {
+    // Rows y..y+count-1 of the image are at `px`, `stride` bytes apart. In a split decode
+    // the worker calls it too, for rows of its own, at the same time.
+    void (*rows)(void *ctx, uint32_t y, uint32_t count, const uint8_t *px, uint32_t stride);
+    void *ctx;
+} mjpeg_rows_hook_t;
+
+typedef struct {
+    uint32_t frames;            // headers read
+    uint32_t tables_reused;     // tables the same as the last frame's, not parsed again
+    uint32_t dht_injected;      // no DHT in the frame: the standard tables
+    uint32_t pool_allocs;       // left to libjpeg's allocator (only until the arena fits)
+    uint32_t arena_bytes;       // the second decompressor's included
+    uint32_t split;             // decoded in two parts at once
+} mjpeg_decoder_stats_t;
+
+/**
+ * @brief A decoder to keep across the frames of a stream; NULL when out of memory
+ */
+mjpeg_decoder_t *mjpeg_decoder_create(void);
+
+void mjpeg_decoder_destroy(mjpeg_decoder_t *dec);
+
+void mjpeg_decoder_get_stats(const mjpeg_decoder_t *dec, mjpeg_decoder_stats_t *stats);
+
+/**
+ * @brief From now on `data` and `size` given to the decode calls are only the start of the
+ * frame (at least MJPEG_HEAD_BYTES of it, or all), and `more` has the rest. NULL: frames
+ * are whole again.
+ */
+void mjpeg_decoder_set_more(mjpeg_decoder_t *dec, const mjpeg_more_t *more);
+
+/**
+ * @brief Use the raw YCbCr path where it applies (the default), or always libjpeg's
+ * RGB565 output (for comparison)
+ */
+void mjpeg_decoder_set_raw(mjpeg_decoder_t *dec, bool on);
+
+/**
+ * @brief Decode whole frames (mjpeg_decode_rgb565()) that have restart markers in two parts,
+ * the bottom one on `worker`, with a second decompressor created here. Only frames handed
+ * over whole are split: without mjpeg_decoder_set_more(), or ending in their EOI. NULL:
+ * one part again, the second decompressor freed.
+ * @return false when out of memory (frames are then decoded in one part)
+ */
+bool mjpeg_decoder_set_worker(mjpeg_decoder_t *dec, const mjpeg_worker_t *worker);
+
+/**
+ * @brief Call `hook` with the rows of every mjpeg_decode_rgb565() from now on (not of
+ * regions or bands); NULL: none
+ */
+void mjpeg_decoder_set_rows_hook(mjpeg_decoder_t *dec, const mjpeg_rows_hook_t *hook);
+
+/**
+ * @brief Decode a JPEG into native-endian RGB565, rows packed (stride = width * 2)
+ * @param dec Decoder of the stream, or NULL
+ * @param dst_size Bytes at `dst`; a larger image is refused before decoding
+ * @return false on a corrupt frame or one that does not fit
+ */
+bool mjpeg_decode_rgb565(mjpeg_decoder_t *dec, const uint8_t *data, uint32_t size, uint8_t *dst,
+                         uint32_t dst_size, uint32_t *w, uint32_t *h);
+
+/**
+ * @brief A rectangle of the image as decoded (after DCT scaling), in its pixels
+ */
+typedef struct {
+    uint32_t x, y, w, h;
+} mjpeg_rect_t;
+
+/**
+ * @brief Decode only part of a JPEG, scaled by 1/`scale_denom` (1, 2, 4 or 8): rows above
+ * it are skipped, decoding stops after its last row and columns outside it are cropped
+ * (to iMCU boundaries, and it starts on an even row of 2:1 subsampled images, so `got`
+ * may be larger than `want`)
+ * @param want Clipped to the image; the whole image if w or h is 0
+ * @param dst Rows `dst_stride` bytes apart. With `in_frame`, `dst` holds the whole scaled
+ * image and the region lands at its place in it; otherwise it is packed from `dst`.
+ * @param got The rectangle decoded
+ * @param img_w, img_h Size of the whole scaled image (either may be NULL)
+ * @return false on a corrupt frame, an empty region or one that does not fit `dst_size`
+ */
+bool mjpeg_decode_region(mjpeg_decoder_t *dec, const uint8_t *data, uint32_t size, uint8_t scale_denom,
+                         const mjpeg_rect_t *want, uint8_t *dst, uint32_t dst_stride, uint32_t dst_size,
+                         bool in_frame, mjpeg_rect_t *got, uint32_t *img_w, uint32_t *img_h);
+
+/**
+ * @brief Size of a JPEG at 1/1 from its header alone, nothing decoded
+ * @return false on a corrupt header
+ */
+bool mjpeg_read_size(mjpeg_decoder_t *dec, const uint8_t *data, uint32_t size, uint32_t *w, uint32_t *h);
+
+/**
+ * @brief Where mjpeg_decode_bands() puts its output: a few small buffers of `rows` rows,
+ * handed back one by one as they fill
+ */
+typedef struct {
+    // A buffer of rows * max_width pixels to fill next (may wait for one); NULL aborts
+    uint8_t *(*get)(void *ctx);
+    // Rows y..y+rows-1 are in `band`, packed at `width` pixels a row. rows == 0 returns an
+    // unused buffer after a failure. false aborts the decode.
+    bool (*put)(void *ctx, uint32_t y, uint32_t rows, uint32_t width, uint8_t *band);
+    void *ctx;
+    uint32_t rows;
+    uint32_t max_width;         // wider images are refused before decoding
+    bool big_endian;            // as the panel takes it
+} mjpeg_band_sink_t;
+
+/**
+ * @brief Decode a JPEG into RGB565 bands, e.g. MCU rows straight to the panel without a
+ * whole frame buffer
+ * @return false on a corrupt frame, one that is too wide, or an abort by the sink
+ */
+bool mjpeg_decode_bands(mjpeg_decoder_t *dec, const uint8_t *data, uint32_t size, const mjpeg_band_sink_t *sink,
+                        uint32_t *w, uint32_t *h);
+
+/**
+ * @brief Byte-swap `count` RGB565 pixels in place (4-byte aligned, even count is fastest)
+ */
+void mjpeg_swap_rgb565(uint8_t *px, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
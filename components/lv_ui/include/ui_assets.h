@@ -0,0 +1,35 @@
+#ifndef UI_ASSETS_H
+#define UI_ASSETS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "lvgl.h"
+#include "esp_err.h"
+
+/**
+ * Map the asset bundle in the `storage` partition (see asset_bundle.h) and check it.
+ * Without a valid bundle the lookups below return NULL and the UI uses its fallbacks.
+ * @return          ESP_OK, ESP_ERR_NOT_FOUND without a partition or bundle, ESP_ERR_INVALID_CRC
+ */
+esp_err_t ui_assets_init(void);
+
+/**
+ * Image descriptor pointing straight into the mapped flash (no copy, no decode)
+ * @param name      asset name, e.g. "img_watermelon"
+ * @return          descriptor valid for the life of the app, NULL if the bundle lacks it
+ */
+const lv_image_dsc_t * ui_assets_image(const char * name);
+
+/**
+ * LVGL binary font from the bundle, loaded on first use (the loader copies it to RAM)
+ * @return          font valid for the life of the app, NULL if missing
+ */
+const lv_font_t * ui_assets_font(const char * name);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*UI_ASSETS_H*/
@@ -21,6 +21,17 @@ lv_obj_t * ui_avi_create(lv_obj_t * parent);
  */
 void ui_avi_set_src(lv_obj_t * obj, const char * src);
 
+/**
+ * Decode straight to the panel instead of through LVGL: the player's area becomes a video
+ * plane that LVGL no longer draws (see lvgl_mgr_video_plane_set()), so nothing may be
+ * placed over it. Taken once the object is laid out; the object is sized to the video and
+ * may move by a pixel to even coordinates. Falls back to LVGL if the plane is not possible
+ * or is lost (rotation).
+ * @param obj       pointer to the AVI player object
+ * @param en        true to use the plane
+ */
+void ui_avi_set_plane(lv_obj_t * obj, bool en);
+
 /**
  * Play/Resume the AVI
  * @param obj       pointer to the AVI player object
@@ -39,6 +50,45 @@ void ui_avi_pause(lv_obj_t * obj);
  */
 void ui_avi_stop(lv_obj_t * obj);
 
+/**
+ * Jump to a time; the frame is shown on the next tick, also while paused.
+ * Until a file without an index has played through, only frames already seen are reachable.
+ * @param obj       pointer to the AVI player object
+ * @param ms        position from the start
+ */
+void ui_avi_seek(lv_obj_t * obj, uint32_t ms);
+
+/**
+ * Pause and move by whole frames (clamped to the first and last)
+ * @param obj       pointer to the AVI player object
+ * @param frames    frames forward (negative: back)
+ */
+void ui_avi_step(lv_obj_t * obj, int32_t frames);
+
+/**
+ * @param obj       pointer to the AVI player object
+ * @return          true while playing
+ */
+bool ui_avi_is_playing(lv_obj_t * obj);
+
+/**
+ * @param obj       pointer to the AVI player object
+ * @return          time of the frame on screen
+ */
+uint32_t ui_avi_get_position_ms(lv_obj_t * obj);
+
+/**
+ * @param obj       pointer to the AVI player object
+ * @return          length of the video (from the header until the frame index is complete)
+ */
+uint32_t ui_avi_get_duration_ms(lv_obj_t * obj);
+
+/**
+ * @param obj       pointer to the AVI player object
+ * @return          latest time ui_avi_seek() can reach now
+ */
+uint32_t ui_avi_get_seekable_ms(lv_obj_t * obj);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -0,0 +1,73 @@
+#ifndef UI_GESTURE_H
+#define UI_GESTURE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Two-finger gesture recognizer (pinch, rotate, pan).
+// Plain C with no LVGL dependency so recorded touch traces can be replayed on the host.
+
+#define UI_GESTURE_MAX_POINTS 5
+
+typedef struct {
+    uint8_t id;         // touch controller tracking ID
+    int16_t x;
+    int16_t y;
+} ui_gesture_point_t;
+
+typedef enum {
+    UI_GESTURE_NONE   = 0,
+    UI_GESTURE_PINCH  = 1 << 0,
+    UI_GESTURE_ROTATE = 1 << 1,
+    UI_GESTURE_PAN    = 1 << 2,
+} ui_gesture_flags_t;
+
+typedef enum {
+    UI_GESTURE_PHASE_IDLE = 0,  // nothing recognized (yet)
+    UI_GESTURE_PHASE_BEGIN,     // first frame with a recognized gesture
+    UI_GESTURE_PHASE_CHANGE,    // recognized gesture updated
+    UI_GESTURE_PHASE_END,       // one of the two fingers lifted
+} ui_gesture_phase_t;
+
+typedef struct {
+    // Recognition thresholds (set by ui_gesture_init, may be tuned afterwards)
+    float pinch_slop_px;        // change in finger distance
+    float rotate_slop_deg;
+    float pan_slop_px;          // centroid travel
+    float rotate_min_span_px;   // fingers closer than this give unreliable angles
+
+    // Output, relative to the moment the second finger landed
+    uint32_t flags;             // ui_gesture_flags_t, latched until the gesture ends
+    float scale;                // finger distance ratio
+    float angle_deg;            // accumulated rotation, positive = clockwise on screen
+    float dx;                   // centroid translation
+    float dy;
+    float start_cx;             // centroid when the gesture started
+    float start_cy;
+
+    // Tracking state
+    bool tracking;
+    uint8_t ids[2];
+    float d0;
+    float prev_angle;
+    uint32_t t_start_ms;
+    uint32_t t_last_ms;
+} ui_gesture_t;
+
+void ui_gesture_init(ui_gesture_t *g);
+
+/**
+ * Feed one touch sample (all fingers currently down, n = 0 on release).
+ * Only the first two fingers are tracked; further fingers are ignored.
+ */
+ui_gesture_phase_t ui_gesture_update(ui_gesture_t *g, uint32_t t_ms, const ui_gesture_point_t *pts, uint8_t n);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*UI_GESTURE_H*/
@@ -0,0 +1,40 @@
+#ifndef UI_JPEG_VIEW_H
+#define UI_JPEG_VIEW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "lvgl.h"
+
+/**
+ * Create a zoomable JPEG viewer (pinch to zoom, one- or two-finger pan).
+ * Decodes are cached per libjpeg DCT scale so zooming reuses or refines them
+ * instead of re-decoding the full image. Zoomed in, when a whole decode at the
+ * needed scale would be too big or mostly off screen, only the visible part (and a
+ * margin) is decoded.
+ * @param parent    pointer to an object, it will be the parent of the new viewer
+ * @return          pointer to the new viewer object
+ */
+lv_obj_t * ui_jpeg_view_create(lv_obj_t * parent);
+
+/**
+ * Load a JPEG file into the viewer. The file is read by the async I/O service and
+ * shown when it arrives.
+ * @param obj       pointer to the viewer object
+ * @param src       path to the JPEG file (e.g. "S:/sdcard/photo.jpg")
+ * @return          true if the load was started
+ */
+bool ui_jpeg_view_set_src(lv_obj_t * obj, const char * src);
+
+/**
+ * Reset zoom and pan to fit the whole image
+ * @param obj       pointer to the viewer object
+ */
+void ui_jpeg_view_reset(lv_obj_t * obj);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*UI_JPEG_VIEW_H*/
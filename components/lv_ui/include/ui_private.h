@@ -24,6 +24,7 @@ extern lv_obj_t * lbl_sd;
 extern lv_obj_t * lbl_disp_info;
 extern lv_obj_t * lbl_sys_info;
 extern lv_obj_t * lbl_fault;
+extern lv_obj_t * chart_vbat;
 
 // Other containers needed for updates
 extern lv_obj_t * cont_sd_files;
@@ -55,6 +56,7 @@ void show_display_view(lv_event_t * e);
 
 void populate_sd_files_list(void);
 void update_stats_timer_cb(lv_timer_t * timer);
+void ui_pmic_chart_update(void);
 
 // New switch for Disable LED
 extern lv_obj_t * sw_disable_led;
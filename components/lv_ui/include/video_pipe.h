@@ -0,0 +1,177 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Decode -> present hand-off of the video player, off the LVGL task:
+//   - a decoder task takes free buffers from a small pool and schedules each frame before
+//     decoding it: its presentation time is its index times the frame period (plus whole
+//     passes when the clip loops), and a frame that would already be late once decoded
+//     is skipped
+//   - the presenter (an LVGL timer) shows the newest ready frame whose time has come,
+//     drops older ones, keeps the shown frame and the one before it (LVGL may still draw
+//     from it), and frees the rest
+//   - the media clock follows wall time from the first frame shown after opening or a
+//     seek; a slow decoder costs frames, not speed
+//   - a seek drops everything queued and restarts the stamps at the target; frames still
+//     being decoded from before it are thrown away when they are submitted
+// With a video plane the decoder writes to the panel itself and there is no pool: it
+// waits until a frame is nearly due (video_pipe_direct_wait), decodes it out to the panel
+// and reports it shown (video_pipe_direct_shown). Stamping, skipping and the clock are
+// the same.
+// The caller provides the lock and the decoder wake-up; no IDF dependencies so the host
+// test runs it with threads and the real libjpeg-turbo.
+
+#define VIDEO_PIPE_WAIT_PAUSED  (-1)    // video_pipe_direct_wait(): wait for play or a seek
+#define VIDEO_PIPE_WAIT_STALE   (-2)    // video_pipe_direct_wait(): a seek overtook the frame
+
+#ifndef VIDEO_PIPE_MAX_FRAMES
+#define VIDEO_PIPE_MAX_FRAMES   4       // on screen, the one before it, ready, decoding
+#endif
+
+typedef enum {
+    VIDEO_PIPE_FREE = 0,
+    VIDEO_PIPE_DECODING,
+    VIDEO_PIPE_READY,
+    VIDEO_PIPE_SHOWN,
+} video_pipe_state_t;
+
+typedef struct {
+    uint8_t *buf;
+    uint32_t buf_size;
+    uint32_t w;                 // set by the decoder
+    uint32_t h;
+    uint32_t frame;             // index in the file
+    int64_t pts_us;             // media time it is due
+    uint32_t decode_us;         // set by the decoder, for the stats
+    uint32_t gen;
+    uint8_t state;
+} video_pipe_frame_t;
+
+typedef struct {
+    void (*lock)(void *ctx);
+    void (*unlock)(void *ctx);
+    void (*wake_decoder)(void *ctx);    // a buffer came free or a seek is waiting
+    void *ctx;
+} video_pipe_os_t;
+
+typedef struct {
+    uint32_t decoded;
+    uint32_t presented;
+    uint32_t dropped;           // skipped before decoding, or overtaken while ready
+    uint32_t discarded;         // failed, or decoded before a seek
+    uint32_t late;              // shown over a frame period after it was due
+    uint32_t underruns;         // presenter found nothing ready when a frame was due
+    uint64_t decode_us;
+    uint32_t decode_max_us;
+    uint64_t jitter_us;         // sum of how long after its time each frame was shown
+    uint32_t jitter_max_us;
+    uint32_t depth_sum;         // ready frames, sampled at each present
+    uint32_t depth_samples;
+    uint32_t depth_max;
+} video_pipe_stats_t;
+
+typedef struct {
+    video_pipe_frame_t frames[VIDEO_PIPE_MAX_FRAMES];
+    uint8_t count;
+    uint8_t ready[VIDEO_PIPE_MAX_FRAMES];       // FIFO of frame slots
+    uint8_t ready_head;
+    uint8_t ready_len;
+    int8_t shown;
+    int8_t prev;
+    int64_t shown_pts;          // of the frame on screen, -1 before the first
+    uint32_t gen;               // bumped by a seek
+    uint32_t dec_gen;           // what the decoder has caught up with
+    bool seek_pending;
+    uint32_t seek_frame;
+    uint32_t period_us;
+    // Decoder side: loop detection and the decode time estimate for skipping
+    int64_t last_frame;         // -1 after opening or a seek
+    int64_t loop_base;          // frames in the passes already played
+    uint32_t decode_est_us;
+    // Media clock: media time = now - origin while playing, `paused_at` while not. Until
+    // `clock_started` the next frame is due at once and sets the clock to its time.
+    bool clock_started;
+    bool playing;
+    int64_t origin;
+    int64_t paused_at;
+    video_pipe_os_t os;
+    video_pipe_stats_t stats;
+} video_pipe_t;
+
+/**
+ * @brief Set up with `count` caller-allocated buffers of `buf_size` bytes each, paused at 0
+ */
+void video_pipe_init(video_pipe_t *vp, uint8_t *const *bufs, uint8_t count, uint32_t buf_size,
+                     uint32_t period_us, const video_pipe_os_t *os);
+
+// --- Decoder side ---
+
+/**
+ * @brief A seek the decoder has not applied yet: move the source to `*frame` when true
+ */
+bool video_pipe_take_seek(video_pipe_t *vp, uint32_t *frame);
+
+/**
+ * @brief A free buffer to decode into, NULL if all are in use (wait for wake_decoder)
+ */
+video_pipe_frame_t *video_pipe_acquire(video_pipe_t *vp);
+
+/**
+ * @brief Stamp `f` with frame `frame` of the file (every frame the source passes, in order)
+ * @return false to skip the frame: it would be late once decoded, or a seek is waiting.
+ * `f` stays with the decoder for the next one.
+ */
+bool video_pipe_schedule(video_pipe_t *vp, video_pipe_frame_t *f, uint32_t frame, int64_t now_us);
+
+/**
+ * @brief Hand a decoded buffer to the presenter (or back to the pool if !ok or stale)
+ */
+void video_pipe_submit(video_pipe_t *vp, video_pipe_frame_t *f, bool ok);
+
+// --- Decoder as presenter (video plane) ---
+
+/**
+ * @brief How long to wait before decoding scheduled frame `f` straight to the panel, so
+ * that it is out about when due, `lead_us` being how long that takes
+ * @return 0 to go now (also for the first frame after a seek, paused or not), microseconds
+ * to wait (less if woken), VIDEO_PIPE_WAIT_PAUSED or VIDEO_PIPE_WAIT_STALE
+ */
+int64_t video_pipe_direct_wait(video_pipe_t *vp, const video_pipe_frame_t *f, int64_t lead_us, int64_t now_us);
+
+/**
+ * @brief `f` (with its decode_us) is on the panel: count it, and start the clock with it
+ * if it is the first since opening or a seek
+ */
+void video_pipe_direct_shown(video_pipe_t *vp, video_pipe_frame_t *f, int64_t now_us);
+
+// --- Presenter side ---
+
+/**
+ * @brief The newest ready frame that is due at `now_us`, else NULL. The returned frame
+ * stays valid until two more have been presented.
+ */
+video_pipe_frame_t *video_pipe_present(video_pipe_t *vp, int64_t now_us);
+
+void video_pipe_play(video_pipe_t *vp, int64_t now_us);
+void video_pipe_pause(video_pipe_t *vp, int64_t now_us);
+
+/**
+ * @brief Drop queued frames and continue from `frame`, shown as soon as it is decoded
+ * (also while paused); the clock restarts from it
+ */
+void video_pipe_seek(video_pipe_t *vp, uint32_t frame);
+
+int64_t video_pipe_media_us(const video_pipe_t *vp, int64_t now_us);
+
+/**
+ * @brief Copy of the stats and the current ready depth
+ */
+void video_pipe_get_stats(video_pipe_t *vp, video_pipe_stats_t *stats, uint32_t *depth);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,84 @@
+#include "asset_bundle.h"
+#include <string.h>
+
+static uint16_t rd16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t rd32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Reflected polynomial 0xEDB88320, a nibble at a time: 64 bytes of table
+static const uint32_t s_crc_nibble[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+};
+
+uint32_t asset_bundle_crc32(uint32_t crc, const uint8_t *data, uint32_t len) {
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ s_crc_nibble[crc & 0x0F];
+        crc = (crc >> 4) ^ s_crc_nibble[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+uint32_t asset_bundle_peek_size(const uint8_t *header) {
+    if (rd32(header) != ASSET_BUNDLE_MAGIC) return 0;
+    return rd32(header + 8);
+}
+
+asset_bundle_status_t asset_bundle_open(asset_bundle_t *b, const uint8_t *base, uint32_t size, bool verify_crc) {
+    memset(b, 0, sizeof(*b));
+    if (size < ASSET_BUNDLE_HEADER || rd32(base) != ASSET_BUNDLE_MAGIC) return ASSET_BUNDLE_ERR_MAGIC;
+    if (rd16(base + 4) != ASSET_BUNDLE_VERSION) return ASSET_BUNDLE_ERR_VERSION;
+    uint16_t count = rd16(base + 6);
+    uint32_t total = rd32(base + 8);
+    uint32_t index_end = ASSET_BUNDLE_HEADER + (uint32_t)count * sizeof(asset_entry_t);
+    if (total > size || total < index_end) return ASSET_BUNDLE_ERR_SIZE;
+    if (verify_crc && asset_bundle_crc32(0, base + ASSET_BUNDLE_HEADER, total - ASSET_BUNDLE_HEADER) != rd32(base + 12)) {
+        return ASSET_BUNDLE_ERR_CRC;
+    }
+
+    const asset_entry_t *index = (const asset_entry_t *)(base + ASSET_BUNDLE_HEADER);
+    for (uint16_t i = 0; i < count; i++) {
+        const asset_entry_t *e = &index[i];
+        // Data after the index and inside the bundle, aligned for LVGL, names terminated
+        // and strictly ascending for the binary search
+        if (e->offset < index_end || e->offset > total || e->size > total - e->offset) return ASSET_BUNDLE_ERR_INDEX;
+        if (e->offset % ASSET_BUNDLE_ALIGN || !memchr(e->name, 0, ASSET_NAME_MAX)) return ASSET_BUNDLE_ERR_INDEX;
+        if (i && strcmp(index[i - 1].name, e->name) >= 0) return ASSET_BUNDLE_ERR_INDEX;
+        if (e->type == ASSET_TYPE_IMAGE && (uint32_t)e->stride * e->h > e->size) return ASSET_BUNDLE_ERR_INDEX;
+    }
+    b->base = base;
+    b->size = total;
+    b->index = index;
+    b->count = count;
+    return ASSET_BUNDLE_OK;
+}
+
+const asset_entry_t *asset_bundle_find(const asset_bundle_t *b, const char *name, asset_type_t type) {
+    int lo = 0, hi = (int)b->count - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        int cmp = strcmp(b->index[mid].name, name);
+        if (cmp == 0) return b->index[mid].type == type ? &b->index[mid] : NULL;
+        if (cmp < 0) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    return NULL;
+}
+
+const char *asset_bundle_status_str(asset_bundle_status_t status) {
+    switch (status) {
+        case ASSET_BUNDLE_OK: return "ok";
+        case ASSET_BUNDLE_ERR_MAGIC: return "no bundle";
+        case ASSET_BUNDLE_ERR_VERSION: return "unsupported version";
+        case ASSET_BUNDLE_ERR_SIZE: return "bad size";
+        case ASSET_BUNDLE_ERR_CRC: return "CRC mismatch";
+        case ASSET_BUNDLE_ERR_INDEX: return "corrupt index";
+    }
+    return "?";
+}
@@ -0,0 +1,308 @@
+#include "avi_index.h"
+#include <string.h>
+
+#define FCC(a, b, c, d) ((uint32_t)(a) | ((uint32_t)(b) << 8) | ((uint32_t)(c) << 16) | ((uint32_t)(d) << 24))
+
+#define ID_RIFF     FCC('R', 'I', 'F', 'F')
+#define ID_AVI      FCC('A', 'V', 'I', ' ')
+#define ID_LIST     FCC('L', 'I', 'S', 'T')
+#define ID_HDRL     FCC('h', 'd', 'r', 'l')
+#define ID_STRL     FCC('s', 't', 'r', 'l')
+#define ID_MOVI     FCC('m', 'o', 'v', 'i')
+#define ID_AVIH     FCC('a', 'v', 'i', 'h')
+#define ID_STRH     FCC('s', 't', 'r', 'h')
+#define ID_INDX     FCC('i', 'n', 'd', 'x')
+#define ID_IDX1     FCC('i', 'd', 'x', '1')
+#define ID_VIDS     FCC('v', 'i', 'd', 's')
+
+#define STRH_SUGGESTED      36          // dwSuggestedBufferSize in strh
+#define IDX1_ENTRY          16
+#define ODML_SUPER_ENTRY    16
+#define ODML_STD_ENTRY      8
+#define ODML_HEADER         24          // after the chunk header, both index kinds
+#define ODML_INDEX_OF_INDEXES   0
+#define ODML_INDEX_OF_CHUNKS    1
+
+static uint16_t rd16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t rd32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static bool read_full(avi_read_fn read, void *ctx, uint32_t offset, void *buf, uint32_t len) {
+    return read(ctx, offset, buf, len) == (int32_t)len;
+}
+
+// End of a chunk's payload (padded), never past `limit`
+static uint32_t chunk_next(uint32_t body, uint32_t size, uint32_t limit) {
+    uint64_t next = (uint64_t)body + size + (size & 1);
+    return next > limit ? limit : (uint32_t)next;
+}
+
+static void parse_super_index(avi_read_fn read, void *ctx, uint32_t body, uint32_t size, avi_info_t *info) {
+    uint8_t h[ODML_HEADER];
+    if (size < ODML_HEADER || !read_full(read, ctx, body, h, sizeof(h))) return;
+    if (rd16(h) != ODML_SUPER_ENTRY / 4 || h[3] != ODML_INDEX_OF_INDEXES) return;
+    uint32_t n = rd32(h + 4);
+    if (n > (size - ODML_HEADER) / ODML_SUPER_ENTRY) n = (size - ODML_HEADER) / ODML_SUPER_ENTRY;
+    for (uint32_t i = 0; i < n && info->odml_count < AVI_ODML_MAX_IX; i++) {
+        uint8_t e[ODML_SUPER_ENTRY];
+        if (!read_full(read, ctx, body + ODML_HEADER + i * ODML_SUPER_ENTRY, e, sizeof(e))) return;
+        if (rd32(e + 4)) continue;      // past 4 GB, beyond anything FAT can hold
+        info->odml_ix[info->odml_count++] = rd32(e);
+    }
+}
+
+static void parse_strl(avi_read_fn read, void *ctx, uint32_t pos, uint32_t end, uint16_t stream,
+                       bool *have_video, avi_info_t *info) {
+    bool is_video = false;
+    uint32_t indx_body = 0, indx_size = 0;
+    while (pos + 8 <= end) {
+        uint8_t c[12];
+        if (!read_full(read, ctx, pos, c, 12)) break;
+        uint32_t id = rd32(c);
+        uint32_t size = rd32(c + 4);
+        if (id == ID_STRH && size >= 4 && rd32(c + 8) == ID_VIDS && !*have_video) {
+            *have_video = true;
+            is_video = true;
+            info->video_stream = stream;
+            // The largest chunk of the stream, as the writer saw it
+            uint8_t sug[4];
+            if (size >= STRH_SUGGESTED + 4 && read_full(read, ctx, pos + 8 + STRH_SUGGESTED, sug, 4) && rd32(sug)) {
+                info->suggested_buffer = rd32(sug);
+            }
+        } else if (id == ID_INDX) {
+            indx_body = pos + 8;
+            indx_size = size;
+        }
+        pos = chunk_next(pos + 8, size, end);
+    }
+    // indx comes after strh in practice, but nothing says so
+    if (is_video && indx_body) parse_super_index(read, ctx, indx_body, indx_size, info);
+}
+
+static void parse_hdrl(avi_read_fn read, void *ctx, uint32_t pos, uint32_t end, avi_info_t *info) {
+    uint16_t streams = 0;
+    bool have_video = false;
+    while (pos + 8 <= end) {
+        uint8_t c[12];
+        if (!read_full(read, ctx, pos, c, 12)) break;
+        uint32_t id = rd32(c);
+        uint32_t size = rd32(c + 4);
+        uint32_t next = chunk_next(pos + 8, size, end);
+        if (id == ID_AVIH && size >= 40) {
+            uint8_t h[40];
+            if (read_full(read, ctx, pos + 8, h, sizeof(h))) {
+                info->usec_per_frame = rd32(h);
+                // Often a writer's default (1 MB) for the whole file; the stream's wins
+                if (!info->suggested_buffer) info->suggested_buffer = rd32(h + 28);
+                info->total_frames = rd32(h + 16);
+                info->width = rd32(h + 32);
+                info->height = rd32(h + 36);
+            }
+        } else if (id == ID_LIST && size >= 4 && rd32(c + 8) == ID_STRL) {
+            parse_strl(read, ctx, pos + 12, next, streams++, &have_video, info);
+        }
+        pos = next;
+    }
+}
+
+bool avi_parse(avi_read_fn read, void *ctx, uint32_t file_size, avi_info_t *info) {
+    memset(info, 0, sizeof(*info));
+    uint8_t h[12];
+    if (file_size < 12 || !read_full(read, ctx, 0, h, sizeof(h))) return false;
+    if (rd32(h) != ID_RIFF || rd32(h + 8) != ID_AVI) return false;
+    // A file cut short (recording stopped) still plays up to where it ends
+    uint32_t end = rd32(h + 4) + 8;
+    if (end > file_size || end < 12) end = file_size;
+
+    uint32_t pos = 12;
+    while (pos + 8 <= end) {
+        uint8_t c[12];
+        int32_t got = read(ctx, pos, c, sizeof(c));
+        if (got < 8) break;
+        uint32_t id = rd32(c);
+        uint32_t size = rd32(c + 4);
+        uint32_t next = chunk_next(pos + 8, size, end);
+        if (id == ID_LIST && size >= 4 && got == 12) {
+            uint32_t type = rd32(c + 8);
+            if (type == ID_HDRL) {
+                parse_hdrl(read, ctx, pos + 12, next, info);
+            } else if (type == ID_MOVI && !info->movi_start) {
+                info->movi_start = pos + 12;
+                info->movi_end = next;
+            }
+        } else if (id == ID_IDX1) {
+            info->idx1_offset = pos + 8;
+            info->idx1_size = next - (pos + 8);
+        }
+        pos = next;
+    }
+    return info->movi_start != 0;
+}
+
+bool avi_is_video_chunk(const avi_info_t *info, uint32_t id) {
+    uint16_t n = info->video_stream;
+    uint32_t stream = (uint32_t)('0' + n / 10 % 10) | ((uint32_t)('0' + n % 10) << 8);
+    uint32_t type = id >> 16;
+    return (id & 0xFFFF) == stream && (type == ('d' | 'c' << 8) || type == ('d' | 'b' << 8));
+}
+
+void avi_index_init(avi_index_t *ix, avi_realloc_fn realloc_fn) {
+    memset(ix, 0, sizeof(*ix));
+    ix->realloc = realloc_fn;
+}
+
+void avi_index_free(avi_index_t *ix) {
+    if (ix->frames) ix->realloc(ix->frames, 0);
+    avi_index_init(ix, ix->realloc);
+}
+
+static bool index_reserve(avi_index_t *ix, uint32_t n) {
+    if (n <= ix->capacity) return true;
+    avi_frame_t *f = (avi_frame_t *)ix->realloc(ix->frames, (size_t)n * sizeof(avi_frame_t));
+    if (!f) return false;
+    ix->frames = f;
+    ix->capacity = n;
+    return true;
+}
+
+// Append a frame; the loaders only keep those inside the movi list, strictly ascending
+static bool index_push(avi_index_t *ix, uint32_t offset, uint32_t size) {
+    if (ix->count == ix->capacity && !index_reserve(ix, ix->capacity ? ix->capacity * 2 : 64)) return false;
+    ix->frames[ix->count].offset = offset;
+    ix->frames[ix->count].size = size;
+    ix->count++;
+    return true;
+}
+
+static bool in_movi(const avi_info_t *info, uint32_t offset, uint32_t size) {
+    return offset >= info->movi_start && offset <= info->movi_end - 8 && size <= info->movi_end - 8 - offset;
+}
+
+static bool load_idx1(avi_index_t *ix, const avi_info_t *info, avi_read_fn read, void *ctx,
+                      uint8_t *buf, uint32_t buf_size) {
+    uint32_t n = info->idx1_size / IDX1_ENTRY;
+    uint32_t per_read = buf_size / IDX1_ENTRY;
+    if (!per_read) return false;
+    if (!index_reserve(ix, info->total_frames && info->total_frames < n ? info->total_frames : n)) return false;
+
+    // Offsets are from the 'movi' FourCC by the spec, from the file start in some writers:
+    // settled on the first video entry by checking which one lands on its chunk
+    int64_t base = -1;
+    for (uint32_t i = 0; i < n; i += per_read) {
+        uint32_t batch = n - i < per_read ? n - i : per_read;
+        if (!read_full(read, ctx, info->idx1_offset + i * IDX1_ENTRY, buf, batch * IDX1_ENTRY)) return false;
+        for (uint32_t j = 0; j < batch; j++) {
+            const uint8_t *e = buf + j * IDX1_ENTRY;
+            uint32_t id = rd32(e);
+            uint32_t off = rd32(e + 8);
+            uint32_t size = rd32(e + 12);
+            if (!avi_is_video_chunk(info, id)) continue;
+            if (base < 0) {
+                const uint32_t cand[2] = {info->movi_start - 4, 0};
+                for (int k = 0; k < 2 && base < 0; k++) {
+                    uint8_t c[8];
+                    uint64_t at = (uint64_t)cand[k] + off;
+                    if (at > UINT32_MAX - 8 || !read_full(read, ctx, (uint32_t)at, c, sizeof(c))) continue;
+                    if (rd32(c) == id && rd32(c + 4) == size) base = cand[k];
+                }
+                if (base < 0) return false;
+            }
+            uint64_t at = (uint64_t)base + off;
+            if (at > UINT32_MAX || !in_movi(info, (uint32_t)at, size)) continue;
+            if (ix->count && (uint32_t)at <= ix->frames[ix->count - 1].offset) return false;
+            if (!index_push(ix, (uint32_t)at, size)) return false;
+        }
+    }
+    return ix->count > 0;
+}
+
+static bool load_odml(avi_index_t *ix, const avi_info_t *info, avi_read_fn read, void *ctx,
+                      uint8_t *buf, uint32_t buf_size) {
+    uint32_t per_read = buf_size / ODML_STD_ENTRY;
+    if (!per_read) return false;
+    for (uint8_t s = 0; s < info->odml_count; s++) {
+        uint8_t h[8 + ODML_HEADER];
+        if (!read_full(read, ctx, info->odml_ix[s], h, sizeof(h))) return false;
+        const uint8_t *d = h + 8;
+        if (rd16(d) != ODML_STD_ENTRY / 4 || d[3] != ODML_INDEX_OF_CHUNKS) return false;
+        if (!avi_is_video_chunk(info, rd32(d + 8)) || rd32(d + 16)) return false;
+        uint32_t n = rd32(d + 4);
+        uint32_t room = rd32(h + 4) < ODML_HEADER ? 0 : (rd32(h + 4) - ODML_HEADER) / ODML_STD_ENTRY;
+        if (n > room) n = room;
+        uint32_t base = rd32(d + 12);
+        if (!index_reserve(ix, ix->count + n)) return false;
+
+        uint32_t entries = info->odml_ix[s] + sizeof(h);
+        for (uint32_t i = 0; i < n; i += per_read) {
+            uint32_t batch = n - i < per_read ? n - i : per_read;
+            if (!read_full(read, ctx, entries + i * ODML_STD_ENTRY, buf, batch * ODML_STD_ENTRY)) return false;
+            for (uint32_t j = 0; j < batch; j++) {
+                const uint8_t *e = buf + j * ODML_STD_ENTRY;
+                // Offsets point at the payload; bit 31 of the size marks a delta frame
+                uint64_t data = (uint64_t)base + rd32(e);
+                uint32_t size = rd32(e + 4) & 0x7FFFFFFF;
+                if (data < 8 || data > UINT32_MAX) continue;
+                uint32_t at = (uint32_t)data - 8;
+                // Frames of a RIFF-AVIX extension lie past the first movi list: not played
+                if (!in_movi(info, at, size)) continue;
+                if (ix->count && at <= ix->frames[ix->count - 1].offset) return false;
+                if (!index_push(ix, at, size)) return false;
+            }
+        }
+    }
+    return ix->count > 0;
+}
+
+avi_index_src_t avi_index_load(avi_index_t *ix, const avi_info_t *info, avi_read_fn read, void *ctx,
+                               uint8_t *buf, uint32_t buf_size) {
+    ix->count = 0;
+    ix->complete = false;
+    ix->src = AVI_INDEX_NONE;
+    if (info->odml_count && load_odml(ix, info, read, ctx, buf, buf_size)) {
+        ix->src = AVI_INDEX_ODML;
+    } else {
+        ix->count = 0;
+        if (info->idx1_size >= IDX1_ENTRY && load_idx1(ix, info, read, ctx, buf, buf_size)) {
+            ix->src = AVI_INDEX_IDX1;
+        } else {
+            ix->count = 0;
+            return AVI_INDEX_NONE;
+        }
+    }
+    ix->complete = true;
+    return ix->src;
+}
+
+bool avi_index_note(avi_index_t *ix, uint32_t offset, uint32_t size) {
+    if (ix->count && offset <= ix->frames[ix->count - 1].offset) return true;
+    return index_push(ix, offset, size);
+}
+
+uint32_t avi_index_find(const avi_index_t *ix, uint32_t offset) {
+    uint32_t lo = 0, hi = ix->count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (ix->frames[mid].offset < offset) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+uint32_t avi_index_frame_at(const avi_index_t *ix, const avi_info_t *info, uint32_t ms) {
+    if (!ix->count || !info->usec_per_frame) return 0;
+    uint64_t frame = (uint64_t)ms * 1000 / info->usec_per_frame;
+    return frame >= ix->count ? ix->count - 1 : (uint32_t)frame;
+}
+
+const char *avi_index_src_str(avi_index_src_t src) {
+    switch (src) {
+        case AVI_INDEX_NONE: return "none";
+        case AVI_INDEX_IDX1: return "idx1";
+        case AVI_INDEX_ODML: return "OpenDML";
+    }
+    return "?";
+}
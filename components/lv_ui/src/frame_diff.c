@@ -0,0 +1,113 @@
+#include "frame_diff.h"
+#include <string.h>
+
+#define HASH_MUL    0x9E3779B1u
+
+uint32_t frame_diff_grid_words(uint32_t w, uint32_t h) {
+    return ((w + FRAME_DIFF_TILE_W - 1) / FRAME_DIFF_TILE_W) * ((h + FRAME_DIFF_TILE_H - 1) / FRAME_DIFF_TILE_H);
+}
+
+// One row's part of a tile, `bytes` long (even), folded into `h`
+static inline uint32_t hash_span(uint32_t h, const uint8_t *p, uint32_t bytes) {
+    uint32_t i = 0;
+    for (; i + 4 <= bytes; i += 4) {
+        uint32_t v;
+        memcpy(&v, p + i, 4);
+        h = (h ^ v) * HASH_MUL;
+        // Fold the high bits down, or changes in the top bit of two words cancel out
+        h ^= h >> 16;
+    }
+    if (i < bytes) h = (h ^ ((uint32_t)p[i] | (uint32_t)p[i + 1] << 8)) * HASH_MUL;
+    return h;
+}
+
+void frame_diff_hash_rows(uint32_t *grid, uint32_t w, uint32_t y, uint32_t rows, const uint8_t *px,
+                          uint32_t stride) {
+    uint32_t cols = (w + FRAME_DIFF_TILE_W - 1) / FRAME_DIFF_TILE_W;
+    uint32_t span = FRAME_DIFF_TILE_W * 2;
+    for (uint32_t r = 0; r < rows; r++, y++, px += stride) {
+        uint32_t *tile = grid + (y / FRAME_DIFF_TILE_H) * cols;
+        // A tile's first row starts its hash afresh, so the grid needs no clearing
+        bool first = y % FRAME_DIFF_TILE_H == 0;
+        for (uint32_t c = 0; c < cols; c++) {
+            uint32_t bytes = c + 1 < cols ? span : (w - c * FRAME_DIFF_TILE_W) * 2;
+            tile[c] = hash_span(first ? y : tile[c], px + c * span, bytes);
+        }
+    }
+}
+
+static uint32_t box_area(const frame_diff_box_t *b) {
+    return b->w * b->h;
+}
+
+static frame_diff_box_t box_union(const frame_diff_box_t *a, const frame_diff_box_t *b) {
+    uint32_t x1 = a->x < b->x ? a->x : b->x;
+    uint32_t y1 = a->y < b->y ? a->y : b->y;
+    uint32_t x2 = a->x + a->w > b->x + b->w ? a->x + a->w : b->x + b->w;
+    uint32_t y2 = a->y + a->h > b->y + b->h ? a->y + a->h : b->y + b->h;
+    return (frame_diff_box_t){ x1, y1, x2 - x1, y2 - y1 };
+}
+
+uint32_t frame_diff_boxes(const uint32_t *prev, const uint32_t *next, uint32_t w, uint32_t h,
+                          frame_diff_box_t *boxes, uint32_t max, uint32_t *changed) {
+    uint32_t cols = (w + FRAME_DIFF_TILE_W - 1) / FRAME_DIFF_TILE_W;
+    uint32_t tile_rows = (h + FRAME_DIFF_TILE_H - 1) / FRAME_DIFF_TILE_H;
+    uint32_t n = 0, tiles = 0;
+    // In tiles: the changed span of each tile row, grown downwards while the next row's
+    // overlaps it, else a new box
+    frame_diff_box_t work[FRAME_DIFF_MAX_BOXES + 1];
+    if (max > FRAME_DIFF_MAX_BOXES) max = FRAME_DIFF_MAX_BOXES;
+    if (!max) return 0;
+    bool open = false;
+    for (uint32_t ty = 0; ty < tile_rows; ty++) {
+        const uint32_t *a = prev + ty * cols, *b = next + ty * cols;
+        uint32_t x1 = cols, x2 = 0;
+        for (uint32_t c = 0; c < cols; c++) {
+            if (a[c] == b[c]) continue;
+            if (c < x1) x1 = c;
+            x2 = c + 1;
+            tiles++;
+        }
+        if (x1 == cols) {
+            open = false;
+            continue;
+        }
+        frame_diff_box_t span = { x1, ty, x2 - x1, 1 };
+        frame_diff_box_t *last = n ? &work[n - 1] : NULL;
+        if (open && x1 < last->x + last->w && x2 > last->x) {
+            *last = box_union(last, &span);
+        } else {
+            work[n++] = span;
+        }
+        open = true;
+        if (n <= max) continue;
+        // One too many: merge the pair whose union adds the least area. Boxes that overlap
+        // (after earlier merges) add less than nothing.
+        uint32_t bi = 0, bj = 1;
+        int64_t best = INT64_MAX;
+        for (uint32_t i = 0; i < n; i++) {
+            for (uint32_t j = i + 1; j < n; j++) {
+                frame_diff_box_t u = box_union(&work[i], &work[j]);
+                int64_t extra = (int64_t)box_area(&u) - box_area(&work[i]) - box_area(&work[j]);
+                if (extra < best) {
+                    best = extra;
+                    bi = i;
+                    bj = j;
+                }
+            }
+        }
+        work[bi] = box_union(&work[bi], &work[bj]);
+        memmove(&work[bj], &work[bj + 1], (n - bj - 1) * sizeof(work[0]));
+        n--;
+        // The open box may have moved or grown; keep growing only the last one
+        open = open && bj != n;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        frame_diff_box_t *t = &work[i];
+        uint32_t x = t->x * FRAME_DIFF_TILE_W, y = t->y * FRAME_DIFF_TILE_H;
+        uint32_t x2 = (t->x + t->w) * FRAME_DIFF_TILE_W, y2 = (t->y + t->h) * FRAME_DIFF_TILE_H;
+        boxes[i] = (frame_diff_box_t){ x, y, (x2 < w ? x2 : w) - x, (y2 < h ? y2 : h) - y };
+    }
+    if (changed) *changed = tiles;
+    return n;
+}
@@ -1,114 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMAGE_IMG_VENEZUELA
-#define LV_ATTRIBUTE_IMAGE_IMG_VENEZUELA
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_VENEZUELA uint8_t img_venezuela_map[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xad, 0xcc, 0xd5, 0xcc, 0xdd, 0xaa, 0xdd, 0x86, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x6b, 0xdd, 0x68, 0xdd, 0xa8, 0xdd, 0x86, 0xd5, 0x44, 0xd5, 0x44, 0xd5, 0x65, 0xd5, 0x85, 0xd5, 0x63, 0xd5, 0x41, 0xd5, 0x41, 0xd5, 0x40, 0xd5, 0x40, 0xd5, 0x41, 0xd5, 0x41, 0xd5, 0x41, 0xd5, 0x40, 0xd5, 0x40, 0xd5, 0x20, 0xd5, 0x21, 0xd5, 0x41, 0xd5, 0x42, 0xd5, 0x63, 0xd5, 0x85, 0xd5, 0x86, 0xdd, 0x85, 0xd5, 0x43, 0xd5, 0x42, 0xd5, 0x43, 0xcd, 0x67, 0xd5, 0xca, 0xd5, 0xea, 0xd5, 0x68, 0xdd, 0xc5, 0xdd, 0x65, 0xdd, 0x6b, 0xdd, 0x10, 0xfe, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xaa, 0xd5, 0x87, 0xdd, 0x65, 0xdd, 0x85, 0xd5, 0x85, 0xdd, 0x84, 0xdd, 0x63, 0xdd, 0x62, 0xdd, 0x82, 0xdd, 0x82, 0xdd, 0x81, 0xdd, 0x81, 0xdd, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x80, 0xe5, 0x81, 0xe5, 0x81, 0xe5, 0x82, 0xdd, 0x82, 0xdd, 0x83, 0xdd, 0x82, 0xdd, 0x61, 0xdd, 0x61, 0xdd, 0x63, 0xdd, 0x85, 0xdd, 0xa7, 0xdd, 0xa7, 0xdd, 0x85, 0xd5, 0x43, 0xd5, 0x65, 0xd5, 0xa8, 0xdd, 0xca, 0xdd, 0xa9, 0xdd, 0xc5, 0xdd, 0xe0, 0xff, 0x00, 0xfc, 0x6b, 0xad, 0x10, 0xfc, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x08, 0xc6, 0xa6, 0xd5, 0x86, 0xd5, 0x86, 0xd5, 0x86, 0xdd, 0x85, 0xdd, 0x84, 0xdd, 0x62, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x88, 0xd5, 0xa6, 0xd5, 0x64, 0xd5, 0x63, 0xd5, 0x62, 0xd5, 0x82, 0xdd, 0x82, 0xdd, 0xa1, 0xe5, 0xc1, 0xe5, 0xc0, 0xed, 0xe1, 0xed, 0xe1, 0xed, 0xe0, 0xf5, 0x00, 0xf6, 0x00, 0xf6, 0x00, 0xf6, 0x00, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x00, 0xf6, 0x00, 0xf6, 0x00, 0xf6, 0x00, 0xf6, 0x00, 0xf6, 0x00, 0xf6, 0xe1, 0xed, 0xe1, 0xed, 0xc0, 0xed, 0xc0, 0xed, 0xc0, 0xe5, 0xa1, 0xe5, 0xa2, 0xe5, 0xa2, 0xe5, 0x82, 0xdd, 0x61, 0xdd, 0x61, 0xdd, 0x62, 0xd5, 0x63, 0xd5, 0x84, 0xdd, 0x63, 0xd5, 0x21, 0xd5, 0x01, 0xcd, 0x44, 0xd5, 0x67, 0xd5, 0xa8, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xd4, 0x65, 0xdd, 0x65, 0xdd, 0x68, 0xdd, 0x6b, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xdd, 0x26, 0xd5, 0x87, 0xd5, 0x86, 0xd5, 0x65, 0xd5, 0x43, 0xd5, 0x42, 0xd5, 0x62, 0xd5, 0x82, 0xdd, 0x82, 0xdd, 0xa1, 0xe5, 0x81, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x86, 0xdd, 0x84, 0xdd, 0x82, 0xdd, 0x81, 0xdd, 0xa0, 0xe5, 0xa0, 0xe5, 0xe0, 0xed, 0x00, 0xf6, 0x20, 0xf6, 0x20, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x20, 0xf6, 0x00, 0xf6, 0x00, 0xf6, 0xe0, 0xed, 0xc0, 0xed, 0xc0, 0xe5, 0xa0, 0xe5, 0xa1, 0xe5, 0xa1, 0xe5, 0x81, 0xdd, 0x81, 0xdd, 0x60, 0xdd, 0x61, 0xdd, 0x83, 0xdd, 0x84, 0xdd, 0x85, 0xdd, 0x84, 0xdd, 0x42, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xd5, 0x84, 0xdd, 0x84, 0xdd, 0x63, 0xdd, 0x61, 0xdd, 0x81, 0xdd, 0x80, 0xdd, 0xa0, 0xe5, 0xe0, 0xed, 0xe0, 0xed, 0xc0, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x62, 0xdd, 0x81, 0xe5, 0xc1, 0xed, 0x00, 0xf6, 0x00, 0xf6, 0x20, 0xf6, 0x40, 0xfe, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x20, 0xf6, 0x00, 0xf6, 0x00, 0xf6, 0xe0, 0xed, 0xe0, 0xed, 0xe0, 0xed, 0xc1, 0xed, 0xc1, 0xe5, 0xc1, 0xe5, 0xa1, 0xe5, 0x81, 0xdd, 0x80, 0xdd, 0x81, 0xdd, 0x81, 0xdd, 0x62, 0xdd, 0x62, 0xdd, 0x63, 0xdd, 0x83, 0xdd, 0x83, 0xdd, 0x83, 0xdd, 0x83, 0xdd, 0x63, 0xdd, 0x62, 0xdd, 0x61, 0xdd, 0x61, 0xdd, 0x81, 0xdd, 0x81, 0xdd, 0xa1, 0xe5, 0xa1, 0xe5, 0xc1, 0xed, 0xe0, 0xed, 0xe0, 0xed, 0x00, 0xf6, 0x20, 0xfe, 0x40, 0xfe, 0x20, 0xfe, 0xe0, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x60, 0xdd, 0xa0, 0xed, 0x00, 0xf6, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x20, 0xfe, 0x00, 0xf6, 0x00, 0xf6, 0xe0, 0xed, 0xe0, 0xed, 0xe0, 0xed, 0xc0, 0xed, 0xc0, 0xed, 0xc0, 0xed, 0xa0, 0xe5, 0xa0, 0xe5, 0xa0, 0xe5, 0xa0, 0xe5, 0xa0, 0xe5, 0xa0, 0xe5, 0xa0, 0xe5, 0xa0, 0xe5, 0xc0, 0xe5, 0xc0, 0xed, 0xc0, 0xed, 0xe0, 0xed, 0xe0, 0xed, 0x00, 0xf6, 0x20, 0xf6, 0x40, 0xfe, 0x40, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0xe0, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xe5, 0xe0, 0xed, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x20, 0xfe, 0x20, 0xfe, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xf6, 0x20, 0xfe, 0x20, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x40, 0xfe, 0xe0, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xe5, 0x00, 0xf6, 0x40, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0xe0, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xe5, 0xe0, 0xed, 0x40, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0xe0, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xdd, 0xe0, 0xed, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0xe0, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xdd, 0xe0, 0xed, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0xe0, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xe5, 0xe0, 0xed, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0xe0, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xe5, 0xe0, 0xed, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0xe0, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xe5, 0xe0, 0xed, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xdd, 0xe0, 0xed, 0x40, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x00, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xdd, 0xe0, 0xed, 0x40, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xf6, 0x21, 0xf6, 0x21, 0xf6, 0x21, 0xf6, 0x21, 0xf6, 0x21, 0xf6, 0x21, 0xf6, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x41, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0xa0, 0xfe, 0x60, 0xfe, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xe0, 0xcc, 0x00, 0x00, 0x80, 0xdd, 0xe0, 0xed, 0x40, 0xfe, 0x80, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0x80, 0xfe, 0x61, 0xfe, 0x41, 0xfe, 0x02, 0xee, 0xa2, 0xe5, 0x63, 0xdd, 0x44, 0xd5, 0x25, 0xcd, 0x05, 0xc5, 0xe6, 0xc4, 0xe6, 0xc4, 0xe6, 0xbc, 0xe6, 0xbc, 0xe6, 0xc4, 0x05, 0xc5, 0x05, 0xc5, 0x25, 0xcd, 0x44, 0xd5, 0x63, 0xd5, 0x83, 0xdd, 0xc2, 0xe5, 0xe2, 0xed, 0x22, 0xf6, 0x41, 0xfe, 0x61, 0xfe, 0x80, 0xfe, 0xa0, 0xfe, 0xc0, 0xfe, 0xc0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0xa0, 0xfe, 0xc0, 0xfe, 0x40, 0xfe, 0x81, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa0, 0xed, 0x00, 0xf6, 0x60, 0xfe, 0x60, 0xfe, 0x41, 0xfe, 0xe2, 0xed, 0xa2, 0xdd, 0x63, 0xd5, 0x05, 0xc5, 0xc6, 0xbc, 0x66, 0xa4, 0x07, 0x9c, 0xa8, 0x8b, 0x69, 0x83, 0x6a, 0x7b, 0x4a, 0x73, 0x4b, 0x73, 0x2b, 0x73, 0x2b, 0x6b, 0x2b, 0x6b, 0x2b, 0x73, 0x4a, 0x73, 0x6a, 0x73, 0x6a, 0x7b, 0x89, 0x83, 0x88, 0x8b, 0xc7, 0x93, 0x07, 0x9c, 0x66, 0xa4, 0xa6, 0xb4, 0xe5, 0xbc, 0x05, 0xc5, 0x44, 0xcd, 0x63, 0xd5, 0x82, 0xdd, 0xa2, 0xe5, 0xe2, 0xed, 0x01, 0xf6, 0x21, 0xf6, 0x41, 0xfe, 0x40, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0xa0, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x21, 0xfe, 0x01, 0xf6, 0xc2, 0xe5, 0x03, 0xc5, 0x25, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xc0, 0xed, 0x00, 0xf6, 0x01, 0xf6, 0xa3, 0xe5, 0x05, 0xc5, 0x46, 0xa4, 0xa8, 0x83, 0x2a, 0x6b, 0xcb, 0x5a, 0x8c, 0x52, 0x2d, 0x3a, 0xed, 0x31, 0xae, 0x29, 0x8e, 0x21, 0x8e, 0x21, 0x8f, 0x21, 0x8f, 0x19, 0x8f, 0x19, 0x8f, 0x19, 0x8f, 0x19, 0x8f, 0x19, 0x8f, 0x19, 0xaf, 0x21, 0x8e, 0x21, 0x8e, 0x21, 0x8e, 0x21, 0xad, 0x29, 0xed, 0x31, 0x2d, 0x3a, 0x6d, 0x4a, 0xac, 0x52, 0xcb, 0x5a, 0xeb, 0x62, 0x2a, 0x6b, 0x68, 0x7b, 0xc8, 0x8b, 0x27, 0xa4, 0x86, 0xb4, 0xc5, 0xbc, 0x24, 0xcd, 0x63, 0xd5, 0xc3, 0xe5, 0x02, 0xf6, 0x22, 0xfe, 0x61, 0xfe, 0x60, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xc0, 0xfe, 0xc0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0x80, 0xfe, 0x60, 0xfe, 0x41, 0xfe, 0x02, 0xf6, 0xa3, 0xe5, 0x04, 0xc5, 0x86, 0xac, 0xc8, 0x8b, 0xea, 0x62, 0xeb, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x02, 0xcd, 0xe4, 0xc4, 0x85, 0xac, 0x08, 0x94, 0x4a, 0x73, 0xab, 0x52, 0x0d, 0x32, 0xae, 0x21, 0x4f, 0x11, 0x30, 0x09, 0xf0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xb0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xb0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x09, 0x2f, 0x11, 0x6f, 0x19, 0xcf, 0x29, 0x4e, 0x42, 0x8e, 0x52, 0xcc, 0x5a, 0xcb, 0x62, 0x0a, 0x6b, 0x49, 0x7b, 0xa8, 0x83, 0x07, 0x94, 0x47, 0xa4, 0xa6, 0xb4, 0xe5, 0xbc, 0x24, 0xc5, 0x43, 0xd5, 0x83, 0xdd, 0xa3, 0xdd, 0xc3, 0xe5, 0xc2, 0xed, 0xe2, 0xed, 0xe2, 0xed, 0xe1, 0xed, 0x01, 0xf6, 0x01, 0xf6, 0x01, 0xf6, 0x01, 0xf6, 0x01, 0xf6, 0x01, 0xf6, 0x01, 0xee, 0xe2, 0xed, 0xe2, 0xed, 0xc2, 0xe5, 0xa3, 0xdd, 0x63, 0xd5, 0x24, 0xcd, 0xe5, 0xbc, 0x66, 0xac, 0x08, 0x94, 0x49, 0x7b, 0xcb, 0x5a, 0x2d, 0x3a, 0x6e, 0x19, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x67, 0x7b, 0x09, 0x63, 0x6c, 0x4a, 0xed, 0x31, 0x8e, 0x21, 0x4f, 0x11, 0x2f, 0x09, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x10, 0x01, 0x10, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x10, 0x09, 0xb1, 0x21, 0x93, 0x4a, 0xb3, 0x52, 0x11, 0x3a, 0x8f, 0x21, 0x6e, 0x19, 0x8e, 0x21, 0xce, 0x31, 0x0d, 0x3a, 0x2d, 0x42, 0x4c, 0x4a, 0x8b, 0x52, 0xeb, 0x5a, 0x2a, 0x6b, 0x69, 0x7b, 0xa9, 0x83, 0xc9, 0x93, 0x08, 0x9c, 0x27, 0x9c, 0x27, 0xa4, 0x46, 0xa4, 0x45, 0xac, 0x65, 0xac, 0x65, 0xac, 0x65, 0xac, 0x65, 0xac, 0x65, 0xac, 0x46, 0xac, 0x27, 0xa4, 0x08, 0x9c, 0xe8, 0x93, 0xa9, 0x83, 0x4a, 0x73, 0xea, 0x62, 0x8b, 0x52, 0x2c, 0x42, 0xed, 0x31, 0x8e, 0x21, 0x6f, 0x11, 0x50, 0x09, 0xef, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x2c, 0x42, 0x8d, 0x21, 0x0f, 0x09, 0xf0, 0x00, 0xd0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x10, 0x01, 0x30, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x4f, 0x09, 0x4f, 0x09, 0x4f, 0x09, 0x4f, 0x09, 0x4f, 0x09, 0x4f, 0x09, 0x4f, 0x09, 0x4f, 0x09, 0x4f, 0x09, 0x4f, 0x09, 0x4f, 0x09, 0x4f, 0x09, 0x4f, 0x09, 0x4f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x6f, 0x11, 0xf1, 0x21, 0x32, 0x32, 0x32, 0x32, 0xb1, 0x19, 0x50, 0x11, 0x52, 0x3a, 0xd6, 0x73, 0x17, 0x7c, 0x94, 0x42, 0x51, 0x11, 0x11, 0x09, 0xb3, 0x21, 0x74, 0x3a, 0x74, 0x42, 0x91, 0x21, 0xef, 0x00, 0xef, 0x00, 0x2f, 0x09, 0x6e, 0x19, 0xae, 0x29, 0x0e, 0x3a, 0x2d, 0x42, 0x4d, 0x4a, 0x6c, 0x4a, 0x6c, 0x52, 0x8b, 0x52, 0x8a, 0x5a, 0xaa, 0x5a, 0xaa, 0x5a, 0xaa, 0x5a, 0xaa, 0x5a, 0x8a, 0x5a, 0x8b, 0x5a, 0x6c, 0x52, 0x6d, 0x4a, 0x4d, 0x42, 0x0e, 0x3a, 0xce, 0x29, 0x6f, 0x19, 0x2f, 0x09, 0x10, 0x01, 0xf0, 0x00, 0xd0, 0x00, 0xf0, 0x00, 0x10, 0x01, 0xef, 0x00, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6e, 0x19, 0xce, 0x00, 0xf0, 0x00, 0x10, 0x01, 0xf0, 0x00, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0xef, 0x00, 0xcf, 0x00, 0x90, 0x19, 0xf3, 0x4a, 0xf6, 0x73, 0x16, 0x74, 0xf4, 0x4a, 0xb1, 0x21, 0x93, 0x42, 0xff, 0xff, 0xff, 0xff, 0x75, 0x63, 0xd2, 0x29, 0xd2, 0x21, 0x15, 0x53, 0xff, 0xff, 0xff, 0xff, 0x73, 0x3a, 0xf0, 0x00, 0x8f, 0x00, 0xaf, 0x00, 0xcf, 0x00, 0x0f, 0x01, 0x2f, 0x09, 0x50, 0x11, 0x4f, 0x11, 0x4f, 0x11, 0x2f, 0x11, 0x2f, 0x11, 0x4f, 0x11, 0x4f, 0x19, 0x4f, 0x19, 0x4f, 0x19, 0x4f, 0x19, 0x4f, 0x11, 0x4f, 0x11, 0x4f, 0x11, 0x4f, 0x11, 0x30, 0x11, 0x30, 0x09, 0x10, 0x09, 0x10, 0x01, 0x10, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x10, 0x01, 0x30, 0x01, 0xef, 0x00, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0x11, 0xae, 0x00, 0x0f, 0x01, 0x50, 0x09, 0x4f, 0x09, 0x4f, 0x01, 0x4f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x50, 0x09, 0x0f, 0x01, 0xef, 0x00, 0xb1, 0x21, 0x54, 0x63, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x6b, 0x11, 0x2a, 0x52, 0x3a, 0xff, 0xff, 0xff, 0xff, 0x54, 0x5b, 0x11, 0x32, 0x31, 0x32, 0xb5, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x4a, 0x70, 0x19, 0x90, 0x19, 0xd1, 0x21, 0xb1, 0x19, 0x70, 0x11, 0x10, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x10, 0x01, 0x10, 0x01, 0x30, 0x01, 0x30, 0x01, 0x2f, 0x01, 0x4f, 0x01, 0x4f, 0x09, 0x4f, 0x09, 0x50, 0x09, 0x0f, 0x01, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0x19, 0xae, 0x00, 0x0f, 0x01, 0x50, 0x01, 0x30, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x2f, 0x01, 0x0f, 0x01, 0x50, 0x09, 0xd1, 0x21, 0xd1, 0x21, 0x91, 0x19, 0xf1, 0x29, 0xd3, 0x52, 0xff, 0xff, 0xff, 0xff, 0x54, 0x63, 0xf1, 0x29, 0x70, 0x19, 0x32, 0x32, 0x72, 0x3a, 0xf1, 0x21, 0x90, 0x19, 0xb1, 0x19, 0xb3, 0x42, 0xd5, 0x73, 0x75, 0x6b, 0x11, 0x32, 0xb1, 0x21, 0xd3, 0x4a, 0x95, 0x63, 0x34, 0x53, 0x52, 0x32, 0x70, 0x09, 0xf0, 0x00, 0x10, 0x01, 0x30, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x50, 0x01, 0x0f, 0x01, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6e, 0x19, 0xcd, 0x00, 0x0f, 0x01, 0x50, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x0f, 0x01, 0xef, 0x00, 0x91, 0x19, 0xd3, 0x4a, 0x75, 0x63, 0x54, 0x5b, 0xb3, 0x4a, 0x52, 0x3a, 0x72, 0x3a, 0xb3, 0x42, 0x72, 0x3a, 0x90, 0x19, 0x0f, 0x01, 0xef, 0x00, 0x0f, 0x01, 0x0f, 0x01, 0x30, 0x01, 0x50, 0x09, 0xb1, 0x19, 0x32, 0x32, 0xf1, 0x29, 0x50, 0x11, 0xf1, 0x29, 0xb5, 0x6b, 0xff, 0xff, 0xff, 0xff, 0x13, 0x53, 0x90, 0x19, 0xce, 0x00, 0xef, 0x00, 0x2f, 0x01, 0x4f, 0x01, 0x4f, 0x01, 0x4f, 0x01, 0x4f, 0x01, 0x4f, 0x01, 0x4f, 0x01, 0x4f, 0x01, 0x4f, 0x01, 0x4f, 0x01, 0x4f, 0x01, 0x4f, 0x01, 0x4f, 0x01, 0x4f, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x50, 0x01, 0x0f, 0x01, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0x19, 0xce, 0x00, 0x0f, 0x01, 0x50, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x50, 0x01, 0xef, 0x00, 0xcf, 0x00, 0xf1, 0x21, 0xb5, 0x6b, 0xff, 0xff, 0xff, 0xff, 0x95, 0x6b, 0x11, 0x2a, 0x30, 0x09, 0x50, 0x11, 0x90, 0x11, 0x50, 0x09, 0x0f, 0x01, 0xef, 0x00, 0xef, 0x00, 0x0f, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x30, 0x09, 0x50, 0x11, 0x0f, 0x01, 0x0f, 0x01, 0xf1, 0x21, 0x75, 0x63, 0xff, 0xff, 0xff, 0xff, 0x14, 0x53, 0x90, 0x19, 0xae, 0x00, 0xcf, 0x00, 0x0f, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x50, 0x01, 0x0f, 0x01, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0x19, 0xce, 0x00, 0x0f, 0x01, 0x50, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0xef, 0x00, 0xaf, 0x00, 0x91, 0x19, 0x54, 0x5b, 0xff, 0xff, 0xff, 0xff, 0x75, 0x63, 0xb1, 0x19, 0xae, 0x00, 0xcf, 0x00, 0x0f, 0x01, 0x0f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x0f, 0x01, 0x0f, 0x01, 0xef, 0x00, 0xef, 0x00, 0x90, 0x11, 0x93, 0x3a, 0x34, 0x5b, 0x14, 0x5b, 0x93, 0x42, 0xf1, 0x29, 0xb1, 0x19, 0xb1, 0x19, 0x90, 0x11, 0x50, 0x09, 0x0f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x50, 0x01, 0x0f, 0x01, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0x19, 0xce, 0x00, 0x0f, 0x01, 0x50, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x0f, 0x01, 0x0f, 0x01, 0x50, 0x11, 0xf1, 0x29, 0x73, 0x42, 0x93, 0x42, 0x32, 0x32, 0x70, 0x11, 0xef, 0x00, 0xef, 0x00, 0x0f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x0f, 0x01, 0x0f, 0x01, 0x0f, 0x01, 0x50, 0x09, 0x90, 0x11, 0x90, 0x19, 0x90, 0x19, 0xf1, 0x21, 0xb3, 0x42, 0x54, 0x5b, 0x54, 0x5b, 0x93, 0x42, 0x91, 0x19, 0x0f, 0x01, 0x0f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x50, 0x01, 0x0f, 0x01, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0x19, 0xce, 0x00, 0x0f, 0x01, 0x50, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x30, 0x09, 0xd1, 0x21, 0x93, 0x42, 0x93, 0x42, 0xd1, 0x29, 0x50, 0x19, 0x30, 0x09, 0x30, 0x09, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x50, 0x01, 0x30, 0x01, 0x0f, 0x01, 0x0f, 0x01, 0xaf, 0x00, 0xae, 0x00, 0x90, 0x19, 0x34, 0x5b, 0xff, 0xff, 0xff, 0xff, 0x75, 0x63, 0xd1, 0x19, 0xcf, 0x00, 0xef, 0x00, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x50, 0x01, 0x0f, 0x01, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0x19, 0xce, 0x00, 0x0f, 0x01, 0x50, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x30, 0x09, 0x2f, 0x01, 0x2f, 0x01, 0x0f, 0x01, 0x30, 0x11, 0xb3, 0x4a, 0xff, 0xff, 0xff, 0xff, 0x34, 0x5b, 0x91, 0x21, 0x0f, 0x09, 0xef, 0x00, 0x0f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x0f, 0x01, 0xcf, 0x00, 0xaf, 0x00, 0x90, 0x19, 0x14, 0x53, 0xff, 0xff, 0xff, 0xff, 0x75, 0x63, 0xd1, 0x21, 0xcf, 0x00, 0xef, 0x00, 0x50, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x50, 0x01, 0x0f, 0x01, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0x19, 0xce, 0x00, 0x0f, 0x01, 0x50, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x10, 0x01, 0x50, 0x09, 0xf4, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x63, 0xf2, 0x21, 0x30, 0x09, 0x0f, 0x01, 0x10, 0x01, 0x50, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x50, 0x09, 0x2f, 0x01, 0x0f, 0x01, 0x90, 0x11, 0x72, 0x3a, 0x34, 0x5b, 0x75, 0x63, 0xb3, 0x42, 0x91, 0x19, 0xef, 0x00, 0x0f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x50, 0x01, 0x0f, 0x01, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0x19, 0xce, 0x00, 0x0f, 0x01, 0x50, 0x09, 0x30, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x10, 0x01, 0x30, 0x01, 0x53, 0x2a, 0xd6, 0x63, 0x16, 0x6c, 0xd4, 0x42, 0xb1, 0x11, 0x30, 0x01, 0x10, 0x01, 0x10, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x2f, 0x01, 0x30, 0x09, 0x90, 0x11, 0xb1, 0x21, 0xd1, 0x21, 0xd1, 0x21, 0xb1, 0x21, 0x70, 0x11, 0x30, 0x09, 0x10, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x30, 0x09, 0x50, 0x09, 0x0f, 0x01, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0x19, 0xce, 0x00, 0x0f, 0x01, 0x50, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x09, 0x30, 0x09, 0x2f, 0x09, 0x2f, 0x11, 0x2f, 0x11, 0x2f, 0x11, 0x2f, 0x11, 0x2f, 0x11, 0x2f, 0x11, 0x0f, 0x11, 0x2f, 0x11, 0x90, 0x29, 0x31, 0x3a, 0x52, 0x42, 0xd1, 0x29, 0x70, 0x19, 0x2f, 0x11, 0x2f, 0x09, 0x30, 0x09, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x0f, 0x01, 0xef, 0x00, 0xef, 0x00, 0x30, 0x11, 0x12, 0x32, 0x14, 0x5b, 0x14, 0x53, 0xf1, 0x29, 0x30, 0x09, 0x0f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x50, 0x01, 0x0f, 0x01, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0x19, 0xce, 0x00, 0x0f, 0x01, 0x50, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x2f, 0x09, 0x2f, 0x11, 0x0e, 0x21, 0x0e, 0x31, 0x0e, 0x39, 0x0d, 0x41, 0x0c, 0x41, 0x0c, 0x49, 0xec, 0x48, 0xec, 0x48, 0xec, 0x48, 0xec, 0x48, 0xec, 0x48, 0x0c, 0x49, 0x0d, 0x51, 0x2d, 0x49, 0x2d, 0x41, 0x0d, 0x41, 0x0e, 0x39, 0x0e, 0x31, 0x0e, 0x29, 0x2f, 0x19, 0x2f, 0x11, 0x2f, 0x09, 0x2f, 0x09, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x09, 0x0f, 0x01, 0xef, 0x00, 0x0f, 0x09, 0xb1, 0x21, 0x74, 0x63, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x52, 0x50, 0x11, 0x0f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x30, 0x09, 0x2f, 0x09, 0x2f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x50, 0x01, 0xef, 0x00, 0xad, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0x19, 0xce, 0x00, 0x0f, 0x01, 0x30, 0x09, 0x2f, 0x11, 0x0e, 0x19, 0x0e, 0x29, 0x0d, 0x39, 0x0d, 0x41, 0xec, 0x50, 0xeb, 0x60, 0xeb, 0x70, 0xea, 0x78, 0xea, 0x80, 0xc9, 0x88, 0xc9, 0x88, 0xc9, 0x88, 0xc8, 0x90, 0xc8, 0x90, 0xc8, 0x90, 0xc8, 0x88, 0xa8, 0x88, 0xa9, 0x80, 0xa9, 0x80, 0xc9, 0x78, 0xca, 0x78, 0xea, 0x70, 0xeb, 0x70, 0xeb, 0x60, 0xec, 0x58, 0x0c, 0x49, 0x0c, 0x41, 0x0d, 0x39, 0x0d, 0x31, 0x0e, 0x29, 0x0e, 0x21, 0x0e, 0x19, 0x0f, 0x11, 0x2f, 0x11, 0x2f, 0x11, 0x2f, 0x09, 0x30, 0x09, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x10, 0x01, 0x10, 0x01, 0x50, 0x09, 0xf2, 0x21, 0xb6, 0x63, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x4a, 0x50, 0x09, 0x10, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x2f, 0x09, 0x2f, 0x11, 0x2f, 0x19, 0x2e, 0x29, 0xcc, 0x38, 0x8a, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0x11, 0xce, 0x00, 0xee, 0x10, 0x2e, 0x31, 0x0c, 0x49, 0xeb, 0x60, 0xea, 0x78, 0xc9, 0x88, 0xc8, 0x98, 0xc8, 0xa0, 0xc7, 0xb0, 0xc7, 0xb8, 0xa7, 0xb8, 0xa6, 0xc0, 0xa6, 0xc0, 0xa6, 0xc0, 0xa6, 0xc0, 0xa6, 0xc0, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc0, 0xa6, 0xc0, 0x86, 0xc0, 0x86, 0xb8, 0xa6, 0xb8, 0xa6, 0xb8, 0xa7, 0xb8, 0xc7, 0xb8, 0xc7, 0xb0, 0xc7, 0xa8, 0xc8, 0xa0, 0xc8, 0x98, 0xc9, 0x90, 0xe9, 0x88, 0xea, 0x78, 0xea, 0x70, 0xeb, 0x60, 0xeb, 0x58, 0xec, 0x50, 0x0d, 0x41, 0x0d, 0x39, 0x0e, 0x29, 0x0e, 0x21, 0x0f, 0x19, 0x2f, 0x11, 0x2f, 0x09, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x91, 0x09, 0x73, 0x32, 0x75, 0x53, 0x55, 0x53, 0x32, 0x22, 0x50, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x30, 0x01, 0x2f, 0x09, 0x2f, 0x11, 0x0e, 0x19, 0x0e, 0x29, 0x0c, 0x49, 0xeb, 0x60, 0xea, 0x78, 0xa8, 0x88, 0x66, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6d, 0x31, 0xab, 0x28, 0xcb, 0x50, 0xeb, 0x70, 0xc9, 0x88, 0xc8, 0xa0, 0xa7, 0xb8, 0xa6, 0xc0, 0xa6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd0, 0xa5, 0xd0, 0xa6, 0xc8, 0xa6, 0xc0, 0xa7, 0xb8, 0xa7, 0xb0, 0xc8, 0xa0, 0xc8, 0x98, 0xc9, 0x90, 0xca, 0x88, 0xea, 0x78, 0xeb, 0x68, 0xeb, 0x60, 0xec, 0x50, 0xec, 0x48, 0x0d, 0x41, 0x0d, 0x39, 0x0e, 0x31, 0x0e, 0x21, 0x0e, 0x21, 0x2e, 0x21, 0x4f, 0x29, 0xb0, 0x39, 0xb0, 0x31, 0x4f, 0x21, 0x2f, 0x19, 0x0f, 0x19, 0x0f, 0x19, 0x0f, 0x19, 0x0f, 0x19, 0x0f, 0x19, 0x0e, 0x19, 0x0e, 0x19, 0x0e, 0x21, 0x0e, 0x29, 0x0d, 0x31, 0x0d, 0x41, 0xec, 0x48, 0xeb, 0x58, 0xea, 0x68, 0xc9, 0x88, 0xc8, 0xa0, 0xc7, 0xb8, 0x85, 0xc0, 0x44, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0x69, 0x67, 0x78, 0x87, 0xa0, 0xc7, 0xb8, 0xa6, 0xc0, 0xa6, 0xc8, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc0, 0xa6, 0xc0, 0xa6, 0xb8, 0xa7, 0xb8, 0xa7, 0xb0, 0xc8, 0xa8, 0xc8, 0xa0, 0xc8, 0x98, 0xc9, 0x90, 0xc9, 0x80, 0xc9, 0x78, 0xca, 0x70, 0xca, 0x70, 0xeb, 0x68, 0xeb, 0x68, 0xec, 0x60, 0xec, 0x58, 0xec, 0x58, 0xec, 0x58, 0xec, 0x58, 0xec, 0x58, 0xec, 0x58, 0xec, 0x60, 0xeb, 0x60, 0xeb, 0x68, 0xea, 0x70, 0xea, 0x78, 0xc9, 0x88, 0xc9, 0x90, 0xc8, 0xa0, 0xc7, 0xa8, 0xa7, 0xb8, 0xa6, 0xc0, 0xa6, 0xc8, 0xa6, 0xd0, 0x64, 0xd0, 0x43, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x08, 0xa1, 0x44, 0xb0, 0x65, 0xd0, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xc8, 0xa5, 0xc8, 0xa5, 0xc8, 0xa5, 0xc8, 0xa5, 0xc8, 0xa5, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa5, 0xc8, 0xa5, 0xc8, 0xa5, 0xc8, 0xa5, 0xc8, 0xa5, 0xc8, 0xa5, 0xc8, 0xa5, 0xc8, 0xa5, 0xc8, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd0, 0xa6, 0xd0, 0xa6, 0xc8, 0xa6, 0xc0, 0xa6, 0xb8, 0xa7, 0xb0, 0xa7, 0xb0, 0xa7, 0xa8, 0xa8, 0xa0, 0xa8, 0x98, 0xc8, 0x98, 0xc8, 0x98, 0xc8, 0x98, 0xc8, 0x98, 0xc8, 0x98, 0xc8, 0xa0, 0xc8, 0xa0, 0xc8, 0xa0, 0xc7, 0xa8, 0xa7, 0xb0, 0xa6, 0xb8, 0xa6, 0xc0, 0xa6, 0xc8, 0xa5, 0xd0, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0x65, 0xc8, 0x44, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xb9, 0x43, 0xc0, 0x64, 0xd0, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xc8, 0x85, 0xc8, 0x86, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd0, 0xa5, 0xd8, 0xc5, 0xd8, 0x85, 0xc8, 0x44, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xb9, 0x44, 0xc0, 0x85, 0xc8, 0xc6, 0xd0, 0xa6, 0xd0, 0xa6, 0xc8, 0xa5, 0xc8, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa5, 0xc8, 0xa5, 0xc8, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd8, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xc8, 0xa5, 0xc8, 0xa6, 0xc8, 0xa6, 0xd0, 0xc6, 0xd0, 0x85, 0xc8, 0x44, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xb9, 0x44, 0xc0, 0x85, 0xc8, 0xc6, 0xd0, 0xa6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa6, 0xd0, 0xc6, 0xd0, 0x85, 0xc8, 0x44, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xb9, 0x44, 0xb8, 0x85, 0xc8, 0xc6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xc8, 0xa5, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa6, 0xc8, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xc6, 0xd0, 0x85, 0xc8, 0x44, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xb9, 0x44, 0xb8, 0x85, 0xc8, 0xc6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xc6, 0xd0, 0x85, 0xc8, 0x44, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xb9, 0x44, 0xb8, 0x85, 0xc8, 0xc6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xc6, 0xd0, 0x85, 0xc8, 0x44, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xb9, 0x44, 0xb8, 0x85, 0xc8, 0xc6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xc6, 0xd0, 0x85, 0xc8, 0x44, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xb9, 0x44, 0xb8, 0x85, 0xc8, 0xc6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xc6, 0xd0, 0x85, 0xc8, 0x44, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xb9, 0x44, 0xb8, 0x85, 0xc8, 0xc6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xa6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xc6, 0xd0, 0x85, 0xc8, 0x44, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xb9, 0x44, 0xc0, 0x85, 0xc8, 0xc6, 0xd0, 0xa6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0x85, 0xd0, 0x85, 0xc8, 0x85, 0xc8, 0x65, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x65, 0xc8, 0x85, 0xc8, 0x85, 0xc8, 0x85, 0xc8, 0x85, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa6, 0xd0, 0xc6, 0xd0, 0x65, 0xc8, 0x03, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xb9, 0x44, 0xc0, 0x85, 0xd0, 0xc6, 0xd8, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xa5, 0xc8, 0x65, 0xc8, 0x44, 0xc0, 0x44, 0xc0, 0x23, 0xb8, 0x23, 0xb8, 0x03, 0xb8, 0x03, 0xb8, 0x03, 0xb0, 0x03, 0xb0, 0x03, 0xb0, 0x03, 0xb0, 0x03, 0xb0, 0x03, 0xb0, 0x03, 0xb0, 0x03, 0xb0, 0x03, 0xb8, 0x03, 0xb8, 0x03, 0xb8, 0x23, 0xb8, 0x23, 0xb8, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x65, 0xc8, 0xa5, 0xc8, 0xc6, 0xc8, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xe6, 0xd0, 0x64, 0xc0, 0x02, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x26, 0xb9, 0x24, 0xb8, 0x44, 0xc8, 0x85, 0xc8, 0x64, 0xc8, 0x44, 0xc0, 0x44, 0xc0, 0x64, 0xb8, 0xc5, 0xb8, 0x06, 0xb9, 0x06, 0xb9, 0x26, 0xb9, 0x47, 0xb9, 0x47, 0xb9, 0x68, 0xb9, 0x68, 0xb9, 0x88, 0xb9, 0x88, 0xb9, 0x88, 0xb9, 0x88, 0xb9, 0x88, 0xb9, 0x88, 0xb9, 0x88, 0xb9, 0x68, 0xb9, 0x68, 0xb9, 0x47, 0xb9, 0x27, 0xb9, 0x26, 0xb9, 0x06, 0xb9, 0x06, 0xb9, 0xe6, 0xb8, 0xc6, 0xb8, 0x64, 0xb8, 0x44, 0xb8, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x64, 0xc0, 0x64, 0xc8, 0x64, 0xc8, 0x65, 0xc8, 0x85, 0xc8, 0x85, 0xc8, 0x85, 0xd0, 0x85, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa6, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0xa5, 0xd0, 0x85, 0xd0, 0x85, 0xd0, 0x85, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xb8, 0x84, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x26, 0xb9, 0x23, 0xb8, 0x23, 0xb8, 0x23, 0xb8, 0x23, 0xb8, 0x02, 0xb0, 0x02, 0xa8, 0x64, 0xb0, 0x47, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xb0, 0x22, 0xa8, 0x02, 0xa8, 0x23, 0xb0, 0x03, 0xb0, 0x03, 0xb0, 0x03, 0xb0, 0x03, 0xb0, 0x03, 0xb8, 0x23, 0xb8, 0x44, 0xc0, 0x44, 0xc0, 0x64, 0xc0, 0x85, 0xc8, 0xa5, 0xc8, 0xc6, 0xc8, 0xc6, 0xc8, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xd0, 0xc6, 0xc8, 0xa5, 0xc8, 0x85, 0xc8, 0x44, 0xc0, 0x44, 0xc0, 0x23, 0xb8, 0x23, 0xb8, 0x02, 0xb0, 0x03, 0xb0, 0xa4, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xc5, 0xb0, 0x03, 0xa8, 0xc5, 0xb8, 0x47, 0xb9, 0x88, 0xb9, 0xe9, 0xb9, 0x6b, 0xc2, 0x6b, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xc2, 0x6b, 0xc2, 0x2a, 0xba, 0xe9, 0xb9, 0xc9, 0xb9, 0x88, 0xb9, 0x67, 0xb9, 0x47, 0xb9, 0x27, 0xb9, 0x06, 0xb9, 0x06, 0xb9, 0xe6, 0xb8, 0xc5, 0xb8, 0x64, 0xb8, 0x44, 0xb8, 0x44, 0xb8, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x64, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xc0, 0x44, 0xb8, 0x64, 0xb8, 0xc5, 0xb8, 0xe6, 0xb8, 0x06, 0xb9, 0x27, 0xb9, 0x68, 0xb9, 0xe9, 0xb9, 0x6b, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x84, 0xa8, 0x43, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xb0, 0x43, 0xa8, 0x23, 0xa8, 0x23, 0xb0, 0x03, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x03, 0xb0, 0x03, 0xb0, 0x23, 0xb0, 0x84, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xc2, 0x2b, 0xba, 0x0a, 0xba, 0xc9, 0xb9, 0xa9, 0xb9, 0xa9, 0xb9, 0xa8, 0xb9, 0xa8, 0xb9, 0xa8, 0xb9, 0xa8, 0xb9, 0xa8, 0xb9, 0xa8, 0xb9, 0xa9, 0xb9, 0xc9, 0xb9, 0xe9, 0xb9, 0x2b, 0xba, 0xac, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xb6, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-const lv_image_dsc_t img_venezuela = {
-  .header.cf = LV_COLOR_FORMAT_RGB565,
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.w = 80,
-  .header.h = 80,
-  .data_size = 6400 * 2,
-  .data = img_venezuela_map,
-};
@@ -1,114 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMAGE_IMG_WATERMELON
-#define LV_ATTRIBUTE_IMAGE_IMG_WATERMELON
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_IMG_WATERMELON uint8_t img_watermelon_map[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xa5, 0xae, 0x9d, 0xad, 0x9d, 0xce, 0xa5, 0x10, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xad, 0x4b, 0x8d, 0x4b, 0x8d, 0x6b, 0x95, 0xee, 0xad, 0xf2, 0xd6, 0x76, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xc6, 0xad, 0x9d, 0x0a, 0x85, 0x09, 0x85, 0x6a, 0x95, 0x4e, 0xbe, 0x52, 0xe7, 0xb5, 0xff, 0xd4, 0xfe, 0x14, 0xfe, 0x10, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xa5, 0x4c, 0x95, 0xe9, 0x7c, 0x08, 0x85, 0xcc, 0xad, 0xf0, 0xd6, 0xb3, 0xf7, 0x74, 0xff, 0x13, 0xfe, 0xd1, 0xfc, 0x31, 0xfc, 0x12, 0xfc, 0x75, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x6c, 0x95, 0x0a, 0x85, 0x09, 0x85, 0x8a, 0x9d, 0xaf, 0xce, 0x93, 0xf7, 0xb4, 0xff, 0xb3, 0xfe, 0x11, 0xfd, 0xef, 0xfb, 0x90, 0xfb, 0xf0, 0xfb, 0x31, 0xfc, 0x52, 0xfc, 0x14, 0xfd, 0x10, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x8c, 0x95, 0x2a, 0x85, 0x09, 0x85, 0x4a, 0x95, 0x4e, 0xbe, 0x72, 0xef, 0xd5, 0xff, 0x54, 0xff, 0xd1, 0xfd, 0x2f, 0xfc, 0x4e, 0xfb, 0x4f, 0xfb, 0xaf, 0xfb, 0xd0, 0xfb, 0xf1, 0xfb, 0x11, 0xfc, 0xd1, 0xfb, 0xb5, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x9e, 0x4c, 0x8d, 0xe9, 0x7c, 0x29, 0x8d, 0xec, 0xb5, 0x11, 0xdf, 0xd4, 0xff, 0x94, 0xff, 0x52, 0xfe, 0xd0, 0xfc, 0xaf, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0xb0, 0xfb, 0x8f, 0xfb, 0x6e, 0xfb, 0x10, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x95, 0x0a, 0x85, 0xe8, 0x7c, 0x6a, 0x95, 0x8f, 0xce, 0xb3, 0xf7, 0xf4, 0xff, 0x13, 0xff, 0x71, 0xfd, 0x0f, 0xfc, 0x6f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0xef, 0xfb, 0x14, 0xfc, 0x75, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x2b, 0x8d, 0x09, 0x85, 0x29, 0x8d, 0xec, 0xad, 0x11, 0xe7, 0xf4, 0xff, 0xb4, 0xff, 0x52, 0xfe, 0x90, 0xfc, 0x6f, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x8f, 0xfb, 0xd0, 0xfb, 0x52, 0xfc, 0xb2, 0xfc, 0x75, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xad, 0x9d, 0x2a, 0x85, 0x09, 0x85, 0x6b, 0x9d, 0x8e, 0xc6, 0x93, 0xf7, 0xd5, 0xff, 0x13, 0xff, 0x91, 0xfd, 0x0f, 0xfc, 0x2e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0xaf, 0xfb, 0xd0, 0xfb, 0xf1, 0xfb, 0x31, 0xfc, 0x12, 0xfc, 0x75, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xbe, 0x8e, 0x95, 0x09, 0x85, 0x29, 0x8d, 0xec, 0xad, 0x11, 0xdf, 0xd4, 0xff, 0x94, 0xff, 0x52, 0xfe, 0xd0, 0xfc, 0xaf, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0xb0, 0xfb, 0xb0, 0xfb, 0xb0, 0xfb, 0x10, 0xfc, 0x10, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xad, 0x6c, 0x95, 0xe9, 0x84, 0x4a, 0x95, 0x6e, 0xc6, 0x93, 0xf7, 0xf4, 0xff, 0x33, 0xff, 0x91, 0xfd, 0x2f, 0xfc, 0x6f, 0xfb, 0x4e, 0xfb, 0x4f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6e, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0xd0, 0xfb, 0x72, 0xfc, 0x94, 0xfc, 0x10, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x9d, 0x2b, 0x8d, 0x09, 0x85, 0xab, 0x9d, 0xd0, 0xd6, 0xd4, 0xff, 0xd4, 0xff, 0xb3, 0xfe, 0xf0, 0xfc, 0xaf, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0xd0, 0xfb, 0x11, 0xfc, 0x31, 0xfc, 0x53, 0xfc, 0x10, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x85, 0x09, 0x85, 0x29, 0x8d, 0x0c, 0xae, 0x31, 0xe7, 0xf5, 0xff, 0x94, 0xff, 0x12, 0xfe, 0x50, 0xfc, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0xaf, 0xfb, 0xd0, 0xfb, 0xf0, 0xfb, 0x11, 0xfc, 0xd1, 0xfb, 0x10, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x86, 0x09, 0x85, 0x09, 0x85, 0x6a, 0x95, 0x6e, 0xc6, 0x93, 0xf7, 0xd5, 0xff, 0xf3, 0xfe, 0x71, 0xfd, 0xef, 0xfb, 0x2e, 0xfb, 0x2e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0xaf, 0xfb, 0xaf, 0xfb, 0xf1, 0xfb, 0x74, 0xfc, 0xda, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6d, 0x8d, 0xe9, 0x7c, 0x09, 0x85, 0xac, 0xa5, 0xd0, 0xd6, 0xb3, 0xf7, 0xb4, 0xff, 0x73, 0xfe, 0xf0, 0xfc, 0xaf, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0xd0, 0xfb, 0x32, 0xfc, 0x93, 0xfc, 0xb3, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0x87, 0x6c, 0x8d, 0xe8, 0x7c, 0x29, 0x8d, 0xed, 0xb5, 0x31, 0xe7, 0xf4, 0xff, 0x74, 0xff, 0xf2, 0xfd, 0x70, 0xfc, 0x8f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x4e, 0xf3, 0x4e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0xd0, 0xfb, 0xf0, 0xfb, 0x31, 0xfc, 0x51, 0xfc, 0x10, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb0, 0xae, 0x6c, 0x95, 0xe9, 0x7c, 0x49, 0x8d, 0x2e, 0xbe, 0x72, 0xef, 0xf4, 0xff, 0x33, 0xff, 0x71, 0xfd, 0x0f, 0xfc, 0x6f, 0xfb, 0x4e, 0xfb, 0x4f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x2e, 0xeb, 0xed, 0xd2, 0xcc, 0xba, 0xab, 0xb2, 0xcc, 0xc2, 0x0d, 0xe3, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0xaf, 0xfb, 0xd0, 0xfb, 0xf0, 0xfb, 0x11, 0xfc, 0x71, 0xfc, 0x10, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x13, 0xae, 0x6d, 0x95, 0x09, 0x7d, 0x49, 0x95, 0x6f, 0xc6, 0xb3, 0xf7, 0xf4, 0xff, 0xf3, 0xfe, 0x11, 0xfd, 0xaf, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x2e, 0xeb, 0xcc, 0xba, 0x49, 0x82, 0xe8, 0x59, 0xc7, 0x49, 0x29, 0x72, 0xab, 0xb2, 0x2e, 0xeb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0xaf, 0xfb, 0xd0, 0xfb, 0x90, 0xfb, 0x53, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf1, 0xad, 0x6c, 0x95, 0xe9, 0x7c, 0x6a, 0x95, 0xaf, 0xce, 0xb4, 0xff, 0xd4, 0xff, 0xb3, 0xfe, 0xd0, 0xfc, 0x8f, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0xed, 0xd2, 0x4a, 0x8a, 0xa7, 0x41, 0x45, 0x19, 0x65, 0x21, 0xe8, 0x59, 0xab, 0xaa, 0x2e, 0xeb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x90, 0xfb, 0x10, 0xfc, 0x75, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x6d, 0x9d, 0x0b, 0x85, 0xe9, 0x84, 0xab, 0x9d, 0xd0, 0xd6, 0xd4, 0xff, 0xb4, 0xff, 0x52, 0xfe, 0x70, 0xfc, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xf3, 0xcc, 0xc2, 0x29, 0x72, 0x86, 0x39, 0x65, 0x21, 0xa7, 0x41, 0x49, 0x82, 0xed, 0xca, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0xf1, 0xfb, 0x31, 0xfc, 0x53, 0xfc, 0x75, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xea, 0x7c, 0xe8, 0x7c, 0xe9, 0x84, 0xcc, 0xa5, 0x11, 0xdf, 0xd4, 0xff, 0x74, 0xff, 0x12, 0xfe, 0x50, 0xfc, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xf3, 0xec, 0xca, 0x6a, 0x92, 0x08, 0x6a, 0x08, 0x62, 0x4a, 0x8a, 0xcc, 0xc2, 0x4e, 0xf3, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0xaf, 0xfb, 0xd0, 0xfb, 0x11, 0xfc, 0x11, 0xfc, 0x10, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe7, 0x7c, 0xc7, 0x7c, 0x09, 0x85, 0xec, 0xad, 0x31, 0xe7, 0xd4, 0xff, 0x54, 0xff, 0xd1, 0xfd, 0x0f, 0xfc, 0x2e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x2e, 0xeb, 0x0d, 0xd3, 0xcc, 0xba, 0xcc, 0xba, 0x0d, 0xdb, 0x4e, 0xf3, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0xb0, 0xfb, 0xd0, 0xfb, 0x52, 0xfc, 0xd3, 0xfc, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x86, 0x74, 0xc7, 0x7c, 0x29, 0x8d, 0x0d, 0xb6, 0x52, 0xe7, 0xd4, 0xff, 0x34, 0xff, 0xb1, 0xfd, 0xef, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0xaf, 0xfb, 0xf0, 0xfb, 0x32, 0xfc, 0x72, 0xfc, 0xb2, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x7d, 0xe8, 0x7c, 0x29, 0x8d, 0x2d, 0xb6, 0x52, 0xe7, 0xd4, 0xff, 0x13, 0xff, 0x71, 0xfd, 0xef, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0xaf, 0xfb, 0xb0, 0xfb, 0xd0, 0xfb, 0xd0, 0xfb, 0xd1, 0xfb, 0xd3, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x10, 0xc6, 0x8c, 0x95, 0x2a, 0x8d, 0x4a, 0x8d, 0x2d, 0xb6, 0x52, 0xef, 0xd4, 0xff, 0xf3, 0xfe, 0x71, 0xfd, 0xef, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xf3, 0x0d, 0xdb, 0xec, 0xca, 0xec, 0xca, 0x0d, 0xdb, 0x4e, 0xf3, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0xaf, 0xfb, 0xb0, 0xfb, 0xf1, 0xfb, 0x32, 0xfc, 0x92, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0x94, 0xbe, 0xae, 0x9d, 0x4b, 0x8d, 0x4a, 0x95, 0x2d, 0xb6, 0x52, 0xef, 0xd4, 0xff, 0xf3, 0xfe, 0x51, 0xfd, 0xcf, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xf3, 0xed, 0xca, 0x6a, 0x92, 0x29, 0x72, 0x29, 0x7a, 0xab, 0xaa, 0x2d, 0xe3, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xf3, 0x2d, 0xe3, 0x2d, 0xe3, 0x4e, 0xf3, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0xf0, 0xfb, 0xd2, 0xfc, 0x73, 0xfe, 0xf6, 0xff, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0x52, 0xae, 0x8d, 0x9d, 0x4b, 0x8d, 0x4a, 0x95, 0x2d, 0xb6, 0x52, 0xef, 0xd4, 0xff, 0xf3, 0xfe, 0x71, 0xfd, 0xcf, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x0d, 0xd3, 0x6a, 0x92, 0xc7, 0x49, 0x86, 0x31, 0xc7, 0x49, 0x6a, 0x92, 0x2d, 0xe3, 0x8f, 0xfb, 0x8f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x0d, 0xdb, 0xab, 0xaa, 0x8a, 0x9a, 0xcc, 0xba, 0x2d, 0xe3, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0xf0, 0xfb, 0x31, 0xfd, 0xb3, 0xfe, 0xf5, 0xff, 0xf5, 0xff, 0xd1, 0xde, 0x70, 0xb6, 0x10, 0xa6, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x10, 0x84, 0x2a, 0x8d, 0x09, 0x85, 0x4a, 0x8d, 0x2d, 0xb6, 0x52, 0xef, 0xd4, 0xff, 0xf3, 0xfe, 0x71, 0xfd, 0xef, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x2e, 0xeb, 0x8b, 0xa2, 0xc7, 0x59, 0x65, 0x21, 0x65, 0x21, 0xe8, 0x51, 0x8b, 0xa2, 0x2e, 0xeb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x4e, 0xeb, 0x2e, 0xeb, 0x4e, 0xf3, 0x4e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0xcc, 0xba, 0x08, 0x72, 0xc7, 0x49, 0x08, 0x6a, 0xab, 0xaa, 0x2d, 0xe3, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x2e, 0xfb, 0x8f, 0xfb, 0x90, 0xfc, 0xf2, 0xfd, 0x54, 0xff, 0xf4, 0xff, 0xd4, 0xff, 0xb0, 0xd6, 0xcd, 0xa5, 0x6c, 0x8d, 0x8d, 0x9d, 0xf0, 0x87, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa7, 0x7c, 0xc7, 0x7c, 0x29, 0x8d, 0x2d, 0xb6, 0x52, 0xef, 0xd4, 0xff, 0x13, 0xff, 0x91, 0xfd, 0xef, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x2d, 0xe3, 0x6a, 0x9a, 0xc7, 0x49, 0x66, 0x29, 0xa7, 0x41, 0x49, 0x82, 0xec, 0xca, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x2e, 0xeb, 0xcc, 0xba, 0xab, 0xaa, 0xcc, 0xc2, 0x2d, 0xe3, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0xab, 0xb2, 0xc7, 0x51, 0x45, 0x19, 0x66, 0x29, 0x09, 0x6a, 0xcc, 0xc2, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x0f, 0xfc, 0x71, 0xfd, 0xf3, 0xfe, 0xb4, 0xff, 0xd4, 0xff, 0x52, 0xef, 0x4e, 0xc6, 0x6b, 0x95, 0x0a, 0x85, 0x4b, 0x8d, 0x6d, 0x9e, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa7, 0x74, 0xc7, 0x74, 0x29, 0x8d, 0x2d, 0xb6, 0x52, 0xe7, 0xd4, 0xff, 0x34, 0xff, 0xb1, 0xfd, 0x0f, 0xfc, 0x2e, 0xfb, 0x2e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x2e, 0xeb, 0xab, 0xb2, 0x29, 0x7a, 0xe8, 0x61, 0x49, 0x7a, 0xcc, 0xba, 0x4e, 0xf3, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0xec, 0xc2, 0x29, 0x7a, 0xe8, 0x59, 0x29, 0x7a, 0xcc, 0xba, 0x4e, 0xf3, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0xec, 0xc2, 0x08, 0x6a, 0x65, 0x21, 0x45, 0x11, 0xc7, 0x49, 0x8b, 0xa2, 0x2e, 0xeb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4f, 0xfb, 0xaf, 0xfb, 0xd0, 0xfc, 0x72, 0xfe, 0xb4, 0xff, 0xf5, 0xff, 0x93, 0xf7, 0xb0, 0xd6, 0xcc, 0xa5, 0x09, 0x85, 0xe8, 0x7c, 0x0a, 0x85, 0x2c, 0x8d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xa7, 0x74, 0xc7, 0x7c, 0x09, 0x85, 0x0d, 0xae, 0x31, 0xe7, 0xf4, 0xff, 0x74, 0xff, 0xf2, 0xfd, 0x2f, 0xfc, 0x2e, 0xfb, 0x2e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x0d, 0xdb, 0xcc, 0xba, 0xab, 0xaa, 0xcc, 0xc2, 0x2e, 0xeb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xeb, 0x8b, 0xa2, 0xc7, 0x41, 0x65, 0x21, 0xc7, 0x49, 0x6a, 0x9a, 0x2d, 0xe3, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x0d, 0xdb, 0x8a, 0x9a, 0xc7, 0x51, 0x86, 0x31, 0xe8, 0x51, 0x8b, 0xaa, 0x2e, 0xeb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x2e, 0xfb, 0x8f, 0xfb, 0x90, 0xfc, 0xf2, 0xfd, 0x53, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0x11, 0xe7, 0x0d, 0xb6, 0x29, 0x8d, 0xc7, 0x7c, 0xc8, 0x7c, 0x09, 0x85, 0x6b, 0x95, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xe7, 0x7c, 0xe8, 0x7c, 0x09, 0x85, 0xcc, 0xad, 0x11, 0xdf, 0xf4, 0xff, 0x94, 0xff, 0x52, 0xfe, 0x70, 0xfc, 0x6e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x4e, 0xf3, 0x4e, 0xeb, 0x4e, 0xf3, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x2d, 0xe3, 0x6a, 0x92, 0xa6, 0x39, 0x45, 0x19, 0xa6, 0x41, 0x6a, 0x92, 0x0d, 0xe3, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xf3, 0xed, 0xca, 0x8b, 0x9a, 0x29, 0x7a, 0x6a, 0x8a, 0xec, 0xca, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x50, 0xfc, 0xd1, 0xfd, 0x33, 0xff, 0xd4, 0xff, 0xd4, 0xff, 0x72, 0xef, 0x6f, 0xc6, 0x6a, 0x95, 0xc8, 0x7c, 0xc7, 0x74, 0xe8, 0x7c, 0x09, 0x85, 0x6b, 0x8d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x2b, 0x95, 0x0a, 0x85, 0x09, 0x85, 0xab, 0xa5, 0xd0, 0xde, 0xd4, 0xff, 0xd4, 0xff, 0x92, 0xfe, 0xd0, 0xfc, 0x8f, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x2d, 0xe3, 0x8a, 0x9a, 0xc7, 0x49, 0x86, 0x31, 0xc7, 0x51, 0x8b, 0xa2, 0x2d, 0xe3, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xf3, 0x0d, 0xdb, 0xec, 0xc2, 0xec, 0xca, 0x2e, 0xeb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x0f, 0xfc, 0x51, 0xfd, 0xd3, 0xfe, 0xd4, 0xff, 0xf5, 0xff, 0x93, 0xf7, 0xd0, 0xd6, 0xcc, 0xa5, 0x09, 0x85, 0xa7, 0x74, 0xa7, 0x74, 0xe8, 0x84, 0x2a, 0x85, 0x6c, 0x95, 0x73, 0x9e, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xce, 0x95, 0x2b, 0x8d, 0xe9, 0x7c, 0x6a, 0x9d, 0xaf, 0xd6, 0xd4, 0xff, 0xf4, 0xff, 0xf3, 0xfe, 0x31, 0xfd, 0xcf, 0xfb, 0x6f, 0xfb, 0x4f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xf3, 0xcc, 0xba, 0x29, 0x72, 0xe8, 0x59, 0x49, 0x82, 0xcc, 0xc2, 0x4e, 0xf3, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x4e, 0xf3, 0x4e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0xef, 0xfb, 0x31, 0xfd, 0x92, 0xfe, 0x94, 0xff, 0xf4, 0xff, 0xd4, 0xff, 0x11, 0xe7, 0x0d, 0xb6, 0x29, 0x8d, 0xe8, 0x7c, 0xc8, 0x74, 0xc7, 0x74, 0xe9, 0x84, 0x4b, 0x8d, 0xad, 0x9d, 0x73, 0xb6, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x31, 0xa6, 0x4c, 0x95, 0xe9, 0x7c, 0x4a, 0x95, 0x6f, 0xc6, 0x93, 0xf7, 0xf4, 0xff, 0x33, 0xff, 0xb1, 0xfd, 0x2f, 0xfc, 0x6f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x2d, 0xe3, 0xab, 0xb2, 0x8b, 0xa2, 0xcc, 0xba, 0x2d, 0xe3, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0xcf, 0xfb, 0xf0, 0xfc, 0x72, 0xfe, 0x94, 0xff, 0xf4, 0xff, 0xd4, 0xff, 0x52, 0xef, 0x6e, 0xc6, 0x6a, 0x95, 0xe8, 0x7c, 0xe8, 0x7c, 0x08, 0x85, 0xe7, 0x84, 0x08, 0x85, 0x6b, 0x95, 0xae, 0x9d, 0x34, 0xb6, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x52, 0xae, 0x6d, 0x95, 0xe9, 0x7c, 0x29, 0x8d, 0x2e, 0xbe, 0x52, 0xef, 0xf4, 0xff, 0x94, 0xff, 0x52, 0xfe, 0xd0, 0xfc, 0xaf, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x2e, 0xeb, 0x2e, 0xeb, 0x4e, 0xf3, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0xaf, 0xfb, 0xf0, 0xfc, 0x32, 0xfe, 0x53, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x72, 0xf7, 0x8f, 0xce, 0x8b, 0x9d, 0xe9, 0x7c, 0xe8, 0x7c, 0x28, 0x8d, 0x67, 0x95, 0x47, 0x95, 0x48, 0x95, 0x6b, 0x95, 0xae, 0x9d, 0x13, 0xc6, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x10, 0xc6, 0x8c, 0x95, 0xe9, 0x7c, 0x09, 0x85, 0xec, 0xad, 0x11, 0xdf, 0xd4, 0xff, 0xd4, 0xff, 0xf3, 0xfe, 0x71, 0xfd, 0xef, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0xaf, 0xfb, 0xb0, 0xfc, 0x12, 0xfe, 0x53, 0xff, 0xd4, 0xff, 0xf4, 0xff, 0x93, 0xff, 0xd0, 0xd6, 0xcc, 0xa5, 0x09, 0x85, 0xc8, 0x7c, 0x28, 0x8d, 0xa7, 0xa5, 0xc7, 0xad, 0x87, 0x9d, 0x48, 0x95, 0x4a, 0x8d, 0x6c, 0x95, 0xb0, 0xae, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x2c, 0x8d, 0xe9, 0x7c, 0x09, 0x85, 0x8b, 0x9d, 0xaf, 0xce, 0x93, 0xf7, 0xf5, 0xff, 0x94, 0xff, 0x12, 0xfe, 0x70, 0xfc, 0x6f, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0xaf, 0xfb, 0xb0, 0xfc, 0xf2, 0xfd, 0x13, 0xff, 0xd4, 0xff, 0xf5, 0xff, 0xb4, 0xff, 0xf1, 0xde, 0x0d, 0xb6, 0x29, 0x8d, 0xc8, 0x7c, 0xe7, 0x84, 0x87, 0x9d, 0x07, 0xb6, 0x07, 0xb6, 0x87, 0x9d, 0x28, 0x8d, 0x08, 0x85, 0x0a, 0x7d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x95, 0x09, 0x85, 0x09, 0x85, 0x4a, 0x8d, 0x2d, 0xbe, 0x32, 0xef, 0xf5, 0xff, 0xd4, 0xff, 0xd3, 0xfe, 0x11, 0xfd, 0xcf, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x70, 0xfc, 0xf1, 0xfd, 0x13, 0xff, 0xd4, 0xff, 0xf5, 0xff, 0xd4, 0xff, 0x11, 0xe7, 0x2d, 0xbe, 0x4a, 0x95, 0xe8, 0x7c, 0xe8, 0x7c, 0x47, 0x8d, 0xc7, 0xad, 0x26, 0xbe, 0x07, 0xb6, 0x67, 0x95, 0xe8, 0x7c, 0xc7, 0x7c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x8d, 0x09, 0x85, 0x09, 0x85, 0xab, 0xa5, 0xf0, 0xde, 0xd4, 0xff, 0xf4, 0xff, 0x53, 0xff, 0x12, 0xfe, 0xb0, 0xfc, 0x8f, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x4e, 0xfb, 0x2e, 0xfb, 0x8f, 0xfb, 0x90, 0xfc, 0xd1, 0xfd, 0xf3, 0xfe, 0xd4, 0xff, 0xf5, 0xff, 0xb4, 0xff, 0x32, 0xe7, 0x4e, 0xc6, 0x6a, 0x95, 0xe8, 0x7c, 0xa8, 0x74, 0x08, 0x85, 0x87, 0x9d, 0x07, 0xb6, 0x26, 0xbe, 0xe7, 0xad, 0x48, 0x8d, 0xc8, 0x7c, 0xc8, 0x7c, 0xe7, 0x7c, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x9d, 0x2a, 0x85, 0xe8, 0x7c, 0x6a, 0x95, 0x6f, 0xce, 0x93, 0xf7, 0xf4, 0xff, 0xb4, 0xff, 0x13, 0xff, 0xb1, 0xfd, 0x2f, 0xfc, 0x4e, 0xfb, 0x2e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0xaf, 0xfb, 0x70, 0xfc, 0xd1, 0xfd, 0xf3, 0xfe, 0xb4, 0xff, 0xf5, 0xff, 0xd4, 0xff, 0x32, 0xe7, 0x4e, 0xbe, 0x8b, 0x9d, 0x08, 0x85, 0xc8, 0x74, 0xc8, 0x74, 0x28, 0x8d, 0x87, 0x9d, 0x07, 0xb6, 0x26, 0xbe, 0xc7, 0xad, 0x47, 0x8d, 0xe8, 0x7c, 0x0a, 0x85, 0x2b, 0x85, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb5, 0x4c, 0x8d, 0xe8, 0x7c, 0x09, 0x85, 0xed, 0xad, 0x11, 0xdf, 0xb4, 0xff, 0xf5, 0xff, 0xb4, 0xff, 0xb2, 0xfe, 0x31, 0xfd, 0xef, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6e, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0xaf, 0xfb, 0xb0, 0xfc, 0xf2, 0xfd, 0x13, 0xff, 0xb4, 0xff, 0xf5, 0xff, 0xd4, 0xff, 0x32, 0xef, 0x6e, 0xc6, 0x6b, 0x9d, 0xe8, 0x7c, 0xc8, 0x7c, 0xc8, 0x7c, 0xc8, 0x7c, 0x08, 0x85, 0x87, 0x9d, 0x07, 0xb6, 0x46, 0xc6, 0x06, 0xb6, 0x67, 0x9d, 0x29, 0x8d, 0x4c, 0x8d, 0xce, 0x95, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x8e, 0x95, 0x0a, 0x85, 0x09, 0x85, 0x6b, 0x9d, 0x4e, 0xc6, 0x52, 0xef, 0xf5, 0xff, 0xf5, 0xff, 0x73, 0xff, 0x52, 0xfe, 0xf0, 0xfc, 0xcf, 0xfb, 0x4e, 0xfb, 0x2e, 0xfb, 0x6e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4f, 0xfb, 0x4e, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0xef, 0xfb, 0xd0, 0xfc, 0x12, 0xfe, 0x33, 0xff, 0xd4, 0xff, 0xf5, 0xff, 0xb4, 0xff, 0x32, 0xef, 0x6e, 0xc6, 0xab, 0x9d, 0x08, 0x85, 0xe7, 0x7c, 0xe8, 0x7c, 0xe8, 0x7c, 0xc8, 0x7c, 0xe8, 0x7c, 0x47, 0x95, 0xe7, 0xad, 0x66, 0xc6, 0x26, 0xbe, 0xa7, 0x9d, 0x49, 0x95, 0x8d, 0x9d, 0x91, 0xa5, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xa6, 0x6c, 0x95, 0x0a, 0x85, 0x09, 0x85, 0xab, 0xa5, 0xd0, 0xd6, 0xb4, 0xff, 0xd4, 0xff, 0xd4, 0xff, 0x73, 0xff, 0x52, 0xfe, 0xd0, 0xfc, 0xcf, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6e, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x2e, 0xfb, 0x2e, 0xfb, 0xaf, 0xfb, 0x50, 0xfc, 0x71, 0xfd, 0x72, 0xfe, 0x33, 0xff, 0xd4, 0xff, 0xf5, 0xff, 0xd4, 0xff, 0x31, 0xe7, 0x4e, 0xc6, 0x8b, 0x9d, 0x28, 0x8d, 0x27, 0x8d, 0x47, 0x95, 0x28, 0x85, 0xe8, 0x7c, 0xc8, 0x7c, 0xe8, 0x7c, 0x48, 0x8d, 0xc7, 0xad, 0x46, 0xc6, 0x26, 0xbe, 0xa7, 0xa5, 0x69, 0x95, 0x8d, 0x9d, 0x10, 0xa6, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0xa5, 0x2b, 0x8d, 0xe8, 0x7c, 0x29, 0x8d, 0x2d, 0xb6, 0x11, 0xe7, 0xb4, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0x53, 0xff, 0x12, 0xfe, 0xf0, 0xfc, 0xef, 0xfb, 0x6f, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0xaf, 0xfb, 0x0f, 0xfc, 0xd0, 0xfc, 0xb1, 0xfd, 0xd3, 0xfe, 0x94, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x93, 0xff, 0xf1, 0xe6, 0x4e, 0xbe, 0x8b, 0x95, 0x08, 0x85, 0x27, 0x8d, 0xa7, 0xa5, 0xc7, 0xa5, 0x48, 0x95, 0xe8, 0x7c, 0xe8, 0x7c, 0x08, 0x85, 0x67, 0x9d, 0x07, 0xb6, 0x66, 0xc6, 0x26, 0xbe, 0x87, 0x9d, 0x49, 0x95, 0x8d, 0x9d, 0x75, 0xad, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xad, 0x4c, 0x8d, 0xe9, 0x7c, 0xe8, 0x7c, 0x6a, 0x95, 0x4e, 0xc6, 0x52, 0xef, 0xf4, 0xff, 0xf4, 0xff, 0xb4, 0xff, 0x53, 0xff, 0x72, 0xfe, 0x31, 0xfd, 0x0f, 0xfc, 0x6f, 0xfb, 0x2e, 0xfb, 0x2e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x2e, 0xfb, 0x2e, 0xfb, 0x6f, 0xfb, 0xef, 0xfb, 0xb0, 0xfc, 0x91, 0xfd, 0x72, 0xfe, 0x33, 0xff, 0xb4, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0x93, 0xf7, 0xd0, 0xd6, 0x0d, 0xb6, 0x4a, 0x8d, 0xe8, 0x7c, 0xe8, 0x84, 0x67, 0x9d, 0x06, 0xb6, 0x07, 0xb6, 0x68, 0x95, 0xe8, 0x84, 0x08, 0x85, 0x87, 0x9d, 0xe7, 0xad, 0x46, 0xbe, 0x46, 0xc6, 0xe7, 0xad, 0x68, 0x95, 0x4a, 0x8d, 0x8d, 0x9d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x9d, 0x4b, 0x8d, 0x09, 0x85, 0x09, 0x85, 0xab, 0x9d, 0xaf, 0xce, 0x73, 0xf7, 0xb4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x74, 0xff, 0x72, 0xfe, 0x71, 0xfd, 0x70, 0xfc, 0xcf, 0xfb, 0x6f, 0xfb, 0x4e, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4f, 0xfb, 0x4f, 0xfb, 0x4f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4f, 0xfb, 0x4f, 0xfb, 0x4f, 0xfb, 0x4f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4f, 0xfb, 0x6f, 0xfb, 0xaf, 0xfb, 0xef, 0xfb, 0x90, 0xfc, 0x31, 0xfd, 0x32, 0xfe, 0xf3, 0xfe, 0xb4, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xb4, 0xff, 0x32, 0xef, 0xb0, 0xd6, 0xec, 0xad, 0x4a, 0x8d, 0xe8, 0x7c, 0xe8, 0x7c, 0x47, 0x95, 0xe7, 0xad, 0x46, 0xc6, 0x07, 0xb6, 0x67, 0x9d, 0x28, 0x8d, 0x87, 0x9d, 0xe7, 0xb5, 0x46, 0xbe, 0x46, 0xbe, 0xe6, 0xad, 0x87, 0x9d, 0x49, 0x8d, 0x4b, 0x8d, 0xcd, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x9d, 0x2b, 0x8d, 0xe9, 0x7c, 0x09, 0x85, 0xac, 0xa5, 0xb0, 0xce, 0x73, 0xf7, 0xd4, 0xff, 0xf4, 0xff, 0xd4, 0xff, 0x74, 0xff, 0xf3, 0xfe, 0x12, 0xfe, 0x31, 0xfd, 0x50, 0xfc, 0xaf, 0xfb, 0x4e, 0xfb, 0x2e, 0xfb, 0x2e, 0xfb, 0x2e, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4f, 0xfb, 0x4f, 0xfb, 0x4f, 0xfb, 0x4f, 0xfb, 0x4f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x2e, 0xfb, 0x2e, 0xfb, 0x2e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0xcf, 0xfb, 0x30, 0xfc, 0xd0, 0xfc, 0x91, 0xfd, 0x52, 0xfe, 0xf3, 0xfe, 0x73, 0xff, 0xb4, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0x93, 0xf7, 0x11, 0xe7, 0x4e, 0xbe, 0xab, 0xa5, 0x49, 0x8d, 0x08, 0x85, 0x07, 0x85, 0x47, 0x95, 0xc7, 0xa5, 0x26, 0xbe, 0x46, 0xc6, 0x07, 0xb6, 0x87, 0x9d, 0x87, 0x9d, 0xe7, 0xb5, 0x46, 0xc6, 0x46, 0xc6, 0xe7, 0xb5, 0x67, 0x9d, 0x28, 0x8d, 0x2a, 0x8d, 0x6c, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x9e, 0x4c, 0x95, 0xe9, 0x84, 0xc8, 0x7c, 0x09, 0x85, 0xac, 0xa5, 0x8f, 0xce, 0x52, 0xef, 0xb4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xd4, 0xff, 0x53, 0xff, 0x92, 0xfe, 0xb1, 0xfd, 0xf0, 0xfc, 0x50, 0xfc, 0xef, 0xfb, 0xaf, 0xfb, 0x8f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x4f, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x6f, 0xfb, 0x8f, 0xfb, 0x8f, 0xfb, 0xcf, 0xfb, 0xef, 0xfb, 0x30, 0xfc, 0x90, 0xfc, 0x11, 0xfd, 0x91, 0xfd, 0x52, 0xfe, 0xf3, 0xfe, 0x94, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0x93, 0xff, 0x32, 0xef, 0xb0, 0xd6, 0x2d, 0xbe, 0xaa, 0xa5, 0x68, 0x95, 0x67, 0x95, 0x67, 0x9d, 0xa7, 0xa5, 0xe7, 0xad, 0x26, 0xbe, 0x46, 0xbe, 0x07, 0xb6, 0xa7, 0xa5, 0x87, 0x9d, 0xc7, 0xad, 0x46, 0xc6, 0x66, 0xc6, 0x07, 0xb6, 0x87, 0x9d, 0x07, 0x85, 0x09, 0x85, 0x4b, 0x8d, 0xcf, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x86, 0x29, 0x85, 0xe8, 0x7c, 0xc8, 0x7c, 0x09, 0x85, 0x8b, 0x9d, 0x6e, 0xc6, 0x32, 0xe7, 0xb4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xd4, 0xff, 0x94, 0xff, 0x13, 0xff, 0xb2, 0xfe, 0x12, 0xfe, 0x91, 0xfd, 0x11, 0xfd, 0xb0, 0xfc, 0x50, 0xfc, 0x2f, 0xfc, 0x0f, 0xfc, 0xef, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb, 0xef, 0xfb, 0x0f, 0xfc, 0x2f, 0xfc, 0x70, 0xfc, 0xb0, 0xfc, 0x11, 0xfd, 0x91, 0xfd, 0xf2, 0xfd, 0x52, 0xfe, 0xd3, 0xfe, 0x33, 0xff, 0x74, 0xff, 0xd4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xd4, 0xff, 0x73, 0xf7, 0xf0, 0xde, 0x4e, 0xbe, 0xab, 0xa5, 0x89, 0x9d, 0xa7, 0xa5, 0xc6, 0xad, 0xe6, 0xb5, 0x26, 0xbe, 0x26, 0xbe, 0x46, 0xc6, 0x46, 0xc6, 0x06, 0xb6, 0xa7, 0xa5, 0x67, 0x95, 0x87, 0x9d, 0x07, 0xb6, 0x66, 0xc6, 0x46, 0xc6, 0xa7, 0xa5, 0x27, 0x8d, 0xe8, 0x7c, 0xe9, 0x84, 0x4c, 0x95, 0xf0, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x9c, 0xe9, 0x84, 0xe9, 0x7c, 0xc8, 0x7c, 0xe8, 0x84, 0x6a, 0x95, 0x4e, 0xbe, 0xf1, 0xde, 0x52, 0xf7, 0x93, 0xff, 0xd4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xd4, 0xff, 0x94, 0xff, 0x13, 0xff, 0x93, 0xfe, 0x12, 0xfe, 0xd2, 0xfd, 0x91, 0xfd, 0x71, 0xfd, 0x51, 0xfd, 0x31, 0xfd, 0x31, 0xfd, 0x31, 0xfd, 0x51, 0xfd, 0x71, 0xfd, 0x91, 0xfd, 0xd2, 0xfd, 0x32, 0xfe, 0x93, 0xfe, 0x13, 0xff, 0x74, 0xff, 0xb4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xd4, 0xff, 0x93, 0xff, 0x52, 0xf7, 0xf1, 0xe6, 0x8f, 0xce, 0xed, 0xad, 0x6a, 0x95, 0x28, 0x8d, 0x67, 0x95, 0xe6, 0xad, 0x46, 0xc6, 0x66, 0xc6, 0x46, 0xc6, 0x26, 0xbe, 0x06, 0xb6, 0xe7, 0xad, 0x87, 0x9d, 0x28, 0x8d, 0x28, 0x8d, 0x87, 0x9d, 0x27, 0xbe, 0x66, 0xc6, 0x06, 0xb6, 0x67, 0x95, 0x08, 0x85, 0x09, 0x85, 0x2b, 0x8d, 0x70, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x9c, 0x29, 0x85, 0xe9, 0x7c, 0xe8, 0x7c, 0xe8, 0x84, 0x49, 0x95, 0xcc, 0xa5, 0x6e, 0xc6, 0xf1, 0xde, 0x73, 0xf7, 0xd4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xd4, 0xff, 0x94, 0xff, 0x74, 0xff, 0x53, 0xff, 0x33, 0xff, 0x13, 0xff, 0xf3, 0xfe, 0xf3, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0xf3, 0xfe, 0x13, 0xff, 0x33, 0xff, 0x53, 0xff, 0x74, 0xff, 0xb4, 0xff, 0xd4, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xb3, 0xff, 0x52, 0xef, 0xd0, 0xd6, 0x6e, 0xc6, 0xec, 0xad, 0x6a, 0x95, 0x09, 0x85, 0x08, 0x85, 0x47, 0x95, 0xc6, 0xa5, 0x26, 0xbe, 0x66, 0xc6, 0x46, 0xc6, 0x07, 0xb6, 0xa7, 0xa5, 0x67, 0x95, 0x48, 0x8d, 0x08, 0x85, 0xc8, 0x7c, 0x08, 0x85, 0xa7, 0xa5, 0x26, 0xbe, 0x46, 0xc6, 0x06, 0xb6, 0x67, 0x95, 0x09, 0x85, 0x2b, 0x8d, 0x6d, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0x9c, 0x4b, 0x95, 0x2a, 0x8d, 0x09, 0x85, 0xe8, 0x7c, 0x08, 0x85, 0x6a, 0x9d, 0x0d, 0xb6, 0x8f, 0xce, 0xf1, 0xde, 0x52, 0xef, 0x73, 0xf7, 0xb3, 0xff, 0xd4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xd4, 0xff, 0x93, 0xf7, 0x73, 0xf7, 0x32, 0xef, 0xf1, 0xde, 0x90, 0xce, 0x4e, 0xbe, 0xcc, 0xad, 0x6b, 0x95, 0x09, 0x85, 0xc8, 0x74, 0xa8, 0x74, 0xe8, 0x84, 0x87, 0x9d, 0x27, 0xbe, 0x66, 0xce, 0x46, 0xc6, 0xe7, 0xad, 0x67, 0x9d, 0x28, 0x8d, 0x08, 0x85, 0x08, 0x85, 0xe8, 0x84, 0x08, 0x85, 0x47, 0x95, 0xe7, 0xad, 0x46, 0xbe, 0x46, 0xc6, 0xe7, 0xad, 0x89, 0x9d, 0x4b, 0x8d, 0x6d, 0x9d, 0x75, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x86, 0xad, 0x9d, 0x4c, 0x8d, 0x09, 0x85, 0xe8, 0x7c, 0xe8, 0x7c, 0x29, 0x8d, 0x6a, 0x95, 0xcc, 0xad, 0x2e, 0xbe, 0x8f, 0xce, 0xf0, 0xde, 0x31, 0xe7, 0x92, 0xef, 0xb3, 0xf7, 0xd4, 0xff, 0xd4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xf4, 0xff, 0xd4, 0xff, 0xd4, 0xff, 0xb3, 0xff, 0xb3, 0xf7, 0x93, 0xf7, 0x52, 0xef, 0x11, 0xdf, 0xd0, 0xd6, 0x8f, 0xc6, 0x2d, 0xb6, 0xcc, 0xa5, 0x6b, 0x95, 0x2a, 0x8d, 0x09, 0x85, 0xe8, 0x7c, 0xc8, 0x74, 0xa8, 0x74, 0xc8, 0x74, 0x27, 0x8d, 0xc7, 0xa5, 0x46, 0xc6, 0x66, 0xce, 0x26, 0xbe, 0x87, 0x9d, 0x28, 0x8d, 0x28, 0x85, 0x28, 0x8d, 0x67, 0x95, 0x87, 0x9d, 0x87, 0x9d, 0xc7, 0xad, 0x26, 0xbe, 0x46, 0xc6, 0x26, 0xbe, 0xc8, 0xad, 0xab, 0x9d, 0x8e, 0x9d, 0x10, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0xef, 0xa5, 0x6c, 0x95, 0x09, 0x85, 0xe9, 0x7c, 0xc8, 0x7c, 0xe8, 0x7c, 0x09, 0x85, 0x4a, 0x8d, 0x8b, 0x9d, 0xec, 0xad, 0x2d, 0xbe, 0x6f, 0xc6, 0x90, 0xce, 0xb0, 0xd6, 0xd1, 0xde, 0xf1, 0xde, 0xf1, 0xde, 0xf1, 0xde, 0xf1, 0xde, 0xf1, 0xde, 0xf1, 0xde, 0xd0, 0xd6, 0xb0, 0xd6, 0x8f, 0xce, 0x6f, 0xce, 0x2e, 0xbe, 0x0d, 0xb6, 0xcc, 0xa5, 0x8b, 0x9d, 0x4a, 0x8d, 0x09, 0x85, 0x08, 0x85, 0x07, 0x85, 0x27, 0x8d, 0x27, 0x8d, 0x28, 0x8d, 0x28, 0x8d, 0x48, 0x8d, 0xa7, 0x9d, 0x07, 0xb6, 0x66, 0xc6, 0x46, 0xc6, 0xe7, 0xad, 0x67, 0x95, 0x28, 0x8d, 0x67, 0x95, 0xc7, 0xa5, 0xe7, 0xb5, 0x07, 0xb6, 0x06, 0xb6, 0x06, 0xb6, 0x26, 0xbe, 0x27, 0xbe, 0xe8, 0xad, 0xca, 0xad, 0xcd, 0xa5, 0x10, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xa6, 0x8e, 0x95, 0x4b, 0x8d, 0x0a, 0x85, 0xe9, 0x7c, 0xc8, 0x7c, 0xe8, 0x7c, 0xe8, 0x7c, 0x09, 0x85, 0x29, 0x8d, 0x4a, 0x95, 0x6b, 0x95, 0x8b, 0x9d, 0xac, 0xa5, 0xac, 0xa5, 0xac, 0xa5, 0xcc, 0xa5, 0xcc, 0xa5, 0xcc, 0xa5, 0xac, 0xa5, 0xab, 0xa5, 0x8b, 0x9d, 0x8b, 0x9d, 0x6a, 0x95, 0x49, 0x8d, 0x29, 0x8d, 0x09, 0x85, 0xe8, 0x7c, 0xe8, 0x7c, 0x08, 0x85, 0x67, 0x95, 0xa7, 0xa5, 0xc6, 0xad, 0xc7, 0xad, 0xc7, 0xa5, 0xc7, 0xa5, 0xe7, 0xad, 0x26, 0xb6, 0x46, 0xc6, 0x46, 0xc6, 0x07, 0xb6, 0xa7, 0xa5, 0x67, 0x95, 0x87, 0x9d, 0xe7, 0xad, 0x46, 0xbe, 0x46, 0xc6, 0x46, 0xbe, 0x26, 0xbe, 0xe6, 0xb5, 0xe6, 0xad, 0xc8, 0xad, 0xcb, 0xad, 0xee, 0xad, 0x10, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0xaf, 0xad, 0x6c, 0x95, 0x2a, 0x8d, 0x09, 0x85, 0xe8, 0x7c, 0xe8, 0x7c, 0xc7, 0x7c, 0xc7, 0x7c, 0xc7, 0x7c, 0xe8, 0x7c, 0xe8, 0x84, 0x08, 0x85, 0x08, 0x85, 0x08, 0x85, 0x08, 0x85, 0x08, 0x85, 0xe8, 0x84, 0xe8, 0x7c, 0xe8, 0x7c, 0xc8, 0x7c, 0xc8, 0x7c, 0xc8, 0x74, 0xa8, 0x74, 0xa7, 0x74, 0xa8, 0x74, 0xc8, 0x7c, 0x28, 0x8d, 0x87, 0x9d, 0xe7, 0xb5, 0x47, 0xc6, 0x66, 0xc6, 0x46, 0xc6, 0x46, 0xc6, 0x26, 0xbe, 0x26, 0xbe, 0x46, 0xbe, 0x46, 0xbe, 0xe7, 0xb5, 0x87, 0x9d, 0x67, 0x95, 0x87, 0x9d, 0xe7, 0xb5, 0x46, 0xc6, 0x86, 0xce, 0x66, 0xc6, 0x27, 0xbe, 0xe7, 0xad, 0xa8, 0xa5, 0x88, 0x9d, 0xaa, 0x9d, 0xcc, 0xa5, 0x75, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x2e, 0x95, 0x4c, 0x8d, 0x2a, 0x8d, 0x29, 0x8d, 0x28, 0x8d, 0x27, 0x8d, 0x27, 0x8d, 0x27, 0x8d, 0x27, 0x8d, 0x27, 0x8d, 0x27, 0x8d, 0x27, 0x8d, 0x07, 0x85, 0xe8, 0x84, 0xe8, 0x7c, 0xc8, 0x7c, 0xc8, 0x74, 0xc8, 0x74, 0xc8, 0x74, 0xc8, 0x74, 0xc8, 0x7c, 0xc8, 0x74, 0xc8, 0x7c, 0x08, 0x85, 0x87, 0x9d, 0x07, 0xb6, 0x46, 0xc6, 0x66, 0xce, 0x66, 0xce, 0x66, 0xc6, 0x46, 0xc6, 0x26, 0xbe, 0x27, 0xbe, 0x07, 0xb6, 0xc7, 0xad, 0x68, 0x95, 0x28, 0x85, 0x28, 0x8d, 0xa7, 0xa5, 0x26, 0xbe, 0x66, 0xc6, 0x66, 0xc6, 0x46, 0xbe, 0xe8, 0xad, 0xaa, 0xa5, 0x8b, 0x95, 0x6c, 0x9d, 0xcc, 0xa5, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6d, 0x9e, 0xad, 0x9d, 0xab, 0x95, 0x89, 0x9d, 0xa8, 0x9d, 0xa7, 0xa5, 0xa7, 0xa5, 0xc7, 0xa5, 0xc7, 0xad, 0xc7, 0xad, 0xc7, 0xa5, 0x87, 0x9d, 0x27, 0x8d, 0xe8, 0x7c, 0xe8, 0x7c, 0xe8, 0x7c, 0x28, 0x85, 0x28, 0x8d, 0x48, 0x95, 0x48, 0x95, 0x48, 0x8d, 0x47, 0x95, 0x87, 0x9d, 0x06, 0xb6, 0x46, 0xc6, 0x66, 0xc6, 0x46, 0xc6, 0x26, 0xbe, 0x06, 0xb6, 0xc7, 0xad, 0xa7, 0xa5, 0xa7, 0xa5, 0x67, 0x9d, 0x47, 0x8d, 0x08, 0x85, 0x08, 0x85, 0x67, 0x95, 0xe7, 0xb5, 0x66, 0xc6, 0x66, 0xce, 0x46, 0xc6, 0x27, 0xbe, 0xe9, 0xad, 0x8c, 0x9d, 0x6f, 0x95, 0xd2, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xad, 0xe9, 0xad, 0x29, 0xbe, 0x49, 0xbe, 0x48, 0xbe, 0x48, 0xc6, 0x48, 0xc6, 0x27, 0xbe, 0xc7, 0xad, 0x47, 0x95, 0xe7, 0x7c, 0xe8, 0x7c, 0x28, 0x8d, 0x87, 0x9d, 0xc7, 0xa5, 0xe7, 0xad, 0xe6, 0xad, 0xc6, 0xad, 0xe6, 0xad, 0x06, 0xb6, 0x26, 0xbe, 0x65, 0xc6, 0x65, 0xc6, 0x25, 0xbe, 0xc6, 0xad, 0x67, 0x95, 0x27, 0x8d, 0x08, 0x85, 0x08, 0x85, 0x08, 0x85, 0xe8, 0x7c, 0xe8, 0x7c, 0x27, 0x8d, 0xa7, 0xa5, 0x27, 0xbe, 0x67, 0xce, 0x87, 0xce, 0x68, 0xc6, 0x49, 0xc6, 0x2b, 0xbe, 0x70, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xab, 0xde, 0x8a, 0xd6, 0xc9, 0xd6, 0xc9, 0xd6, 0xa9, 0xd6, 0x89, 0xce, 0x28, 0xb6, 0x89, 0x9d, 0x29, 0x8d, 0x29, 0x8d, 0x68, 0x9d, 0xe7, 0xad, 0x26, 0xbe, 0x46, 0xc6, 0x46, 0xc6, 0x47, 0xc6, 0x47, 0xc6, 0x67, 0xc6, 0x67, 0xc6, 0x67, 0xc6, 0x47, 0xc6, 0x07, 0xb6, 0x88, 0x9d, 0x28, 0x8d, 0xe8, 0x7c, 0xc8, 0x7c, 0xc8, 0x7c, 0xe9, 0x7c, 0xe9, 0x7c, 0x09, 0x85, 0x67, 0x95, 0xc7, 0xad, 0x47, 0xbe, 0x88, 0xce, 0x68, 0xd6, 0xa8, 0xc6, 0x08, 0xc6, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x0c, 0xe7, 0xcc, 0xce, 0x2c, 0xbe, 0xcd, 0xa5, 0x8d, 0x9d, 0xac, 0x9d, 0xe9, 0xad, 0x26, 0xbe, 0x45, 0xc6, 0x65, 0xce, 0x87, 0xce, 0x89, 0xce, 0x8a, 0xce, 0x8a, 0xce, 0x8a, 0xce, 0x89, 0xce, 0x49, 0xc6, 0x0a, 0xb6, 0xab, 0x9d, 0x4b, 0x8d, 0x0a, 0x85, 0xe9, 0x7c, 0xe9, 0x7c, 0x2b, 0x85, 0x4c, 0x8d, 0x6b, 0x95, 0xa8, 0xa5, 0xc6, 0xbd, 0xab, 0xde, 0x6b, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x75, 0xad, 0xd2, 0xbd, 0x31, 0xb6, 0xef, 0xad, 0x6b, 0xbe, 0x05, 0xc6, 0x45, 0xce, 0x86, 0xce, 0x89, 0xce, 0xcb, 0xce, 0xac, 0xd6, 0xac, 0xd6, 0xcc, 0xd6, 0x8c, 0xd6, 0x6c, 0xc6, 0x2d, 0xb6, 0xce, 0xa5, 0x8d, 0x9d, 0x4b, 0x8d, 0x08, 0x8d, 0x29, 0x85, 0x2b, 0x95, 0xcf, 0xa5, 0x70, 0xad, 0xf0, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xeb, 0xff, 0x10, 0xc6, 0x73, 0xd6, 0x73, 0xd6, 0x73, 0xd6, 0x73, 0xd6, 0x73, 0xd6, 0x73, 0xd6, 0x73, 0xd6, 0x75, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-const lv_image_dsc_t img_watermelon = {
-  .header.cf = LV_COLOR_FORMAT_RGB565,
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.w = 80,
-  .header.h = 80,
-  .data_size = 6400 * 2,
-  .data = img_watermelon_map,
-};
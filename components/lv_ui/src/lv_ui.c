@@ -1,5 +1,8 @@
 #include "lv_ui.h"
 #include "ui_private.h"
+#include "lvgl_mgr.h"
+#include "sd_io.h"
+#include "ui_assets.h"
 #include "esp_log.h"
 
 static const char *TAG = "lv_ui";
@@ -26,6 +29,7 @@ lv_obj_t * lbl_sd = NULL;
 lv_obj_t * lbl_disp_info = NULL;
 lv_obj_t * lbl_sys_info = NULL;
 lv_obj_t * lbl_fault = NULL;
+lv_obj_t * chart_vbat = NULL;
 
 static lv_timer_t * stats_timer = NULL;
 
@@ -62,6 +66,7 @@ void clear_current_view(void) {
     lbl_disp_info = NULL;
     lbl_sys_info = NULL;
     lbl_fault = NULL;
+    chart_vbat = NULL;
     
     cont_sd_files = NULL;
     cont_pmic_details = NULL;
@@ -74,9 +79,27 @@ void clear_current_view(void) {
     }
 }
 
+// File I/O completions run on the LVGL task, so callbacks can touch widgets directly
+static void ui_io_dispatch(void *arg) {
+    sd_io_dispatch();
+}
+
+static void ui_io_notify(void *arg) {
+    // If the post is lost, the stats timer still dispatches
+    if (lvgl_mgr_run_async(ui_io_dispatch, NULL) != ESP_OK) {
+        ESP_LOGW(TAG, "I/O completion not posted");
+    }
+}
+
 void lv_ui_init(void) {
     ESP_LOGI(TAG, "Initializing UI...");
 
+    if (sd_io_start(ui_io_notify, NULL) != ESP_OK) {
+        ESP_LOGE(TAG, "Async file I/O not available");
+    }
+    // Images and fonts from the storage partition; without it the UI uses fallbacks
+    ui_assets_init();
+
     // Restore PMIC settings from NVS at startup
     ui_pmic_restore_settings();
     
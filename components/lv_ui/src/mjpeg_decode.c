@@ -0,0 +1,1011 @@
+#include "mjpeg_decode.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include "jpeglib.h"
+#include "jerror.h"
+
+#define MJPEG_ALIGN         32      // as libjpeg-turbo's pools with SIMD
+#define MJPEG_TABLE_SEGS    8       // DQT and DHT segments a frame may have and still be cached
+#define MJPEG_TABLES_MAX    1024    // bytes of them
+#define MJPEG_ROWS_MAX      16      // rows asked of libjpeg per call
+#define MJPEG_M_SOF0        0xC0
+#define MJPEG_M_SOF1        0xC1
+#define MJPEG_M_DHT         0xC4
+#define MJPEG_M_JPG         0xC8
+#define MJPEG_M_DAC         0xCC
+#define MJPEG_M_SOS         0xDA
+#define MJPEG_M_DQT         0xDB
+#define MJPEG_M_DRI         0xDD
+
+// DHT segment with the standard tables of JPEG Annex K.3. AVI MJPEG frames may leave their
+// Huffman tables out and mean these.
+static const uint8_t mjpeg_std_dht[420] = {
+    0xff, 0xc4, 0x01, 0xa2, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+    0x0b, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00,
+    0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51,
+    0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52,
+    0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26,
+    0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5,
+    0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3,
+    0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda,
+    0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6,
+    0xf7, 0xf8, 0xf9, 0xfa, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+    0x0b, 0x11, 0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01,
+    0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07,
+    0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33,
+    0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19,
+    0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3,
+    0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba,
+    0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8,
+    0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6,
+    0xf7, 0xf8, 0xf9, 0xfa,
+};
+
+#if JPEG_LIB_VERSION >= 70
+#define MJPEG_DCT_H(comp)   ((comp)->DCT_h_scaled_size)
+#define MJPEG_DCT_V(comp)   ((comp)->DCT_v_scaled_size)
+#else
+#define MJPEG_DCT_H(comp)   ((comp)->DCT_scaled_size)
+#define MJPEG_DCT_V(comp)   ((comp)->DCT_scaled_size)
+#endif
+
+// YCbCr -> RGB in 16-bit fixed point, rounded as libjpeg's jdcolor.c does
+#define YCC_BITS            16
+#define YCC_HALF            (1 << (YCC_BITS - 1))
+#define YCC_FIX(x)          ((int32_t)((x) * (1 << YCC_BITS) + 0.5))
+
+// Error handling for libjpeg to prevent exit()
+typedef struct {
+    struct jpeg_error_mgr pub;
+    jmp_buf setjmp_buffer;
+} mjpeg_error_mgr_t;
+
+typedef struct {
+    const uint8_t *p;
+    uint32_t len;
+} mjpeg_range_t;
+
+// Source fed from a few pieces: the frame without the table segments the decoder already
+// holds, plus the standard DHT when the frame has none. After them the rest of the frame,
+// when the caller gave only its start, or the scan data of the bottom part of a split.
+typedef struct {
+    struct jpeg_source_mgr pub;
+    mjpeg_range_t range[MJPEG_TABLE_SEGS + 4];
+    uint8_t count;
+    uint8_t next;
+    mjpeg_more_t more;          // more.more NULL: the ranges are the whole frame
+    bool more_done;
+    uint8_t rst_shift;          // restart markers numbered this far ahead (a split's bottom part)
+} mjpeg_source_t;
+
+// Where a frame is cut for a split decode
+typedef struct {
+    uint32_t width;             // of the whole image
+    uint32_t height;
+    uint32_t row;               // first row of the bottom part
+    uint32_t sof;               // offset of the SOF segment
+    uint32_t head;              // bytes up to the scan data
+    uint32_t scan;              // scan data of the bottom part, after its restart marker
+    uint8_t shift;              // number of the first marker in it
+} mjpeg_split_t;
+
+struct mjpeg_decoder {
+    struct jpeg_decompress_struct cinfo;    // first: libjpeg's callbacks get it back from cinfo
+    mjpeg_error_mgr_t jerr;
+    mjpeg_source_t src;
+    // libjpeg's own allocator, for what the arena does not take
+    void *(*lib_alloc_small)(j_common_ptr cinfo, int pool_id, size_t size);
+    void *(*lib_alloc_large)(j_common_ptr cinfo, int pool_id, size_t size);
+    JSAMPARRAY (*lib_alloc_sarray)(j_common_ptr cinfo, int pool_id, JDIMENSION samples, JDIMENSION rows);
+    void (*lib_free_pool)(j_common_ptr cinfo, int pool_id);
+    // Image pool arena: everything a frame allocates, emptied when libjpeg frees the pool
+    uint8_t *arena_mem;
+    uint8_t *arena;             // arena_mem aligned
+    size_t arena_size;
+    size_t arena_used;
+    size_t arena_spill;         // asked beyond the arena this frame: it grows to fit
+    // DQT and DHT segments of the last frame, as loaded in cinfo
+    uint8_t tables[MJPEG_TABLES_MAX];
+    uint32_t tables_len;
+    bool tables_ok;
+    // Raw output: one iMCU row of Y, Cb and Cr from libjpeg, converted here
+    bool raw_enabled;
+    JSAMPARRAY raw[3];
+    uint8_t raw_hshift;         // chroma subsampling against Y, after DCT scaling
+    uint8_t raw_vshift;
+    uint32_t raw_lines;         // rows an iMCU row gives
+    uint32_t raw_count;         // rows in hand
+    uint32_t raw_next;          // next of them to convert
+    // Split decodes: the bottom part on the worker, by a decoder of its own
+    mjpeg_worker_t worker;
+    mjpeg_decoder_t *half;
+    uint8_t *half_head;         // the frame's markers up to the scan, its height cut
+    uint8_t *half_dst;
+    uint32_t half_y;
+    uint32_t half_width;
+    uint32_t half_rows;
+    bool half_ok;
+    mjpeg_rows_hook_t hook;     // rows of whole-frame decodes
+    mjpeg_decoder_stats_t stats;
+};
+
+static void ycc_init(void);
+
+static void mjpeg_error_exit(j_common_ptr cinfo) {
+    mjpeg_error_mgr_t *err = (mjpeg_error_mgr_t *)cinfo->err;
+    (*cinfo->err->output_message)(cinfo);
+    longjmp(err->setjmp_buffer, 1);
+}
+
+static void *arena_take(mjpeg_decoder_t *d, size_t size) {
+    size = (size + MJPEG_ALIGN - 1) & ~(size_t)(MJPEG_ALIGN - 1);
+    if (d->arena_used + size > d->arena_size) {
+        d->arena_spill += size;
+        d->stats.pool_allocs++;
+        return NULL;
+    }
+    void *p = d->arena + d->arena_used;
+    d->arena_used += size;
+    return p;
+}
+
+static void *mjpeg_alloc_small(j_common_ptr cinfo, int pool_id, size_t size) {
+    mjpeg_decoder_t *d = (mjpeg_decoder_t *)cinfo;
+    void *p = pool_id == JPOOL_IMAGE ? arena_take(d, size) : NULL;
+    return p ? p : d->lib_alloc_small(cinfo, pool_id, size);
+}
+
+static void *mjpeg_alloc_large(j_common_ptr cinfo, int pool_id, size_t size) {
+    mjpeg_decoder_t *d = (mjpeg_decoder_t *)cinfo;
+    void *p = pool_id == JPOOL_IMAGE ? arena_take(d, size) : NULL;
+    return p ? p : d->lib_alloc_large(cinfo, pool_id, size);
+}
+
+// libjpeg's own one takes its rows from its pools directly, not through alloc_large
+static JSAMPARRAY mjpeg_alloc_sarray(j_common_ptr cinfo, int pool_id, JDIMENSION samples, JDIMENSION rows) {
+    mjpeg_decoder_t *d = (mjpeg_decoder_t *)cinfo;
+    if (pool_id != JPOOL_IMAGE || d->cinfo.data_precision > 8) {
+        return d->lib_alloc_sarray(cinfo, pool_id, samples, rows);
+    }
+    // Rows padded the same way, the upsamplers may run past the end
+    size_t stride = ((size_t)samples + 2 * MJPEG_ALIGN - 1) & ~(size_t)(2 * MJPEG_ALIGN - 1);
+    JSAMPARRAY result = (JSAMPARRAY)mjpeg_alloc_small(cinfo, pool_id, rows * sizeof(JSAMPROW));
+    JSAMPROW ws = (JSAMPROW)mjpeg_alloc_large(cinfo, pool_id, stride * rows);
+    for (JDIMENSION i = 0; i < rows; i++) result[i] = ws + i * stride;
+    return result;
+}
+
+static void mjpeg_free_pool(j_common_ptr cinfo, int pool_id) {
+    mjpeg_decoder_t *d = (mjpeg_decoder_t *)cinfo;
+    if (pool_id == JPOOL_IMAGE) {
+        if (d->arena_spill) {
+            // Nothing in it is live any more: replace it with one that holds the whole frame
+            size_t size = d->arena_used + d->arena_spill;
+            free(d->arena_mem);
+            d->arena_mem = (uint8_t *)malloc(size + MJPEG_ALIGN);
+            d->arena = d->arena_mem ? (uint8_t *)(((uintptr_t)d->arena_mem + MJPEG_ALIGN - 1) &
+                                                  ~(uintptr_t)(MJPEG_ALIGN - 1)) : NULL;
+            d->arena_size = d->arena_mem ? size : 0;
+            d->stats.arena_bytes = (uint32_t)d->arena_size;
+        }
+        d->arena_used = 0;
+        d->arena_spill = 0;
+    }
+    d->lib_free_pool(cinfo, pool_id);
+}
+
+static void mjpeg_src_init(j_decompress_ptr cinfo) {
+    (void)cinfo;
+}
+
+static boolean mjpeg_src_fill(j_decompress_ptr cinfo) {
+    static const JOCTET eoi[2] = { 0xFF, JPEG_EOI };
+    mjpeg_source_t *src = (mjpeg_source_t *)cinfo->src;
+    const uint8_t *p;
+    uint32_t len;
+    if (src->next < src->count) {
+        src->pub.next_input_byte = src->range[src->next].p;
+        src->pub.bytes_in_buffer = src->range[src->next].len;
+        src->next++;
+    } else if (src->more.more && !src->more_done && (len = src->more.more(src->more.ctx, &p))) {
+        src->pub.next_input_byte = p;
+        src->pub.bytes_in_buffer = len;
+    } else {
+        src->more_done = true;
+        // Truncated frame: end it here, as jpeg_mem_src does
+        WARNMS(cinfo, JWRN_JPEG_EOF);
+        src->pub.next_input_byte = eoi;
+        src->pub.bytes_in_buffer = 2;
+    }
+    return TRUE;
+}
+
+static void mjpeg_src_skip(j_decompress_ptr cinfo, long count) {
+    struct jpeg_source_mgr *src = cinfo->src;
+    if (count <= 0) return;
+    while (count > (long)src->bytes_in_buffer) {
+        count -= (long)src->bytes_in_buffer;
+        mjpeg_src_fill(cinfo);
+    }
+    src->next_input_byte += count;
+    src->bytes_in_buffer -= count;
+}
+
+static void mjpeg_src_term(j_decompress_ptr cinfo) {
+    (void)cinfo;
+}
+
+// The bottom part of a split starts mid-scan: its first marker is the one libjpeg expects
+// as RST0, and so on
+static boolean mjpeg_src_resync(j_decompress_ptr cinfo, int desired) {
+    mjpeg_source_t *src = (mjpeg_source_t *)cinfo->src;
+    if (src->rst_shift && cinfo->unread_marker == JPEG_RST0 + ((desired + src->rst_shift) & 7)) {
+        cinfo->unread_marker = 0;
+        return TRUE;
+    }
+    return jpeg_resync_to_restart(cinfo, desired);
+}
+
+static void src_add(mjpeg_source_t *src, const uint8_t *p, uint32_t len) {
+    if (len) src->range[src->count++] = (mjpeg_range_t){ p, len };
+}
+
+// Lay out the source for a frame. Its DQT and DHT segments (with the standard DHT when it
+// has none) are what the decoder will hold after it; when they match what it holds from
+// the last frame they are left out and not parsed again.
+static void mjpeg_plan(mjpeg_decoder_t *d, const uint8_t *data, uint32_t size) {
+    mjpeg_range_t tab[MJPEG_TABLE_SEGS + 1];
+    uint32_t ntab = 0, sos = 0, pos = 2;
+    bool dht = false, ok = true;
+    while (pos + 4 <= size) {
+        uint8_t marker = data[pos + 1];
+        if (data[pos] != 0xFF) {
+            ok = false;
+            break;
+        }
+        if (marker == 0xFF) {
+            pos++;      // fill byte
+            continue;
+        }
+        if (marker == MJPEG_M_SOS) {
+            sos = pos;
+            break;
+        }
+        uint32_t end = pos + 2 + ((uint32_t)data[pos + 2] << 8 | data[pos + 3]);
+        if (end > size) {
+            ok = false;
+            break;
+        }
+        if (marker == MJPEG_M_DHT || marker == MJPEG_M_DQT) {
+            if (ntab == MJPEG_TABLE_SEGS) {
+                ok = false;
+                break;
+            }
+            tab[ntab++] = (mjpeg_range_t){ data + pos, end - pos };
+            dht |= marker == MJPEG_M_DHT;
+        }
+        pos = end;
+    }
+
+    mjpeg_source_t *src = &d->src;
+    src->count = 0;
+    src->next = 0;
+    src->more_done = false;
+    src->rst_shift = 0;
+    src->pub.next_input_byte = NULL;
+    src->pub.bytes_in_buffer = 0;
+    if (!ok || !sos) {
+        // Not laid out as expected (or the scan starts past the part given): let libjpeg
+        // sort it out, tables unknown after it
+        d->tables_ok = false;
+        d->tables_len = 0;
+        src_add(src, data, size);
+        return;
+    }
+    if (!dht) {
+        tab[ntab++] = (mjpeg_range_t){ mjpeg_std_dht, sizeof(mjpeg_std_dht) };
+        d->stats.dht_injected++;
+    }
+
+    uint32_t len = 0;
+    bool same = d->tables_ok;
+    for (uint32_t i = 0; i < ntab; i++) {
+        if (same && (len + tab[i].len > d->tables_len || memcmp(d->tables + len, tab[i].p, tab[i].len))) {
+            same = false;
+        }
+        len += tab[i].len;
+    }
+    same = same && len == d->tables_len;
+
+    const uint8_t *at = data;
+    if (same) {
+        d->stats.tables_reused++;
+        for (uint32_t i = 0; i < ntab; i++) {
+            if (tab[i].p == mjpeg_std_dht) continue;
+            src_add(src, at, (uint32_t)(tab[i].p - at));
+            at = tab[i].p + tab[i].len;
+        }
+    } else {
+        // Known once the header has been read
+        d->tables_ok = false;
+        d->tables_len = 0;
+        if (len <= MJPEG_TABLES_MAX) {
+            for (uint32_t i = 0; i < ntab; i++) {
+                memcpy(d->tables + d->tables_len, tab[i].p, tab[i].len);
+                d->tables_len += tab[i].len;
+            }
+        }
+    }
+    src_add(src, at, (uint32_t)(data + sos - at));
+    if (!dht && !same) src_add(src, mjpeg_std_dht, sizeof(mjpeg_std_dht));
+    src_add(src, data + sos, size - sos);
+}
+
+// Each setjmp sits in a function handed its decoder, which it never reassigns: a local
+// changed around setjmp may be clobbered by the longjmp
+static bool mjpeg_lib_create(mjpeg_decoder_t *d) {
+    d->cinfo.err = jpeg_std_error(&d->jerr.pub);
+    d->jerr.pub.error_exit = mjpeg_error_exit;
+    if (setjmp(d->jerr.setjmp_buffer)) {
+        jpeg_destroy_decompress(&d->cinfo);
+        return false;
+    }
+    jpeg_create_decompress(&d->cinfo);
+    return true;
+}
+
+mjpeg_decoder_t *mjpeg_decoder_create(void) {
+    mjpeg_decoder_t *d = (mjpeg_decoder_t *)calloc(1, sizeof(*d));
+    if (!d) return NULL;
+    if (!mjpeg_lib_create(d)) {
+        free(d);
+        return NULL;
+    }
+
+    d->src.pub.init_source = mjpeg_src_init;
+    d->src.pub.fill_input_buffer = mjpeg_src_fill;
+    d->src.pub.skip_input_data = mjpeg_src_skip;
+    d->src.pub.resync_to_restart = mjpeg_src_resync;
+    d->src.pub.term_source = mjpeg_src_term;
+    d->cinfo.src = &d->src.pub;
+
+    struct jpeg_memory_mgr *mem = d->cinfo.mem;
+    d->lib_alloc_small = mem->alloc_small;
+    d->lib_alloc_large = mem->alloc_large;
+    d->lib_alloc_sarray = mem->alloc_sarray;
+    d->lib_free_pool = mem->free_pool;
+    mem->alloc_small = mjpeg_alloc_small;
+    mem->alloc_large = mjpeg_alloc_large;
+    mem->alloc_sarray = mjpeg_alloc_sarray;
+    mem->free_pool = mjpeg_free_pool;
+    d->raw_enabled = true;
+    ycc_init();
+    return d;
+}
+
+void mjpeg_decoder_destroy(mjpeg_decoder_t *dec) {
+    if (!dec) return;
+    jpeg_destroy_decompress(&dec->cinfo);
+    mjpeg_decoder_destroy(dec->half);
+    free(dec->half_head);
+    free(dec->arena_mem);
+    free(dec);
+}
+
+void mjpeg_decoder_get_stats(const mjpeg_decoder_t *dec, mjpeg_decoder_stats_t *stats) {
+    *stats = dec->stats;
+    if (dec->half) stats->arena_bytes += dec->half->stats.arena_bytes;
+}
+
+void mjpeg_decoder_set_more(mjpeg_decoder_t *dec, const mjpeg_more_t *more) {
+    dec->src.more = more ? *more : (mjpeg_more_t){0};
+}
+
+void mjpeg_decoder_set_raw(mjpeg_decoder_t *dec, bool on) {
+    dec->raw_enabled = on;
+}
+
+void mjpeg_decoder_set_rows_hook(mjpeg_decoder_t *dec, const mjpeg_rows_hook_t *hook) {
+    dec->hook = hook ? *hook : (mjpeg_rows_hook_t){0};
+}
+
+bool mjpeg_decoder_set_worker(mjpeg_decoder_t *dec, const mjpeg_worker_t *worker) {
+    if (worker && !dec->half) {
+        dec->half = mjpeg_decoder_create();
+        dec->half_head = (uint8_t *)malloc(MJPEG_HEAD_BYTES);
+    }
+    if (!worker || !dec->half || !dec->half_head) {
+        mjpeg_decoder_destroy(dec->half);
+        free(dec->half_head);
+        dec->half = NULL;
+        dec->half_head = NULL;
+        return !worker;
+    }
+    dec->worker = *worker;
+    return true;
+}
+
+// Read the header of the frame laid out in the source. Called under the caller's setjmp.
+static void mjpeg_header(mjpeg_decoder_t *d) {
+    jpeg_read_header(&d->cinfo, TRUE);
+    // Its tables are loaded now
+    d->tables_ok = d->tables_len > 0;
+    d->stats.frames++;
+    d->cinfo.out_color_space = JCS_RGB565;
+    d->cinfo.dct_method = JDCT_IFAST; // Speed over quality
+    // Chroma replicated, not interpolated, and no dither: what the raw converter does, so
+    // cropped and whole decodes of a frame agree (and libjpeg can use its merged upsampler)
+    d->cinfo.do_fancy_upsampling = FALSE;
+    d->cinfo.dither_mode = JDITHER_NONE;
+}
+
+// Lay out a frame and read its header. Called under the caller's setjmp.
+static void mjpeg_start(mjpeg_decoder_t *d, const uint8_t *data, uint32_t size) {
+    mjpeg_plan(d, data, size);
+    mjpeg_header(d);
+}
+
+// Whole images of 8-bit YCbCr, Cb and Cr sampled alike at 1/1, 1/2 or 1/4 across and 1/1
+// or 1/2 down, skip libjpeg's upsampling and color conversion: take the components raw
+static bool raw_prepare(mjpeg_decoder_t *d) {
+    struct jpeg_decompress_struct *c = &d->cinfo;
+    jpeg_component_info *comp = c->comp_info;
+    if (!d->raw_enabled || c->num_components != 3 || c->jpeg_color_space != JCS_YCbCr || c->data_precision != 8) {
+        return false;
+    }
+    if (comp[0].h_samp_factor != c->max_h_samp_factor || comp[0].v_samp_factor != c->max_v_samp_factor ||
+        comp[1].h_samp_factor != comp[2].h_samp_factor || comp[1].v_samp_factor != comp[2].v_samp_factor) {
+        return false;
+    }
+    int h = comp[0].h_samp_factor / comp[1].h_samp_factor;
+    int v = comp[0].v_samp_factor / comp[1].v_samp_factor;
+    if (h * comp[1].h_samp_factor != comp[0].h_samp_factor || v * comp[1].v_samp_factor != comp[0].v_samp_factor ||
+        (h != 1 && h != 2 && h != 4) || (v != 1 && v != 2)) {
+        return false;
+    }
+    c->raw_data_out = TRUE;
+    return true;
+}
+
+// After jpeg_start_decompress(): buffers for an iMCU row. DCT scaling may shrink chroma
+// less than luma, so the ratios are taken from the scaled block sizes.
+static void raw_begin(mjpeg_decoder_t *d) {
+    struct jpeg_decompress_struct *c = &d->cinfo;
+    jpeg_component_info *comp = c->comp_info;
+    uint32_t yw = comp[0].h_samp_factor * MJPEG_DCT_H(&comp[0]);
+    uint32_t yh = comp[0].v_samp_factor * MJPEG_DCT_V(&comp[0]);
+    uint32_t cw = comp[1].h_samp_factor * MJPEG_DCT_H(&comp[1]);
+    uint32_t ch = comp[1].v_samp_factor * MJPEG_DCT_V(&comp[1]);
+    d->raw_hshift = yw >= 4 * cw ? 2 : yw >= 2 * cw ? 1 : 0;
+    d->raw_vshift = yh >= 2 * ch ? 1 : 0;
+    d->raw_lines = yh;
+    d->raw_count = 0;
+    d->raw_next = 0;
+    for (int i = 0; i < 3; i++) {
+        d->raw[i] = c->mem->alloc_sarray((j_common_ptr)c, JPOOL_IMAGE,
+                                         comp[i].width_in_blocks * MJPEG_DCT_H(&comp[i]),
+                                         comp[i].v_samp_factor * MJPEG_DCT_V(&comp[i]));
+    }
+}
+
+// Conversion tables, as libjpeg's: per chroma value its share of R, G and B, and per
+// clamped-to-be value (offset by 256) the RGB565 bits of each channel
+static struct {
+    bool ready;
+    int16_t cr_r[256];
+    int16_t cb_b[256];
+    int32_t cb_g[256];
+    int32_t cr_g[256];
+    uint16_t r[768];
+    uint16_t g[768];
+    uint16_t b[768];
+} s_ycc;
+
+// The same values each time, so a race between two first decoders does no harm
+static void ycc_init(void) {
+    if (s_ycc.ready) return;
+    for (int i = 0; i < 256; i++) {
+        int x = i - 128;
+        s_ycc.cr_r[i] = (int16_t)((YCC_FIX(1.40200) * x + YCC_HALF) >> YCC_BITS);
+        s_ycc.cb_b[i] = (int16_t)((YCC_FIX(1.77200) * x + YCC_HALF) >> YCC_BITS);
+        s_ycc.cb_g[i] = -YCC_FIX(0.34414) * x;
+        s_ycc.cr_g[i] = -YCC_FIX(0.71414) * x + YCC_HALF;
+    }
+    for (int i = 0; i < 768; i++) {
+        int v = i - 256;
+        uint16_t c = (uint16_t)(v < 0 ? 0 : v > 255 ? 255 : v);
+        s_ycc.r[i] = (uint16_t)((c & 0xF8) << 8);
+        s_ycc.g[i] = (uint16_t)((c & 0xFC) << 3);
+        s_ycc.b[i] = (uint16_t)(c >> 3);
+    }
+    s_ycc.ready = true;
+}
+
+#define YCC_PIXEL(l) (s_ycc.r[(l) + r_off] | s_ycc.g[(l) + g_off] | s_ycc.b[(l) + b_off])
+
+#define YCC_PUT(dst, px) ((dst) = big_endian ? __builtin_bswap16(px) : (px))
+
+// One row, or two sharing their chroma row (`y1` and `out1` used only if `pair`)
+static inline __attribute__((always_inline)) void ycc_rows(const JSAMPLE *restrict y0, const JSAMPLE *restrict y1,
+                                                          const JSAMPLE *restrict cb, const JSAMPLE *restrict cr,
+                                                          uint32_t width, uint16_t *restrict out0,
+                                                          uint16_t *restrict out1, const uint8_t hshift, const bool pair,
+                                                          const bool big_endian) {
+    uint32_t step = 1u << hshift;
+    for (uint32_t x = 0; x < width; x += step) {
+        int u = *cb++, v = *cr++;
+        int r_off = s_ycc.cr_r[v] + 256;
+        int g_off = ((s_ycc.cb_g[u] + s_ycc.cr_g[v]) >> YCC_BITS) + 256;
+        int b_off = s_ycc.cb_b[u] + 256;
+        if (hshift == 1 && x + 1 < width) {
+            // The common 4:2:0 and 4:2:2 case, two pixels per chroma sample
+            YCC_PUT(out0[x], YCC_PIXEL(y0[x]));
+            YCC_PUT(out0[x + 1], YCC_PIXEL(y0[x + 1]));
+            if (pair) {
+                YCC_PUT(out1[x], YCC_PIXEL(y1[x]));
+                YCC_PUT(out1[x + 1], YCC_PIXEL(y1[x + 1]));
+            }
+            continue;
+        }
+        uint32_t end = x + step < width ? x + step : width;
+        for (uint32_t i = x; i < end; i++) {
+            YCC_PUT(out0[i], YCC_PIXEL(y0[i]));
+            if (pair) YCC_PUT(out1[i], YCC_PIXEL(y1[i]));
+        }
+    }
+}
+
+#define YCC_CASES(pair) \
+    switch (d->raw_hshift * 2 + big_endian) { \
+    case 0: ycc_rows(y0, y1, cb, cr, width, out0, out1, 0, pair, false); break; \
+    case 1: ycc_rows(y0, y1, cb, cr, width, out0, out1, 0, pair, true); break; \
+    case 2: ycc_rows(y0, y1, cb, cr, width, out0, out1, 1, pair, false); break; \
+    case 3: ycc_rows(y0, y1, cb, cr, width, out0, out1, 1, pair, true); break; \
+    case 4: ycc_rows(y0, y1, cb, cr, width, out0, out1, 2, pair, false); break; \
+    default: ycc_rows(y0, y1, cb, cr, width, out0, out1, 2, pair, true); break; \
+    }
+
+// Row `r` of the iMCU row in hand as RGB565, and the next if `out1`: each chroma sample
+// used for the pixels it covers (as libjpeg's plain upsampling). Returns rows written.
+static uint32_t raw_rows(const mjpeg_decoder_t *d, uint32_t r, uint32_t width, uint16_t *out0, uint16_t *out1,
+                         bool big_endian) {
+    const JSAMPLE *y0 = d->raw[0][r];
+    const JSAMPLE *y1 = d->raw[0][r + 1];
+    const JSAMPLE *cb = d->raw[1][r >> d->raw_vshift];
+    const JSAMPLE *cr = d->raw[2][r >> d->raw_vshift];
+    // A copy of the loop for each case, the checks in it folded away. Rows sharing a
+    // chroma row are done together, as libjpeg's merged upsampler does.
+    if (out1 && d->raw_vshift && !(r & 1)) {
+        YCC_CASES(true)
+        return 2;
+    }
+    YCC_CASES(false)
+    return 1;
+}
+
+// The next rows, at most `max_rows`, into rows `stride` bytes apart from `dst`: the rest of
+// the iMCU row in hand through the converter, else as many rows as libjpeg gives in one
+// call. 0 if libjpeg gave none.
+static uint32_t mjpeg_read_rows(mjpeg_decoder_t *d, bool raw, uint8_t *dst, uint32_t stride, uint32_t max_rows,
+                                bool big_endian) {
+    struct jpeg_decompress_struct *c = &d->cinfo;
+    if (raw) {
+        if (d->raw_next == d->raw_count) {
+            d->raw_count = jpeg_read_raw_data(c, d->raw, d->raw_lines);
+            d->raw_next = 0;
+        }
+        uint32_t n = d->raw_count - d->raw_next;
+        if (n > max_rows) n = max_rows;
+        for (uint32_t r = 0; r < n;) {
+            uint16_t *out1 = r + 1 < n ? (uint16_t *)(dst + (r + 1) * stride) : NULL;
+            r += raw_rows(d, d->raw_next + r, c->output_width, (uint16_t *)(dst + r * stride), out1, big_endian);
+        }
+        d->raw_next += n;
+        return n;
+    }
+    JSAMPROW rows[MJPEG_ROWS_MAX];
+    if (max_rows > MJPEG_ROWS_MAX) max_rows = MJPEG_ROWS_MAX;
+    for (uint32_t r = 0; r < max_rows; r++) rows[r] = dst + r * stride;
+    return jpeg_read_scanlines(c, rows, max_rows);
+}
+
+// Done with the frame (decoded or not): back to the start state, pools kept
+static void mjpeg_end(mjpeg_decoder_t *d, mjpeg_decoder_t *own, bool failed) {
+    jpeg_abort_decompress(&d->cinfo);
+    // It may have stopped halfway through loading tables
+    if (failed) d->tables_ok = false;
+    mjpeg_decoder_destroy(own);
+}
+
+// Where to cut a frame in two: at the restart marker nearest its middle that starts a row of
+// MCUs. False for one without restart markers, with none there, not a single interleaved
+// baseline scan, or with markers too long to copy.
+static bool mjpeg_find_split(const uint8_t *data, uint32_t size, mjpeg_split_t *s) {
+    uint32_t pos = 2, sof = 0, sos = 0, interval = 0;
+    while (pos + 4 <= size && !sos) {
+        uint8_t marker = data[pos + 1];
+        if (data[pos] != 0xFF) return false;
+        if (marker == 0xFF) {
+            pos++;
+            continue;
+        }
+        uint32_t end = pos + 2 + ((uint32_t)data[pos + 2] << 8 | data[pos + 3]);
+        if (end > size) return false;
+        if (marker == MJPEG_M_SOF0 || marker == MJPEG_M_SOF1) {
+            sof = pos;
+        } else if (marker > MJPEG_M_SOF1 && marker <= 0xCF && marker != MJPEG_M_DHT && marker != MJPEG_M_JPG &&
+                   marker != MJPEG_M_DAC) {
+            return false;       // progressive, lossless or arithmetic coded
+        } else if (marker == MJPEG_M_DRI && end - pos >= 6) {
+            interval = (uint32_t)data[pos + 4] << 8 | data[pos + 5];
+        } else if (marker == MJPEG_M_SOS) {
+            sos = pos;
+        }
+        pos = end;
+    }
+    if (!sof || !sos || !interval || pos > MJPEG_HEAD_BYTES || data[sof + 4] != 8) return false;
+    uint32_t height = (uint32_t)data[sof + 5] << 8 | data[sof + 6];
+    uint32_t width = (uint32_t)data[sof + 7] << 8 | data[sof + 8];
+    uint32_t ncomp = data[sof + 9];
+    uint32_t sof_end = sof + 2 + ((uint32_t)data[sof + 2] << 8 | data[sof + 3]);
+    if (!height || !ncomp || sof + 10 + 3 * ncomp > sof_end || pos - sos < 6 || data[sos + 4] != ncomp) return false;
+    // One block per MCU in a scan of one component, else the largest sampling factors
+    uint32_t hmax = 1, vmax = 1;
+    for (uint32_t i = 0; i < ncomp && ncomp > 1; i++) {
+        uint8_t hv = data[sof + 11 + 3 * i];
+        if (hv >> 4 > hmax) hmax = hv >> 4;
+        if ((hv & 15) > vmax) vmax = hv & 15;
+    }
+    uint32_t per_row = (width + 8 * hmax - 1) / (8 * hmax);
+    uint32_t mcu_rows = (height + 8 * vmax - 1) / (8 * vmax);
+    uint32_t best = 0;
+    for (uint32_t r = 1; r < mcu_rows; r++) {
+        if (r * per_row % interval) continue;
+        if (!best || (r * 2 > mcu_rows ? r * 2 - mcu_rows : mcu_rows - r * 2) <
+                     (best * 2 > mcu_rows ? best * 2 - mcu_rows : mcu_rows - best * 2)) {
+            best = r;
+        }
+    }
+    if (!best) return false;
+
+    // Count the markers through the scan data up to the cut
+    uint32_t want = best * per_row / interval, seen = 0;
+    const uint8_t *p = data + pos, *end = data + size;
+    while ((p = memchr(p, 0xFF, (size_t)(end - p))) && p + 1 < end) {
+        uint8_t m = p[1];
+        if (m == 0x00 || m == 0xFF) {
+            p++;                // stuffed byte or fill
+            continue;
+        }
+        if (m < JPEG_RST0 || m > JPEG_RST0 + 7) return false;
+        p += 2;
+        if (++seen == want) {
+            s->width = width;
+            s->height = height;
+            s->row = best * 8 * vmax;
+            s->sof = sof;
+            s->head = pos;
+            s->scan = (uint32_t)(p - data);
+            s->shift = (uint8_t)(want & 7);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Bottom part of a split decode, on the worker
+static void mjpeg_half_run(void *arg) {
+    mjpeg_decoder_t *d = (mjpeg_decoder_t *)arg;
+    mjpeg_decoder_t *h = d->half;
+    d->half_ok = false;
+    if (setjmp(h->jerr.setjmp_buffer)) {
+        mjpeg_end(h, NULL, true);
+        return;
+    }
+    mjpeg_header(h);
+    bool raw = raw_prepare(h);
+    jpeg_start_decompress(&h->cinfo);
+    if (raw) raw_begin(h);
+    bool ok = h->cinfo.output_width == d->half_width && h->cinfo.output_height == d->half_rows;
+    uint32_t stride = d->half_width * 2;
+    for (uint32_t y = 0, n; ok && y < d->half_rows; y += n) {
+        n = mjpeg_read_rows(h, raw, d->half_dst + (size_t)y * stride, stride, d->half_rows - y, false);
+        ok = n > 0;
+        if (ok && d->hook.rows) d->hook.rows(d->hook.ctx, d->half_y + y, n, d->half_dst + (size_t)y * stride, stride);
+    }
+    mjpeg_end(h, NULL, !ok);
+    d->half_ok = ok;
+}
+
+// Top part of a split decode: the first `rows` rows of the frame, the rest never decoded
+static bool mjpeg_top_run(mjpeg_decoder_t *d, const uint8_t *data, uint32_t size, const mjpeg_split_t *s,
+                          uint8_t *dst) {
+    if (setjmp(d->jerr.setjmp_buffer)) {
+        mjpeg_end(d, NULL, true);
+        return false;
+    }
+    mjpeg_start(d, data, size);
+    bool raw = raw_prepare(d);
+    jpeg_start_decompress(&d->cinfo);
+    if (raw) raw_begin(d);
+    bool ok = d->cinfo.output_width == s->width && d->cinfo.output_height == s->height;
+    uint32_t stride = s->width * 2;
+    for (uint32_t y = 0, n; ok && y < s->row; y += n) {
+        n = mjpeg_read_rows(d, raw, dst + (size_t)y * stride, stride, s->row - y, false);
+        ok = n > 0;
+        if (ok && d->hook.rows) d->hook.rows(d->hook.ctx, y, n, dst + (size_t)y * stride, stride);
+    }
+    mjpeg_end(d, NULL, !ok);
+    return ok;
+}
+
+static bool mjpeg_decode_split(mjpeg_decoder_t *d, const uint8_t *data, uint32_t size, const mjpeg_split_t *s,
+                               uint8_t *dst) {
+    // The bottom part as an image of its own: the frame's markers with its height, then
+    // the scan data after the marker
+    mjpeg_decoder_t *h = d->half;
+    uint32_t rows = s->height - s->row;
+    memcpy(d->half_head, data, s->head);
+    d->half_head[s->sof + 5] = (uint8_t)(rows >> 8);
+    d->half_head[s->sof + 6] = (uint8_t)rows;
+    mjpeg_plan(h, d->half_head, s->head);
+    src_add(&h->src, data + s->scan, size - s->scan);
+    h->src.rst_shift = s->shift;
+    h->raw_enabled = d->raw_enabled;
+    d->half_dst = dst + (size_t)s->row * s->width * 2;
+    d->half_y = s->row;
+    d->half_width = s->width;
+    d->half_rows = rows;
+
+    d->worker.start(d->worker.ctx, mjpeg_half_run, d);
+    bool ok = mjpeg_top_run(d, data, size, s, dst);
+    d->worker.wait(d->worker.ctx);
+    ok = ok && d->half_ok;
+    if (ok) d->stats.split++;
+    return ok;
+}
+
+// One part, into `dst`; `own` is destroyed when done
+static bool mjpeg_rgb565_run(mjpeg_decoder_t *dec, mjpeg_decoder_t *own, const uint8_t *data, uint32_t size,
+                             uint8_t *dst, uint32_t dst_size, uint32_t *w, uint32_t *h) {
+    struct jpeg_decompress_struct *cinfo = &dec->cinfo;
+    if (setjmp(dec->jerr.setjmp_buffer)) {
+        mjpeg_end(dec, own, true);
+        return false;
+    }
+
+    mjpeg_start(dec, data, size);
+    bool raw = raw_prepare(dec);
+    jpeg_start_decompress(cinfo);
+    if (raw) raw_begin(dec);
+
+    uint32_t width = cinfo->output_width;
+    uint32_t height = cinfo->output_height;
+    if ((uint64_t)width * height * 2 > dst_size) {
+        mjpeg_end(dec, own, false);
+        return false;
+    }
+    uint32_t stride = width * 2;
+    for (uint32_t y = 0, n; y < height; y += n) {
+        if (!(n = mjpeg_read_rows(dec, raw, dst + y * stride, stride, height - y, false))) {
+            mjpeg_end(dec, own, true);
+            return false;
+        }
+        if (dec->hook.rows) dec->hook.rows(dec->hook.ctx, y, n, dst + y * stride, stride);
+    }
+    mjpeg_end(dec, own, false);
+    *w = width;
+    *h = height;
+    return true;
+}
+
+bool mjpeg_decode_rgb565(mjpeg_decoder_t *dec, const uint8_t *data, uint32_t size, uint8_t *dst,
+                         uint32_t dst_size, uint32_t *w, uint32_t *h) {
+    // Verify JPEG header (SOI)
+    if (size < 2 || data[0] != 0xFF || data[1] != 0xD8) return false;
+
+    // In two parts when the frame is all here and has a place to cut; one part if that fails
+    mjpeg_split_t split;
+    bool whole = !dec || !dec->src.more.more || (data[size - 2] == 0xFF && data[size - 1] == JPEG_EOI);
+    if (dec && dec->half && whole && mjpeg_find_split(data, size, &split) &&
+        (uint64_t)split.width * split.height * 2 <= dst_size && mjpeg_decode_split(dec, data, size, &split, dst)) {
+        *w = split.width;
+        *h = split.height;
+        return true;
+    }
+
+    mjpeg_decoder_t *own = NULL;
+    if (!dec && !(dec = own = mjpeg_decoder_create())) return false;
+    return mjpeg_rgb565_run(dec, own, data, size, dst, dst_size, w, h);
+}
+
+static bool mjpeg_region_run(mjpeg_decoder_t *dec, mjpeg_decoder_t *own, const uint8_t *data, uint32_t size,
+                             uint8_t scale_denom, const mjpeg_rect_t *want, uint8_t *dst, uint32_t dst_stride,
+                             uint32_t dst_size, bool in_frame, mjpeg_rect_t *got, uint32_t *img_w,
+                             uint32_t *img_h) {
+    struct jpeg_decompress_struct *cinfo = &dec->cinfo;
+    if (setjmp(dec->jerr.setjmp_buffer)) {
+        mjpeg_end(dec, own, true);
+        return false;
+    }
+
+    mjpeg_start(dec, data, size);
+    cinfo->scale_num = 1;
+    cinfo->scale_denom = scale_denom;
+    jpeg_calc_output_dimensions(cinfo);
+
+    uint32_t width = cinfo->output_width;
+    uint32_t height = cinfo->output_height;
+    mjpeg_rect_t r = { 0, 0, width, height };
+    if (want->w && want->h) {
+        r = *want;
+        if (r.x > width) r.x = width;
+        if (r.y > height) r.y = height;
+        if (r.w > width - r.x) r.w = width - r.x;
+        if (r.h > height - r.y) r.h = height - r.y;
+    }
+    // Raw components cannot be cropped or skipped: only for the whole image
+    bool raw = !r.x && !r.y && r.w == width && r.h == height && raw_prepare(dec);
+    jpeg_start_decompress(cinfo);
+    if (raw) raw_begin(dec);
+    // Start on a whole group of upsampled rows: skipping to an odd row of a 2:1 vertically
+    // subsampled image gives wrong pixels at some scales
+    uint32_t odd = r.y % (uint32_t)cinfo->max_v_samp_factor;
+    r.y -= odd;
+    r.h += r.h ? odd : 0;
+    if (r.w && r.w < width) {
+        // Widened to whole iMCUs; the columns beside it are never transformed
+        JDIMENSION x = r.x, w = r.w;
+        jpeg_crop_scanline(cinfo, &x, &w);
+        r.x = x;
+        r.w = w;
+    }
+    uint32_t row_bytes = (in_frame ? r.x + r.w : r.w) * 2;
+    uint32_t first_row = in_frame ? r.y : 0;
+    if (!r.w || !r.h || row_bytes > dst_stride ||
+        (uint64_t)(first_row + r.h - 1) * dst_stride + row_bytes > dst_size) {
+        mjpeg_end(dec, own, false);
+        return false;
+    }
+    // Rows above are only entropy-decoded, rows below not at all
+    if (r.y) jpeg_skip_scanlines(cinfo, r.y);
+    uint8_t *base = in_frame ? dst + (size_t)r.y * dst_stride + (size_t)r.x * 2 : dst;
+    for (uint32_t y = 0, n; y < r.h; y += n) {
+        if (!(n = mjpeg_read_rows(dec, raw, base + (size_t)y * dst_stride, dst_stride, r.h - y, false))) {
+            mjpeg_end(dec, own, true);
+            return false;
+        }
+    }
+    mjpeg_end(dec, own, false);
+    *got = r;
+    if (img_w) *img_w = width;
+    if (img_h) *img_h = height;
+    return true;
+}
+
+bool mjpeg_decode_region(mjpeg_decoder_t *dec, const uint8_t *data, uint32_t size, uint8_t scale_denom,
+                         const mjpeg_rect_t *want, uint8_t *dst, uint32_t dst_stride, uint32_t dst_size,
+                         bool in_frame, mjpeg_rect_t *got, uint32_t *img_w, uint32_t *img_h) {
+    if (size < 2 || data[0] != 0xFF || data[1] != 0xD8) return false;
+
+    mjpeg_decoder_t *own = NULL;
+    if (!dec && !(dec = own = mjpeg_decoder_create())) return false;
+    return mjpeg_region_run(dec, own, data, size, scale_denom, want, dst, dst_stride, dst_size, in_frame, got,
+                            img_w, img_h);
+}
+
+static bool mjpeg_size_run(mjpeg_decoder_t *dec, mjpeg_decoder_t *own, const uint8_t *data, uint32_t size,
+                           uint32_t *w, uint32_t *h) {
+    if (setjmp(dec->jerr.setjmp_buffer)) {
+        mjpeg_end(dec, own, true);
+        return false;
+    }
+
+    mjpeg_start(dec, data, size);
+    *w = dec->cinfo.image_width;
+    *h = dec->cinfo.image_height;
+    mjpeg_end(dec, own, false);
+    return true;
+}
+
+bool mjpeg_read_size(mjpeg_decoder_t *dec, const uint8_t *data, uint32_t size, uint32_t *w, uint32_t *h) {
+    if (size < 2 || data[0] != 0xFF || data[1] != 0xD8) return false;
+
+    mjpeg_decoder_t *own = NULL;
+    if (!dec && !(dec = own = mjpeg_decoder_create())) return false;
+    return mjpeg_size_run(dec, own, data, size, w, h);
+}
+
+void mjpeg_swap_rgb565(uint8_t *px, uint32_t count) {
+    uint32_t *p32 = (uint32_t *)px;
+    uint32_t pairs = count / 2;
+    for (uint32_t i = 0; i < pairs; i++) {
+        uint32_t v = p32[i];
+        p32[i] = ((v & 0x00FF00FFu) << 8) | ((v >> 8) & 0x00FF00FFu);
+    }
+    if (count & 1) {
+        uint8_t *last = px + (count - 1) * 2;
+        uint8_t t = last[0];
+        last[0] = last[1];
+        last[1] = t;
+    }
+}
+
+static bool mjpeg_bands_run(mjpeg_decoder_t *dec, mjpeg_decoder_t *own, const uint8_t *data, uint32_t size,
+                            const mjpeg_band_sink_t *sink, uint32_t *w, uint32_t *h) {
+    struct jpeg_decompress_struct *cinfo = &dec->cinfo;
+    // Changed after setjmp, read after a longjmp
+    uint8_t *volatile band = NULL;
+    volatile uint32_t band_y = 0;
+    volatile uint32_t width = 0;
+    if (setjmp(dec->jerr.setjmp_buffer)) {
+        if (band) sink->put(sink->ctx, band_y, 0, width, band);
+        mjpeg_end(dec, own, true);
+        return false;
+    }
+
+    mjpeg_start(dec, data, size);
+    bool raw = raw_prepare(dec);
+    jpeg_start_decompress(cinfo);
+    if (raw) raw_begin(dec);
+    width = cinfo->output_width;
+    uint32_t height = cinfo->output_height;
+    if (width > sink->max_width) {
+        mjpeg_end(dec, own, false);
+        return false;
+    }
+
+    uint32_t stride = width * 2;
+    uint32_t filled = 0;
+    bool ok = true;
+    while (band_y + filled < height) {
+        if (!band && !(band = sink->get(sink->ctx))) {
+            ok = false;
+            break;
+        }
+        uint32_t space = sink->rows - filled;
+        if (space > height - band_y - filled) space = height - band_y - filled;
+        // The converter writes the panel's byte order itself
+        uint32_t n = mjpeg_read_rows(dec, raw, band + filled * stride, stride, space, raw && sink->big_endian);
+        if (!n) {
+            sink->put(sink->ctx, band_y, 0, width, band);
+            band = NULL;
+            ok = false;
+            break;
+        }
+        filled += n;
+        if (filled < sink->rows && band_y + filled < height) continue;
+        if (sink->big_endian && !raw) mjpeg_swap_rgb565(band, filled * width);
+        uint8_t *full = band;
+        band = NULL;
+        if (!sink->put(sink->ctx, band_y, filled, width, full)) {
+            ok = false;
+            break;
+        }
+        band_y += filled;
+        filled = 0;
+    }
+    mjpeg_end(dec, own, false);
+    *w = width;
+    *h = height;
+    return ok;
+}
+
+bool mjpeg_decode_bands(mjpeg_decoder_t *dec, const uint8_t *data, uint32_t size, const mjpeg_band_sink_t *sink,
+                        uint32_t *w, uint32_t *h) {
+    if (size < 2 || data[0] != 0xFF || data[1] != 0xD8 || !sink->rows) return false;
+
+    mjpeg_decoder_t *own = NULL;
+    if (!dec && !(dec = own = mjpeg_decoder_create())) return false;
+    return mjpeg_bands_run(dec, own, data, size, sink, w, h);
+}
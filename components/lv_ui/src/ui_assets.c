@@ -0,0 +1,111 @@
+#include "ui_assets.h"
+#include "asset_bundle.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_timer.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "ui_assets";
+
+#define ASSETS_PARTITION    "storage"
+
+static asset_bundle_t s_bundle;
+static esp_partition_mmap_handle_t s_map;
+static lv_image_dsc_t *s_images = NULL;    // per index entry; only image entries are filled
+static const lv_font_t **s_fonts = NULL;
+
+esp_err_t ui_assets_init(void) {
+    if (s_bundle.base) return ESP_OK;
+    int64_t t0 = esp_timer_get_time();
+
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           ASSETS_PARTITION);
+    if (!part) {
+        ESP_LOGW(TAG, "No '%s' partition", ASSETS_PARTITION);
+        return ESP_ERR_NOT_FOUND;
+    }
+    // Map only the bundle, not the whole partition
+    uint8_t header[ASSET_BUNDLE_HEADER];
+    esp_err_t ret = esp_partition_read(part, 0, header, sizeof(header));
+    uint32_t size = ret == ESP_OK ? asset_bundle_peek_size(header) : 0;
+    if (!size || size > part->size) {
+        ESP_LOGW(TAG, "No asset bundle in '%s' (flash assets/assets.bin)", ASSETS_PARTITION);
+        return ESP_ERR_NOT_FOUND;
+    }
+    const void *base;
+    ret = esp_partition_mmap(part, 0, size, ESP_PARTITION_MMAP_DATA, &base, &s_map);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "mmap failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    int64_t t_map = esp_timer_get_time();
+
+    asset_bundle_t b;
+    asset_bundle_status_t st = asset_bundle_open(&b, (const uint8_t *)base, size, true);
+    if (st != ASSET_BUNDLE_OK) {
+        ESP_LOGE(TAG, "Asset bundle rejected: %s", asset_bundle_status_str(st));
+        esp_partition_munmap(s_map);
+        return st == ASSET_BUNDLE_ERR_CRC ? ESP_ERR_INVALID_CRC : ESP_ERR_NOT_FOUND;
+    }
+
+    s_images = (lv_image_dsc_t *)calloc(b.count, sizeof(lv_image_dsc_t));
+    s_fonts = (const lv_font_t **)calloc(b.count, sizeof(lv_font_t *));
+    if (!s_images || !s_fonts) {
+        free(s_images);
+        free(s_fonts);
+        s_images = NULL;
+        s_fonts = NULL;
+        esp_partition_munmap(s_map);
+        return ESP_ERR_NO_MEM;
+    }
+    for (uint16_t i = 0; i < b.count; i++) {
+        const asset_entry_t *e = &b.index[i];
+        if (e->type != ASSET_TYPE_IMAGE) continue;
+        lv_image_dsc_t *d = &s_images[i];
+        d->header.magic = LV_IMAGE_HEADER_MAGIC;
+        d->header.cf = e->cf;
+        d->header.w = e->w;
+        d->header.h = e->h;
+        d->header.stride = e->stride;
+        d->data_size = e->size;
+        d->data = asset_bundle_data(&b, e);
+    }
+    s_bundle = b;
+
+    int64_t t_end = esp_timer_get_time();
+    ESP_LOGI(TAG, "%u assets, %lu bytes mapped from '%s' in %lld us (map %lld us, CRC + index %lld us)",
+             (unsigned)b.count, (unsigned long)size, ASSETS_PARTITION, t_end - t0, t_map - t0, t_end - t_map);
+    return ESP_OK;
+}
+
+const lv_image_dsc_t * ui_assets_image(const char * name) {
+    if (!s_bundle.base || !name) return NULL;
+    const asset_entry_t *e = asset_bundle_find(&s_bundle, name, ASSET_TYPE_IMAGE);
+    if (!e) {
+        ESP_LOGW(TAG, "Image '%s' not in the bundle", name);
+        return NULL;
+    }
+    return &s_images[e - s_bundle.index];
+}
+
+const lv_font_t * ui_assets_font(const char * name) {
+    if (!s_bundle.base || !name) return NULL;
+    const asset_entry_t *e = asset_bundle_find(&s_bundle, name, ASSET_TYPE_FONT);
+    if (!e) {
+        ESP_LOGW(TAG, "Font '%s' not in the bundle", name);
+        return NULL;
+    }
+#if LV_USE_FS_MEMFS
+    size_t i = (size_t)(e - s_bundle.index);
+    if (!s_fonts[i]) {
+        // The loader only reads the buffer; it builds its own copy of the glyph data
+        s_fonts[i] = lv_binfont_create_from_buffer((void *)asset_bundle_data(&s_bundle, e), e->size);
+        if (!s_fonts[i]) ESP_LOGE(TAG, "Font '%s' failed to load", name);
+    }
+    return s_fonts[i];
+#else
+    ESP_LOGW(TAG, "Font '%s': bundled fonts need LV_USE_FS_MEMFS", name);
+    return NULL;
+#endif
+}
@@ -1,383 +1,882 @@
 #include "ui_avi.h"
+#include "hal_mgr.h"
+#include "lvgl_mgr.h"
+#include "sd_reader.h"
+#include "avi_index.h"
+#include "video_pipe.h"
+#include "mjpeg_decode.h"
+#include "frame_diff.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "misc/cache/instance/lv_image_cache.h"
-#include "jpeglib.h"
-#include "jerror.h"
-#include <setjmp.h>
 
 // Max resolution 600x450 * 2 bytes/pixel = 540,000 bytes
 // Round up to 600KB for safety
-#define AVI_PIXEL_BUFFER_SIZE (600 * 1024) 
-#define AVI_WORK_BUFFER_SIZE (100 * 1024)
+#define AVI_PIXEL_BUFFER_SIZE (600 * 1024)
+// Inline fallback: frames are read through this a piece at a time as libjpeg asks for them
+// (any size); also the scratch for loading the index
+#define AVI_INLINE_BUF_SIZE (8 * 1024)
 
-static const char *TAG = "ui_avi";
-#define LOG_AVI(...) ESP_LOGI(TAG, __VA_ARGS__)
-
-// Error handling for libjpeg to prevent exit()
-struct my_error_mgr {
-  struct jpeg_error_mgr pub;
-  jmp_buf setjmp_buffer;
-};
+// Frames are decoded on core 0, below the SD reader (6) and file service (4), so decoding
+// only takes time the I/O does not need. LVGL renders on core 1 and only swaps buffers.
+#define AVI_DECODE_TASK_PRIO    3
+#define AVI_DECODE_TASK_CORE    0
+#define AVI_DECODE_TASK_STACK   6144    // libjpeg keeps its state on the heap
+// Frames with restart markers are decoded in two parts at once: the bottom one on core 1,
+// beside LVGL and below it
+#define AVI_HALF_TASK_PRIO      AVI_DECODE_TASK_PRIO
+#define AVI_HALF_TASK_CORE      1
+#define AVI_HALF_TASK_STACK     4096
+#define AVI_PRESENT_PERIOD_MS   5       // presenter check; a frame is shown within this of its time
+#define AVI_STATS_EVERY         15      // frames between stats lines
+// Through LVGL only the tiles that changed since the frame on screen are redrawn; all of it
+// every so often, in case a changed tile kept its hash
+#define AVI_DIFF_FULL_EVERY     60      // frames
+// Video plane: MCU rows go from the decoder to the panel through two band buffers in
+// internal DMA RAM, one decoding while the other is sent
+#define AVI_BAND_ROWS           16
+#define AVI_BAND_COUNT          2
 
-static void my_error_exit(j_common_ptr cinfo) {
-  struct my_error_mgr *myerr = (struct my_error_mgr *)cinfo->err;
-  (*cinfo->err->output_message)(cinfo);
-  longjmp(myerr->setjmp_buffer, 1);
-}
+static const char *TAG = "ui_avi";
 
 typedef struct {
     FILE *f;
-    uint8_t *frame_buffer[2]; // Uncompressed RGB565 buffers
-    uint8_t *work_buffer;     // Compressed JPEG data
-    lv_timer_t *timer;
-    lv_image_dsc_t img_dsc[2]; // Double buffered descriptors
-    uint8_t dsc_idx;
-    uint32_t movi_start_offset;
-    uint32_t movi_end_offset;
-    uint32_t current_offset;
-    uint32_t frame_delay_ms;
+    sd_reader_t *reader;      // Read-ahead stream of the movi list (NULL: read inline from f)
+    uint8_t *inline_buf;      // Inline fallback: the part of the frame libjpeg is at
+    uint8_t *pool[VIDEO_PIPE_MAX_FRAMES]; // Decoded RGB565 frames in PSRAM
+    uint32_t *grid[VIDEO_PIPE_MAX_FRAMES]; // Tile hashes of each, after its pixels (NULL: none)
+    bool grid_ok[VIDEO_PIPE_MAX_FRAMES];   // Hashed from a whole-frame decode
+    uint8_t pool_count;
+    lv_image_dsc_t img_dsc;   // The image's source; its data is switched to each new frame
+    int8_t shown;             // Pool buffer on screen through LVGL (-1: none or not all of it)
+    uint32_t since_full;      // Frames presented since the whole image was redrawn
+    uint64_t redraw_px;       // Pixels invalidated and frame pixels presented, since the
+    uint64_t frame_px;        // last stats line
+    lv_timer_t *timer;        // Presenter
+    video_pipe_t pipe;
+    SemaphoreHandle_t lock;   // Pipe state and the frame index
+    SemaphoreHandle_t done;   // Decoder task exited
+    TaskHandle_t task;
+    TaskHandle_t half_task;   // Bottom parts of split frames (NULL: one core decodes)
+    SemaphoreHandle_t half_done;
+    void (*half_fn)(void *arg);   // What it runs next, NULL to exit
+    void *half_arg;
+    volatile bool closing;
+    avi_info_t info;
+    avi_index_t index;        // Video frames: offsets for seeking and stepping
+    uint32_t frame;           // Frame on screen
+    mjpeg_rect_t crop;        // Part of the frame on screen (w == 0: all), set by the LVGL task
+    // Decoder task only
+    mjpeg_decoder_t *dec;     // libjpeg set up once for the stream
+    uint32_t *hash_grid;      // Where the decoder hashes the frame it writes
+    uint32_t dec_frame;       // Last frame decoded
+    uint32_t current_offset;  // Inline fallback: next chunk to read
+    uint32_t inline_pos;      // Inline fallback: file offset of the frame's next bytes
+    uint32_t inline_left;     // and how many are still to come
+    bool pulled;              // libjpeg asked for more of the frame than its first part
+    bool seek_pending;
+    bool stream_failed;
     bool is_playing;
+    // Presenter timing, since the last stats line
+    int64_t last_tick_us;
+    uint32_t tick_max_us;
+    uint32_t present_max_us;
+    int64_t log_us;           // When the last stats line was written
+    uint32_t log_presented;   // Frames presented by then
+    // Video plane: the decoder writes frames straight to the panel while plane_on
+    bool plane_want;
+    bool plane_held;          // LVGL task: the area is reserved with lvgl_mgr
+    bool plane_failed;        // Not for this source, LVGL shows the frames
+    volatile bool plane_on;
+    int32_t plane_x;
+    int32_t plane_y;
+    uint32_t plane_w;
+    uint32_t plane_h;
+    uint8_t *band[AVI_BAND_COUNT];
+    uint8_t band_next;
+    SemaphoreHandle_t band_free;  // Band buffers not queued to the panel
+    bool band_err;            // Decoder: the panel refused a band
+    video_pipe_frame_t direct;    // Decoder: the frame going to the plane
 } ui_avi_t;
 
-static void ui_avi_cleanup(lv_event_t * e) {
-    lv_obj_t * obj = lv_event_get_target(e);
-    ui_avi_t * avi = (ui_avi_t *)lv_obj_get_user_data(obj);
-    
-    if (avi) {
-        if (avi->timer) {
-            lv_timer_delete(avi->timer);
-            avi->timer = NULL;
+static void avi_lock(void *ctx) {
+    xSemaphoreTake(((ui_avi_t *)ctx)->lock, portMAX_DELAY);
+}
+
+static void avi_unlock(void *ctx) {
+    xSemaphoreGive(((ui_avi_t *)ctx)->lock);
+}
+
+static void avi_wake_decoder(void *ctx) {
+    ui_avi_t *avi = (ui_avi_t *)ctx;
+    if (avi->task) xTaskNotifyGive(avi->task);
+}
+
+static void avi_half_task(void *arg) {
+    ui_avi_t *avi = (ui_avi_t *)arg;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (!avi->half_fn) break;
+        avi->half_fn(avi->half_arg);
+        xSemaphoreGive(avi->half_done);
+    }
+    xSemaphoreGive(avi->half_done);
+    vTaskDelete(NULL);
+}
+
+static void avi_half_start(void *ctx, void (*fn)(void *arg), void *arg) {
+    ui_avi_t *avi = (ui_avi_t *)ctx;
+    avi->half_fn = fn;
+    avi->half_arg = arg;
+    xTaskNotifyGive(avi->half_task);
+}
+
+static void avi_half_wait(void *ctx) {
+    xSemaphoreTake(((ui_avi_t *)ctx)->half_done, portMAX_DELAY);
+}
+
+// Decoder hook, on both cores for a split frame: hash the rows of a whole frame while they
+// are still in cache. Frames not of the file's size are not hashed.
+static void avi_hash_rows(void *ctx, uint32_t y, uint32_t count, const uint8_t *px, uint32_t stride) {
+    ui_avi_t *avi = (ui_avi_t *)ctx;
+    if (avi->hash_grid && stride == avi->info.width * 2 && y + count <= avi->info.height) {
+        frame_diff_hash_rows(avi->hash_grid, avi->info.width, y, count, px, stride);
+    }
+}
+
+// The second core for frames with restart markers; without it frames are decoded on one
+static void avi_half_begin(ui_avi_t *avi) {
+    mjpeg_worker_t worker = { .start = avi_half_start, .wait = avi_half_wait, .ctx = avi };
+    avi->half_done = xSemaphoreCreateBinary();
+    if (avi->half_done && mjpeg_decoder_set_worker(avi->dec, &worker) &&
+        xTaskCreatePinnedToCore(avi_half_task, "avi_half", AVI_HALF_TASK_STACK, avi, AVI_HALF_TASK_PRIO,
+                                &avi->half_task, AVI_HALF_TASK_CORE) == pdPASS) {
+        return;
+    }
+    ESP_LOGW(TAG, "Split decoding unavailable, frames decode on one core");
+    avi->half_task = NULL;
+    mjpeg_decoder_set_worker(avi->dec, NULL);
+}
+
+// After the decoder task has stopped: no split is under way
+static void avi_half_end(ui_avi_t *avi) {
+    if (avi->half_task) {
+        avi->half_fn = NULL;
+        xTaskNotifyGive(avi->half_task);
+        xSemaphoreTake(avi->half_done, portMAX_DELAY);
+        avi->half_task = NULL;
+    }
+    if (avi->half_done) {
+        vSemaphoreDelete(avi->half_done);
+        avi->half_done = NULL;
+    }
+}
+
+static uint32_t read_u32(FILE *f) {
+    uint32_t val;
+    if (fread(&val, 1, 4, f) != 4) return 0;
+    return val; // AVI is little-endian, ESP32 is little-endian (mostly), usually matches
+}
+
+static int32_t avi_file_read(void *ctx, uint32_t offset, void *buf, uint32_t len) {
+    FILE *f = (FILE *)ctx;
+    if (fseek(f, offset, SEEK_SET) != 0) return -1;
+    return (int32_t)fread(buf, 1, len, f);
+}
+
+// Frame index array in PSRAM: 8 bytes a frame
+static void *avi_index_realloc(void *ptr, size_t size) {
+    if (!size) {
+        heap_caps_free(ptr);
+        return NULL;
+    }
+    return heap_caps_realloc(ptr, size, MALLOC_CAP_SPIRAM);
+}
+
+// Decoder task: a video chunk is about to be decoded. In a file without an index, add the
+// frame the first time through. Returns its index.
+static uint32_t avi_frame_seen(ui_avi_t *avi, uint32_t offset, uint32_t size) {
+    avi_lock(avi);
+    avi_index_t *ix = &avi->index;
+    if (!ix->complete) {
+        if (ix->count && offset <= ix->frames[ix->count - 1].offset) {
+            // Back at the start after the last frame without a seek: the pass saw them all
+            if (!avi->seek_pending && avi->dec_frame == ix->count - 1 && offset == ix->frames[0].offset) {
+                ix->complete = true;
+                ESP_LOGI(TAG, "Frame index built while playing: %lu frames", (unsigned long)ix->count);
+            }
+        } else if (!avi_index_note(ix, offset, size)) {
+            ESP_LOGW(TAG, "Frame index full at %lu frames", (unsigned long)ix->count);
         }
-        if (avi->f) {
-            fclose(avi->f);
-            avi->f = NULL;
+    }
+    avi->dec_frame = avi_index_find(ix, offset);
+    avi_unlock(avi);
+    avi->seek_pending = false;
+    return avi->dec_frame;
+}
+
+// Decoder task: continue the source at `frame`
+static void avi_source_seek(ui_avi_t *avi, uint32_t frame) {
+    avi_lock(avi);
+    uint32_t offset = frame < avi->index.count ? avi->index.frames[frame].offset : avi->info.movi_start;
+    avi_unlock(avi);
+    avi->current_offset = offset;
+    sd_reader_seek(avi->reader, offset);
+    avi->seek_pending = true;
+    avi->stream_failed = false;
+}
+
+typedef enum {
+    AVI_FETCH_OK,
+    AVI_FETCH_AGAIN,
+    AVI_FETCH_ERR,
+} avi_fetch_t;
+
+// Frames come zero-copy out of the SD read-ahead ring as soon as their first part is read;
+// libjpeg pulls the rest through avi_more_streamed(). Valid until sd_reader_release().
+static avi_fetch_t avi_fetch_streamed(ui_avi_t *avi, const uint8_t **data, uint32_t *avail, uint32_t *size,
+                                      uint32_t *offset) {
+    sd_stream_chunk_t chunk;
+    for (int chunks_checked = 0; chunks_checked < 200; chunks_checked++) {
+        sd_stream_res_t res = sd_reader_next_part(avi->reader, &chunk, MJPEG_HEAD_BYTES);
+        if (res == SD_STREAM_AGAIN) {
+            sd_reader_wait(avi->reader, 20);
+            return AVI_FETCH_AGAIN;
         }
-        for(int i=0; i<2; i++) {
-            if (avi->frame_buffer[i]) {
-                free(avi->frame_buffer[i]);
-                avi->frame_buffer[i] = NULL;
+        if (res != SD_STREAM_OK) return AVI_FETCH_ERR;
+        if (!avi_is_video_chunk(&avi->info, chunk.id) || chunk.size == 0) continue;
+        *data = chunk.data;
+        *avail = chunk.avail;
+        *size = chunk.size;
+        *offset = chunk.offset - 8;
+        return AVI_FETCH_OK;
+    }
+    return AVI_FETCH_AGAIN;
+}
+
+// Decoder task, inside libjpeg: the next part of the frame out of the ring, waiting for the
+// I/O task to read it
+static uint32_t avi_more_streamed(void *ctx, const uint8_t **data) {
+    ui_avi_t *avi = (ui_avi_t *)ctx;
+    uint32_t len;
+    for (;;) {
+        avi->pulled = true;
+        sd_stream_res_t res = sd_reader_more(avi->reader, data, &len);
+        if (res == SD_STREAM_OK) return len;
+        if (res != SD_STREAM_AGAIN || avi->closing) return 0;
+        sd_reader_wait(avi->reader, 20);
+    }
+}
+
+// Inline fallback: the next piece of the frame at inline_pos into the inline buffer
+static uint32_t avi_more_inline(void *ctx, const uint8_t **data) {
+    ui_avi_t *avi = (ui_avi_t *)ctx;
+    uint32_t len = avi->inline_left < AVI_INLINE_BUF_SIZE ? avi->inline_left : AVI_INLINE_BUF_SIZE;
+    avi->pulled = true;
+    if (!len || avi_file_read(avi->f, avi->inline_pos, avi->inline_buf, len) != (int32_t)len) {
+        if (len) ESP_LOGE(TAG, "Read failed at %lu", (unsigned long)avi->inline_pos);
+        avi->inline_left = 0;
+        return 0;
+    }
+    avi->inline_pos += len;
+    avi->inline_left -= len;
+    *data = avi->inline_buf;
+    return len;
+}
+
+// Fallback without the reader: the chunk found with one read when the index is complete,
+// else by walking the chunks, then its first part into the inline buffer
+static avi_fetch_t avi_fetch_inline(ui_avi_t *avi, const uint8_t **data, uint32_t *avail, uint32_t *size,
+                                    uint32_t *offset) {
+    avi_lock(avi);
+    bool indexed = avi->index.complete;
+    avi_frame_t fr = {0};
+    uint32_t next = avi->info.movi_start;
+    if (indexed) {
+        uint32_t k = avi_index_find(&avi->index, avi->current_offset);
+        if (k >= avi->index.count) k = 0;
+        fr = avi->index.frames[k];
+        if (k + 1 < avi->index.count) next = avi->index.frames[k + 1].offset;
+    }
+    avi_unlock(avi);
+
+    if (!indexed) {
+        fr.size = 0;
+        fseek(avi->f, avi->current_offset, SEEK_SET);
+        int chunks_checked = 0;
+        while (!fr.size && ftell(avi->f) < avi->info.movi_end) {
+            if (chunks_checked++ > 200) return AVI_FETCH_AGAIN; // Limit search (audio/padding gaps)
+
+            long chunk_pos = ftell(avi->f);
+            uint32_t id = read_u32(avi->f);
+            uint32_t chunk_size = read_u32(avi->f);
+            long next_chunk = chunk_pos + 8 + chunk_size + (chunk_size & 1); // Align to even
+            avi->current_offset = next_chunk;
+            if (avi_is_video_chunk(&avi->info, id) && chunk_size > 0) {
+                fr = (avi_frame_t){ (uint32_t)chunk_pos, chunk_size };
+            } else {
+                fseek(avi->f, next_chunk, SEEK_SET);
             }
         }
-        if (avi->work_buffer) {
-            free(avi->work_buffer);
-            avi->work_buffer = NULL;
+        if (!fr.size) {
+            // End of movie loop
+            avi->current_offset = avi->info.movi_start;
+            return AVI_FETCH_AGAIN;
         }
-        free(avi);
-        lv_obj_set_user_data(obj, NULL);
+        next = avi->current_offset;
     }
+
+    avi->current_offset = next;
+    avi->inline_pos = fr.offset + 8;
+    avi->inline_left = fr.size;
+    *avail = avi_more_inline(avi, data);
+    if (!*avail) return AVI_FETCH_ERR;
+    *size = fr.size;
+    *offset = fr.offset;
+    return AVI_FETCH_OK;
 }
 
-static uint32_t read_u32(FILE *f) {
-    uint32_t val;
-    if (fread(&val, 1, 4, f) != 4) return 0;
-    return val; // AVI is little-endian, ESP32 is little-endian (mostly), usually matches
+// Panel task: a band is on the panel, its buffer is free
+static void avi_band_done(void *ctx) {
+    xSemaphoreGive(((ui_avi_t *)ctx)->band_free);
+}
+
+static uint8_t *avi_band_get(void *ctx) {
+    ui_avi_t *avi = (ui_avi_t *)ctx;
+    // Flushes complete in order, so the buffers come free in turn
+    if (xSemaphoreTake(avi->band_free, pdMS_TO_TICKS(200)) != pdTRUE) return NULL;
+    uint8_t *band = avi->band[avi->band_next];
+    avi->band_next = (avi->band_next + 1) % AVI_BAND_COUNT;
+    return band;
 }
 
-static bool parse_avi_chunks(ui_avi_t *avi) {
-    if (!avi->f) return false;
-    fseek(avi->f, 0, SEEK_SET);
-    
-    uint32_t riff = read_u32(avi->f);
-    if (riff != 0x46464952) { // "RIFF"
-        ESP_LOGE(TAG, "Not a RIFF file");
+static bool avi_band_put(void *ctx, uint32_t y, uint32_t rows, uint32_t width, uint8_t *band) {
+    ui_avi_t *avi = (ui_avi_t *)ctx;
+    // Rows past the plane (a frame larger than the header said) are dropped
+    if (!rows || y + rows > avi->plane_h) {
+        xSemaphoreGive(avi->band_free);
+        return true;
+    }
+    if (lvgl_mgr_video_plane_flush(avi->plane_x, avi->plane_y + y, avi->plane_x + width - 1,
+                                   avi->plane_y + y + rows - 1, band, avi_band_done, avi) != ESP_OK) {
+        xSemaphoreGive(avi->band_free);
+        avi->band_err = true;
         return false;
     }
-    
-    read_u32(avi->f); // file size
-    
-    uint32_t avi_sig = read_u32(avi->f);
-    if (avi_sig != 0x20495641) { // "AVI "
-        ESP_LOGE(TAG, "Not an AVI file");
+    return true;
+}
+
+// Decoder task: wait until the scheduled direct frame is nearly due, then decode it to
+// the panel. False if it was not shown.
+static bool avi_decode_direct(ui_avi_t *avi, const uint8_t *data, uint32_t avail, uint32_t size) {
+    video_pipe_frame_t *d = &avi->direct;
+    int64_t wait;
+    while ((wait = video_pipe_direct_wait(&avi->pipe, d, avi->pipe.decode_est_us, esp_timer_get_time())) != 0) {
+        if (wait == VIDEO_PIPE_WAIT_STALE || avi->closing) return false;
+        // Play, a seek or closing wake it early
+        ulTaskNotifyTake(pdTRUE, wait == VIDEO_PIPE_WAIT_PAUSED ? pdMS_TO_TICKS(100) : pdMS_TO_TICKS(wait / 1000) + 1);
+    }
+    mjpeg_band_sink_t sink = {
+        .get = avi_band_get, .put = avi_band_put, .ctx = avi,
+        .rows = AVI_BAND_ROWS, .max_width = avi->plane_w, .big_endian = true,
+    };
+    int64_t t0 = esp_timer_get_time();
+    avi->band_err = false;
+    hal_mgr_power_begin(POWER_GOV_WORK_DECODE);
+    bool ok = mjpeg_decode_bands(avi->dec, data, avail, &sink, &d->w, &d->h);
+    hal_mgr_power_end(POWER_GOV_WORK_DECODE);
+    int64_t now = esp_timer_get_time();
+    d->decode_us = (uint32_t)(now - t0);
+    if (!ok) {
+        if (avi->band_err) {
+            // Plane gone (the display rotated): LVGL shows the frames from now on
+            ESP_LOGW(TAG, "Video plane lost, back to LVGL composition");
+            avi->plane_failed = true;
+            avi->plane_on = false;
+        } else {
+            ESP_LOGE(TAG, "JPEG decode error (frame %lu, %u bytes)", (unsigned long)d->frame, (unsigned int)size);
+        }
+        // Counted as discarded
+        video_pipe_submit(&avi->pipe, d, false);
         return false;
     }
-    
-    bool movi_found = false;
-    long file_size_check = 0;
-    fseek(avi->f, 0, SEEK_END);
-    file_size_check = ftell(avi->f);
-    fseek(avi->f, 12, SEEK_SET); // Skip RIFF header
-
-    while (ftell(avi->f) < file_size_check) {
-        uint32_t id;
-        uint32_t size;
-        
-        if (fread(&id, 1, 4, avi->f) != 4) break;
-        if (fread(&size, 1, 4, avi->f) != 4) break;
-
-        long chunk_start = ftell(avi->f);
-        // Align to even bytes
-        long next_chunk = chunk_start + size + (size & 1);
-        
-        if (next_chunk > file_size_check + 8) { // Allow small tolerance
-             ESP_LOGW(TAG, "Chunk size %u extends past EOF", (unsigned int)size);
-             break; 
+    video_pipe_direct_shown(&avi->pipe, d, now);
+    avi->frame = d->frame;
+    return true;
+}
+
+// Stage 2 of 3 (after the SD reader, before the presenter): compressed chunks in, RGB565
+// frames out, as far ahead as the pool allows. With a video plane it presents too,
+// writing each frame to the panel when due.
+static void avi_decode_task(void *arg) {
+    ui_avi_t *avi = (ui_avi_t *)arg;
+    video_pipe_frame_t *f = NULL;
+    while (!avi->closing) {
+        uint32_t seek_frame;
+        if (video_pipe_take_seek(&avi->pipe, &seek_frame)) avi_source_seek(avi, seek_frame);
+        bool direct = avi->plane_on;
+        if (!direct && !f && !(f = video_pipe_acquire(&avi->pipe))) {
+            // Pool full: a buffer frees up when the next frame is shown
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(50));
+            continue;
         }
 
-        if (id == 0x5453494C) { // "LIST"
-            uint32_t type = read_u32(avi->f);
-            
-            if (type == 0x6C726468) { // "hdrl"
-                // We are inside hdrl, let's look for avih
-                long hdrl_end = next_chunk;
-                long current_pos = ftell(avi->f);
-                
-                while (current_pos < hdrl_end - 8) {
-                    uint32_t sub_id;
-                    uint32_t sub_size;
-                    
-                    if (fread(&sub_id, 1, 4, avi->f) != 4) break;
-                    if (fread(&sub_size, 1, 4, avi->f) != 4) break;
-                    
-                    if (sub_size == 0 && sub_id == 0) break; // Avoid infinite loop on zeros
-
-                    long sub_next = ftell(avi->f) + sub_size + (sub_size & 1);
-                    
-                    if (sub_id == 0x68697661) { // "avih"
-                        if (sub_size >= 4) {
-                            uint32_t usec_per_frame = read_u32(avi->f);
-                            if (usec_per_frame > 0) {
-                                avi->frame_delay_ms = usec_per_frame / 1000;
-                                ESP_LOGI(TAG, "AVI Header: %lu us/frame -> %lu ms delay", (unsigned long)usec_per_frame, (unsigned long)avi->frame_delay_ms);
-                            }
-                        }
-                    }
-                    
-                    fseek(avi->f, sub_next, SEEK_SET);
-                    current_pos = ftell(avi->f);
-                }
-                // Done with hdrl, move to next main chunk
-                fseek(avi->f, next_chunk, SEEK_SET);
-                continue;
+        const uint8_t *data = NULL;
+        uint32_t avail = 0, size = 0, offset = 0;
+        avi_fetch_t res = avi->reader ? avi_fetch_streamed(avi, &data, &avail, &size, &offset)
+                                      : avi_fetch_inline(avi, &data, &avail, &size, &offset);
+        if (res != AVI_FETCH_OK) {
+            if (res == AVI_FETCH_ERR) {
+                if (!avi->stream_failed) ESP_LOGE(TAG, "AVI stream stopped");
+                avi->stream_failed = true;
+                ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
             }
-            
-            if (type == 0x69766F6D) { // "movi"
-                avi->movi_start_offset = ftell(avi->f);
-                avi->movi_end_offset = next_chunk - 4; // -4 because we read type
-                avi->current_offset = avi->movi_start_offset;
-                movi_found = true;
-                ESP_LOGI(TAG, "MOVI chunk found: Start=%ld End=%ld", avi->movi_start_offset, avi->movi_end_offset);
-                // Continue scanning to find other chunks if necessary, or break if satisfied
-                // For safety, let's break if we found movi and header (optional, but robust)
+            continue;
+        }
+
+        uint32_t frame = avi_frame_seen(avi, offset, size);
+        if (direct) {
+            if (video_pipe_schedule(&avi->pipe, &avi->direct, frame, esp_timer_get_time())) {
+                avi_decode_direct(avi, data, avail, size);
             }
+            if (avi->reader) sd_reader_release(avi->reader);
+            continue;
+        }
+        int64_t t0 = esp_timer_get_time();
+        if (!video_pipe_schedule(&avi->pipe, f, frame, t0)) {
+            // Would be late: keep the buffer for the next frame
+            if (avi->reader) sd_reader_release(avi->reader);
+            continue;
+        }
+        avi_lock(avi);
+        mjpeg_rect_t crop = avi->crop;
+        avi_unlock(avi);
+        avi->pulled = false;
+        uint8_t slot = (uint8_t)(f - avi->pipe.frames);
+        avi->hash_grid = avi->grid[slot];
+        hal_mgr_power_begin(POWER_GOV_WORK_DECODE);
+        bool ok = false, whole = false;
+        if (crop.w) {
+            // Only what is on screen, in place; the rest of the buffer is never shown
+            mjpeg_rect_t got;
+            ok = mjpeg_decode_region(avi->dec, data, avail, 1, &crop, f->buf, avi->info.width * 2, f->buf_size, true,
+                                     &got, &f->w, &f->h);
         }
-        
-        fseek(avi->f, next_chunk, SEEK_SET);
+        // Again whole only while the start of the frame is still in hand; a region decode
+        // that failed further on had a bad frame
+        if (!ok && !avi->pulled) {
+            ok = whole = mjpeg_decode_rgb565(avi->dec, data, avail, f->buf, f->buf_size, &f->w, &f->h);
+        }
+        hal_mgr_power_end(POWER_GOV_WORK_DECODE);
+        // Only a whole frame of the file's size has all its tiles hashed
+        avi->grid_ok[slot] = whole && avi->hash_grid && f->w == avi->info.width && f->h == avi->info.height;
+        f->decode_us = (uint32_t)(esp_timer_get_time() - t0);
+        // Decoded: let the I/O task reuse the space
+        if (avi->reader) sd_reader_release(avi->reader);
+        if (!ok) ESP_LOGE(TAG, "JPEG decode error (frame %lu, %u bytes)", (unsigned long)frame, (unsigned int)size);
+        video_pipe_submit(&avi->pipe, f, ok);
+        f = NULL;
+    }
+    if (f) video_pipe_submit(&avi->pipe, f, false);
+    if (avi->band_free) {
+        // Wait for bands still queued to the panel before the buffers can go
+        for (int i = 0; i < AVI_BAND_COUNT; i++) xSemaphoreTake(avi->band_free, pdMS_TO_TICKS(500));
+        for (int i = 0; i < AVI_BAND_COUNT; i++) xSemaphoreGive(avi->band_free);
+    }
+    xSemaphoreGive(avi->done);
+    vTaskDelete(NULL);
+}
+
+static void avi_log_stats(ui_avi_t *avi) {
+    video_pipe_stats_t st;
+    uint32_t depth;
+    video_pipe_get_stats(&avi->pipe, &st, &depth);
+    uint32_t avg_us = st.decoded ? (uint32_t)(st.decode_us / st.decoded) : 0;
+    uint32_t depth_x10 = st.depth_samples ? st.depth_sum * 10 / st.depth_samples : 0;
+    uint32_t jitter_us = st.presented ? (uint32_t)(st.jitter_us / st.presented) : 0;
+    // Delivered rate since the last line, against the file's
+    int64_t now = esp_timer_get_time();
+    uint32_t fps_x10 = 0;
+    if (avi->log_us && now > avi->log_us) {
+        fps_x10 = (uint32_t)((int64_t)(st.presented - avi->log_presented) * 10000000 / (now - avi->log_us));
+    }
+    avi->log_us = now;
+    avi->log_presented = st.presented;
+    uint32_t file_fps_x10 = avi->pipe.period_us ? 10000000 / avi->pipe.period_us : 0;
+    mjpeg_decoder_stats_t ds;
+    mjpeg_decoder_get_stats(avi->dec, &ds);
+    char sd[96] = "inline";
+    if (avi->reader) {
+        sd_reader_stats_t rs;
+        sd_reader_get_stats(avi->reader, &rs);
+        snprintf(sd, sizeof(sd), "%lu KB/s (%s), %lu KB ring, %lu stalls + %lu mid-frame", (unsigned long)rs.kb_per_s,
+                 rs.raw ? "raw" : "FATFS", (unsigned long)(rs.ring_size / 1024), (unsigned long)rs.stream.stalls,
+                 (unsigned long)rs.stream.part_stalls);
+    }
+    // Pixel bytes through PSRAM per frame. Through LVGL: the decoder writes the frame, the
+    // image draw reads what was invalidated and writes the draw buffer, the flush swaps the
+    // buffer in place (read + write) and the DMA reads it. The plane keeps pixels in internal RAM.
+    uint32_t redraw_pct = avi->frame_px ? (uint32_t)(avi->redraw_px * 100 / avi->frame_px) : 100;
+    avi->redraw_px = 0;
+    avi->frame_px = 0;
+    uint32_t frame_kb = avi->info.width * avi->info.height * 2 / 1024;
+    uint32_t psram_kb = avi->plane_on ? 0 : frame_kb + frame_kb * 5 * redraw_pct / 100;
+    ESP_LOGI(TAG, "AVI frame %lu: %lu.%lu of %lu.%lu fps, %lu dropped, jitter %lu.%lu ms avg / %lu ms max; "
+             "decode %lu.%lu ms avg / %lu ms max, ready %lu.%lu avg / %lu max, "
+             "%lu late, %lu underruns, %lu discarded; %s, %lu%% redrawn, %lu KB PSRAM/frame; LVGL tick gap max %lu ms, "
+             "present max %lu us; SD %s; JPEG tables reused %lu of %lu, %lu split, %lu KB arena",
+             (unsigned long)st.presented, (unsigned long)(fps_x10 / 10), (unsigned long)(fps_x10 % 10),
+             (unsigned long)(file_fps_x10 / 10), (unsigned long)(file_fps_x10 % 10), (unsigned long)st.dropped,
+             (unsigned long)(jitter_us / 1000), (unsigned long)(jitter_us % 1000 / 100),
+             (unsigned long)(st.jitter_max_us / 1000), (unsigned long)(avg_us / 1000), (unsigned long)(avg_us % 1000 / 100),
+             (unsigned long)(st.decode_max_us / 1000), (unsigned long)(depth_x10 / 10), (unsigned long)(depth_x10 % 10),
+             (unsigned long)st.depth_max, (unsigned long)st.late, (unsigned long)st.underruns,
+             (unsigned long)st.discarded, avi->plane_on ? "plane" : "LVGL", (unsigned long)redraw_pct,
+             (unsigned long)psram_kb,
+             (unsigned long)(avi->tick_max_us / 1000),
+             (unsigned long)avi->present_max_us, sd, (unsigned long)ds.tables_reused, (unsigned long)ds.frames,
+             (unsigned long)ds.split, (unsigned long)(ds.arena_bytes / 1024));
+    avi->tick_max_us = 0;
+    avi->present_max_us = 0;
+}
+
+static void avi_free_bands(ui_avi_t *avi) {
+    for (int i = 0; i < AVI_BAND_COUNT; i++) {
+        heap_caps_free(avi->band[i]);
+        avi->band[i] = NULL;
+    }
+    if (avi->band_free) {
+        vSemaphoreDelete(avi->band_free);
+        avi->band_free = NULL;
+    }
+}
+
+// LVGL task, decoder stopped or not using the plane: give the area back to LVGL
+static void avi_plane_release(ui_avi_t *avi) {
+    avi->plane_on = false;
+    if (avi->plane_held) {
+        lvgl_mgr_video_plane_set(NULL);
+        avi->plane_held = false;
+    }
+}
+
+// LVGL task: reserve the image's area for the decoder once it is laid out. The image is
+// sized to the video and moved by a pixel if needed, as the panel wants even coordinates.
+static void avi_plane_activate(lv_obj_t *obj, ui_avi_t *avi) {
+    uint32_t w = avi->info.width;
+    uint32_t h = avi->info.height;
+    if (w & 1 || h & 1 || !w || !h) {
+        ESP_LOGW(TAG, "Video plane needs an even size, not %lux%lu", (unsigned long)w, (unsigned long)h);
+        avi->plane_failed = true;
+        return;
+    }
+    lv_obj_set_size(obj, w, h);
+    lv_obj_update_layout(obj);
+    lv_area_t a;
+    lv_obj_get_coords(obj, &a);
+    if (a.x1 & 1 || a.y1 & 1) {
+        lv_obj_set_style_translate_x(obj, a.x1 & 1, 0);
+        lv_obj_set_style_translate_y(obj, a.y1 & 1, 0);
+        lv_obj_update_layout(obj);
+        lv_obj_get_coords(obj, &a);
+    }
+    // The decoder writes all of it, so none may be clipped
+    lv_area_t vis = a;
+    if (!lv_obj_area_is_visible(obj, &vis) || vis.x1 != a.x1 || vis.y1 != a.y1 || vis.x2 != a.x2 || vis.y2 != a.y2) {
+        ESP_LOGW(TAG, "Video plane needs the whole video on screen");
+        avi->plane_failed = true;
+        return;
+    }
+
+    bool ok = true;
+    avi->band_free = xSemaphoreCreateCounting(AVI_BAND_COUNT, AVI_BAND_COUNT);
+    for (int i = 0; i < AVI_BAND_COUNT; i++) {
+        avi->band[i] = (uint8_t *)heap_caps_malloc(w * AVI_BAND_ROWS * 2, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        ok = ok && avi->band[i];
+    }
+    if (!ok || !avi->band_free) {
+        ESP_LOGW(TAG, "No internal RAM for video plane bands (%lu bytes each)", (unsigned long)(w * AVI_BAND_ROWS * 2));
+        avi_free_bands(avi);
+        avi->plane_failed = true;
+        return;
     }
-    
-    return movi_found;
+    if (lvgl_mgr_video_plane_set(&a) != ESP_OK) {
+        ESP_LOGW(TAG, "Video plane not possible at %ld,%ld", (long)a.x1, (long)a.y1);
+        avi_free_bands(avi);
+        avi->plane_failed = true;
+        return;
+    }
+    avi->plane_x = a.x1;
+    avi->plane_y = a.y1;
+    avi->plane_w = w;
+    avi->plane_h = h;
+    avi->band_next = 0;
+    avi->plane_held = true;
+    // LVGL no longer draws the frames; the decoder picks this up with its next frame
+    lv_image_set_src(obj, NULL);
+    avi->plane_on = true;
+    ESP_LOGI(TAG, "Decoding to the panel at %ld,%ld in %d-row bands", (long)a.x1, (long)a.y1, AVI_BAND_ROWS);
 }
 
+// LVGL task: the part of the frame not clipped by the parents or the screen, e.g. after
+// rotating to portrait makes the media container narrower than the video. Frames are shown
+// 1:1, so cropping is all there is to save.
+static void avi_update_crop(lv_obj_t *obj, ui_avi_t *avi) {
+    lv_area_t coords, vis;
+    lv_obj_get_coords(obj, &coords);
+    vis = coords;
+    mjpeg_rect_t crop = {0};
+    if (lv_obj_area_is_visible(obj, &vis) &&
+        (vis.x1 != coords.x1 || vis.y1 != coords.y1 || vis.x2 != coords.x2 || vis.y2 != coords.y2)) {
+        crop.x = vis.x1 - coords.x1;
+        crop.y = vis.y1 - coords.y1;
+        crop.w = lv_area_get_width(&vis);
+        crop.h = lv_area_get_height(&vis);
+    }
+    if (!memcmp(&crop, &avi->crop, sizeof(crop))) return;
+    // More of the frame shows than was decoded
+    bool grew = avi->crop.w && (!crop.w || crop.x < avi->crop.x || crop.y < avi->crop.y ||
+                                crop.x + crop.w > avi->crop.x + avi->crop.w ||
+                                crop.y + crop.h > avi->crop.y + avi->crop.h);
+    avi_lock(avi);
+    avi->crop = crop;
+    avi_unlock(avi);
+    if (crop.w) {
+        ESP_LOGI(TAG, "Decoding the visible %lux%lu at %lu,%lu of each frame", (unsigned long)crop.w,
+                 (unsigned long)crop.h, (unsigned long)crop.x, (unsigned long)crop.y);
+    } else {
+        ESP_LOGI(TAG, "Decoding whole frames");
+    }
+    // Paused, nothing would fill it in: decode the frame on screen again
+    if (grew && !avi->is_playing) video_pipe_seek(&avi->pipe, avi->frame);
+}
 
-static void avi_timer_cb(lv_timer_t * timer) {
+// LVGL task: redraw only where frame `slot` differs from the one on screen, or all of it
+// when that cannot be told (size changed, not hashed, scaled or not drawn 1:1 at the
+// object's corner) or is due. Returns the pixels invalidated.
+static uint32_t avi_invalidate_changed(lv_obj_t *obj, ui_avi_t *avi, uint8_t slot, uint32_t w, uint32_t h) {
+    int8_t prev = avi->shown;
+    avi->shown = (int8_t)slot;
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    bool diff = prev >= 0 && prev != slot && avi->grid_ok[prev] && avi->grid_ok[slot] &&
+                avi->since_full < AVI_DIFF_FULL_EVERY && lv_image_get_scale(obj) == LV_SCALE_NONE &&
+                lv_image_get_rotation(obj) == 0 && (uint32_t)lv_area_get_width(&coords) == w &&
+                (uint32_t)lv_area_get_height(&coords) == h;
+    if (!diff) {
+        avi->since_full = 0;
+        lv_obj_invalidate(obj);
+        return w * h;
+    }
+    avi->since_full++;
+    frame_diff_box_t boxes[FRAME_DIFF_MAX_BOXES];
+    uint32_t n = frame_diff_boxes(avi->grid[prev], avi->grid[slot], w, h, boxes, FRAME_DIFF_MAX_BOXES, NULL);
+    uint32_t px = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        lv_area_t a = { coords.x1 + (int32_t)boxes[i].x, coords.y1 + (int32_t)boxes[i].y,
+                        coords.x1 + (int32_t)(boxes[i].x + boxes[i].w) - 1,
+                        coords.y1 + (int32_t)(boxes[i].y + boxes[i].h) - 1 };
+        lv_obj_invalidate_area(obj, &a);
+        px += boxes[i].w * boxes[i].h;
+    }
+    return px;
+}
+
+// Stage 3: on the LVGL task, only swaps the image source when a frame is due
+static void avi_present_cb(lv_timer_t * timer) {
     lv_obj_t * obj = (lv_obj_t *)lv_timer_get_user_data(timer);
     ui_avi_t * avi = (ui_avi_t *)lv_obj_get_user_data(obj);
-    
-    if (!avi || !avi->is_playing || !avi->f) return;
-    
-    // Seek to current offset
-    fseek(avi->f, avi->current_offset, SEEK_SET);
-    
-    int chunks_checked = 0;
-    while (ftell(avi->f) < avi->movi_end_offset) {
-        if (chunks_checked++ > 200) { // Limit search (increased to handle audio/padding gaps)
-             LOG_AVI("Search limit reached (200 chunks scanned without valid frame).");
-             break;
-        }
+    if (!avi || !avi->task) return;
+
+    int64_t now = esp_timer_get_time();
+    // Gaps between ticks are how long the LVGL task went without running its timers
+    if (avi->last_tick_us && now - avi->last_tick_us > avi->tick_max_us) avi->tick_max_us = (uint32_t)(now - avi->last_tick_us);
+    avi->last_tick_us = now;
 
-        uint32_t id = read_u32(avi->f);
-        uint32_t size = read_u32(avi->f);
-        
-        long payload_pos = ftell(avi->f);
-        long next_chunk = payload_pos + size + (size & 1); // Align to even
-        
-        // Debug first few chunks ended
-        // if (chunks_checked < 5) { ... }
-
-        // Check for "00dc" (Compressed video frame)
-        // 00dc = 0x63643030 (Little Endian)
-        if ((id & 0xFFFF0000) == 0x63640000) { 
-             // LOG_AVI("Chunk %c%c%c%c found, Size=%u", (char)(id), (char)(id>>8), (char)(id>>16), (char)(id>>24), (unsigned int)size);
-             if (size > 0 && size <= AVI_WORK_BUFFER_SIZE) {
-                 // Read into work buffer
-                 size_t read_len = fread(avi->work_buffer, 1, size, avi->f);
-                 if (read_len == size) {
-                     // Verify JPEG header (SOI)
-                     if (avi->work_buffer[0] == 0xFF && avi->work_buffer[1] == 0xD8) {
-                         
-                         // Decode JPEG using libjpeg-turbo
-                         struct jpeg_decompress_struct cinfo;
-                         struct my_error_mgr jerr;
-                         int64_t t_start = esp_timer_get_time();
-                         
-                         cinfo.err = jpeg_std_error(&jerr.pub);
-                         jerr.pub.error_exit = my_error_exit;
-                         
-                         if (setjmp(jerr.setjmp_buffer)) {
-                             // If we get here, the JPEG code has signaled an error.
-                             ESP_LOGE(TAG, "JPEG decode error");
-                             jpeg_destroy_decompress(&cinfo);
-                             goto skip_frame;
-                         }
-                         
-                         jpeg_create_decompress(&cinfo);
-                         jpeg_mem_src(&cinfo, avi->work_buffer, size);
-                         jpeg_read_header(&cinfo, TRUE);
-                         
-                         // Configure for RGB565 Output
-                         cinfo.out_color_space = JCS_RGB565;
-                         cinfo.dct_method = JDCT_IFAST; // Speed over quality
-                         
-                         jpeg_start_decompress(&cinfo);
-                         
-                         uint32_t w = cinfo.output_width;
-                         uint32_t h = cinfo.output_height;
-                         
-                         // Update descriptor if needed
-                         if (avi->img_dsc[avi->dsc_idx].header.w != w || avi->img_dsc[avi->dsc_idx].header.h != h) {
-                             avi->img_dsc[avi->dsc_idx].header.w = w;
-                             avi->img_dsc[avi->dsc_idx].header.h = h;
-                         }
-                         
-                         // Decompress into the large frame buffer
-                         uint8_t *dest = avi->frame_buffer[avi->dsc_idx];
-                         JSAMPROW row_pointer[1];
-                         int row_stride = w * 2; // RGB565
-                         
-                         while (cinfo.output_scanline < h) {
-                             row_pointer[0] = &dest[cinfo.output_scanline * row_stride];
-                             jpeg_read_scanlines(&cinfo, row_pointer, 1);
-                         }
-                         
-                         jpeg_finish_decompress(&cinfo);
-                         jpeg_destroy_decompress(&cinfo);
-                         
-                         int64_t t_end = esp_timer_get_time();
-
-                         avi->img_dsc[avi->dsc_idx].data_size = w * h * 2; // Valid pixel data size
-
-                         // Refresh LVGL image
-                         // Vital: Drop cache for the reused descriptor pointer
-                         lv_image_cache_drop(&avi->img_dsc[avi->dsc_idx]);
-                         
-                         static int frame_count = 0;
-                         if (++frame_count % 15 == 0) {
-                             ESP_LOGI(TAG, "AVI Frame: %d, Size: %u, Decode: %lld ms", frame_count, (unsigned int)size, (t_end - t_start)/1000);
-                         }
-
-                         // Re-apply source and invalidate to force redraw
-                         // Using the toggled descriptor address trick
-                         lv_image_set_src(obj, &avi->img_dsc[avi->dsc_idx]); 
-                         
-                         // Toggle index for next frame
-                         avi->dsc_idx = (avi->dsc_idx + 1) % 2;
-
-                         lv_obj_invalidate(obj);
-                         
-                         // Save state for next tick
-                         avi->current_offset = next_chunk;
-                         return; // Displayed a frame, yield to LVGL
-
-                     } else {
-                         // Not a JPEG
-                     }
-                 } else {
-                     ESP_LOGE(TAG, "Read mismatch! Req=%u Got=%u at %ld", (unsigned int)size, (unsigned int)read_len, payload_pos);
-                 }
-                   skip_frame:;
-             } else {
-                 if (size > AVI_WORK_BUFFER_SIZE) {
-                    ESP_LOGE(TAG, "Frame size %u too big (Max %d)", (unsigned int)size, AVI_WORK_BUFFER_SIZE);
-                 }
-             }
+    if (avi->plane_want && !avi->plane_held && !avi->plane_failed) avi_plane_activate(obj, avi);
+    if (avi->plane_held && !avi->plane_on) {
+        // The decoder lost the plane; LVGL shows the frames again
+        avi_plane_release(avi);
+    }
+    if (!avi->plane_on) avi_update_crop(obj, avi);
+    if (avi->plane_on) {
+        // The decoder presents; frames decoded for LVGL before the switch are let go
+        video_pipe_present(&avi->pipe, now);
+        avi->shown = -1;
+        if (avi->pipe.stats.presented >= avi->log_presented + AVI_STATS_EVERY) avi_log_stats(avi);
+        return;
+    }
+
+    video_pipe_frame_t *f = video_pipe_present(&avi->pipe, now);
+    if (!f) return;
+    uint8_t slot = (uint8_t)(f - avi->pipe.frames);
+    lv_image_dsc_t *dsc = &avi->img_dsc;
+    // Setting the source invalidates the whole image: only when the size changes, else
+    // the same descriptor just points at the new pixels
+    bool resized = !dsc->data || dsc->header.w != f->w || dsc->header.h != f->h;
+    dsc->header.w = f->w;
+    dsc->header.h = f->h;
+    dsc->header.stride = f->w * 2;
+    dsc->data_size = f->w * f->h * 2; // Valid pixel data size
+    dsc->data = f->buf;
+    // Vital: Drop cache for the reused descriptor pointer
+    lv_image_cache_drop(dsc);
+    if (resized) {
+        avi->shown = -1;
+        lv_image_set_src(obj, dsc);
+    }
+    avi->redraw_px += avi_invalidate_changed(obj, avi, slot, f->w, f->h);
+    avi->frame_px += f->w * f->h;
+    avi->frame = f->frame;
+
+    uint32_t spent = (uint32_t)(esp_timer_get_time() - now);
+    if (spent > avi->present_max_us) avi->present_max_us = spent;
+    if (avi->pipe.stats.presented >= avi->log_presented + AVI_STATS_EVERY) avi_log_stats(avi);
+}
+
+// Stop the decoder and drop the file; the pool stays for the next source
+static void avi_close_source(ui_avi_t *avi) {
+    if (avi->task) {
+        avi->closing = true;
+        xTaskNotifyGive(avi->task);
+        xSemaphoreTake(avi->done, portMAX_DELAY);
+        avi->task = NULL;
+        avi->closing = false;
+    }
+    if (avi->f) {
+        fclose(avi->f);
+        avi->f = NULL;
+    }
+    if (avi->reader) {
+        sd_reader_close(avi->reader);
+        avi->reader = NULL;
+    }
+    heap_caps_free(avi->inline_buf);
+    avi->inline_buf = NULL;
+    avi_plane_release(avi);
+    avi_free_bands(avi);
+}
+
+static void avi_free_pool(ui_avi_t *avi) {
+    for (int i = 0; i < VIDEO_PIPE_MAX_FRAMES; i++) {
+        heap_caps_free(avi->pool[i]);
+        avi->pool[i] = NULL;
+        avi->grid[i] = NULL;
+    }
+    avi->pool_count = 0;
+}
+
+static void ui_avi_cleanup(lv_event_t * e) {
+    lv_obj_t * obj = lv_event_get_target(e);
+    ui_avi_t * avi = (ui_avi_t *)lv_obj_get_user_data(obj);
+
+    if (avi) {
+        avi_close_source(avi);
+        if (avi->timer) {
+            lv_timer_delete(avi->timer);
+            avi->timer = NULL;
         }
-        
-        // Move to next chunk
-        fseek(avi->f, next_chunk, SEEK_SET);
-        avi->current_offset = next_chunk;
+        avi_free_pool(avi);
+        avi_index_free(&avi->index);
+        avi_half_end(avi);
+        mjpeg_decoder_destroy(avi->dec);
+        vSemaphoreDelete(avi->lock);
+        vSemaphoreDelete(avi->done);
+        free(avi);
+        lv_obj_set_user_data(obj, NULL);
     }
-    
-    // End of movie loop
-    avi->current_offset = avi->movi_start_offset;
 }
 
 lv_obj_t * ui_avi_create(lv_obj_t * parent) {
     lv_obj_t * obj = lv_image_create(parent);
-    
+
     ui_avi_t * avi = (ui_avi_t *)calloc(1, sizeof(ui_avi_t));
     if (!avi) return NULL;
-    
-    // Allocate frame buffers in PSRAM
-    // We allocate TWO buffers to ensure that when we switch descriptors,
-    // the 'data' pointer also changes. explicit cache invalidation 
-    // works better when the underlying data pointer is different.
-    for(int i=0; i<2; i++) {
-        avi->frame_buffer[i] = (uint8_t *)heap_caps_malloc(AVI_PIXEL_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
-        if (!avi->frame_buffer[i]) {
-            ESP_LOGE(TAG, "Failed to allocate AVI frame buffer %d in PSRAM", i);
-            return NULL; 
-        }
-    }
 
-    // Allocate work buffer for compressed data
-    avi->work_buffer = (uint8_t *)heap_caps_malloc(AVI_WORK_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
-    if (!avi->work_buffer) {
-        ESP_LOGE(TAG, "Failed to allocate AVI work buffer");
+    avi->lock = xSemaphoreCreateMutex();
+    avi->done = xSemaphoreCreateBinary();
+    avi->dec = mjpeg_decoder_create();
+    if (!avi->lock || !avi->done || !avi->dec) {
+        ESP_LOGE(TAG, "Failed to allocate AVI player");
+        mjpeg_decoder_destroy(avi->dec);
+        if (avi->lock) vSemaphoreDelete(avi->lock);
+        if (avi->done) vSemaphoreDelete(avi->done);
+        free(avi);
         return NULL;
     }
-    
-    // Initialize standard Image Descriptors (Double Buffered)
-    for(int i=0; i<2; i++) {
-        avi->img_dsc[i].header.magic = LV_IMAGE_HEADER_MAGIC;
-        avi->img_dsc[i].header.cf = LV_COLOR_FORMAT_RGB565; 
-        avi->img_dsc[i].header.w = 300; 
-        avi->img_dsc[i].header.h = 300; 
-        avi->img_dsc[i].header.stride = 0; // LVGL will calculate stride from width
-        avi->img_dsc[i].data = avi->frame_buffer[i]; // POINT TO SEPARATE BUFFERS
-        avi->img_dsc[i].data_size = 0;
-    }
+    avi_index_init(&avi->index, avi_index_realloc);
+    avi_half_begin(avi);
+    mjpeg_rows_hook_t hook = { .rows = avi_hash_rows, .ctx = avi };
+    mjpeg_decoder_set_rows_hook(avi->dec, &hook);
+    avi->shown = -1;
 
-    avi->frame_delay_ms = 33; // Default to ~30fps, will be overridden by header
-    
     lv_obj_set_user_data(obj, avi);
     lv_obj_add_event_cb(obj, ui_avi_cleanup, LV_EVENT_DELETE, NULL);
-    
+
     return obj;
 }
 
+// Decoded frames in PSRAM, sized for this file: one on screen, the one before it (LVGL may
+// still be drawing from it), one ready and one being decoded. Each has room for its tile
+// hashes after the pixels (`grid_words`, 0: none).
+static bool avi_alloc_pool(ui_avi_t *avi, uint32_t frame_bytes, uint32_t grid_words) {
+    avi_free_pool(avi);
+    uint32_t grid_at = (frame_bytes + 3) & ~3u;
+    for (int i = 0; i < VIDEO_PIPE_MAX_FRAMES; i++) {
+        avi->pool[i] = (uint8_t *)heap_caps_malloc(grid_at + grid_words * 4, MALLOC_CAP_SPIRAM);
+        if (!avi->pool[i]) break;
+        avi->grid[i] = grid_words ? (uint32_t *)(avi->pool[i] + grid_at) : NULL;
+        avi->grid_ok[i] = false;
+        avi->pool_count++;
+    }
+    // Three is the least that still lets the decoder work while two are held
+    if (avi->pool_count < 3) {
+        ESP_LOGE(TAG, "Failed to allocate AVI frame buffers in PSRAM (%lu bytes each)", (unsigned long)frame_bytes);
+        avi_free_pool(avi);
+        return false;
+    }
+    // No frame yet: the first sets the image's source
+    memset(&avi->img_dsc, 0, sizeof(avi->img_dsc));
+    avi->img_dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    avi->img_dsc.header.cf = LV_COLOR_FORMAT_RGB565;
+    avi->shown = -1;
+    return true;
+}
+
 void ui_avi_set_src(lv_obj_t * obj, const char * src) {
     ui_avi_t * avi = (ui_avi_t *)lv_obj_get_user_data(obj);
     if (!avi) return;
-    
-    if (avi->f) {
-        fclose(avi->f);
-        avi->f = NULL;
-    }
-    
+
+    avi_close_source(avi);
+
     // Handle LVGL path (e.g. "S:path" or "S:/path") by stripping driver letter if present
     const char * real_path = src;
     if (src[0] && src[1] == ':') {
         real_path = src + 2;
     }
-    
+
     char full_path[512];
+    const char * open_path = real_path;
     // If path is relative (no leading slash), prepend /sdcard/
     if (real_path[0] != '/') {
         snprintf(full_path, sizeof(full_path), "/sdcard/%s", real_path);
-        avi->f = fopen(full_path, "rb");
-    } else {
-        avi->f = fopen(real_path, "rb");
+        open_path = full_path;
     }
+    avi->f = fopen(open_path, "rb");
 
     if (!avi->f) {
         // Fallback: try opening EXACTLY as passed (after stripping S:) just in case
         if (real_path[0] != '/') {
              ESP_LOGW(TAG, "Failed to open AVI at %s. Retrying relative: %s", full_path, real_path);
-             avi->f = fopen(real_path, "rb");
+             open_path = real_path;
+             avi->f = fopen(open_path, "rb");
         }
     }
 
@@ -385,38 +884,188 @@ void ui_avi_set_src(lv_obj_t * obj, const char * src) {
         ESP_LOGE(TAG, "Failed to open AVI: %s", src);
         return;
     }
-    
-    if (parse_avi_chunks(avi)) {
-        ESP_LOGI(TAG, "AVI MOVI list found at %u", (unsigned int)avi->movi_start_offset);
-        avi->is_playing = true;
-        
-        if (!avi->timer) {
-            avi->timer = lv_timer_create(avi_timer_cb, avi->frame_delay_ms, obj);
-        } else {
-            // Update existing timer period if file changed
-             lv_timer_set_period(avi->timer, avi->frame_delay_ms);
-        }
-    } else {
+
+    fseek(avi->f, 0, SEEK_END);
+    long file_size = ftell(avi->f);
+    if (file_size <= 0 || !avi_parse(avi_file_read, avi->f, (uint32_t)file_size, &avi->info)) {
         ESP_LOGE(TAG, "Bad AVI structure");
         fclose(avi->f);
         avi->f = NULL;
+        return;
+    }
+    ESP_LOGI(TAG, "AVI %lux%lu, %lu frames, MOVI list at %lu", (unsigned long)avi->info.width,
+             (unsigned long)avi->info.height, (unsigned long)avi->info.total_frames,
+             (unsigned long)avi->info.movi_start);
+    uint32_t period_us = avi->info.usec_per_frame ? avi->info.usec_per_frame : 33333; // Default to ~30fps
+    ESP_LOGI(TAG, "AVI Header: %lu us/frame, frames up to %lu bytes", (unsigned long)period_us,
+             (unsigned long)avi->info.suggested_buffer);
+
+    uint32_t frame_bytes = avi->info.width * avi->info.height * 2;
+    uint32_t grid_words = frame_diff_grid_words(avi->info.width, avi->info.height);
+    if (!frame_bytes || frame_bytes > AVI_PIXEL_BUFFER_SIZE) {
+        frame_bytes = AVI_PIXEL_BUFFER_SIZE;
+        grid_words = 0;
+    }
+    if (!avi_alloc_pool(avi, frame_bytes, grid_words)) {
+        fclose(avi->f);
+        avi->f = NULL;
+        return;
+    }
+
+    // Kept only for the inline fallback; until then it is the scratch for the index
+    avi->inline_buf = (uint8_t *)heap_caps_malloc(AVI_INLINE_BUF_SIZE, MALLOC_CAP_SPIRAM);
+    if (!avi->inline_buf) {
+        ESP_LOGE(TAG, "Failed to allocate the AVI read buffer");
+        avi_close_source(avi);
+        return;
+    }
+    int64_t t0 = esp_timer_get_time();
+    avi_index_src_t isrc = avi_index_load(&avi->index, &avi->info, avi_file_read, avi->f,
+                                          avi->inline_buf, AVI_INLINE_BUF_SIZE);
+    if (isrc != AVI_INDEX_NONE) {
+        ESP_LOGI(TAG, "Frame index from %s: %lu frames in %lld us", avi_index_src_str(isrc),
+                 (unsigned long)avi->index.count, esp_timer_get_time() - t0);
+    } else {
+        ESP_LOGW(TAG, "No frame index in the file, building it while playing");
+    }
+    avi->frame = 0;
+    avi->dec_frame = 0;
+    avi->current_offset = avi->info.movi_start;
+    avi->seek_pending = false;
+    avi->stream_failed = false;
+    avi->plane_failed = false;
+    avi->log_presented = 0;
+    avi->redraw_px = 0;
+    avi->frame_px = 0;
+    memset(&avi->crop, 0, sizeof(avi->crop));
+
+    // Stage 1: stream the movi list from the SD I/O task, reading a frame of the size the
+    // file suggests ahead; the FILE is only kept for the inline fallback
+    if (sd_reader_open(open_path, avi->info.movi_start, avi->info.movi_end, true, avi->info.suggested_buffer,
+                       &avi->reader) == ESP_OK) {
+        fclose(avi->f);
+        avi->f = NULL;
+        heap_caps_free(avi->inline_buf);
+        avi->inline_buf = NULL;
+    } else {
+        ESP_LOGW(TAG, "SD read-ahead unavailable, reading frames inline");
+    }
+    // Frames are handed to libjpeg from their first part; it pulls the rest
+    mjpeg_more_t more = { .more = avi->reader ? avi_more_streamed : avi_more_inline, .ctx = avi };
+    mjpeg_decoder_set_more(avi->dec, &more);
+
+    video_pipe_os_t os = { .lock = avi_lock, .unlock = avi_unlock, .wake_decoder = avi_wake_decoder, .ctx = avi };
+    video_pipe_init(&avi->pipe, avi->pool, avi->pool_count, frame_bytes, period_us, &os);
+    video_pipe_play(&avi->pipe, esp_timer_get_time());
+    avi->is_playing = true;
+    avi->last_tick_us = 0;
+    avi->log_us = 0;
+
+    if (xTaskCreatePinnedToCore(avi_decode_task, "avi_decode", AVI_DECODE_TASK_STACK, avi, AVI_DECODE_TASK_PRIO,
+                                &avi->task, AVI_DECODE_TASK_CORE) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to start the AVI decoder task");
+        avi->task = NULL;
+        avi_close_source(avi);
+        return;
+    }
+    ESP_LOGI(TAG, "Decoding on core %d into %u x %lu KB frames", AVI_DECODE_TASK_CORE,
+             (unsigned)avi->pool_count, (unsigned long)(frame_bytes / 1024));
+
+    if (!avi->timer) {
+        avi->timer = lv_timer_create(avi_present_cb, AVI_PRESENT_PERIOD_MS, obj);
     }
 }
 
 void ui_avi_play(lv_obj_t * obj) {
     ui_avi_t * avi = (ui_avi_t *)lv_obj_get_user_data(obj);
-    if (avi) avi->is_playing = true;
+    if (!avi || !avi->task) return;
+    video_pipe_play(&avi->pipe, esp_timer_get_time());
+    avi->is_playing = true;
 }
 
 void ui_avi_pause(lv_obj_t * obj) {
     ui_avi_t * avi = (ui_avi_t *)lv_obj_get_user_data(obj);
-    if (avi) avi->is_playing = false;
+    if (!avi || !avi->task) return;
+    video_pipe_pause(&avi->pipe, esp_timer_get_time());
+    avi->is_playing = false;
+}
+
+// Continue from `frame`; the decoder moves the source, and the frame is shown as soon as
+// it is decoded, also while paused
+static void avi_seek_frame(ui_avi_t *avi, uint32_t frame) {
+    video_pipe_seek(&avi->pipe, frame);
+    avi->frame = frame;
 }
 
 void ui_avi_stop(lv_obj_t * obj) {
     ui_avi_t * avi = (ui_avi_t *)lv_obj_get_user_data(obj);
-    if (avi) {
-        avi->is_playing = false;
-        avi->current_offset = avi->movi_start_offset;
+    if (!avi || !avi->task) return;
+    ui_avi_pause(obj);
+    avi_seek_frame(avi, 0);
+}
+
+void ui_avi_seek(lv_obj_t * obj, uint32_t ms) {
+    ui_avi_t * avi = (ui_avi_t *)lv_obj_get_user_data(obj);
+    if (!avi || !avi->task) return;
+    avi_lock(avi);
+    uint32_t frame = avi_index_frame_at(&avi->index, &avi->info, ms);
+    avi_unlock(avi);
+    avi_seek_frame(avi, frame);
+}
+
+void ui_avi_step(lv_obj_t * obj, int32_t frames) {
+    ui_avi_t * avi = (ui_avi_t *)lv_obj_get_user_data(obj);
+    if (!avi || !avi->task) return;
+    avi_lock(avi);
+    uint32_t count = avi->index.count;
+    avi_unlock(avi);
+    if (!count) return;
+    ui_avi_pause(obj);
+    int64_t target = (int64_t)avi->frame + frames;
+    if (target < 0) target = 0;
+    if (target >= count) target = count - 1;
+    avi_seek_frame(avi, (uint32_t)target);
+}
+
+bool ui_avi_is_playing(lv_obj_t * obj) {
+    ui_avi_t * avi = (ui_avi_t *)lv_obj_get_user_data(obj);
+    return avi && avi->task && avi->is_playing;
+}
+
+uint32_t ui_avi_get_position_ms(lv_obj_t * obj) {
+    ui_avi_t * avi = (ui_avi_t *)lv_obj_get_user_data(obj);
+    return avi ? avi_frame_ms(&avi->info, avi->frame) : 0;
+}
+
+uint32_t ui_avi_get_duration_ms(lv_obj_t * obj) {
+    ui_avi_t * avi = (ui_avi_t *)lv_obj_get_user_data(obj);
+    if (!avi) return 0;
+    avi_lock(avi);
+    // Until an index-less file has played through, trust the header
+    uint32_t frames = avi->index.count;
+    if (!avi->index.complete && avi->info.total_frames > frames) frames = avi->info.total_frames;
+    avi_unlock(avi);
+    return avi_frame_ms(&avi->info, frames);
+}
+
+uint32_t ui_avi_get_seekable_ms(lv_obj_t * obj) {
+    ui_avi_t * avi = (ui_avi_t *)lv_obj_get_user_data(obj);
+    if (!avi) return 0;
+    avi_lock(avi);
+    uint32_t count = avi->index.count;
+    avi_unlock(avi);
+    return count ? avi_frame_ms(&avi->info, count - 1) : 0;
+}
+
+void ui_avi_set_plane(lv_obj_t * obj, bool en) {
+    ui_avi_t * avi = (ui_avi_t *)lv_obj_get_user_data(obj);
+    if (!avi) return;
+    avi->plane_want = en;
+    if (en) {
+        // Taken on the next presenter tick, once the layout is final
+        avi->plane_failed = false;
+    } else {
+        // A band the decoder sends after this is refused, and it goes back to LVGL
+        avi_plane_release(avi);
     }
 }
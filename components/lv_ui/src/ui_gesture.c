@@ -0,0 +1,82 @@
+#include "ui_gesture.h"
+#include <math.h>
+#include <string.h>
+
+#define RAD_TO_DEG (180.0f / 3.14159265f)
+
+void ui_gesture_init(ui_gesture_t *g) {
+    memset(g, 0, sizeof(*g));
+    g->pinch_slop_px = 16.0f;
+    g->rotate_slop_deg = 10.0f;
+    g->pan_slop_px = 12.0f;
+    g->rotate_min_span_px = 60.0f;
+    g->scale = 1.0f;
+}
+
+static const ui_gesture_point_t * find_id(const ui_gesture_point_t *pts, uint8_t n, uint8_t id) {
+    for (uint8_t i = 0; i < n; i++) {
+        if (pts[i].id == id) return &pts[i];
+    }
+    return NULL;
+}
+
+static ui_gesture_phase_t finish(ui_gesture_t *g) {
+    bool recognized = g->flags != UI_GESTURE_NONE;
+    g->tracking = false;
+    return recognized ? UI_GESTURE_PHASE_END : UI_GESTURE_PHASE_IDLE;
+}
+
+ui_gesture_phase_t ui_gesture_update(ui_gesture_t *g, uint32_t t_ms, const ui_gesture_point_t *pts, uint8_t n) {
+    if (!g->tracking) {
+        if (n < 2) return UI_GESTURE_PHASE_IDLE;
+
+        // Second finger landed: take the baseline
+        float vx = (float)(pts[1].x - pts[0].x);
+        float vy = (float)(pts[1].y - pts[0].y);
+        g->tracking = true;
+        g->ids[0] = pts[0].id;
+        g->ids[1] = pts[1].id;
+        g->d0 = sqrtf(vx * vx + vy * vy);
+        if (g->d0 < 1.0f) g->d0 = 1.0f;
+        g->prev_angle = atan2f(vy, vx) * RAD_TO_DEG;
+        g->start_cx = (pts[0].x + pts[1].x) * 0.5f;
+        g->start_cy = (pts[0].y + pts[1].y) * 0.5f;
+        g->flags = UI_GESTURE_NONE;
+        g->scale = 1.0f;
+        g->angle_deg = 0.0f;
+        g->dx = 0.0f;
+        g->dy = 0.0f;
+        g->t_start_ms = t_ms;
+        g->t_last_ms = t_ms;
+        return UI_GESTURE_PHASE_IDLE;
+    }
+
+    const ui_gesture_point_t *a = find_id(pts, n, g->ids[0]);
+    const ui_gesture_point_t *b = find_id(pts, n, g->ids[1]);
+    if (!a || !b) return finish(g);
+
+    float vx = (float)(b->x - a->x);
+    float vy = (float)(b->y - a->y);
+    float d = sqrtf(vx * vx + vy * vy);
+    float ang = atan2f(vy, vx) * RAD_TO_DEG;
+
+    // Accumulate the per-sample delta so turns past +-180 degrees stay continuous
+    float delta = ang - g->prev_angle;
+    if (delta > 180.0f) delta -= 360.0f;
+    if (delta < -180.0f) delta += 360.0f;
+    g->prev_angle = ang;
+    g->angle_deg += delta;
+
+    g->scale = d / g->d0;
+    g->dx = (a->x + b->x) * 0.5f - g->start_cx;
+    g->dy = (a->y + b->y) * 0.5f - g->start_cy;
+    g->t_last_ms = t_ms;
+
+    uint32_t prev = g->flags;
+    if (fabsf(d - g->d0) >= g->pinch_slop_px) g->flags |= UI_GESTURE_PINCH;
+    if (g->d0 >= g->rotate_min_span_px && fabsf(g->angle_deg) >= g->rotate_slop_deg) g->flags |= UI_GESTURE_ROTATE;
+    if (sqrtf(g->dx * g->dx + g->dy * g->dy) >= g->pan_slop_px) g->flags |= UI_GESTURE_PAN;
+
+    if (g->flags == UI_GESTURE_NONE) return UI_GESTURE_PHASE_IDLE;
+    return prev == UI_GESTURE_NONE ? UI_GESTURE_PHASE_BEGIN : UI_GESTURE_PHASE_CHANGE;
+}
@@ -5,8 +5,17 @@
 #include "esp_chip_info.h"
 #include "sy6970.h"
 #include "sd_card.h"
+#include "sd_io.h"
+#include "hal_mgr.h"
+
+// Battery voltage spread (over the last few seconds, USB connected) that means "no battery"
+#define BATT_VOLATILITY_WINDOW_S    10
+#define BATT_VOLATILITY_MV          50
 
 void update_stats_timer_cb(lv_timer_t * timer) {
+    // Backstop for file I/O completions whose wake-up was dropped
+    sd_io_dispatch();
+
     // Update System Info
     if (lbl_sys_info) {
         uint32_t free_heap = esp_get_free_heap_size();
@@ -57,43 +66,36 @@ void update_stats_timer_cb(lv_timer_t * timer) {
 
     // Update PMIC Info
     if (lbl_sys_volts) { // Check one label to assume others are ready (or check all if safer)
-        uint16_t sys_volts = sy6970_get_system_voltage();
-        uint16_t batt_volts = sy6970_get_battery_voltage();
-        uint16_t chg_curr = sy6970_get_charge_current();
-        uint16_t usb_volts = sy6970_get_vbus_voltage();
-        uint8_t ntc_pct = sy6970_get_ntc_percentage();
-        bool vbus_conn = sy6970_is_vbus_connected();
-        sy6970_charge_status_t chg_status = sy6970_get_charge_status();
-        uint8_t faults = sy6970_get_faults();
+        // ADC values come from the scheduler's last sample (the PMIC view registered for them)
+        // and status from the snapshot the HAL task keeps fresh; nothing here touches the I2C
+        // bus, so the LVGL thread never waits behind touch or the charger
+        sy6970_adc_values_t adc = {0};
+        sy6970_get_adc_values(&adc);
+        uint16_t sys_volts = adc.vsys_mv;
+        uint16_t batt_volts = adc.vbat_mv;
+        uint16_t chg_curr = adc.ichg_ma;
+        uint16_t usb_volts = adc.vbus_mv;
+        uint8_t ntc_pct = adc.ntc_pct;
+        sy6970_snapshot_t snap;
+        sy6970_get_snapshot(&snap);
+        uint8_t stat = snap.valid ? snap.regs[SY6970_REG_0B - SY6970_REG_0B] : 0;
+        uint8_t faults = snap.valid ? snap.regs[SY6970_REG_0C - SY6970_REG_0B] : 0;
+        bool vbus_conn = (stat & (SY6970_REG0B_VBUS_STAT_MASK | SY6970_REG0B_PG_STAT)) != 0;
+        sy6970_charge_status_t chg_status = (sy6970_charge_status_t)((stat >> 3) & 0x03);
 
         // Heuristic to detect No Battery via voltage fluctuation or NTC fault
-        // When no battery is present, the charging circuit often "hiccups" causing rapid voltage swings
-        static uint16_t last_batt_volts = 0;
-        static int volatility_score = 0;
-        
-        // Calculate absolute difference (simple math to avoid stdlib dep if needed)
-        int diff = (int)batt_volts - (int)last_batt_volts;
-        if (diff < 0) diff = -diff;
-        
-        if (vbus_conn) {
-             // If voltage moves >50mV between samples, it's likely unstable/no battery
-             // A real battery is very stable.
-             if (diff > 50) {
-                 // Fast attack: jump up quickly on detection
-                 // Cap at 20 (max duration ~10s at 2 ticks/sec decay)
-                 if (volatility_score < 20) volatility_score += 5;
-             } else {
-                 // Slow decay: require many stable samples to clear
-                 if (volatility_score > 0) volatility_score--;
-             }
-        } else {
-             // No USB, so if we are running, we must have a battery (or large cap, but treated as batt)
-             volatility_score = 0;
+        // When no battery is present, the charging circuit often "hiccups" causing rapid voltage swings.
+        // A real battery is very stable, so look at the spread of the recent HAL history.
+        bool volatile_batt = false;
+        pmic_telem_stats_t vbat_hist;
+        if (vbus_conn &&
+            hal_mgr_telemetry_query(PMIC_TELEM_RES_1S, PMIC_TELEM_VBAT, BATT_VOLATILITY_WINDOW_S, &vbat_hist) == ESP_OK &&
+            vbat_hist.count >= 2) {
+            volatile_batt = (vbat_hist.max - vbat_hist.min) > BATT_VOLATILITY_MV;
         }
-        last_batt_volts = batt_volts;
 
-        // Detect battery disconnected: NTC fault (bits 2:0) OR High Volatility (hysteresis at 5)
-        bool battery_disconnected = ((faults & SY6970_FAULT_NTC_MASK) != 0) || (volatility_score >= 5);
+        // Detect battery disconnected: NTC fault (bits 2:0) OR high volatility
+        bool battery_disconnected = ((faults & SY6970_FAULT_NTC_MASK) != 0) || volatile_batt;
 
         const char * chg_str = "Not Charging";
         if (chg_status == SY6970_CHG_PRE_CHARGE) chg_str = "Pre-Charge";
@@ -149,7 +151,7 @@ void update_stats_timer_cb(lv_timer_t * timer) {
              // For now, just show N/A or maybe calculate if charging.
              // Let's just show VBUS status for now or remove it if not useful.
              // Or maybe "Power Good" status
-             bool pg = sy6970_is_power_good();
+             bool pg = (stat & SY6970_REG0B_PG_STAT) != 0;
              lv_label_set_text_fmt(lbl_usb_pg, "USB Power:\n%s", pg ? "Yes" : "No");
         }
         
@@ -163,7 +165,6 @@ void update_stats_timer_cb(lv_timer_t * timer) {
                 lv_obj_set_style_text_color(lbl_fault, lv_color_hex(0xFFA500), 0); // Orange warning
                 has_fault = true;
             } else if (faults == 0) {
-                sy6970_charge_status_t chg_status = sy6970_get_charge_status();
                 if (chg_status == SY6970_CHG_PRE_CHARGE || chg_status == SY6970_CHG_FAST_CHARGE) {
                     lv_label_set_text(lbl_fault, "Fault:\nNone (LED on) charging");
                 } else if (chg_status == SY6970_CHG_TERM_DONE) {
@@ -193,5 +194,7 @@ void update_stats_timer_cb(lv_timer_t * timer) {
                 }
             }
         }
+
+        ui_pmic_chart_update();
     }
 }
@@ -1,4 +1,5 @@
 #include "ui_private.h"
+#include "ui_assets.h"
 #include "esp_log.h"
 #include "wifi_mgr.h"
 #include <time.h>
@@ -6,9 +7,6 @@
 
 static const char *TAG = "ui_home";
 
-LV_IMG_DECLARE(img_watermelon);
-LV_IMG_DECLARE(img_venezuela);
-
 static lv_obj_t * lbl_header_time = NULL;
 static lv_obj_t * lbl_header_wifi = NULL;
 static lv_timer_t * status_timer = NULL;
@@ -272,7 +270,8 @@ void ui_home_create(lv_obj_t * parent) {
 
     // Watermelon Image (Left)
     lv_obj_t * icon_watermelon = lv_image_create(title_row);
-    lv_image_set_src(icon_watermelon, &img_watermelon);
+    const lv_image_dsc_t * watermelon = ui_assets_image("img_watermelon");
+    lv_image_set_src(icon_watermelon, watermelon ? (const void *)watermelon : LV_SYMBOL_IMAGE);
     lv_obj_set_style_align(icon_watermelon, LV_ALIGN_CENTER, 0);
 
     // Title Container (Center)
@@ -357,7 +356,8 @@ void ui_home_create(lv_obj_t * parent) {
 
     // Venezuela Flag Image (Right)
     lv_obj_t * icon_venezuela = lv_image_create(title_row);
-    lv_image_set_src(icon_venezuela, &img_venezuela);
+    const lv_image_dsc_t * venezuela = ui_assets_image("img_venezuela");
+    lv_image_set_src(icon_venezuela, venezuela ? (const void *)venezuela : LV_SYMBOL_IMAGE);
     lv_obj_set_style_align(icon_venezuela, LV_ALIGN_CENTER, 0);
 
     // 2. Button Container (Row 1)
@@ -0,0 +1,546 @@
+#include "ui_jpeg_view.h"
+#include "ui_gesture.h"
+#include "lvgl_mgr.h"
+#include "hal_mgr.h"
+#include "sd_io.h"
+#include "mjpeg_decode.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "misc/cache/instance/lv_image_cache.h"
+
+// Compressed file is kept in PSRAM so refining the zoom never touches the SD card again
+#define JPEG_VIEW_MAX_FILE_SIZE   (4 * 1024 * 1024)
+// Budget for decoded RGB565 levels (1/1, 1/2, 1/4, 1/8 of full size)
+#define JPEG_VIEW_CACHE_BYTES     (6 * 1024 * 1024)
+#define JPEG_VIEW_LEVELS          4
+#define JPEG_VIEW_MAX_ZOOM        8.0f
+// A zoomed view decodes only the visible part, plus this fraction of its size on each side
+// for panning, when the whole level would not fit the budget or is this many times larger
+#define JPEG_VIEW_REGION_MARGIN   0.5f
+#define JPEG_VIEW_REGION_RATIO    4
+
+static const char *TAG = "ui_jpeg_view";
+
+typedef struct {
+    uint8_t *buf;              // RGB565 pixels, NULL if not decoded
+    size_t size;
+    lv_image_dsc_t dsc;
+    uint32_t last_used;
+} jpeg_view_level_t;
+
+typedef struct {
+    uint8_t *jpeg;             // Compressed file contents
+    size_t jpeg_len;
+    char retry_path[SD_IO_PATH_MAX];   // relative path as given, tried if not under /sdcard/
+    uint32_t src_w;
+    uint32_t src_h;
+    jpeg_view_level_t level[JPEG_VIEW_LEVELS];  // index = log2(DCT scale denominator)
+    int cur;                   // level currently shown, -1 if none
+    // Decode of the visible part only, at DCT scale 1/2^cur when `show_region`
+    jpeg_view_level_t region;
+    int region_idx;            // -1 if none
+    mjpeg_rect_t region_rect;  // in pixels of that level
+    bool show_region;
+    uint32_t use_seq;
+
+    // Committed view: zoom 1 = whole image fits, pan = image center offset in px
+    float zoom;
+    float pan_x;
+    float pan_y;
+    // View while a gesture is in progress
+    float live_zoom;
+    float live_pan_x;
+    float live_pan_y;
+
+    ui_gesture_t gesture;
+    bool multi_touch;          // a second finger was down during this press
+
+    uint32_t decodes;
+    uint32_t cache_hits;
+} ui_jpeg_view_t;
+
+static size_t cached_bytes(const ui_jpeg_view_t *v) {
+    size_t total = 0;
+    for (int i = 0; i < JPEG_VIEW_LEVELS; i++) total += v->level[i].size;
+    return total;
+}
+
+static void free_level(jpeg_view_level_t *lvl) {
+    if (!lvl->buf) return;
+    lv_image_cache_drop(&lvl->dsc);
+    heap_caps_free(lvl->buf);
+    lvl->buf = NULL;
+    lvl->size = 0;
+}
+
+// Bytes needed for a decode at 1/2^idx (libjpeg rounds output dimensions up)
+static size_t level_bytes(const ui_jpeg_view_t *v, int idx) {
+    uint32_t d = 1u << idx;
+    return (size_t)((v->src_w + d - 1) / d) * ((v->src_h + d - 1) / d) * 2;
+}
+
+// Drop least recently used levels (never the visible one) until `need` more bytes fit the budget
+static void evict_for(ui_jpeg_view_t *v, size_t need) {
+    while (cached_bytes(v) + need > JPEG_VIEW_CACHE_BYTES) {
+        int victim = -1;
+        for (int i = 0; i < JPEG_VIEW_LEVELS; i++) {
+            if (i == v->cur || !v->level[i].buf) continue;
+            if (victim < 0 || v->level[i].last_used < v->level[victim].last_used) victim = i;
+        }
+        if (victim < 0) return;
+        free_level(&v->level[victim]);
+    }
+}
+
+static bool decode_level(ui_jpeg_view_t *v, int idx) {
+    jpeg_view_level_t *lvl = &v->level[idx];
+    if (lvl->buf) {
+        v->cache_hits++;
+        lvl->last_used = ++v->use_seq;
+        return true;
+    }
+
+    size_t need = level_bytes(v, idx);
+    evict_for(v, need);
+    uint8_t *buf = (uint8_t *)heap_caps_malloc(need, MALLOC_CAP_SPIRAM);
+    if (!buf) {
+        ESP_LOGW(TAG, "No PSRAM for 1/%d decode (%u bytes)", 1 << idx, (unsigned int)need);
+        return false;
+    }
+
+    // The region decoder's whole-image path: raw multi-row output and the same pixels as a
+    // zoomed region of this level
+    int64_t t_start = esp_timer_get_time();
+    mjpeg_rect_t got;
+    uint32_t w = (v->src_w + (1u << idx) - 1) >> idx;
+    uint32_t h;
+    hal_mgr_power_begin(POWER_GOV_WORK_DECODE);
+    bool ok = mjpeg_decode_region(NULL, v->jpeg, v->jpeg_len, 1u << idx, &(mjpeg_rect_t){0}, buf, w * 2, need,
+                                  false, &got, &w, &h);
+    hal_mgr_power_end(POWER_GOV_WORK_DECODE);
+    if (!ok) {
+        ESP_LOGE(TAG, "JPEG decode error");
+        heap_caps_free(buf);
+        return false;
+    }
+
+    lvl->buf = buf;
+    lvl->size = need;
+    lvl->last_used = ++v->use_seq;
+    memset(&lvl->dsc, 0, sizeof(lvl->dsc));
+    lvl->dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    lvl->dsc.header.cf = LV_COLOR_FORMAT_RGB565;
+    lvl->dsc.header.w = w;
+    lvl->dsc.header.h = h;
+    lvl->dsc.header.stride = 0; // LVGL will calculate stride from width
+    lvl->dsc.data = buf;
+    lvl->dsc.data_size = w * h * 2;
+    v->decodes++;
+
+    ESP_LOGI(TAG, "Decoded 1/%d: %lux%lu in %lld ms (cache %u KB)", 1 << idx,
+             (unsigned long)w, (unsigned long)h, (esp_timer_get_time() - t_start) / 1000,
+             (unsigned int)(cached_bytes(v) / 1024));
+    return true;
+}
+
+// Display scale (screen px per source px) that fits the whole image in the widget
+static float fit_scale(lv_obj_t * obj, const ui_jpeg_view_t *v) {
+    float sx = (float)lv_obj_get_content_width(obj) / (float)v->src_w;
+    float sy = (float)lv_obj_get_content_height(obj) / (float)v->src_h;
+    float s = sx < sy ? sx : sy;
+    return s > 0.0f ? s : 1.0f;
+}
+
+// Coarsest DCT scale that still has at least one decoded pixel per screen pixel
+static int sharp_level(float display_scale) {
+    int idx = 0;
+    while (idx < JPEG_VIEW_LEVELS - 1 && display_scale * (float)(2u << idx) <= 1.0f) idx++;
+    return idx;
+}
+
+// The same, or coarser until a whole decode fits the budget
+static int pick_level(const ui_jpeg_view_t *v, float display_scale) {
+    int idx = sharp_level(display_scale);
+    while (idx < JPEG_VIEW_LEVELS - 1 && level_bytes(v, idx) > JPEG_VIEW_CACHE_BYTES) idx++;
+    return idx;
+}
+
+// Part of level `idx` on screen at display scale `s` and the given pan, grown by `margin`
+// of its size on each side: the widget's content clipped by its parents and the screen
+static bool visible_rect(lv_obj_t * obj, const ui_jpeg_view_t *v, float s, float pan_x, float pan_y, int idx,
+                         float margin, mjpeg_rect_t *r) {
+    lv_area_t c, a;
+    lv_obj_get_content_coords(obj, &c);
+    a = c;
+    if (!lv_obj_area_is_visible(obj, &a)) return false;
+    float cx = (c.x1 + c.x2 + 1) * 0.5f + pan_x;
+    float cy = (c.y1 + c.y2 + 1) * 0.5f + pan_y;
+    // Screen to source pixels
+    float x1 = v->src_w * 0.5f + (a.x1 - cx) / s;
+    float x2 = v->src_w * 0.5f + (a.x2 + 1 - cx) / s;
+    float y1 = v->src_h * 0.5f + (a.y1 - cy) / s;
+    float y2 = v->src_h * 0.5f + (a.y2 + 1 - cy) / s;
+    float mx = (x2 - x1) * margin, my = (y2 - y1) * margin;
+    float d = (float)(1u << idx);
+    int32_t lw = (int32_t)((v->src_w + (1u << idx) - 1) >> idx);
+    int32_t lh = (int32_t)((v->src_h + (1u << idx) - 1) >> idx);
+    int32_t lx1 = (int32_t)floorf((x1 - mx) / d), lx2 = (int32_t)ceilf((x2 + mx) / d);
+    int32_t ly1 = (int32_t)floorf((y1 - my) / d), ly2 = (int32_t)ceilf((y2 + my) / d);
+    if (lx1 < 0) lx1 = 0;
+    if (ly1 < 0) ly1 = 0;
+    if (lx2 > lw) lx2 = lw;
+    if (ly2 > lh) ly2 = lh;
+    if (lx2 <= lx1 || ly2 <= ly1) return false;
+    *r = (mjpeg_rect_t){ (uint32_t)lx1, (uint32_t)ly1, (uint32_t)(lx2 - lx1), (uint32_t)(ly2 - ly1) };
+    return true;
+}
+
+static bool rect_contains(const mjpeg_rect_t *outer, const mjpeg_rect_t *in) {
+    return in->x >= outer->x && in->y >= outer->y && in->x + in->w <= outer->x + outer->w &&
+           in->y + in->h <= outer->y + outer->h;
+}
+
+static void free_region(ui_jpeg_view_t *v) {
+    free_level(&v->region);
+    v->region_idx = -1;
+    v->show_region = false;
+}
+
+// Decode only `want` of level `idx` (crop, skipped rows, DCT scale) into the region buffer
+static bool decode_region(ui_jpeg_view_t *v, int idx, const mjpeg_rect_t *want) {
+    // Cropping widens to whole iMCUs (16 px at most) and may start a row early
+    uint32_t stride = (want->w + 32) * 2;
+    size_t need = (size_t)stride * (want->h + 1);
+    uint8_t *buf = (uint8_t *)heap_caps_malloc(need, MALLOC_CAP_SPIRAM);
+    if (!buf) {
+        ESP_LOGW(TAG, "No PSRAM for a %lux%lu region", (unsigned long)want->w, (unsigned long)want->h);
+        return false;
+    }
+    int64_t t_start = esp_timer_get_time();
+    mjpeg_rect_t got;
+    hal_mgr_power_begin(POWER_GOV_WORK_DECODE);
+    bool ok = mjpeg_decode_region(NULL, v->jpeg, v->jpeg_len, 1u << idx, want, buf, stride, need, false, &got, NULL, NULL);
+    hal_mgr_power_end(POWER_GOV_WORK_DECODE);
+    if (!ok) {
+        ESP_LOGE(TAG, "JPEG region decode error");
+        heap_caps_free(buf);
+        return false;
+    }
+
+    // The old one may be on screen until now
+    bool shown = v->show_region;
+    free_region(v);
+    v->show_region = shown;
+    jpeg_view_level_t *r = &v->region;
+    r->buf = buf;
+    r->size = need;
+    memset(&r->dsc, 0, sizeof(r->dsc));
+    r->dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    r->dsc.header.cf = LV_COLOR_FORMAT_RGB565;
+    r->dsc.header.w = got.w;
+    r->dsc.header.h = got.h;
+    r->dsc.header.stride = stride;
+    r->dsc.data = buf;
+    r->dsc.data_size = stride * got.h;
+    v->region_idx = idx;
+    v->region_rect = got;
+    v->decodes++;
+
+    ESP_LOGI(TAG, "Decoded 1/%d region %lux%lu at %lu,%lu in %lld ms", 1 << idx, (unsigned long)got.w,
+             (unsigned long)got.h, (unsigned long)got.x, (unsigned long)got.y,
+             (esp_timer_get_time() - t_start) / 1000);
+    return true;
+}
+
+static void clamp_pan(lv_obj_t * obj, const ui_jpeg_view_t *v, float zoom, float *pan_x, float *pan_y) {
+    float s = fit_scale(obj, v) * zoom;
+    float max_x = ((float)v->src_w * s - (float)lv_obj_get_content_width(obj)) * 0.5f;
+    float max_y = ((float)v->src_h * s - (float)lv_obj_get_content_height(obj)) * 0.5f;
+    if (max_x < 0.0f) max_x = 0.0f;
+    if (max_y < 0.0f) max_y = 0.0f;
+    if (*pan_x > max_x) *pan_x = max_x;
+    if (*pan_x < -max_x) *pan_x = -max_x;
+    if (*pan_y > max_y) *pan_y = max_y;
+    if (*pan_y < -max_y) *pan_y = -max_y;
+}
+
+// Show the current level at the requested zoom/pan; LVGL scales the cached decode
+static void apply_view(lv_obj_t * obj, ui_jpeg_view_t *v, float zoom, float pan_x, float pan_y) {
+    if (v->cur < 0) return;
+    float d = (float)(1u << v->cur);
+    float s = fit_scale(obj, v) * zoom;
+    uint32_t scale = (uint32_t)(s * d * LV_SCALE_NONE + 0.5f);
+    if (scale < 1) scale = 1;
+    lv_image_set_scale(obj, scale);
+    if (v->show_region) {
+        // The region is centred like a whole image would be: move it to where it belongs
+        const mjpeg_rect_t *r = &v->region_rect;
+        pan_x += ((r->x + r->w * 0.5f) * d - v->src_w * 0.5f) * s;
+        pan_y += ((r->y + r->h * 0.5f) * d - v->src_h * 0.5f) * s;
+    }
+    lv_image_set_offset_x(obj, (int32_t)pan_x);
+    lv_image_set_offset_y(obj, (int32_t)pan_y);
+}
+
+// Zoomed in where a whole decode at the sharp scale is not cached and would be too big
+// or mostly off screen: decode (or keep) just the visible part. False to use a level.
+static bool commit_region(lv_obj_t * obj, ui_jpeg_view_t *v, float s) {
+    int idx = sharp_level(s);
+    if (v->level[idx].buf) return false;
+    mjpeg_rect_t vis, want;
+    if (!visible_rect(obj, v, s, v->pan_x, v->pan_y, idx, 0.0f, &vis) ||
+        !visible_rect(obj, v, s, v->pan_x, v->pan_y, idx, JPEG_VIEW_REGION_MARGIN, &want)) {
+        return false;
+    }
+    size_t whole = level_bytes(v, idx);
+    if (whole <= JPEG_VIEW_CACHE_BYTES && whole <= (size_t)want.w * want.h * 2 * JPEG_VIEW_REGION_RATIO) {
+        return false;
+    }
+    if (v->region_idx == idx && rect_contains(&v->region_rect, &vis)) {
+        v->cache_hits++;
+    } else if (!decode_region(v, idx, &want)) {
+        return false;
+    }
+    v->cur = idx;
+    v->show_region = true;
+    lv_image_cache_drop(&v->region.dsc);
+    lv_image_set_src(obj, &v->region.dsc);
+    return true;
+}
+
+// Gesture finished: keep the view and swap to a sharper or cheaper decode if needed
+static void commit_view(lv_obj_t * obj, ui_jpeg_view_t *v) {
+    v->zoom = v->live_zoom;
+    v->pan_x = v->live_pan_x;
+    v->pan_y = v->live_pan_y;
+
+    float s = fit_scale(obj, v) * v->zoom;
+    if (!commit_region(obj, v, s)) {
+        int want = pick_level(v, s);
+        if ((want != v->cur || v->show_region) && decode_level(v, want)) {
+            v->cur = want;
+            lv_image_set_src(obj, &v->level[want].dsc);
+            free_region(v);
+        }
+    }
+    apply_view(obj, v, v->zoom, v->pan_x, v->pan_y);
+}
+
+static void jpeg_view_event_cb(lv_event_t * e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_current_target_obj(e);
+    ui_jpeg_view_t * v = (ui_jpeg_view_t *)lv_obj_get_user_data(obj);
+    if (!v || v->cur < 0) return;
+
+    if (code == LV_EVENT_PRESSED || code == LV_EVENT_PRESSING) {
+        if (code == LV_EVENT_PRESSED) v->multi_touch = false;
+
+        lvgl_mgr_touch_point_t tp[UI_GESTURE_MAX_POINTS];
+        ui_gesture_point_t pts[UI_GESTURE_MAX_POINTS];
+        uint8_t n = lvgl_mgr_touch_get_points(tp, UI_GESTURE_MAX_POINTS);
+        for (uint8_t i = 0; i < n; i++) {
+            pts[i].id = tp[i].id;
+            pts[i].x = tp[i].x;
+            pts[i].y = tp[i].y;
+        }
+        if (n >= 2) v->multi_touch = true;
+
+        ui_gesture_phase_t ph = ui_gesture_update(&v->gesture, lv_tick_get(), pts, n);
+        if (ph == UI_GESTURE_PHASE_BEGIN || ph == UI_GESTURE_PHASE_CHANGE) {
+            const ui_gesture_t *g = &v->gesture;
+            float zoom = v->zoom;
+            if (g->flags & UI_GESTURE_PINCH) {
+                zoom *= g->scale;
+                if (zoom < 1.0f) zoom = 1.0f;
+                if (zoom > JPEG_VIEW_MAX_ZOOM) zoom = JPEG_VIEW_MAX_ZOOM;
+            }
+            // Zoom about the point between the fingers so it stays under them
+            lv_area_t c;
+            lv_obj_get_content_coords(obj, &c);
+            float fx = g->start_cx - (c.x1 + c.x2) * 0.5f;
+            float fy = g->start_cy - (c.y1 + c.y2) * 0.5f;
+            float k = zoom / v->zoom;
+            float pan_x = fx - (fx - v->pan_x) * k;
+            float pan_y = fy - (fy - v->pan_y) * k;
+            if (g->flags & UI_GESTURE_PAN) {
+                pan_x += g->dx;
+                pan_y += g->dy;
+            }
+            clamp_pan(obj, v, zoom, &pan_x, &pan_y);
+            v->live_zoom = zoom;
+            v->live_pan_x = pan_x;
+            v->live_pan_y = pan_y;
+            apply_view(obj, v, zoom, pan_x, pan_y);
+        } else if (ph == UI_GESTURE_PHASE_END) {
+            commit_view(obj, v);
+        } else if (!v->gesture.tracking && !v->multi_touch && v->zoom > 1.0f && code == LV_EVENT_PRESSING) {
+            // One finger drags a zoomed image
+            lv_point_t vect;
+            lv_indev_get_vect(lv_indev_active(), &vect);
+            v->pan_x += vect.x;
+            v->pan_y += vect.y;
+            clamp_pan(obj, v, v->zoom, &v->pan_x, &v->pan_y);
+            v->live_pan_x = v->pan_x;
+            v->live_pan_y = v->pan_y;
+            apply_view(obj, v, v->zoom, v->pan_x, v->pan_y);
+        }
+    }
+    else if (code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST) {
+        if (ui_gesture_update(&v->gesture, lv_tick_get(), NULL, 0) == UI_GESTURE_PHASE_END) {
+            commit_view(obj, v);
+        }
+    }
+    else if (code == LV_EVENT_GESTURE) {
+        // Multi-touch moves and drags of a zoomed image must not trigger the swipe-back handler
+        if (v->multi_touch || v->zoom > 1.0f) {
+            lv_event_stop_processing(e);
+        }
+    }
+    else if (code == LV_EVENT_SIZE_CHANGED) {
+        // e.g. rotated: the fit and what is visible changed
+        clamp_pan(obj, v, v->zoom, &v->pan_x, &v->pan_y);
+        v->live_zoom = v->zoom;
+        v->live_pan_x = v->pan_x;
+        v->live_pan_y = v->pan_y;
+        commit_view(obj, v);
+    }
+}
+
+static void ui_jpeg_view_cleanup(lv_event_t * e) {
+    lv_obj_t * obj = lv_event_get_target(e);
+    ui_jpeg_view_t * v = (ui_jpeg_view_t *)lv_obj_get_user_data(obj);
+
+    if (v) {
+        ESP_LOGI(TAG, "Viewer closed: %lu decodes, %lu cache hits",
+                 (unsigned long)v->decodes, (unsigned long)v->cache_hits);
+        sd_io_cancel_owner(obj);
+        for (int i = 0; i < JPEG_VIEW_LEVELS; i++) free_level(&v->level[i]);
+        free_region(v);
+        if (v->jpeg) heap_caps_free(v->jpeg);
+        free(v);
+        lv_obj_set_user_data(obj, NULL);
+    }
+}
+
+lv_obj_t * ui_jpeg_view_create(lv_obj_t * parent) {
+    lv_obj_t * obj = lv_image_create(parent);
+
+    ui_jpeg_view_t * v = (ui_jpeg_view_t *)calloc(1, sizeof(ui_jpeg_view_t));
+    if (!v) {
+        lv_obj_delete(obj);
+        return NULL;
+    }
+    v->cur = -1;
+    v->region_idx = -1;
+    v->zoom = v->live_zoom = 1.0f;
+    ui_gesture_init(&v->gesture);
+
+    lv_image_set_inner_align(obj, LV_IMAGE_ALIGN_CENTER);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLL_CHAIN);
+    lv_obj_set_user_data(obj, v);
+    lv_obj_add_event_cb(obj, jpeg_view_event_cb, LV_EVENT_ALL, NULL);
+    lv_obj_add_event_cb(obj, ui_jpeg_view_cleanup, LV_EVENT_DELETE, NULL);
+
+    return obj;
+}
+
+// The whole file arrives from the I/O task; the request is cancelled with the viewer
+static bool jpeg_view_request(lv_obj_t * obj, const char * path);
+
+static void jpeg_view_loaded_cb(sd_io_result_t * res, void * user) {
+    lv_obj_t * obj = (lv_obj_t *)user;
+    ui_jpeg_view_t * v = (ui_jpeg_view_t *)lv_obj_get_user_data(obj);
+    if (!v) return;
+    if (res->status == SD_IO_ERR_NOT_FOUND && v->retry_path[0]) {
+        // Not under /sdcard/: try the path exactly as passed (after stripping S:)
+        char path[SD_IO_PATH_MAX];
+        strcpy(path, v->retry_path);
+        v->retry_path[0] = '\0';
+        ESP_LOGW(TAG, "JPEG not found under /sdcard, retrying relative: %s", path);
+        jpeg_view_request(obj, path);
+        return;
+    }
+    if (res->status == SD_IO_ERR_TOO_BIG) {
+        ESP_LOGE(TAG, "JPEG size %lu not supported (max %d)", (unsigned long)res->file_size, JPEG_VIEW_MAX_FILE_SIZE);
+        return;
+    }
+    if (res->status != SD_IO_OK || res->len == 0) {
+        ESP_LOGE(TAG, "Failed to load JPEG (status %d)", (int)res->status);
+        return;
+    }
+    // Keep the PSRAM buffer the service allocated
+    v->jpeg = res->data;
+    v->jpeg_len = res->len;
+    res->data = NULL;
+
+    // Header only, to size the levels
+    uint32_t w, h;
+    if (!mjpeg_read_size(NULL, v->jpeg, v->jpeg_len, &w, &h)) {
+        ESP_LOGE(TAG, "Not a JPEG");
+        return;
+    }
+    v->src_w = w;
+    v->src_h = h;
+
+    ui_jpeg_view_reset(obj);
+}
+
+// The file the user opened: ahead of listings and thumbnails
+static bool jpeg_view_request(lv_obj_t * obj, const char * path) {
+    sd_io_opts_t opts = {
+        .prio = SD_IO_PRIO_HIGH,
+        .owner = obj,
+        .cb = jpeg_view_loaded_cb,
+        .user = obj,
+    };
+    return sd_io_read(path, 0, 0, JPEG_VIEW_MAX_FILE_SIZE, NULL, &opts);
+}
+
+bool ui_jpeg_view_set_src(lv_obj_t * obj, const char * src) {
+    ui_jpeg_view_t * v = (ui_jpeg_view_t *)lv_obj_get_user_data(obj);
+    if (!v || !src) return false;
+
+    sd_io_cancel_owner(obj);
+    for (int i = 0; i < JPEG_VIEW_LEVELS; i++) free_level(&v->level[i]);
+    free_region(v);
+    if (v->jpeg) {
+        heap_caps_free(v->jpeg);
+        v->jpeg = NULL;
+    }
+    v->cur = -1;
+
+    // Handle LVGL path (e.g. "S:path" or "S:/path") by stripping driver letter if present
+    const char * real_path = src;
+    if (src[0] && src[1] == ':') {
+        real_path = src + 2;
+    }
+    v->retry_path[0] = '\0';
+    char full_path[SD_IO_PATH_MAX];
+    if (real_path[0] != '/') {
+        snprintf(v->retry_path, sizeof(v->retry_path), "%s", real_path);
+        snprintf(full_path, sizeof(full_path), "/sdcard/%s", real_path);
+        real_path = full_path;
+    }
+    if (!jpeg_view_request(obj, real_path)) {
+        ESP_LOGE(TAG, "Failed to open JPEG: %s", src);
+        return false;
+    }
+    return true;
+}
+
+void ui_jpeg_view_reset(lv_obj_t * obj) {
+    ui_jpeg_view_t * v = (ui_jpeg_view_t *)lv_obj_get_user_data(obj);
+    if (!v || !v->jpeg) return;
+
+    lv_obj_update_layout(obj);
+    v->live_zoom = 1.0f;
+    v->live_pan_x = 0.0f;
+    v->live_pan_y = 0.0f;
+    commit_view(obj, v);
+}
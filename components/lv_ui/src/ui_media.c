@@ -1,12 +1,13 @@
 #include "ui_private.h"
-#include <dirent.h>
-#include <sys/stat.h>
 #include "sd_card.h" // Assuming this is available via REQUIRES sd_card
+#include "sd_io.h"
 #include <stdio.h> // For snprintf
+#include <stdlib.h>
 #include <string.h>
 #include "esp_log.h"
 #include "esp_system.h"
 #include "ui_avi.h"
+#include "ui_jpeg_view.h"
 #include "hal_mgr.h"
 #include "rm690b0.h"
 
@@ -18,6 +19,7 @@ LV_IMG_DECLARE(swipeR34);
 static uint8_t s_current_brightness = 0;
 static bool s_brightness_initialized = false;
 static lv_obj_t * brightness_slider = NULL;
+static lv_obj_t * s_sd_files_loading = NULL;   // "Reading card..." until the first batch
 
 // Metadata structures
 typedef struct {
@@ -32,45 +34,31 @@ typedef struct {
 } jpg_metadata_t;
 
 /**
- * Extract frame rate from AVI file header
+ * Extract frame rate from the first bytes of an AVI file
  */
-static avi_metadata_t extract_avi_metadata(const char *file_path) {
+static avi_metadata_t parse_avi_metadata(const uint8_t *buf, uint32_t len) {
     avi_metadata_t meta = {0};
     
-    FILE* f = fopen(file_path, "rb");
-    if (!f) return meta;
-    
-    // Read AVI header to get microseconds per frame
-    fseek(f, 0x20, SEEK_SET); // Skip to avih chunk location (approximate)
+    // Microseconds per frame: first field of avih (approximate location)
     uint32_t usec_per_frame;
-    if (fread(&usec_per_frame, 4, 1, f) == 1 && usec_per_frame > 0) {
+    if (len < 0x24) return meta;
+    memcpy(&usec_per_frame, buf + 0x20, 4);
+    if (usec_per_frame > 0) {
         meta.frame_rate = 1000000 / usec_per_frame;
         meta.valid = true;
     }
-    fclose(f);
     
     return meta;
 }
 
 /**
- * Extract dimensions from JPEG file header
+ * Extract dimensions from the first bytes of a JPEG file
  */
-static jpg_metadata_t extract_jpg_metadata(const char *file_path) {
+static jpg_metadata_t parse_jpg_metadata(const uint8_t *buf, uint32_t len) {
     jpg_metadata_t meta = {0};
     
-    FILE* f = fopen(file_path, "rb");
-    if (!f) return meta;
-    
-    // Read JPEG header to get dimensions
-    uint8_t buf[256];
-    if (fread(buf, 1, 256, f) != 256) {
-        fclose(f);
-        return meta;
-    }
-    fclose(f);
-    
     // Simple JPEG marker scan for SOF0 (0xFFC0)
-    for (int i = 0; i < 240; i++) {
+    for (uint32_t i = 0; i + 8 < len; i++) {
         if (buf[i] == 0xFF && buf[i+1] == 0xC0) {
             meta.height = (buf[i+5] << 8) | buf[i+6];
             meta.width = (buf[i+7] << 8) | buf[i+8];
@@ -82,6 +70,58 @@ static jpg_metadata_t extract_jpg_metadata(const char *file_path) {
     return meta;
 }
 
+// Info panel rows, in creation order
+#define PLAY_INFO_SIZE  2
+#define PLAY_INFO_META  3
+#define PLAY_INFO_HEADER_BYTES 256
+
+static void play_info_set_size(lv_obj_t * lbl_size, long file_size) {
+    if (file_size < 1024) {
+        lv_label_set_text_fmt(lbl_size, "Size: %ld B", file_size);
+    } else if (file_size < 1024 * 1024) {
+         lv_label_set_text_fmt(lbl_size, "Size: %ld.%ld KB", file_size / 1024, ((file_size % 1024) * 10) / 1024);
+    } else {
+        lv_label_set_text_fmt(lbl_size, "Size: %ld.%ld MB", file_size / (1024 * 1024), ((file_size % (1024 * 1024)) * 10) / (1024 * 1024));
+    }
+}
+
+// Size and header arrive from the I/O task at low priority; the request is cancelled with
+// the info panel, so `user` is valid here
+static void play_info_avi_cb(sd_io_result_t * res, void * user) {
+    lv_obj_t * info_cont = (lv_obj_t *)user;
+    if (res->status != SD_IO_OK) return;
+    play_info_set_size(lv_obj_get_child(info_cont, PLAY_INFO_SIZE), (long)res->file_size);
+
+    avi_metadata_t avi_meta = parse_avi_metadata(res->data, res->len);
+    ESP_LOGI("ui_media", "AVI metadata: valid=%d, fps=%lu", avi_meta.valid, (unsigned long)avi_meta.frame_rate);
+    if (avi_meta.valid && avi_meta.frame_rate > 0) {
+        lv_obj_t * lbl_fps = lv_obj_get_child(info_cont, PLAY_INFO_META);
+        lv_label_set_text_fmt(lbl_fps, "Frame Rate: ~%lu fps", (unsigned long)avi_meta.frame_rate);
+        lv_obj_remove_flag(lbl_fps, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+static void play_info_jpg_cb(sd_io_result_t * res, void * user) {
+    lv_obj_t * info_cont = (lv_obj_t *)user;
+    if (res->status != SD_IO_OK) return;
+    play_info_set_size(lv_obj_get_child(info_cont, PLAY_INFO_SIZE), (long)res->file_size);
+    ESP_LOGI("ui_media", "JPG size: %lu bytes", (unsigned long)res->file_size);
+
+    jpg_metadata_t jpg_meta = parse_jpg_metadata(res->data, res->len);
+    ESP_LOGI("ui_media", "JPG metadata: valid=%d, %lux%lu", jpg_meta.valid,
+        (unsigned long)jpg_meta.width, (unsigned long)jpg_meta.height);
+    if (jpg_meta.valid && jpg_meta.width > 0 && jpg_meta.height > 0) {
+        lv_obj_t * lbl_dim = lv_obj_get_child(info_cont, PLAY_INFO_META);
+        lv_label_set_text_fmt(lbl_dim, "Dimensions: %lux%lu",
+            (unsigned long)jpg_meta.width, (unsigned long)jpg_meta.height);
+        lv_obj_remove_flag(lbl_dim, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+static void play_info_delete_cb(lv_event_t * e) {
+    sd_io_cancel_owner(lv_event_get_target(e));
+}
+
 static void init_brightness(void) {
     if (!s_brightness_initialized) {
         s_current_brightness = hal_mgr_get_brightness();
@@ -124,6 +164,102 @@ static void play_event_cb(lv_event_t * e) {
     }
 }
 
+// Scrub bar under the video: position follows playback, dragging seeks through the frame index
+#define PLAY_SCRUB_PERIOD_MS 200
+
+typedef struct {
+    lv_obj_t * avi;
+    lv_obj_t * slider;
+    lv_obj_t * lbl_time;
+    lv_timer_t * timer;
+    bool resume;            // was playing when the drag started
+} play_scrub_t;
+
+static void play_scrub_timer_cb(lv_timer_t * t) {
+    play_scrub_t * sc = (play_scrub_t *)lv_timer_get_user_data(t);
+    uint32_t dur = ui_avi_get_duration_ms(sc->avi);
+    if ((int32_t)dur != lv_slider_get_max_value(sc->slider)) {
+        lv_slider_set_range(sc->slider, 0, dur ? (int32_t)dur : 1);
+    }
+    uint32_t pos = ui_avi_get_position_ms(sc->avi);
+    if (!lv_slider_is_dragged(sc->slider)) lv_slider_set_value(sc->slider, (int32_t)pos, LV_ANIM_OFF);
+    lv_label_set_text_fmt(sc->lbl_time, "%lu.%lu / %lu.%lu s", (unsigned long)(pos / 1000),
+                          (unsigned long)(pos % 1000 / 100), (unsigned long)(dur / 1000), (unsigned long)(dur % 1000 / 100));
+}
+
+static void play_scrub_slider_cb(lv_event_t * e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    play_scrub_t * sc = (play_scrub_t *)lv_event_get_user_data(e);
+    if (code == LV_EVENT_PRESSED) {
+        sc->resume = ui_avi_is_playing(sc->avi);
+        ui_avi_pause(sc->avi);
+    } else if (code == LV_EVENT_VALUE_CHANGED) {
+        // Frames not reached yet in a file without an index snap back to the last one seen
+        uint32_t ms = (uint32_t)lv_slider_get_value(sc->slider);
+        uint32_t reach = ui_avi_get_seekable_ms(sc->avi);
+        ui_avi_seek(sc->avi, ms < reach ? ms : reach);
+    } else if (code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST) {
+        if (sc->resume) ui_avi_play(sc->avi);
+    }
+}
+
+static void play_scrub_step_cb(lv_event_t * e) {
+    play_scrub_t * sc = (play_scrub_t *)lv_event_get_user_data(e);
+    lv_obj_t * btn = lv_event_get_target(e);
+    ui_avi_step(sc->avi, lv_obj_get_index(btn) == 0 ? -1 : 1);
+}
+
+static void play_scrub_delete_cb(lv_event_t * e) {
+    play_scrub_t * sc = (play_scrub_t *)lv_event_get_user_data(e);
+    lv_timer_delete(sc->timer);
+    free(sc);
+}
+
+static lv_obj_t * play_scrub_btn(lv_obj_t * parent, const char * symbol, play_scrub_t * sc) {
+    lv_obj_t * btn = lv_button_create(parent);
+    lv_obj_set_size(btn, 44, 36);
+    lv_obj_add_event_cb(btn, play_scrub_step_cb, LV_EVENT_CLICKED, sc);
+    lv_obj_t * lbl = lv_label_create(btn);
+    lv_label_set_text(lbl, symbol);
+    lv_obj_center(lbl);
+    return btn;
+}
+
+static void play_scrub_create(lv_obj_t * parent, lv_obj_t * avi, lv_obj_t * info_cont) {
+    play_scrub_t * sc = (play_scrub_t *)calloc(1, sizeof(play_scrub_t));
+    if (!sc) return;
+    sc->avi = avi;
+
+    lv_obj_t * row = lv_obj_create(parent);
+    lv_obj_set_size(row, LV_PCT(100), 44);
+    lv_obj_align(row, LV_ALIGN_BOTTOM_MID, 0, 0);
+    lv_obj_remove_flag(row, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_bg_opa(row, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(row, 0, 0);
+    lv_obj_set_style_pad_all(row, 4, 0);
+    lv_obj_set_style_pad_column(row, 12, 0);
+    lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(row, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+
+    // Step buttons pause; the slider pauses only while it is held
+    play_scrub_btn(row, LV_SYMBOL_LEFT, sc);
+    sc->slider = lv_slider_create(row);
+    lv_obj_set_flex_grow(sc->slider, 1);
+    lv_obj_set_height(sc->slider, 12);
+    lv_slider_set_range(sc->slider, 0, 1);
+    lv_obj_add_event_cb(sc->slider, play_scrub_slider_cb, LV_EVENT_ALL, sc);
+    play_scrub_btn(row, LV_SYMBOL_RIGHT, sc);
+
+    sc->lbl_time = lv_label_create(info_cont);
+    lv_label_set_text(sc->lbl_time, "");
+    lv_obj_set_style_text_font(sc->lbl_time, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_color(sc->lbl_time, lv_color_white(), 0);
+    lv_obj_set_size(sc->lbl_time, LV_PCT(100), LV_SIZE_CONTENT);
+
+    sc->timer = lv_timer_create(play_scrub_timer_cb, PLAY_SCRUB_PERIOD_MS, sc);
+    lv_obj_add_event_cb(row, play_scrub_delete_cb, LV_EVENT_DELETE, sc);
+}
+
 static void rainbow_test_cb(lv_event_t * e) {
     lv_obj_t * sw = lv_event_get_target(e);
     if (lv_obj_has_state(sw, LV_STATE_CHECKED)) {
@@ -198,9 +334,78 @@ static void file_btn_event_handler(lv_event_t * e) {
     }
 }
 
+static void sd_files_add_row(const char * name, uint32_t file_size) {
+    lv_obj_t * btn = lv_button_create(cont_sd_files);
+    lv_obj_set_width(btn, LV_PCT(100));
+    lv_obj_set_height(btn, LV_SIZE_CONTENT);
+    lv_obj_add_event_cb(btn, file_btn_event_handler, LV_EVENT_CLICKED, NULL);
+
+    // Style: List item style (Transparent, Left aligned, No border)
+    lv_obj_set_style_bg_opa(btn, LV_OPA_TRANSP, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_shadow_width(btn, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_border_width(btn, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_radius(btn, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_color(btn, lv_color_white(), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_all(btn, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    // Pressed style: Dark Grey background
+    lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_PRESSED);
+    lv_obj_set_style_bg_color(btn, lv_palette_darken(LV_PALETTE_GREY, 2), LV_PART_MAIN | LV_STATE_PRESSED);
+    lv_obj_set_style_text_color(btn, lv_color_white(), LV_PART_MAIN | LV_STATE_PRESSED);
+
+    // File Name Label (Left)
+    lv_obj_t * lbl_name = lv_label_create(btn);
+    lv_label_set_text_fmt(lbl_name, "%s  %s", LV_SYMBOL_FILE, name);
+    lv_obj_set_style_text_font(lbl_name, &lv_font_montserrat_24, 0);
+    lv_obj_align(lbl_name, LV_ALIGN_LEFT_MID, 0, 0);
+
+    // File Size Label (Right)
+    lv_obj_t * lbl_size = lv_label_create(btn);
+    lv_obj_set_style_text_font(lbl_size, &lv_font_montserrat_24, 0);
+    if (file_size < 1024) {
+        lv_label_set_text_fmt(lbl_size, "%lu B", (unsigned long)file_size);
+    } else if (file_size < 1024 * 1024) {
+        unsigned long k = (unsigned long)file_size / 1024;
+        unsigned long d = ((unsigned long)file_size * 10 / 1024) % 10;
+        lv_label_set_text_fmt(lbl_size, "%lu.%lu KB", k, d);
+    } else {
+        unsigned long m = (unsigned long)file_size / (1024 * 1024);
+        unsigned long d = ((unsigned long)file_size * 10 / (1024 * 1024)) % 10;
+        lv_label_set_text_fmt(lbl_size, "%lu.%lu MB", m, d);
+    }
+    lv_obj_align(lbl_size, LV_ALIGN_RIGHT_MID, 0, 0);
+}
+
+static void sd_files_show_error(const char * text) {
+    lv_obj_t * lbl = lv_label_create(cont_sd_files);
+    lv_label_set_text(lbl, text);
+    lv_obj_set_style_text_color(lbl, lv_palette_main(LV_PALETTE_RED), 0);
+}
+
+// Rows arrive in batches from the I/O task. The request is cancelled when the list is
+// deleted, so cont_sd_files is valid whenever this runs.
+static void sd_files_list_cb(sd_io_result_t * res, void * user) {
+    if (s_sd_files_loading) {
+        lv_obj_delete(s_sd_files_loading);
+        s_sd_files_loading = NULL;
+    }
+    if (res->status != SD_IO_OK) {
+        sd_files_show_error("Failed to open directory");
+        return;
+    }
+    for (uint32_t i = 0; i < res->count; i++) {
+        if (!res->entries[i].is_dir) sd_files_add_row(res->entries[i].name, res->entries[i].size);
+    }
+}
+
+static void sd_files_delete_cb(lv_event_t * e) {
+    sd_io_cancel_owner(lv_event_get_target(e));
+}
+
 void populate_sd_files_list(void) {
     if (!cont_sd_files) return;
     
+    sd_io_cancel_owner(cont_sd_files);
     lv_obj_clean(cont_sd_files);
     
     // Check if SD card is mounted
@@ -212,68 +417,20 @@ void populate_sd_files_list(void) {
         return;
     }
 
-    DIR *d;
-    struct dirent *dir;
-    struct stat st;
-    char path[512];
-
-    d = opendir("/sdcard");
-    if (d) {
-        while ((dir = readdir(d)) != NULL) {
-            if (dir->d_type == DT_REG) { // Regular file
-                // Get file size
-                snprintf(path, sizeof(path), "/sdcard/%s", dir->d_name);
-                size_t file_size = 0;
-                if (stat(path, &st) == 0) {
-                    file_size = st.st_size;
-                }
-
-                lv_obj_t * btn = lv_button_create(cont_sd_files);
-                lv_obj_set_width(btn, LV_PCT(100));
-                lv_obj_set_height(btn, LV_SIZE_CONTENT);
-                lv_obj_add_event_cb(btn, file_btn_event_handler, LV_EVENT_CLICKED, NULL);
-
-                // Style: List item style (Transparent, Left aligned, No border)
-                lv_obj_set_style_bg_opa(btn, LV_OPA_TRANSP, LV_PART_MAIN | LV_STATE_DEFAULT);
-                lv_obj_set_style_shadow_width(btn, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                lv_obj_set_style_border_width(btn, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                lv_obj_set_style_radius(btn, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
-                lv_obj_set_style_text_color(btn, lv_color_white(), LV_PART_MAIN | LV_STATE_DEFAULT);
-                lv_obj_set_style_pad_all(btn, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-                // Pressed style: Dark Grey background
-                lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_PRESSED);
-                lv_obj_set_style_bg_color(btn, lv_palette_darken(LV_PALETTE_GREY, 2), LV_PART_MAIN | LV_STATE_PRESSED);
-                lv_obj_set_style_text_color(btn, lv_color_white(), LV_PART_MAIN | LV_STATE_PRESSED);
-
-                // File Name Label (Left)
-                lv_obj_t * lbl_name = lv_label_create(btn);
-                lv_label_set_text_fmt(lbl_name, "%s  %s", LV_SYMBOL_FILE, dir->d_name);
-                lv_obj_set_style_text_font(lbl_name, &lv_font_montserrat_24, 0);
-                lv_obj_align(lbl_name, LV_ALIGN_LEFT_MID, 0, 0);
-
-                // File Size Label (Right)
-                lv_obj_t * lbl_size = lv_label_create(btn);
-                lv_obj_set_style_text_font(lbl_size, &lv_font_montserrat_24, 0);
-                if (file_size < 1024) {
-                    lv_label_set_text_fmt(lbl_size, "%lu B", (unsigned long)file_size);
-                } else if (file_size < 1024 * 1024) {
-                    unsigned long k = (unsigned long)file_size / 1024;
-                    unsigned long d = ((unsigned long)file_size * 10 / 1024) % 10;
-                    lv_label_set_text_fmt(lbl_size, "%lu.%lu KB", k, d);
-                } else {
-                    unsigned long m = (unsigned long)file_size / (1024 * 1024);
-                    unsigned long d = ((unsigned long)file_size * 10 / (1024 * 1024)) % 10;
-                    lv_label_set_text_fmt(lbl_size, "%lu.%lu MB", m, d);
-                }
-                lv_obj_align(lbl_size, LV_ALIGN_RIGHT_MID, 0, 0);
-            }
-        }
-        closedir(d);
-    } else {
-        lv_obj_t * lbl = lv_label_create(cont_sd_files);
-        lv_label_set_text(lbl, "Failed to open directory");
-        lv_obj_set_style_text_color(lbl, lv_palette_main(LV_PALETTE_RED), 0);
+    // readdir + stat per file runs on the I/O task; the view shows up right away
+    s_sd_files_loading = lv_label_create(cont_sd_files);
+    lv_label_set_text(s_sd_files_loading, LV_SYMBOL_REFRESH "  Reading card...");
+    lv_obj_set_style_text_color(s_sd_files_loading, lv_color_hex(0x808080), 0);
+
+    sd_io_opts_t opts = {
+        .prio = SD_IO_PRIO_NORMAL,
+        .owner = cont_sd_files,
+        .cb = sd_files_list_cb,
+    };
+    if (!sd_io_list("/sdcard", &opts)) {
+        lv_obj_delete(s_sd_files_loading);
+        s_sd_files_loading = NULL;
+        sd_files_show_error("Failed to open directory");
     }
 }
 
@@ -330,6 +487,7 @@ void ui_media_create(lv_obj_t * parent) {
     lv_obj_set_style_border_width(cont_sd_files, 0, 0);
     lv_obj_set_style_pad_all(cont_sd_files, 0, 0);
     lv_obj_set_flex_flow(cont_sd_files, LV_FLEX_FLOW_COLUMN);
+    lv_obj_add_event_cb(cont_sd_files, sd_files_delete_cb, LV_EVENT_DELETE, NULL);
 
     lbl_sd = lv_label_create(cont_sd_files);
     lv_label_set_text(lbl_sd, "SD Card:\n--");
@@ -550,6 +708,7 @@ void ui_play_create(lv_obj_t * parent, const char * file_path) {
     lv_obj_set_flex_flow(info_cont, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_flex_align(info_cont, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER);
     lv_obj_set_style_pad_row(info_cont, 8, 0);
+    lv_obj_add_event_cb(info_cont, play_info_delete_cb, LV_EVENT_DELETE, NULL);
     
     // Info panel title
     lv_obj_t * info_title = lv_label_create(info_cont);
@@ -566,13 +725,7 @@ void ui_play_create(lv_obj_t * parent, const char * file_path) {
     if(file_path) {
         ESP_LOGI("ui_media", "Opening media file: %s", file_path);
         
-        // Get file size
         const char* fs_path = file_path + 2; // Skip "S:" prefix
-        struct stat st;
-        long file_size = 0;
-        if (stat(fs_path, &st) == 0) {
-            file_size = st.st_size;
-        }
         
         // Simple extension check
         const char * ext = strrchr(file_path, '.');
@@ -589,12 +742,7 @@ void ui_play_create(lv_obj_t * parent, const char * file_path) {
             if (img) {
                 ui_avi_set_src(img, file_path);
                 
-                // Extract AVI metadata (use fs_path without "S:" prefix)
-                avi_metadata_t avi_meta = extract_avi_metadata(fs_path);
-                
-                ESP_LOGI("ui_media", "AVI metadata: valid=%d, fps=%lu", avi_meta.valid, (unsigned long)avi_meta.frame_rate);
-                
-                // Display AVI info
+                // Display AVI info; size and frame rate fill in once the header is read
                 lv_obj_t * lbl_type = lv_label_create(info_cont);
                 lv_label_set_text(lbl_type, "Type: AVI Video");
                 lv_obj_set_style_text_font(lbl_type, &lv_font_montserrat_14, 0);
@@ -603,76 +751,61 @@ void ui_play_create(lv_obj_t * parent, const char * file_path) {
                 
                 lv_obj_t * lbl_size = lv_label_create(info_cont);
                 lv_obj_set_size(lbl_size, LV_PCT(100), LV_SIZE_CONTENT);
-                if (file_size < 1024) {
-                    lv_label_set_text_fmt(lbl_size, "Size: %ld B", file_size);
-                } else if (file_size < 1024 * 1024) {
-                     lv_label_set_text_fmt(lbl_size, "Size: %ld.%ld KB", file_size / 1024, ((file_size % 1024) * 10) / 1024);
-                } else {
-                    lv_label_set_text_fmt(lbl_size, "Size: %ld.%ld MB", file_size / (1024 * 1024), ((file_size % (1024 * 1024)) * 10) / (1024 * 1024));
-                }
+                lv_label_set_text(lbl_size, "Size: --");
                 lv_obj_set_style_text_font(lbl_size, &lv_font_montserrat_14, 0);
                 lv_obj_set_style_text_color(lbl_size, lv_color_white(), 0);
                 
-                if (avi_meta.valid && avi_meta.frame_rate > 0) {
-                    lv_obj_t * lbl_fps = lv_label_create(info_cont);
-                    lv_label_set_text_fmt(lbl_fps, "Frame Rate: ~%lu fps", (unsigned long)avi_meta.frame_rate);
-                    lv_obj_set_style_text_font(lbl_fps, &lv_font_montserrat_14, 0);
-                    lv_obj_set_style_text_color(lbl_fps, lv_color_white(), 0);
-                    lv_obj_set_size(lbl_fps, LV_PCT(100), LV_SIZE_CONTENT);
-                }
+                lv_obj_t * lbl_fps = lv_label_create(info_cont);
+                lv_label_set_text(lbl_fps, "");
+                lv_obj_set_style_text_font(lbl_fps, &lv_font_montserrat_14, 0);
+                lv_obj_set_style_text_color(lbl_fps, lv_color_white(), 0);
+                lv_obj_set_size(lbl_fps, LV_PCT(100), LV_SIZE_CONTENT);
+                lv_obj_add_flag(lbl_fps, LV_OBJ_FLAG_HIDDEN);
+                
+                sd_io_opts_t opts = { .prio = SD_IO_PRIO_LOW, .owner = info_cont, .cb = play_info_avi_cb, .user = info_cont };
+                sd_io_read(fs_path, 0, PLAY_INFO_HEADER_BYTES, 0, NULL, &opts);
                 
                 lv_obj_t * lbl_codec = lv_label_create(info_cont);
                 lv_label_set_text(lbl_codec, "Codec: MJPEG");
                 lv_obj_set_style_text_font(lbl_codec, &lv_font_montserrat_14, 0);
                 lv_obj_set_style_text_color(lbl_codec, lv_color_white(), 0);
                 lv_obj_set_size(lbl_codec, LV_PCT(100), LV_SIZE_CONTENT);
+
+                play_scrub_create(media_cont, img, info_cont);
             } else {
                 ESP_LOGE("ui_media", "Failed to create AVI object");
             }
         } else {
-            // JPG files handled by LVGL's libjpeg-turbo decoder
+            // JPG files: zoomable viewer with cached libjpeg-turbo scaled decodes
             ESP_LOGI("ui_media", "Creating image viewer for %s", file_path);
             
-            img = lv_image_create(media_cont);
+            img = ui_jpeg_view_create(media_cont);
             if (img) {
                 lv_obj_set_size(img, LV_PCT(100), LV_PCT(100));
-                lv_image_set_src(img, file_path);
-                
-                // Extract JPG metadata (use fs_path without "S:" prefix)
-                jpg_metadata_t jpg_meta = extract_jpg_metadata(fs_path);
+                ui_jpeg_view_set_src(img, file_path);
                 
-                ESP_LOGI("ui_media", "JPG metadata: valid=%d, %lux%lu", jpg_meta.valid, 
-                    (unsigned long)jpg_meta.width, (unsigned long)jpg_meta.height);
-                
-                // Display JPG info
+                // Display JPG info; size and dimensions fill in once the header is read
                 lv_obj_t * lbl_type = lv_label_create(info_cont);
                 lv_label_set_text(lbl_type, "Type: JPEG Image");
                 lv_obj_set_style_text_font(lbl_type, &lv_font_montserrat_14, 0);
                 lv_obj_set_style_text_color(lbl_type, lv_color_white(), 0);
                 lv_obj_set_size(lbl_type, LV_PCT(100), LV_SIZE_CONTENT);
-                ESP_LOGI("ui_media", "Created JPG type label");
                 
                 lv_obj_t * lbl_size = lv_label_create(info_cont);
                 lv_obj_set_size(lbl_size, LV_PCT(100), LV_SIZE_CONTENT);
-                if (file_size < 1024) {
-                    lv_label_set_text_fmt(lbl_size, "Size: %ld B", file_size);
-                } else if (file_size < 1024 * 1024) {
-                     lv_label_set_text_fmt(lbl_size, "Size: %ld.%ld KB", file_size / 1024, ((file_size % 1024) * 10) / 1024);
-                } else {
-                    lv_label_set_text_fmt(lbl_size, "Size: %ld.%ld MB", file_size / (1024 * 1024), ((file_size % (1024 * 1024)) * 10) / (1024 * 1024));
-                }
+                lv_label_set_text(lbl_size, "Size: --");
                 lv_obj_set_style_text_font(lbl_size, &lv_font_montserrat_14, 0);
                 lv_obj_set_style_text_color(lbl_size, lv_color_white(), 0);
-                ESP_LOGI("ui_media", "Created JPG size label: %ld bytes", file_size);
                 
-                if (jpg_meta.valid && jpg_meta.width > 0 && jpg_meta.height > 0) {
-                    lv_obj_t * lbl_dim = lv_label_create(info_cont);
-                    lv_label_set_text_fmt(lbl_dim, "Dimensions: %lux%lu", 
-                        (unsigned long)jpg_meta.width, (unsigned long)jpg_meta.height);
-                    lv_obj_set_style_text_font(lbl_dim, &lv_font_montserrat_14, 0);
-                    lv_obj_set_style_text_color(lbl_dim, lv_color_white(), 0);
-                    lv_obj_set_size(lbl_dim, LV_PCT(100), LV_SIZE_CONTENT);
-                }
+                lv_obj_t * lbl_dim = lv_label_create(info_cont);
+                lv_label_set_text(lbl_dim, "");
+                lv_obj_set_style_text_font(lbl_dim, &lv_font_montserrat_14, 0);
+                lv_obj_set_style_text_color(lbl_dim, lv_color_white(), 0);
+                lv_obj_set_size(lbl_dim, LV_PCT(100), LV_SIZE_CONTENT);
+                lv_obj_add_flag(lbl_dim, LV_OBJ_FLAG_HIDDEN);
+                
+                sd_io_opts_t opts = { .prio = SD_IO_PRIO_LOW, .owner = info_cont, .cb = play_info_jpg_cb, .user = info_cont };
+                sd_io_read(fs_path, 0, PLAY_INFO_HEADER_BYTES, 0, NULL, &opts);
                 
                 lv_obj_t * lbl_fmt = lv_label_create(info_cont);
                 lv_label_set_text(lbl_fmt, "Format: RGB565");
@@ -686,15 +819,23 @@ void ui_play_create(lv_obj_t * parent, const char * file_path) {
         }
 
         if(img) {
-            lv_obj_center(img);
+            if (is_avi) {
+                // Under the title, clear of the scrub row: the video goes straight to the
+                // panel there and nothing may overlap it
+                lv_obj_align(img, LV_ALIGN_TOP_MID, 0, 0);
+                ui_avi_set_plane(img, true);
+            } else {
+                lv_obj_center(img);
+            }
             // Clean up gesture bubble
             lv_obj_clear_flag(img, LV_OBJ_FLAG_GESTURE_BUBBLE);
             // Add event handler for press/release to pause/resume playback
-            lv_obj_add_event_cb(img, play_event_cb, LV_EVENT_ALL, img);
+            // (only AVI players are paused; the JPEG viewer keeps its own user data)
+            lv_obj_add_event_cb(img, play_event_cb, LV_EVENT_ALL, is_avi ? img : NULL);
         }
         
         // Add event to container too, passing the image object (which might be AVI)
         // This ensures touching the background also pauses playback
-        lv_obj_add_event_cb(play_cont, play_event_cb, LV_EVENT_ALL, img);
+        lv_obj_add_event_cb(play_cont, play_event_cb, LV_EVENT_ALL, is_avi ? img : NULL);
     }
 }
@@ -6,6 +6,7 @@
 #include "nvs.h"
 #include "ota_mgr.h" // Include OTA manager
 #include "lvgl_mgr.h" // For lvgl_mgr_lock/unlock
+#include "hal_mgr.h"
 
 LV_IMG_DECLARE(swipeL34);
 LV_IMG_DECLARE(swipeR34);
@@ -210,7 +211,7 @@ static void disable_led_cb(lv_event_t * e) {
 static void enable_adc_cb(lv_event_t * e) {
     lv_obj_t * sw = lv_event_get_target(e);
     bool enable = lv_obj_has_state(sw, LV_STATE_CHECKED);
-    sy6970_enable_adc(enable, enable); 
+    sy6970_enable_adc(enable, false); // the scheduler picks one-shot or continuous
     if(enable) {
          ESP_LOGI("ui_system", "ADC Monitoring Enabled");
     } else {
@@ -481,6 +482,35 @@ static void defaults_btn_cb(lv_event_t * e) {
     ESP_LOGI("ui_system", "SY6970 Defaults Applied & UI Settings Page Reloaded");
 }
 
+// ADC demand while the PM Status view exists: every channel, fresh enough for the stats timer
+static int s_pmic_adc = -1;
+
+// Battery history chart: one point per minute (mean), newest on the right
+#define PMIC_CHART_POINTS   60
+static lv_chart_series_t * s_vbat_series = NULL;
+static int64_t s_vbat_cursor = -1;      // newest 1 min bucket already plotted
+
+// Appends the minutes that closed since the last call; the first call fills the history
+void ui_pmic_chart_update(void) {
+    if (!chart_vbat || !s_vbat_series) return;
+    pmic_telem_stats_t buckets[PMIC_CHART_POINTS];
+    size_t n = hal_mgr_telemetry_read(PMIC_TELEM_RES_1MIN, PMIC_TELEM_VBAT, &s_vbat_cursor,
+                                      buckets, PMIC_CHART_POINTS);
+    if (n == 0) return;
+    for (size_t i = 0; i < n; i++) {
+        int32_t v = buckets[i].count ? buckets[i].mean : LV_CHART_POINT_NONE;
+        lv_chart_set_next_value(chart_vbat, s_vbat_series, v);
+    }
+    lv_chart_refresh(chart_vbat);
+}
+
+static void pmic_cleanup_cb(lv_event_t * e) {
+    if (s_pmic_adc >= 0) {
+        sy6970_adc_release(s_pmic_adc);
+        s_pmic_adc = -1;
+    }
+}
+
 void ui_pmic_create(lv_obj_t * parent) {
     pmic_parent_obj = parent; // Save for reload
     // restore_pmic_settings() is now called in lv_ui_init() globally
@@ -497,6 +527,8 @@ void ui_pmic_create(lv_obj_t * parent) {
     lv_obj_set_flex_flow(pmic_cont, LV_FLEX_FLOW_ROW);
     lv_obj_add_flag(pmic_cont, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_add_event_cb(pmic_cont, pmic_swipe_event_cb, LV_EVENT_GESTURE, NULL);
+    lv_obj_add_event_cb(pmic_cont, pmic_cleanup_cb, LV_EVENT_DELETE, NULL);
+    if (s_pmic_adc < 0) s_pmic_adc = sy6970_adc_request(SY6970_ADC_ALL, 1000);
     
     lv_obj_t * img_swipe = lv_image_create(pmic_cont);
     lv_image_set_src(img_swipe, &swipeL34);
@@ -571,6 +603,27 @@ void ui_pmic_create(lv_obj_t * parent) {
     lv_obj_set_style_text_color(lbl_ntc, lv_color_white(), 0);
     lv_obj_set_style_text_font(lbl_ntc, &lv_font_montserrat_22, 0);
 
+    // Battery history (last hour)
+    lv_obj_t * lbl_chart = lv_label_create(cont_pmic_details);
+    lv_label_set_text(lbl_chart, "Battery, last hour (mV):");
+    lv_obj_set_style_text_color(lbl_chart, lv_color_white(), 0);
+    lv_obj_set_style_text_font(lbl_chart, &lv_font_montserrat_22, 0);
+
+    chart_vbat = lv_chart_create(cont_pmic_details);
+    lv_obj_set_size(chart_vbat, LV_PCT(100), 120);
+    lv_chart_set_type(chart_vbat, LV_CHART_TYPE_LINE);
+    lv_chart_set_update_mode(chart_vbat, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_set_point_count(chart_vbat, PMIC_CHART_POINTS);
+    lv_chart_set_axis_range(chart_vbat, LV_CHART_AXIS_PRIMARY_Y, 3000, 4400);
+    lv_chart_set_div_line_count(chart_vbat, 4, 0);
+    lv_obj_set_style_bg_color(chart_vbat, lv_color_hex(0x202020), 0);
+    lv_obj_set_style_border_color(chart_vbat, lv_color_hex(0x404040), 0);
+    lv_obj_set_style_size(chart_vbat, 0, 0, LV_PART_INDICATOR); // No point markers
+    s_vbat_series = lv_chart_add_series(chart_vbat, lv_color_hex(0x00FF00), LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_set_all_values(chart_vbat, s_vbat_series, LV_CHART_POINT_NONE);
+    s_vbat_cursor = -1;
+    ui_pmic_chart_update();
+
     // Fault Row (Label + Switch)
     lv_obj_t * fault_row = lv_obj_create(cont_pmic_details);
     lv_obj_set_width(fault_row, LV_PCT(100));
@@ -0,0 +1,249 @@
+#include "video_pipe.h"
+#include <string.h>
+
+static void vp_lock(video_pipe_t *vp) {
+    if (vp->os.lock) vp->os.lock(vp->os.ctx);
+}
+
+static void vp_unlock(video_pipe_t *vp) {
+    if (vp->os.unlock) vp->os.unlock(vp->os.ctx);
+}
+
+static void vp_wake(video_pipe_t *vp) {
+    if (vp->os.wake_decoder) vp->os.wake_decoder(vp->os.ctx);
+}
+
+void video_pipe_init(video_pipe_t *vp, uint8_t *const *bufs, uint8_t count, uint32_t buf_size,
+                     uint32_t period_us, const video_pipe_os_t *os) {
+    memset(vp, 0, sizeof(*vp));
+    if (count > VIDEO_PIPE_MAX_FRAMES) count = VIDEO_PIPE_MAX_FRAMES;
+    for (uint8_t i = 0; i < count; i++) {
+        vp->frames[i].buf = bufs[i];
+        vp->frames[i].buf_size = buf_size;
+    }
+    vp->count = count;
+    vp->shown = -1;
+    vp->prev = -1;
+    vp->shown_pts = -1;
+    vp->last_frame = -1;
+    vp->period_us = period_us;
+    if (os) vp->os = *os;
+}
+
+bool video_pipe_take_seek(video_pipe_t *vp, uint32_t *frame) {
+    vp_lock(vp);
+    // From here on the decoder's frames belong to the latest seek
+    vp->dec_gen = vp->gen;
+    bool pending = vp->seek_pending;
+    if (pending) *frame = vp->seek_frame;
+    vp->seek_pending = false;
+    vp_unlock(vp);
+    return pending;
+}
+
+video_pipe_frame_t *video_pipe_acquire(video_pipe_t *vp) {
+    video_pipe_frame_t *f = NULL;
+    vp_lock(vp);
+    for (uint8_t i = 0; i < vp->count; i++) {
+        if (vp->frames[i].state == VIDEO_PIPE_FREE) {
+            f = &vp->frames[i];
+            f->state = VIDEO_PIPE_DECODING;
+            break;
+        }
+    }
+    vp_unlock(vp);
+    return f;
+}
+
+int64_t video_pipe_media_us(const video_pipe_t *vp, int64_t now_us) {
+    return vp->playing && vp->clock_started ? now_us - vp->origin : vp->paused_at;
+}
+
+bool video_pipe_schedule(video_pipe_t *vp, video_pipe_frame_t *f, uint32_t frame, int64_t now_us) {
+    vp_lock(vp);
+    if (vp->seek_pending) {
+        vp_unlock(vp);
+        return false;
+    }
+    // Back at or before the last frame without a seek: the clip looped
+    if (vp->last_frame >= 0 && frame <= vp->last_frame) vp->loop_base += vp->last_frame + 1;
+    vp->last_frame = frame;
+    f->frame = frame;
+    f->pts_us = (vp->loop_base + frame) * (int64_t)vp->period_us;
+    f->gen = vp->dec_gen;
+    // Skip a frame that would be late by the time it is decoded. Never before the clock
+    // runs, so the first frame after opening or a seek is always shown.
+    bool skip = vp->playing && vp->clock_started &&
+                f->pts_us < video_pipe_media_us(vp, now_us) + vp->decode_est_us;
+    if (skip) vp->stats.dropped++;
+    vp_unlock(vp);
+    return !skip;
+}
+
+// Called locked
+static void vp_note_decoded(video_pipe_t *vp, const video_pipe_frame_t *f) {
+    vp->stats.decoded++;
+    vp->stats.decode_us += f->decode_us;
+    if (f->decode_us > vp->stats.decode_max_us) vp->stats.decode_max_us = f->decode_us;
+    // Moving average over about eight frames
+    vp->decode_est_us = vp->decode_est_us ? (vp->decode_est_us * 7 + f->decode_us) / 8 : f->decode_us;
+}
+
+// Called locked: `f` went on screen at media time `media`
+static void vp_note_shown(video_pipe_t *vp, const video_pipe_frame_t *f, int64_t media) {
+    // A direct frame may finish a little early
+    uint32_t lateness = media > f->pts_us ? (uint32_t)(media - f->pts_us) : 0;
+    vp->stats.jitter_us += lateness;
+    if (lateness > vp->stats.jitter_max_us) vp->stats.jitter_max_us = lateness;
+    if (lateness > vp->period_us) vp->stats.late++;
+    vp->stats.presented++;
+    vp->shown_pts = f->pts_us;
+}
+
+// Called locked: the first frame after opening or a seek starts the clock
+static void vp_start_clock(video_pipe_t *vp, const video_pipe_frame_t *f, int64_t now_us) {
+    vp->clock_started = true;
+    vp->paused_at = f->pts_us;
+    vp->origin = now_us - f->pts_us;
+}
+
+void video_pipe_submit(video_pipe_t *vp, video_pipe_frame_t *f, bool ok) {
+    vp_lock(vp);
+    if (!ok || f->gen != vp->gen) {
+        f->state = VIDEO_PIPE_FREE;
+        vp->stats.discarded++;
+    } else {
+        f->state = VIDEO_PIPE_READY;
+        vp->ready[(vp->ready_head + vp->ready_len) % VIDEO_PIPE_MAX_FRAMES] = (uint8_t)(f - vp->frames);
+        vp->ready_len++;
+        vp_note_decoded(vp, f);
+    }
+    vp_unlock(vp);
+}
+
+int64_t video_pipe_direct_wait(video_pipe_t *vp, const video_pipe_frame_t *f, int64_t lead_us, int64_t now_us) {
+    int64_t wait;
+    vp_lock(vp);
+    if (vp->seek_pending || f->gen != vp->gen) {
+        wait = VIDEO_PIPE_WAIT_STALE;
+    } else if (!vp->clock_started) {
+        wait = 0;
+    } else if (!vp->playing) {
+        wait = VIDEO_PIPE_WAIT_PAUSED;
+    } else {
+        wait = f->pts_us - lead_us - video_pipe_media_us(vp, now_us);
+        if (wait < 0) wait = 0;
+    }
+    vp_unlock(vp);
+    return wait;
+}
+
+void video_pipe_direct_shown(video_pipe_t *vp, video_pipe_frame_t *f, int64_t now_us) {
+    vp_lock(vp);
+    if (f->gen != vp->gen) {
+        // Already on the panel, but a seek wants another frame there
+        vp->stats.discarded++;
+    } else {
+        vp_note_decoded(vp, f);
+        if (!vp->clock_started) vp_start_clock(vp, f, now_us);
+        vp_note_shown(vp, f, video_pipe_media_us(vp, now_us));
+    }
+    vp_unlock(vp);
+}
+
+video_pipe_frame_t *video_pipe_present(video_pipe_t *vp, int64_t now_us) {
+    video_pipe_frame_t *f = NULL;
+    bool freed = false;
+    vp_lock(vp);
+    int64_t media = video_pipe_media_us(vp, now_us);
+    vp->stats.depth_sum += vp->ready_len;
+    vp->stats.depth_samples++;
+    if (vp->ready_len > vp->stats.depth_max) vp->stats.depth_max = vp->ready_len;
+
+    if (!vp->ready_len) {
+        // Nothing decoded although the frame after the one on screen is due
+        if (vp->playing && vp->clock_started && vp->shown_pts >= 0 &&
+            media >= vp->shown_pts + 2 * (int64_t)vp->period_us) {
+            vp->stats.underruns++;
+        }
+    }
+    // The newest due frame wins; older ones were overtaken while waiting
+    while (vp->ready_len) {
+        video_pipe_frame_t *head = &vp->frames[vp->ready[vp->ready_head]];
+        if (vp->clock_started && head->pts_us > media) break;
+        vp->ready_head = (vp->ready_head + 1) % VIDEO_PIPE_MAX_FRAMES;
+        vp->ready_len--;
+        if (f) {
+            f->state = VIDEO_PIPE_FREE;
+            vp->stats.dropped++;
+            freed = true;
+        }
+        f = head;
+        if (!vp->clock_started) {
+            vp_start_clock(vp, f, now_us);
+            media = f->pts_us;
+        }
+    }
+    if (f) {
+        uint8_t i = (uint8_t)(f - vp->frames);
+        vp_note_shown(vp, f, media);
+        if (vp->prev >= 0) {
+            vp->frames[vp->prev].state = VIDEO_PIPE_FREE;
+            freed = true;
+        }
+        vp->prev = vp->shown;
+        vp->shown = (int8_t)i;
+        f->state = VIDEO_PIPE_SHOWN;
+    }
+    vp_unlock(vp);
+    if (freed) vp_wake(vp);
+    return f;
+}
+
+void video_pipe_play(video_pipe_t *vp, int64_t now_us) {
+    vp_lock(vp);
+    if (!vp->playing) {
+        // Before the first frame is shown the clock starts with it instead
+        if (vp->clock_started) vp->origin = now_us - vp->paused_at;
+        vp->playing = true;
+    }
+    vp_unlock(vp);
+    // A direct decoder may be waiting for it
+    vp_wake(vp);
+}
+
+void video_pipe_pause(video_pipe_t *vp, int64_t now_us) {
+    vp_lock(vp);
+    if (vp->playing) {
+        if (vp->clock_started) vp->paused_at = now_us - vp->origin;
+        vp->playing = false;
+    }
+    vp_unlock(vp);
+}
+
+void video_pipe_seek(video_pipe_t *vp, uint32_t frame) {
+    vp_lock(vp);
+    vp->gen++;
+    vp->seek_pending = true;
+    vp->seek_frame = frame;
+    while (vp->ready_len) {
+        vp->frames[vp->ready[vp->ready_head]].state = VIDEO_PIPE_FREE;
+        vp->ready_head = (vp->ready_head + 1) % VIDEO_PIPE_MAX_FRAMES;
+        vp->ready_len--;
+        vp->stats.discarded++;
+    }
+    // Stamps restart at the target, and the clock waits for its frame
+    vp->last_frame = -1;
+    vp->loop_base = 0;
+    vp->clock_started = false;
+    vp->paused_at = (int64_t)frame * vp->period_us;
+    vp_unlock(vp);
+    vp_wake(vp);
+}
+
+void video_pipe_get_stats(video_pipe_t *vp, video_pipe_stats_t *stats, uint32_t *depth) {
+    vp_lock(vp);
+    *stats = vp->stats;
+    if (depth) *depth = vp->ready_len;
+    vp_unlock(vp);
+}
@@ -0,0 +1,182 @@
+// Multi-touch traces for the gesture recognizer host test.
+// Display coordinates (600x450 landscape), one frame per touch sample, n = 0 is the release.
+
+#pragma once
+#include "ui_gesture.h"
+
+typedef struct {
+    uint32_t t_ms;
+    uint8_t n;
+    ui_gesture_point_t p[3];
+} trace_frame_t;
+
+#define TRACE_LEN(t) (sizeof(t) / sizeof((t)[0]))
+
+// Pinch out: 100 px -> 200 px span around (300,225), first finger lands 10 ms early
+static const trace_frame_t trace_pinch_out[] = {
+    {   0, 1, {{0, 250, 225}}},
+    {  10, 2, {{0, 250, 225}, {1, 350, 224}}},
+    {  30, 2, {{0, 247, 226}, {1, 351, 225}}},
+    {  50, 2, {{0, 246, 224}, {1, 356, 225}}},
+    {  70, 2, {{0, 241, 224}, {1, 358, 225}}},
+    {  90, 2, {{0, 239, 225}, {1, 359, 226}}},
+    { 110, 2, {{0, 238, 224}, {1, 363, 224}}},
+    { 130, 2, {{0, 235, 226}, {1, 364, 226}}},
+    { 150, 2, {{0, 233, 225}, {1, 367, 225}}},
+    { 170, 2, {{0, 229, 226}, {1, 370, 225}}},
+    { 190, 2, {{0, 228, 225}, {1, 373, 224}}},
+    { 210, 2, {{0, 226, 225}, {1, 376, 225}}},
+    { 230, 2, {{0, 221, 226}, {1, 379, 225}}},
+    { 250, 2, {{0, 220, 224}, {1, 381, 224}}},
+    { 270, 2, {{0, 219, 224}, {1, 383, 225}}},
+    { 290, 2, {{0, 215, 226}, {1, 385, 225}}},
+    { 310, 2, {{0, 212, 226}, {1, 388, 225}}},
+    { 330, 2, {{0, 210, 225}, {1, 390, 225}}},
+    { 350, 2, {{0, 207, 226}, {1, 392, 226}}},
+    { 370, 2, {{0, 205, 225}, {1, 395, 225}}},
+    { 390, 2, {{0, 203, 224}, {1, 397, 226}}},
+    { 410, 2, {{0, 200, 225}, {1, 400, 225}}},
+    { 440, 1, {{1, 350, 225}}},
+    { 450, 0, {}},
+};
+
+// Clockwise twist: 160 px span, 0 -> 35 degrees
+static const trace_frame_t trace_rotate_cw[] = {
+    {   0, 2, {{0, 220, 225}, {1, 379, 224}}},
+    {  20, 2, {{0, 221, 223}, {1, 380, 228}}},
+    {  40, 2, {{0, 220, 221}, {1, 380, 231}}},
+    {  60, 2, {{0, 220, 216}, {1, 379, 233}}},
+    {  80, 2, {{0, 221, 213}, {1, 378, 236}}},
+    { 100, 2, {{0, 222, 211}, {1, 379, 239}}},
+    { 120, 2, {{0, 222, 208}, {1, 378, 241}}},
+    { 140, 2, {{0, 222, 207}, {1, 377, 244}}},
+    { 160, 2, {{0, 222, 204}, {1, 377, 246}}},
+    { 180, 2, {{0, 224, 201}, {1, 376, 249}}},
+    { 200, 2, {{0, 224, 198}, {1, 375, 252}}},
+    { 220, 2, {{0, 227, 196}, {1, 374, 254}}},
+    { 240, 2, {{0, 228, 193}, {1, 373, 257}}},
+    { 260, 2, {{0, 228, 191}, {1, 372, 258}}},
+    { 280, 2, {{0, 229, 188}, {1, 371, 262}}},
+    { 300, 2, {{0, 229, 186}, {1, 371, 264}}},
+    { 320, 2, {{0, 232, 184}, {1, 367, 266}}},
+    { 340, 2, {{0, 233, 182}, {1, 367, 270}}},
+    { 360, 2, {{0, 235, 179}, {1, 366, 272}}},
+    { 380, 0, {}},
+};
+
+// Two-finger pan: vertical pair moves +120/+40 px
+static const trace_frame_t trace_pan[] = {
+    {   0, 2, {{0, 201, 129}, {1, 200, 271}}},
+    {  20, 2, {{0, 208, 133}, {1, 208, 273}}},
+    {  40, 2, {{0, 215, 135}, {1, 216, 274}}},
+    {  60, 2, {{0, 224, 137}, {1, 224, 278}}},
+    {  80, 2, {{0, 232, 140}, {1, 232, 282}}},
+    { 100, 2, {{0, 239, 142}, {1, 239, 284}}},
+    { 120, 2, {{0, 248, 147}, {1, 247, 286}}},
+    { 140, 2, {{0, 257, 148}, {1, 255, 289}}},
+    { 160, 2, {{0, 265, 151}, {1, 264, 291}}},
+    { 180, 2, {{0, 272, 155}, {1, 272, 294}}},
+    { 200, 2, {{0, 279, 156}, {1, 280, 297}}},
+    { 220, 2, {{0, 288, 159}, {1, 288, 298}}},
+    { 240, 2, {{0, 296, 161}, {1, 296, 302}}},
+    { 260, 2, {{0, 304, 165}, {1, 305, 304}}},
+    { 280, 2, {{0, 312, 168}, {1, 312, 307}}},
+    { 300, 2, {{0, 321, 169}, {1, 321, 310}}},
+    { 320, 0, {}},
+};
+
+// Two fingers resting with sensor jitter: nothing should be recognized
+static const trace_frame_t trace_hold[] = {
+    {   0, 2, {{0, 229, 199}, {1, 371, 251}}},
+    {  20, 2, {{0, 230, 199}, {1, 370, 252}}},
+    {  40, 2, {{0, 231, 200}, {1, 370, 251}}},
+    {  60, 2, {{0, 231, 199}, {1, 370, 251}}},
+    {  80, 2, {{0, 230, 199}, {1, 371, 251}}},
+    { 100, 2, {{0, 230, 198}, {1, 369, 251}}},
+    { 120, 2, {{0, 230, 199}, {1, 370, 252}}},
+    { 140, 2, {{0, 230, 199}, {1, 370, 251}}},
+    { 160, 2, {{0, 229, 199}, {1, 369, 251}}},
+    { 180, 2, {{0, 230, 199}, {1, 370, 251}}},
+    { 200, 2, {{0, 230, 200}, {1, 371, 250}}},
+    { 220, 2, {{0, 230, 199}, {1, 369, 250}}},
+    { 240, 2, {{0, 230, 199}, {1, 370, 251}}},
+    { 260, 2, {{0, 230, 199}, {1, 369, 251}}},
+    { 280, 2, {{0, 230, 199}, {1, 369, 251}}},
+    { 300, 2, {{0, 230, 199}, {1, 369, 251}}},
+    { 320, 2, {{0, 231, 199}, {1, 370, 252}}},
+    { 340, 2, {{0, 231, 199}, {1, 370, 251}}},
+    { 360, 2, {{0, 231, 200}, {1, 370, 250}}},
+    { 380, 2, {{0, 229, 198}, {1, 371, 251}}},
+    { 400, 2, {{0, 230, 199}, {1, 370, 250}}},
+    { 420, 2, {{0, 230, 199}, {1, 370, 252}}},
+    { 440, 2, {{0, 230, 200}, {1, 370, 251}}},
+    { 460, 2, {{0, 231, 199}, {1, 370, 250}}},
+    { 480, 2, {{0, 230, 199}, {1, 371, 252}}},
+    { 500, 0, {}},
+};
+
+// Single-finger drag: not a two-finger gesture
+static const trace_frame_t trace_single_drag[] = {
+    {   0, 1, {{0, 100, 301}}},
+    {  20, 1, {{0, 113, 301}}},
+    {  40, 1, {{0, 126, 301}}},
+    {  60, 1, {{0, 141, 299}}},
+    {  80, 1, {{0, 153, 300}}},
+    { 100, 1, {{0, 167, 299}}},
+    { 120, 1, {{0, 180, 300}}},
+    { 140, 1, {{0, 193, 300}}},
+    { 160, 1, {{0, 207, 299}}},
+    { 180, 1, {{0, 221, 299}}},
+    { 200, 1, {{0, 233, 301}}},
+    { 220, 1, {{0, 247, 301}}},
+    { 240, 1, {{0, 260, 299}}},
+    { 260, 1, {{0, 274, 299}}},
+    { 280, 1, {{0, 286, 300}}},
+    { 300, 1, {{0, 300, 299}}},
+    { 320, 0, {}},
+};
+
+// Pinch in 240 -> 120 px (IDs 2/3); a third finger lands mid-way, then ID 2 lifts
+static const trace_frame_t trace_pinch_in_third_finger[] = {
+    {   0, 2, {{2, 179, 226}, {3, 420, 226}}},
+    {  20, 2, {{2, 184, 224}, {3, 415, 225}}},
+    {  40, 2, {{2, 191, 226}, {3, 411, 226}}},
+    {  60, 2, {{2, 195, 225}, {3, 405, 226}}},
+    {  80, 2, {{2, 201, 225}, {3, 401, 225}}},
+    { 100, 2, {{2, 206, 225}, {3, 396, 225}}},
+    { 120, 3, {{2, 210, 225}, {3, 390, 224}, {4, 500, 400}}},
+    { 140, 3, {{2, 215, 224}, {3, 385, 225}, {4, 499, 400}}},
+    { 160, 3, {{2, 220, 224}, {3, 380, 225}, {4, 500, 400}}},
+    { 180, 3, {{2, 225, 225}, {3, 375, 224}, {4, 500, 400}}},
+    { 200, 3, {{2, 230, 225}, {3, 370, 225}, {4, 501, 400}}},
+    { 220, 3, {{2, 235, 225}, {3, 365, 225}, {4, 500, 399}}},
+    { 240, 3, {{2, 240, 224}, {3, 360, 226}, {4, 500, 400}}},
+    { 260, 2, {{3, 360, 225}, {4, 500, 400}}},
+    { 280, 0, {}},
+};
+
+// Fast spin through the +-180 degree seam: 170 -> 370 degrees (200 degrees clockwise)
+static const trace_frame_t trace_spin[] = {
+    {   0, 2, {{0, 373, 212}, {1, 226, 239}}},
+    {  16, 2, {{0, 376, 225}, {1, 226, 224}}},
+    {  32, 2, {{0, 373, 238}, {1, 225, 211}}},
+    {  48, 2, {{0, 370, 251}, {1, 229, 199}}},
+    {  64, 2, {{0, 365, 262}, {1, 235, 188}}},
+    {  80, 2, {{0, 357, 273}, {1, 244, 178}}},
+    {  96, 2, {{0, 349, 282}, {1, 252, 167}}},
+    { 112, 2, {{0, 338, 289}, {1, 262, 160}}},
+    { 128, 2, {{0, 325, 295}, {1, 273, 154}}},
+    { 144, 2, {{0, 313, 298}, {1, 288, 151}}},
+    { 160, 2, {{0, 299, 300}, {1, 299, 150}}},
+    { 176, 2, {{0, 286, 299}, {1, 314, 151}}},
+    { 192, 2, {{0, 274, 296}, {1, 326, 154}}},
+    { 208, 2, {{0, 263, 290}, {1, 337, 160}}},
+    { 224, 2, {{0, 252, 281}, {1, 348, 168}}},
+    { 240, 2, {{0, 243, 273}, {1, 358, 177}}},
+    { 256, 2, {{0, 235, 263}, {1, 366, 187}}},
+    { 272, 2, {{0, 230, 251}, {1, 369, 199}}},
+    { 288, 2, {{0, 225, 237}, {1, 373, 213}}},
+    { 304, 2, {{0, 226, 225}, {1, 376, 225}}},
+    { 320, 2, {{0, 226, 212}, {1, 373, 238}}},
+    { 336, 0, {}},
+};
@@ -0,0 +1,2770 @@
+// Host-side test for the lv_ui gesture recognizer: replays multi-touch traces
+// (gesture_traces.h) and checks the recognized gestures and their parameters.
+// Also checks the asset bundle reader against assets/assets.bin as packed by
+// tools/pack_assets.py, and that damaged bundles are rejected. The AVI frame index is
+// checked against a chunk walk over the sample AVIs in 4_sd_card/ and a synthetic OpenDML
+// file, and seek and per-frame demux costs are measured both ways. The video pipeline runs
+// with a demux thread, a decoder thread using the system libjpeg-turbo and a UI thread
+// presenting frames, against decoding inline on the UI thread as the timer player did.
+// Region decodes (crop, skip, DCT scale) must match the same pixels of a whole-frame
+// decode, and are timed against it for each sample video in both orientations of the
+// media screen and for the viewer zoomed into a photo-sized JPEG. The video plane's band decode must match the frame buffer decode byte-swapped, and its
+// host frame rate and PSRAM pixel traffic are compared with the LVGL path. A decoder kept
+// across a stream must give the same pixels as one set up per frame with no heap
+// allocations after the first, and decode frames without Huffman tables. The raw YCbCr
+// converter must give the same pixels as libjpeg's RGB565 output, big-endian bands the
+// same swapped, and both are timed on the sample frames. Frames streamed out of the SD
+// read-ahead in parts, through a ring smaller than a frame, must decode as they do from
+// memory; their read + decode latency and the buffer memory are compared with whole chunks.
+// Frames re-encoded with restart markers must decode in two parts at once to the pixels of
+// the original in one, and the CPU time of each part is measured. Tile hashes taken as the
+// decoder writes rows must cover every tile whose pixels changed since the frame before;
+// the pixels redrawn and the composition time are compared with redrawing whole frames.
+//
+// Run from the repository root (needs libjpeg-turbo, e.g. libjpeg-turbo8-dev):
+// gcc -std=gnu11 -O2 -Wall -pthread -I components/lv_ui/include -I components/sd_card -o /tmp/lv_ui_host_test components/lv_ui/test/host_test.c components/lv_ui/src/ui_gesture.c components/lv_ui/src/asset_bundle.c components/lv_ui/src/avi_index.c components/lv_ui/src/video_pipe.c components/lv_ui/src/mjpeg_decode.c components/lv_ui/src/frame_diff.c components/sd_card/sd_stream.c -ljpeg -lm
+// /tmp/lv_ui_host_test
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "ui_gesture.h"
+#include "asset_bundle.h"
+#include "avi_index.h"
+#include "video_pipe.h"
+#include "mjpeg_decode.h"
+#include "frame_diff.h"
+#include "sd_stream.h"
+#include "gesture_traces.h"
+#include <jpeglib.h>
+
+static int s_failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); s_failures++; } \
+} while (0)
+
+#define NEAR(a, b, tol) (fabsf((float)(a) - (float)(b)) <= (tol))
+
+typedef struct {
+    int begins;
+    int ends;
+    int changes;
+    uint32_t flags_at_end;      // flags latched when the gesture ended
+    float scale;                // last values reported before the end
+    float angle;
+    float dx;
+    float dy;
+} replay_result_t;
+
+static replay_result_t replay(const trace_frame_t *trace, size_t len) {
+    ui_gesture_t g;
+    replay_result_t r = {0};
+    ui_gesture_init(&g);
+    for (size_t i = 0; i < len; i++) {
+        ui_gesture_phase_t ph = ui_gesture_update(&g, trace[i].t_ms, trace[i].p, trace[i].n);
+        switch (ph) {
+        case UI_GESTURE_PHASE_BEGIN:  r.begins++; break;
+        case UI_GESTURE_PHASE_CHANGE: r.changes++; break;
+        case UI_GESTURE_PHASE_END:    r.ends++; r.flags_at_end = g.flags; break;
+        default: break;
+        }
+        if (ph == UI_GESTURE_PHASE_BEGIN || ph == UI_GESTURE_PHASE_CHANGE) {
+            r.scale = g.scale;
+            r.angle = g.angle_deg;
+            r.dx = g.dx;
+            r.dy = g.dy;
+        }
+    }
+    return r;
+}
+
+static void test_pinch_out(void) {
+    replay_result_t r = replay(trace_pinch_out, TRACE_LEN(trace_pinch_out));
+    CHECK(r.begins == 1 && r.ends == 1);
+    CHECK(r.flags_at_end == UI_GESTURE_PINCH);
+    CHECK(NEAR(r.scale, 2.0f, 0.05f));
+    CHECK(NEAR(r.angle, 0.0f, 2.0f));
+}
+
+static void test_rotate(void) {
+    replay_result_t r = replay(trace_rotate_cw, TRACE_LEN(trace_rotate_cw));
+    CHECK(r.begins == 1 && r.ends == 1);
+    CHECK(r.flags_at_end == UI_GESTURE_ROTATE);
+    CHECK(NEAR(r.angle, 35.0f, 2.0f));
+    CHECK(NEAR(r.scale, 1.0f, 0.05f));
+}
+
+static void test_pan(void) {
+    replay_result_t r = replay(trace_pan, TRACE_LEN(trace_pan));
+    CHECK(r.begins == 1 && r.ends == 1);
+    CHECK(r.flags_at_end == UI_GESTURE_PAN);
+    CHECK(NEAR(r.dx, 120.0f, 2.0f));
+    CHECK(NEAR(r.dy, 40.0f, 2.0f));
+}
+
+static void test_hold_is_ignored(void) {
+    replay_result_t r = replay(trace_hold, TRACE_LEN(trace_hold));
+    CHECK(r.begins == 0 && r.changes == 0 && r.ends == 0);
+}
+
+static void test_single_finger_is_ignored(void) {
+    replay_result_t r = replay(trace_single_drag, TRACE_LEN(trace_single_drag));
+    CHECK(r.begins == 0 && r.ends == 0);
+}
+
+static void test_third_finger_and_lift(void) {
+    replay_result_t r = replay(trace_pinch_in_third_finger, TRACE_LEN(trace_pinch_in_third_finger));
+    CHECK(r.begins == 1 && r.ends == 1);
+    CHECK(r.flags_at_end == UI_GESTURE_PINCH);
+    CHECK(NEAR(r.scale, 0.5f, 0.05f));
+}
+
+static void test_spin_unwraps(void) {
+    replay_result_t r = replay(trace_spin, TRACE_LEN(trace_spin));
+    CHECK(r.ends == 1);
+    CHECK(r.flags_at_end & UI_GESTURE_ROTATE);
+    CHECK(!(r.flags_at_end & UI_GESTURE_PINCH));
+    CHECK(NEAR(r.angle, 200.0f, 3.0f));
+}
+
+static void test_restart_after_end(void) {
+    // Two gestures back to back on one recognizer start from fresh baselines
+    ui_gesture_t g;
+    ui_gesture_init(&g);
+    for (size_t i = 0; i < TRACE_LEN(trace_pinch_out); i++) {
+        ui_gesture_update(&g, trace_pinch_out[i].t_ms, trace_pinch_out[i].p, trace_pinch_out[i].n);
+    }
+    int begins = 0;
+    for (size_t i = 0; i < TRACE_LEN(trace_pan); i++) {
+        if (ui_gesture_update(&g, 1000 + trace_pan[i].t_ms, trace_pan[i].p, trace_pan[i].n) == UI_GESTURE_PHASE_BEGIN) begins++;
+    }
+    CHECK(begins == 1);
+    CHECK(g.flags == UI_GESTURE_PAN && !g.tracking);
+}
+
+// --- Asset bundle ---
+
+static uint8_t *load_file(const char *path, uint32_t *size) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    *size = (uint32_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = malloc(*size);
+    if (data && fread(data, 1, *size, f) != *size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static void test_asset_bundle(void) {
+    uint32_t size = 0;
+    uint8_t *data = load_file("assets/assets.bin", &size);
+    CHECK(data != NULL);
+    if (!data) return;
+
+    asset_bundle_t b;
+    CHECK(asset_bundle_peek_size(data) == size);
+    CHECK(asset_bundle_open(&b, data, size, true) == ASSET_BUNDLE_OK);
+    CHECK(b.count == 2);
+    // The two images that used to be C arrays: 80x80 RGB565 (lv_color_format_t 0x12)
+    static const char *names[] = {"img_venezuela", "img_watermelon"};
+    for (int i = 0; i < 2; i++) {
+        const asset_entry_t *e = asset_bundle_find(&b, names[i], ASSET_TYPE_IMAGE);
+        CHECK(e && e->w == 80 && e->h == 80 && e->cf == 0x12 && e->stride == 160 && e->size == 12800);
+        CHECK(e && (uintptr_t)asset_bundle_data(&b, e) % 16 == 0);
+    }
+    CHECK(asset_bundle_find(&b, "img_watermelon", ASSET_TYPE_FONT) == NULL);
+    CHECK(asset_bundle_find(&b, "img_water", ASSET_TYPE_IMAGE) == NULL);
+    CHECK(asset_bundle_find(&b, "", ASSET_TYPE_IMAGE) == NULL);
+
+    // Damage: a flipped pixel only shows with the CRC; header and index damage always does
+    uint8_t *bad = malloc(size);
+    memcpy(bad, data, size);
+    bad[size - 1] ^= 1;
+    CHECK(asset_bundle_open(&b, bad, size, true) == ASSET_BUNDLE_ERR_CRC);
+    CHECK(asset_bundle_open(&b, bad, size, false) == ASSET_BUNDLE_OK);
+    CHECK(asset_bundle_open(&b, data, size - 1, false) == ASSET_BUNDLE_ERR_SIZE);
+    memcpy(bad, data, size);
+    bad[4] = 2;
+    CHECK(asset_bundle_open(&b, bad, size, false) == ASSET_BUNDLE_ERR_VERSION);
+    memset(bad, 0xFF, 16);     // erased flash
+    CHECK(asset_bundle_peek_size(bad) == 0 && asset_bundle_open(&b, bad, size, false) == ASSET_BUNDLE_ERR_MAGIC);
+    asset_entry_t *idx = (asset_entry_t *)(bad + ASSET_BUNDLE_HEADER);
+    memcpy(bad, data, size);
+    idx[1].offset = size - 100;
+    CHECK(asset_bundle_open(&b, bad, size, false) == ASSET_BUNDLE_ERR_INDEX);
+    memcpy(bad, data, size);
+    idx[0].offset += 2;
+    CHECK(asset_bundle_open(&b, bad, size, false) == ASSET_BUNDLE_ERR_INDEX);
+    memcpy(bad, data, size);
+    idx[0].offset += 4;        // word aligned is not enough
+    CHECK(asset_bundle_open(&b, bad, size, false) == ASSET_BUNDLE_ERR_INDEX);
+    memcpy(bad, data, size);
+    memcpy(idx[0].name, "zzz", 4);
+    CHECK(asset_bundle_open(&b, bad, size, false) == ASSET_BUNDLE_ERR_INDEX);
+    memcpy(bad, data, size);
+    memset(idx[0].name, 'a', ASSET_NAME_MAX);
+    CHECK(asset_bundle_open(&b, bad, size, false) == ASSET_BUNDLE_ERR_INDEX);
+    free(bad);
+
+    // Boot cost is the CRC over the bundle: this one, and a full 6 MB partition
+    const int reps = 200;
+    double t0 = now_ms();
+    for (int i = 0; i < reps; i++) asset_bundle_open(&b, data, size, true);
+    double open_us = (now_ms() - t0) * 1e3 / reps;
+    uint32_t big = 6 * 1024 * 1024;
+    uint8_t *full = calloc(1, big);
+    t0 = now_ms();
+    volatile uint32_t crc = asset_bundle_crc32(0, full, big);
+    double full_ms = now_ms() - t0;
+    t0 = now_ms();
+    volatile const asset_entry_t *hit = NULL;
+    for (int i = 0; i < 100000; i++) hit = asset_bundle_find(&b, names[i & 1], ASSET_TYPE_IMAGE);
+    double find_ns = (now_ms() - t0) * 1e6 / 100000;
+    printf("asset bundle: %u bytes, open + CRC %.1f us, "
+           "CRC of a full 6 MB partition %.1f ms, lookup %.0f ns (host)\n",
+           (unsigned)size, open_us, full_ms, find_ns);
+    (void)crc;
+    CHECK(hit != NULL);
+    free(full);
+
+    // CRC-32 as zlib.crc32
+    CHECK(asset_bundle_crc32(0, (const uint8_t *)"123456789", 9) == 0xCBF43926u);
+    free(data);
+}
+
+// ---- AVI frame index ----
+
+static const char *s_avi_samples[] = {
+    "circletriangle", "eye", "fallingcube", "hearttunnel", "pulpfictiondance",
+    "redplasma", "spacetime", "starspin", "waterrings",
+};
+
+typedef struct {
+    const uint8_t *data;
+    uint32_t size;
+} mem_file_t;
+
+static int32_t mem_read(void *ctx, uint32_t offset, void *buf, uint32_t len) {
+    mem_file_t *m = (mem_file_t *)ctx;
+    if (offset >= m->size) return 0;
+    if (len > m->size - offset) len = m->size - offset;
+    memcpy(buf, m->data + offset, len);
+    return (int32_t)len;
+}
+
+// As on the card: every read is a seek and a call into the file system
+typedef struct {
+    FILE *f;
+    uint32_t reads;
+} disk_file_t;
+
+static int32_t disk_read(void *ctx, uint32_t offset, void *buf, uint32_t len) {
+    disk_file_t *d = (disk_file_t *)ctx;
+    d->reads++;
+    if (fseek(d->f, offset, SEEK_SET) != 0) return -1;
+    return (int32_t)fread(buf, 1, len, d->f);
+}
+
+static void *host_realloc(void *ptr, size_t size) {
+    if (!size) {
+        free(ptr);
+        return NULL;
+    }
+    return realloc(ptr, size);
+}
+
+static uint32_t le32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// The player before the index: chunk headers one by one from `from` to the next video
+// frame. Returns its header offset (0 at the end of the list).
+static uint32_t walk_next_frame(const avi_info_t *info, avi_read_fn read, void *ctx, uint32_t from,
+                                uint32_t *size) {
+    uint32_t pos = from;
+    while (pos + 8 <= info->movi_end) {
+        uint8_t h[8];
+        if (read(ctx, pos, h, 8) != 8) return 0;
+        uint32_t id = le32(h), sz = le32(h + 4);
+        if (avi_is_video_chunk(info, id) && sz) {
+            *size = sz;
+            return pos;
+        }
+        pos += 8 + sz + (sz & 1);
+    }
+    return 0;
+}
+
+// Index built the way the player does for a file without one: noting frames as they pass
+static void walk_build(avi_index_t *ix, const avi_info_t *info, avi_read_fn read, void *ctx) {
+    uint32_t size, pos = info->movi_start;
+    while ((pos = walk_next_frame(info, read, ctx, pos, &size)) != 0) {
+        CHECK(avi_index_note(ix, pos, size));
+        pos += 8 + size + (size & 1);
+    }
+}
+
+static bool same_index(const avi_index_t *a, const avi_index_t *b) {
+    return a->count == b->count && !memcmp(a->frames, b->frames, a->count * sizeof(avi_frame_t));
+}
+
+typedef struct {
+    uint8_t *p;
+    uint32_t len;
+    uint32_t cap;
+} wbuf_t;
+
+static void wb_put(wbuf_t *w, const void *d, uint32_t n) {
+    if (w->len + n > w->cap) {
+        w->cap = (w->len + n) * 2;
+        w->p = realloc(w->p, w->cap);
+    }
+    if (d) memcpy(w->p + w->len, d, n);
+    else memset(w->p + w->len, 0, n);
+    w->len += n;
+}
+
+static void wb_u32(wbuf_t *w, uint32_t v) {
+    uint8_t b[4] = {(uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24)};
+    wb_put(w, b, 4);
+}
+
+static void wb_set32(wbuf_t *w, uint32_t at, uint32_t v) {
+    w->p[at] = (uint8_t)v;
+    w->p[at + 1] = (uint8_t)(v >> 8);
+    w->p[at + 2] = (uint8_t)(v >> 16);
+    w->p[at + 3] = (uint8_t)(v >> 24);
+}
+
+// Chunk header with the size filled in by wb_end; returns where the payload starts
+static uint32_t wb_begin(wbuf_t *w, const char *id) {
+    wb_put(w, id, 4);
+    wb_u32(w, 0);
+    return w->len;
+}
+
+static void wb_end(wbuf_t *w, uint32_t body) {
+    wb_set32(w, body - 4, w->len - body);
+    if ((w->len - body) & 1) wb_put(w, NULL, 1);
+}
+
+// OpenDML-style file: audio in stream 0, video in stream 1 behind a super index, an ix01
+// standard index at the end of movi and no idx1. Returns the header offsets of the frames.
+static wbuf_t make_odml(const mem_file_t *src, const avi_index_t *six, uint32_t *hdrs) {
+    wbuf_t w = {0};
+    uint32_t riff = wb_begin(&w, "RIFF");
+    wb_put(&w, "AVI ", 4);
+    uint32_t hdrl = wb_begin(&w, "LIST");
+    wb_put(&w, "hdrl", 4);
+    uint32_t avih = wb_begin(&w, "avih");
+    wb_put(&w, NULL, 56);
+    wb_set32(&w, avih, 66666);
+    wb_set32(&w, avih + 16, six->count);
+    wb_set32(&w, avih + 24, 2);
+    wb_set32(&w, avih + 32, 300);
+    wb_set32(&w, avih + 36, 300);
+    wb_end(&w, avih);
+    static const char *types[2] = {"auds", "vids"};
+    uint32_t super_entry = 0;
+    for (int s = 0; s < 2; s++) {
+        uint32_t strl = wb_begin(&w, "LIST");
+        wb_put(&w, "strl", 4);
+        uint32_t strh = wb_begin(&w, "strh");
+        wb_put(&w, types[s], 4);
+        wb_put(&w, NULL, 52);
+        wb_end(&w, strh);
+        if (s == 1) {
+            uint32_t indx = wb_begin(&w, "indx");
+            wb_u32(&w, 4);              // wLongsPerEntry 4, sub type 0, AVI_INDEX_OF_INDEXES
+            wb_u32(&w, 1);
+            wb_put(&w, "01dc", 4);
+            wb_put(&w, NULL, 12);
+            super_entry = w.len;
+            wb_put(&w, NULL, 16);       // qwOffset, dwSize, dwDuration: patched below
+            wb_end(&w, indx);
+        }
+        wb_end(&w, strl);
+    }
+    wb_end(&w, hdrl);
+
+    uint32_t movi = wb_begin(&w, "LIST");
+    wb_put(&w, "movi", 4);
+    for (uint32_t i = 0; i < six->count; i++) {
+        uint32_t au = wb_begin(&w, "00wb");
+        wb_put(&w, NULL, 101);          // odd: padded
+        wb_end(&w, au);
+        hdrs[i] = w.len;
+        uint32_t vd = wb_begin(&w, "01dc");
+        wb_put(&w, src->data + six->frames[i].offset + 8, six->frames[i].size);
+        wb_end(&w, vd);
+    }
+    uint32_t ix_at = w.len;
+    uint32_t ix = wb_begin(&w, "ix01");
+    uint32_t base = movi;               // qwBaseOffset: anything below the first frame
+    wb_u32(&w, 2 | (1u << 24));         // wLongsPerEntry 2, sub type 0, AVI_INDEX_OF_CHUNKS
+    wb_u32(&w, six->count);
+    wb_put(&w, "01dc", 4);
+    wb_u32(&w, base);
+    wb_u32(&w, 0);
+    wb_u32(&w, 0);
+    for (uint32_t i = 0; i < six->count; i++) {
+        wb_u32(&w, hdrs[i] + 8 - base);
+        wb_u32(&w, six->frames[i].size | (i ? 0x80000000u : 0));  // all but the first "delta"
+    }
+    wb_end(&w, ix);
+    wb_end(&w, movi);
+    wb_end(&w, riff);
+    wb_set32(&w, super_entry, ix_at);
+    wb_set32(&w, super_entry + 8, w.len - ix_at);
+    wb_set32(&w, super_entry + 12, six->count);
+    return w;
+}
+
+typedef struct {
+    double load_us;
+    double walk_seek_us, walk_seek_reads;
+    double ix_seek_us;
+    double walk_frame_us, walk_frame_reads;
+    double ix_frame_us;
+} avi_cost_t;
+
+// Seek latency (random frame: located and its data read) and sequential demux per frame,
+// through stdio on a real file, the old chunk walk against the index
+static avi_cost_t avi_measure(const char *path, uint8_t *frame_buf) {
+    avi_cost_t c = {0};
+    disk_file_t d = {.f = fopen(path, "rb")};
+    CHECK(d.f != NULL);
+    if (!d.f) return c;
+    fseek(d.f, 0, SEEK_END);
+    uint32_t file_size = (uint32_t)ftell(d.f);
+
+    avi_info_t info;
+    avi_index_t ix;
+    avi_index_init(&ix, host_realloc);
+    uint8_t scratch[4096];
+    const int reps = 20;
+    double t0 = now_ms();
+    for (int r = 0; r < reps; r++) {
+        avi_parse(disk_read, &d, file_size, &info);
+        avi_index_load(&ix, &info, disk_read, &d, scratch, sizeof(scratch));
+    }
+    c.load_us = (now_ms() - t0) * 1e3 / reps;
+    CHECK(ix.complete && ix.count > 1);
+
+    const int seeks = 400;
+    uint32_t seed = 12345, size;
+    d.reads = 0;
+    t0 = now_ms();
+    for (int i = 0; i < seeks; i++) {
+        seed = seed * 1103515245 + 12345;
+        uint32_t k = (seed >> 8) % ix.count;
+        uint32_t pos = info.movi_start;
+        for (uint32_t n = 0;; n++) {
+            pos = walk_next_frame(&info, disk_read, &d, pos, &size);
+            if (n == k) break;
+            pos += 8 + size + (size & 1);
+        }
+        CHECK(pos == ix.frames[k].offset);
+        disk_read(&d, pos + 8, frame_buf, size);
+    }
+    c.walk_seek_us = (now_ms() - t0) * 1e3 / seeks;
+    c.walk_seek_reads = (double)d.reads / seeks;
+
+    seed = 12345;
+    t0 = now_ms();
+    for (int i = 0; i < seeks; i++) {
+        seed = seed * 1103515245 + 12345;
+        uint32_t ms = avi_frame_ms(&info, (seed >> 8) % ix.count);
+        const avi_frame_t *f = &ix.frames[avi_index_frame_at(&ix, &info, ms)];
+        disk_read(&d, f->offset + 8, frame_buf, f->size);
+    }
+    c.ix_seek_us = (now_ms() - t0) * 1e3 / seeks;
+
+    const int passes = 10;
+    d.reads = 0;
+    t0 = now_ms();
+    for (int p = 0; p < passes; p++) {
+        uint32_t pos = info.movi_start;
+        while ((pos = walk_next_frame(&info, disk_read, &d, pos, &size)) != 0) {
+            disk_read(&d, pos + 8, frame_buf, size);
+            pos += 8 + size + (size & 1);
+        }
+    }
+    c.walk_frame_us = (now_ms() - t0) * 1e3 / (passes * ix.count);
+    c.walk_frame_reads = (double)d.reads / (passes * ix.count);
+    t0 = now_ms();
+    for (int p = 0; p < passes; p++) {
+        for (uint32_t k = 0; k < ix.count; k++) disk_read(&d, ix.frames[k].offset + 8, frame_buf, ix.frames[k].size);
+    }
+    c.ix_frame_us = (now_ms() - t0) * 1e3 / (passes * ix.count);
+
+    avi_index_free(&ix);
+    fclose(d.f);
+    return c;
+}
+
+static void print_cost(const char *name, uint32_t frames, const avi_cost_t *c) {
+    printf("  %-17s %4u  %6.1f  %7.1f (%4.1f) %6.1f  %6.1f (%3.1f) %6.1f\n", name, (unsigned)frames, c->load_us,
+           c->walk_seek_us, c->walk_seek_reads, c->ix_seek_us, c->walk_frame_us, c->walk_frame_reads, c->ix_frame_us);
+}
+
+static void test_avi_index(void) {
+    uint8_t *frame_buf = malloc(1 << 20);
+    uint8_t scratch[256];
+    printf("avi index (host, stdio): us; chunk walk (reads) vs index\n");
+    printf("  %-17s %4s  %6s  %14s %6s  %12s %6s\n", "file", "frm", "load", "seek walk", "index",
+           "frame walk", "index");
+
+    for (size_t i = 0; i < sizeof(s_avi_samples) / sizeof(s_avi_samples[0]); i++) {
+        char path[64];
+        snprintf(path, sizeof(path), "4_sd_card/%s.avi", s_avi_samples[i]);
+        mem_file_t m;
+        uint8_t *data = load_file(path, &m.size);
+        CHECK(data != NULL);
+        if (!data) continue;
+        m.data = data;
+
+        avi_info_t info;
+        CHECK(avi_parse(mem_read, &m, m.size, &info));
+        CHECK(info.usec_per_frame == 66666 && info.width == 300 && info.height == 300);
+        CHECK(info.video_stream == 0 && info.idx1_offset && !info.odml_count);
+
+        // idx1 against a walk of the movi list; a small scratch buffer reads it in blocks
+        avi_index_t ix, walked;
+        avi_index_init(&ix, host_realloc);
+        avi_index_init(&walked, host_realloc);
+        CHECK(avi_index_load(&ix, &info, mem_read, &m, scratch, sizeof(scratch)) == AVI_INDEX_IDX1);
+        CHECK(ix.complete && ix.count == info.total_frames);
+        walk_build(&walked, &info, mem_read, &m);
+        CHECK(same_index(&ix, &walked));
+        // Noting frames already known changes nothing
+        CHECK(avi_index_note(&walked, ix.frames[0].offset, ix.frames[0].size) && walked.count == ix.count);
+
+        for (uint32_t k = 0; k < ix.count; k++) {
+            CHECK(avi_index_find(&ix, ix.frames[k].offset) == k);
+            CHECK(avi_index_find(&ix, ix.frames[k].offset - 1) == k);
+            CHECK(avi_index_frame_at(&ix, &info, avi_frame_ms(&info, k) + 1) == k);
+        }
+        CHECK(avi_index_find(&ix, info.movi_end) == ix.count);
+        CHECK(avi_index_frame_at(&ix, &info, UINT32_MAX) == ix.count - 1);
+
+        // idx1 with absolute offsets, as some writers do
+        uint8_t *abs_copy = malloc(m.size);
+        memcpy(abs_copy, data, m.size);
+        for (uint32_t e = info.idx1_offset; e + 16 <= info.idx1_offset + info.idx1_size; e += 16) {
+            uint32_t v = le32(abs_copy + e + 8) + info.movi_start - 4;
+            memcpy(abs_copy + e + 8, &v, 4);
+        }
+        mem_file_t abs_m = {abs_copy, m.size};
+        avi_index_t abs_ix;
+        avi_index_init(&abs_ix, host_realloc);
+        CHECK(avi_index_load(&abs_ix, &info, mem_read, &abs_m, scratch, sizeof(scratch)) == AVI_INDEX_IDX1);
+        CHECK(same_index(&ix, &abs_ix));
+        // idx1 pointing nowhere: no index rather than a wrong one
+        memset(abs_copy + info.idx1_offset + 8, 0xEE, 4);
+        CHECK(avi_index_load(&abs_ix, &info, mem_read, &abs_m, scratch, sizeof(scratch)) == AVI_INDEX_NONE);
+        CHECK(abs_ix.count == 0 && !abs_ix.complete);
+        avi_index_free(&abs_ix);
+        free(abs_copy);
+
+        // Cut mid-movi (recording stopped): the head still parses, frames come from playing
+        avi_info_t cut;
+        CHECK(avi_parse(mem_read, &m, info.movi_start + 30000, &cut));
+        CHECK(cut.movi_end == info.movi_start + 30000 && !cut.idx1_offset);
+
+        if (i == 1) {
+            // eye: the same frames in an OpenDML layout, interleaved with audio
+            uint32_t *hdrs = malloc(ix.count * sizeof(uint32_t));
+            wbuf_t w = make_odml(&m, &ix, hdrs);
+            mem_file_t om = {w.p, w.len};
+            avi_info_t oi;
+            CHECK(avi_parse(mem_read, &om, om.size, &oi));
+            CHECK(oi.video_stream == 1 && oi.odml_count == 1 && !oi.idx1_offset);
+            CHECK(avi_is_video_chunk(&oi, 0x63643130) && !avi_is_video_chunk(&oi, 0x63643030));
+            avi_index_t oix, owalk;
+            avi_index_init(&oix, host_realloc);
+            avi_index_init(&owalk, host_realloc);
+            CHECK(avi_index_load(&oix, &oi, mem_read, &om, scratch, sizeof(scratch)) == AVI_INDEX_ODML);
+            CHECK(oix.count == ix.count);
+            for (uint32_t k = 0; k < oix.count && k < ix.count; k++) {
+                CHECK(oix.frames[k].offset == hdrs[k] && oix.frames[k].size == ix.frames[k].size);
+            }
+            walk_build(&owalk, &oi, mem_read, &om);
+            CHECK(same_index(&oix, &owalk));
+
+            FILE *f = fopen("/tmp/avi_index_odml.avi", "wb");
+            CHECK(f && fwrite(w.p, 1, w.len, f) == w.len);
+            if (f) fclose(f);
+            avi_cost_t c = avi_measure("/tmp/avi_index_odml.avi", frame_buf);
+            CHECK(c.walk_frame_reads > 2.9);    // audio header, video header, data
+            print_cost("eye (ODML+audio)", oix.count, &c);
+            avi_index_free(&oix);
+            avi_index_free(&owalk);
+            free(hdrs);
+            free(w.p);
+        }
+
+        avi_cost_t c = avi_measure(path, frame_buf);
+        print_cost(s_avi_samples[i], ix.count, &c);
+        // One read per seek with the index; the walk grows with the distance
+        CHECK(c.walk_seek_reads > ix.count / 3.0);
+
+        avi_index_free(&ix);
+        avi_index_free(&walked);
+        free(data);
+    }
+    free(frame_buf);
+}
+
+// ---- Video pipeline ----
+
+// Acquire, schedule and submit one frame decoded in no time
+static video_pipe_frame_t *pipe_decode(video_pipe_t *vp, uint32_t frame, int64_t now) {
+    video_pipe_frame_t *f = video_pipe_acquire(vp);
+    if (!f) return NULL;
+    if (!video_pipe_schedule(vp, f, frame, now)) {
+        video_pipe_submit(vp, f, false);
+        return NULL;
+    }
+    video_pipe_submit(vp, f, true);
+    return f;
+}
+
+static void test_video_pipe_logic(void) {
+    static uint8_t mem[4][16];
+    uint8_t *bufs[4] = {mem[0], mem[1], mem[2], mem[3]};
+    video_pipe_t vp;
+    video_pipe_init(&vp, bufs, 4, 16, 1000, NULL);
+
+    // Four buffers, stamped from their index in the file
+    video_pipe_frame_t *f[8];
+    for (int i = 0; i < 4; i++) CHECK((f[i] = pipe_decode(&vp, (uint32_t)i, 0)) != NULL);
+    CHECK(video_pipe_acquire(&vp) == NULL);
+    CHECK(f[3]->pts_us == 3000);
+
+    // The first frame starts the clock whenever it comes; then each at its time
+    video_pipe_play(&vp, 0);
+    CHECK(video_pipe_present(&vp, 500) == f[0]);
+    CHECK(video_pipe_present(&vp, 1000) == NULL);
+    CHECK(video_pipe_present(&vp, 1500) == f[1]);
+    CHECK(video_pipe_acquire(&vp) == NULL);             // 0 still held behind 1
+    CHECK(video_pipe_present(&vp, 2600) == f[2]);
+    CHECK(vp.stats.jitter_max_us == 100);
+
+    // Pausing freezes the clock
+    video_pipe_pause(&vp, 3000);
+    CHECK(video_pipe_present(&vp, 9000) == NULL);
+    video_pipe_play(&vp, 10000);
+    CHECK(video_pipe_present(&vp, 10400) == NULL);
+    CHECK(video_pipe_present(&vp, 10500) == f[3]);
+
+    // A loop keeps the stamps going up; the clock never slips, so a frame shown late is
+    // late, and a newer due one overtakes it
+    CHECK((f[4] = pipe_decode(&vp, 0, 10500)) && f[4]->pts_us == 4000);
+    CHECK(video_pipe_present(&vp, 13000) == f[4] && vp.stats.late == 1);
+    CHECK(video_pipe_media_us(&vp, 13000) == 5500);
+    CHECK((f[5] = pipe_decode(&vp, 1, 10500)) && f[5]->pts_us == 5000);
+    CHECK((f[6] = pipe_decode(&vp, 2, 13000)) && f[6]->pts_us == 6000);
+    CHECK(video_pipe_present(&vp, 14600) == f[6] && vp.stats.dropped == 1);
+
+    // Decoding slower than the frames come: skip those that would be late once decoded
+    vp.decode_est_us = 2500;
+    f[7] = video_pipe_acquire(&vp);
+    CHECK(!video_pipe_schedule(&vp, f[7], 3, 14600));   // due 7000, done at 9600
+    CHECK(!video_pipe_schedule(&vp, f[7], 4, 14600));
+    CHECK(!video_pipe_schedule(&vp, f[7], 5, 14600));
+    CHECK(video_pipe_schedule(&vp, f[7], 6, 14600) && f[7]->pts_us == 10000);
+    CHECK(vp.stats.dropped == 4);
+    video_pipe_submit(&vp, f[7], true);
+
+    // Seek: queued frames go back to the pool, one decoded from before it is thrown away,
+    // and the target is shown as soon as it is ready, also while paused
+    video_pipe_frame_t *b = video_pipe_acquire(&vp);
+    CHECK(b && video_pipe_schedule(&vp, b, 7, 14600));
+    video_pipe_pause(&vp, 15000);
+    video_pipe_seek(&vp, 40);
+    video_pipe_submit(&vp, b, true);                    // decoded from before the seek
+    CHECK(vp.stats.discarded == 2 && vp.ready_len == 0);
+    video_pipe_frame_t *c = video_pipe_acquire(&vp);
+    uint32_t target = 0;
+    CHECK(c && !video_pipe_schedule(&vp, c, 8, 15000)); // not until the seek is taken
+    CHECK(video_pipe_take_seek(&vp, &target) && target == 40);
+    CHECK(!video_pipe_take_seek(&vp, &target));
+    CHECK(video_pipe_schedule(&vp, c, 40, 15000) && c->pts_us == 40000);
+    video_pipe_submit(&vp, c, true);
+    CHECK(video_pipe_present(&vp, 90000) == c);
+    CHECK(video_pipe_media_us(&vp, 99000) == 40000);
+    // Playing on from the target in wall time
+    video_pipe_play(&vp, 100000);
+    CHECK(video_pipe_media_us(&vp, 100700) == 40700);
+    // Failed decodes never reach the presenter
+    video_pipe_frame_t *d = video_pipe_acquire(&vp);
+    CHECK(video_pipe_schedule(&vp, d, 45, 100700));
+    video_pipe_submit(&vp, d, false);
+    CHECK(vp.ready_len == 0 && d->state == VIDEO_PIPE_FREE);
+}
+
+// The decoder presenting to a video plane: no pool, it waits until a frame is nearly due
+static void test_video_pipe_direct(void) {
+    video_pipe_t vp;
+    video_pipe_frame_t d = {0};
+    video_pipe_init(&vp, NULL, 0, 0, 1000, NULL);
+    video_pipe_play(&vp, 0);
+
+    // The first frame goes at once and starts the clock when it is out
+    CHECK(video_pipe_schedule(&vp, &d, 0, 0));
+    CHECK(video_pipe_direct_wait(&vp, &d, 300, 0) == 0);
+    d.decode_us = 300;
+    video_pipe_direct_shown(&vp, &d, 300);
+    CHECK(vp.clock_started && video_pipe_media_us(&vp, 300) == 0);
+    CHECK(vp.stats.presented == 1 && vp.stats.decoded == 1 && vp.decode_est_us == 300);
+
+    // The next is started its decode time before it is due, and may finish a little early
+    CHECK(video_pipe_schedule(&vp, &d, 1, 400));
+    CHECK(video_pipe_direct_wait(&vp, &d, 300, 400) == 600);   // due 1000, media 100
+    CHECK(video_pipe_direct_wait(&vp, &d, 300, 1000) == 0);
+    d.decode_us = 250;
+    video_pipe_direct_shown(&vp, &d, 1250);
+    CHECK(vp.stats.jitter_max_us == 0 && vp.shown_pts == 1000);
+
+    // Paused: wait for play, which wakes the decoder
+    video_pipe_pause(&vp, 1500);
+    CHECK(video_pipe_schedule(&vp, &d, 2, 1500));
+    CHECK(video_pipe_direct_wait(&vp, &d, 300, 5000) == VIDEO_PIPE_WAIT_PAUSED);
+    video_pipe_play(&vp, 9000);
+    CHECK(video_pipe_direct_wait(&vp, &d, 300, 9000) == 500);  // due 2000, media 1200
+
+    // Late ones are skipped before decoding as in the pool
+    CHECK(!video_pipe_schedule(&vp, &d, 3, 12000) && vp.stats.dropped == 1);
+
+    // A seek makes the frame in hand stale; the target goes at once, also while paused
+    CHECK(video_pipe_schedule(&vp, &d, 5, 12000));
+    video_pipe_pause(&vp, 12000);
+    video_pipe_seek(&vp, 20);
+    CHECK(video_pipe_direct_wait(&vp, &d, 300, 12000) == VIDEO_PIPE_WAIT_STALE);
+    uint32_t target;
+    CHECK(video_pipe_take_seek(&vp, &target) && target == 20);
+    CHECK(video_pipe_direct_wait(&vp, &d, 300, 12000) == VIDEO_PIPE_WAIT_STALE);
+    CHECK(video_pipe_schedule(&vp, &d, 20, 12000));
+    CHECK(video_pipe_direct_wait(&vp, &d, 300, 12000) == 0);
+    // One that was already going out when the seek came is not counted as shown
+    video_pipe_frame_t old = d;
+    old.gen--;
+    video_pipe_direct_shown(&vp, &old, 12100);
+    CHECK(vp.stats.discarded == 1 && vp.stats.presented == 2);
+    video_pipe_direct_shown(&vp, &d, 12300);
+    CHECK(vp.stats.presented == 3 && video_pipe_media_us(&vp, 50000) == 20000);
+}
+
+// Pacing against a decoder slower than the frame rate, in simulated time: 1 ms steps, the
+// presenter checks every 5 ms, the decoder takes `decode_us` per frame (alternating
+// +-`wobble_us`) and 0.2 ms to skip one. Returns the stats; `*pos_err_us` is how far the
+// frame on screen is from wall time at the end.
+static video_pipe_stats_t pace_sim(uint32_t period_us, uint32_t frames, uint32_t decode_us, uint32_t wobble_us,
+                                   int64_t run_us, int64_t *pos_err_us) {
+    static uint8_t mem[4][16];
+    uint8_t *bufs[4] = {mem[0], mem[1], mem[2], mem[3]};
+    video_pipe_t vp;
+    video_pipe_init(&vp, bufs, 4, 16, period_us, NULL);
+    video_pipe_play(&vp, 0);
+    video_pipe_frame_t *f = NULL;
+    bool decoding = false;
+    uint32_t next = 0, n = 0;
+    int64_t dec_t = 0, start = -1, shown_pts = 0;
+    for (int64_t now = 0; now <= run_us; now += 1000) {
+        // The decoder catches up to `now`
+        while (dec_t <= now) {
+            if (decoding) {
+                video_pipe_submit(&vp, f, true);
+                f = NULL;
+                decoding = false;
+            }
+            if (!f && !(f = video_pipe_acquire(&vp))) {
+                dec_t = now + 1000;                     // pool full until the next present
+                break;
+            }
+            uint32_t frame = next;
+            next = (next + 1) % frames;
+            if (!video_pipe_schedule(&vp, f, frame, dec_t)) {
+                dec_t += 200;
+                continue;
+            }
+            f->decode_us = decode_us + ((n++ & 1) ? wobble_us : -wobble_us);
+            dec_t += f->decode_us;
+            decoding = true;
+        }
+        if (now % 5000 == 0) {
+            video_pipe_frame_t *p = video_pipe_present(&vp, now);
+            if (p) {
+                if (start < 0) start = now - p->pts_us;
+                shown_pts = p->pts_us;
+            }
+        }
+    }
+    *pos_err_us = (run_us - start) - shown_pts;
+    video_pipe_stats_t st;
+    video_pipe_get_stats(&vp, &st, NULL);
+    return st;
+}
+
+static void test_video_pacing(void) {
+    // eye.avi's rate (15 fps), and a 30 fps clip
+    const struct {
+        uint32_t period_us, decode_us, wobble_us;
+    } cases[] = {
+        {66666, 30000, 0}, {66666, 90000, 0}, {66666, 150000, 40000},
+        {33333, 20000, 5000}, {33333, 45000, 0}, {33333, 70000, 20000},
+    };
+    const int64_t run_us = 20000000;
+    printf("frame pacing (simulated, %lld s):\n", (long long)(run_us / 1000000));
+    printf("  period   decode      ms timer: fps, drift     media clock: fps, dropped, jitter avg / max, drift\n");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        int64_t err;
+        video_pipe_stats_t st = pace_sim(cases[i].period_us, 108, cases[i].decode_us, cases[i].wobble_us, run_us, &err);
+        double file_fps = 1e6 / cases[i].period_us;
+        double fps = st.presented / (run_us / 1e6);
+        // The old timer: one frame per truncated-ms period or per decode plus a tick, so slow
+        // motion once decoding is slower (drift > 0 is behind wall time)
+        uint32_t timer_ms = cases[i].period_us / 1000;
+        double old_step = fmax(timer_ms * 1000.0, (double)cases[i].decode_us + 5000);
+        double old_fps = 1e6 / old_step;
+        double old_err_s = run_us / 1e6 - (run_us / old_step) * cases[i].period_us / 1e6;
+        printf("  %5.1f ms %3u+-%-2u ms    %5.1f fps, %+6.2f s    %5.1f fps, %4u, %4.1f / %5.1f ms, %+5.0f ms\n",
+               cases[i].period_us / 1e3, (unsigned)(cases[i].decode_us / 1000), (unsigned)(cases[i].wobble_us / 1000),
+               old_fps, old_err_s, fps, (unsigned)st.dropped,
+               st.presented ? st.jitter_us / 1e3 / st.presented : 0.0, st.jitter_max_us / 1e3, err / 1e3);
+        // In sync with wall time whatever the decoder does
+        CHECK(err >= 0 && err < (int64_t)cases[i].period_us + cases[i].decode_us + cases[i].wobble_us);
+        // Only a decoder that varies a lot shows an occasional frame over a period late
+        CHECK(st.discarded == 0 && st.late * 50 <= st.presented);
+        if (cases[i].decode_us + cases[i].wobble_us + 5000 < cases[i].period_us) {
+            // Fast enough: every frame, on time to the presenter's check
+            CHECK(st.dropped == 0 && fps > file_fps * 0.98);
+            CHECK(st.jitter_max_us <= 5000);
+        } else {
+            // Too slow: as many frames as the decoder manages, the rest skipped unseen
+            CHECK(st.dropped > 0 && fps > 0.8 * 1e6 / (cases[i].decode_us + cases[i].wobble_us + 5000));
+            CHECK(st.presented + st.dropped >= (uint32_t)(run_us / cases[i].period_us) - 4);
+        }
+    }
+}
+
+#define PIPE_DEMUX_SLOTS    4
+#define PIPE_SPEEDUP        4           // play at 4x so the test stays short
+#define PIPE_TICK_US        5000        // as AVI_PRESENT_PERIOD_MS
+
+typedef struct {
+    const uint8_t *data;
+    uint32_t size;
+    uint32_t frame;
+    uint32_t gen;
+} pipe_chunk_t;
+
+// Stand-in for the SD reader: frames by index into a bounded queue (stage 1)
+typedef struct {
+    const mem_file_t *file;
+    const avi_index_t *ix;
+    video_pipe_t vp;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;                // any change below, or a free buffer
+    pipe_chunk_t q[PIPE_DEMUX_SLOTS];
+    uint32_t q_head, q_len;
+    uint32_t demux_pos;                 // next frame the demuxer reads
+    uint32_t demux_gen;
+    bool stop;
+    double demux_us;
+    uint32_t demuxed;
+    uint64_t q_depth_sum;
+    uint32_t q_depth_samples, q_depth_max;
+} pipe_rig_t;
+
+static int64_t rig_now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int64_t thread_cpu_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void sleep_us(int64_t us) {
+    if (us <= 0) return;
+    struct timespec ts = {us / 1000000, (us % 1000000) * 1000};
+    nanosleep(&ts, NULL);
+}
+
+// The pipe shares the rig's lock; its wake-ups land on the rig's condition
+static void rig_lock(void *ctx) {
+    pthread_mutex_lock(&((pipe_rig_t *)ctx)->lock);
+}
+
+static void rig_unlock(void *ctx) {
+    pthread_mutex_unlock(&((pipe_rig_t *)ctx)->lock);
+}
+
+static void rig_wake_decoder(void *ctx) {
+    pipe_rig_t *rig = (pipe_rig_t *)ctx;
+    pthread_cond_broadcast(&rig->cond);
+}
+
+static void *rig_demux_thread(void *arg) {
+    pipe_rig_t *rig = (pipe_rig_t *)arg;
+    pthread_mutex_lock(&rig->lock);
+    while (!rig->stop) {
+        if (rig->q_len == PIPE_DEMUX_SLOTS) {
+            pthread_cond_wait(&rig->cond, &rig->lock);
+            continue;
+        }
+        uint32_t k = rig->demux_pos;
+        uint32_t gen = rig->demux_gen;
+        pthread_mutex_unlock(&rig->lock);
+        // Locate and frame the chunk: what sd_stream_next() does on the device
+        double t0 = now_ms();
+        const avi_frame_t *fr = &rig->ix->frames[k];
+        const uint8_t *p = rig->file->data + fr->offset;
+        bool good = le32(p + 4) == fr->size;
+        double dt = (now_ms() - t0) * 1e3;
+        pthread_mutex_lock(&rig->lock);
+        CHECK(good);
+        rig->demux_us += dt;
+        rig->demuxed++;
+        if (gen != rig->demux_gen) continue;        // seeked meanwhile
+        rig->q[(rig->q_head + rig->q_len) % PIPE_DEMUX_SLOTS] = (pipe_chunk_t){p + 8, fr->size, k, gen};
+        rig->q_len++;
+        rig->demux_pos = (k + 1) % rig->ix->count;  // looping
+        pthread_cond_broadcast(&rig->cond);
+    }
+    pthread_mutex_unlock(&rig->lock);
+    return NULL;
+}
+
+// Stage 2, as avi_decode_task()
+static void *rig_decode_thread(void *arg) {
+    pipe_rig_t *rig = (pipe_rig_t *)arg;
+    video_pipe_frame_t *f = NULL;
+    mjpeg_decoder_t *dec = mjpeg_decoder_create();
+    for (;;) {
+        uint32_t seek_frame;
+        if (video_pipe_take_seek(&rig->vp, &seek_frame)) {
+            pthread_mutex_lock(&rig->lock);
+            rig->q_len = 0;
+            rig->demux_pos = seek_frame;
+            rig->demux_gen++;
+            pthread_cond_broadcast(&rig->cond);
+            pthread_mutex_unlock(&rig->lock);
+        }
+        pthread_mutex_lock(&rig->lock);
+        if (rig->stop) {
+            pthread_mutex_unlock(&rig->lock);
+            break;
+        }
+        if (!f) {
+            pthread_mutex_unlock(&rig->lock);
+            f = video_pipe_acquire(&rig->vp);
+            if (!f) {
+                pthread_mutex_lock(&rig->lock);
+                struct timespec ts;
+                clock_gettime(CLOCK_REALTIME, &ts);
+                ts.tv_nsec += 2000000;
+                if (ts.tv_nsec >= 1000000000) { ts.tv_sec++; ts.tv_nsec -= 1000000000; }
+                pthread_cond_timedwait(&rig->cond, &rig->lock, &ts);
+                pthread_mutex_unlock(&rig->lock);
+            }
+            continue;
+        }
+        if (!rig->q_len) {
+            pthread_cond_wait(&rig->cond, &rig->lock);
+            pthread_mutex_unlock(&rig->lock);
+            continue;
+        }
+        rig->q_depth_sum += rig->q_len;
+        rig->q_depth_samples++;
+        if (rig->q_len > rig->q_depth_max) rig->q_depth_max = rig->q_len;
+        pipe_chunk_t c = rig->q[rig->q_head];
+        rig->q_head = (rig->q_head + 1) % PIPE_DEMUX_SLOTS;
+        rig->q_len--;
+        pthread_cond_broadcast(&rig->cond);
+        pthread_mutex_unlock(&rig->lock);
+
+        int64_t t0 = rig_now_us();
+        if (!video_pipe_schedule(&rig->vp, f, c.frame, t0)) continue;
+        bool ok = mjpeg_decode_rgb565(dec, c.data, c.size, f->buf, f->buf_size, &f->w, &f->h);
+        f->decode_us = (uint32_t)(rig_now_us() - t0);
+        CHECK(ok && f->w == 300 && f->h == 300);
+        video_pipe_submit(&rig->vp, f, ok);
+        f = NULL;
+    }
+    if (f) video_pipe_submit(&rig->vp, f, false);
+    mjpeg_decoder_destroy(dec);
+    return NULL;
+}
+
+typedef struct {
+    double tick_avg_us, tick_max_us;    // UI frame time: tick start to tick start
+    double busy_avg_us, busy_max_us;    // UI thread CPU time spent on video per tick
+} ui_times_t;
+
+static void ui_account(ui_times_t *t, int64_t *last, int64_t start, int64_t busy, uint32_t *ticks) {
+    if (*last) {
+        double gap = (double)(start - *last);
+        t->tick_avg_us += gap;
+        if (gap > t->tick_max_us) t->tick_max_us = gap;
+    }
+    *last = start;
+    t->busy_avg_us += (double)busy;
+    if (busy > t->busy_max_us) t->busy_max_us = (double)busy;
+    (*ticks)++;
+}
+
+static void test_video_pipe_threads(void) {
+    mem_file_t m;
+    uint8_t *data = load_file("4_sd_card/eye.avi", &m.size);
+    CHECK(data != NULL);
+    if (!data) return;
+    m.data = data;
+    avi_info_t info;
+    avi_index_t ix;
+    uint8_t scratch[4096];
+    avi_index_init(&ix, host_realloc);
+    CHECK(avi_parse(mem_read, &m, m.size, &info));
+    CHECK(avi_index_load(&ix, &info, mem_read, &m, scratch, sizeof(scratch)) == AVI_INDEX_IDX1);
+    uint32_t period = info.usec_per_frame / PIPE_SPEEDUP;
+    uint32_t frame_bytes = info.width * info.height * 2;
+
+    // Before: decode inline on the UI thread whenever a frame is due
+    uint8_t *inline_buf = malloc(frame_bytes);
+    ui_times_t before = {0};
+    uint32_t ticks = 0, shown = 0;
+    int64_t last = 0, start = rig_now_us();
+    while (shown < 40) {
+        int64_t t0 = rig_now_us(), c0 = thread_cpu_us();
+        if (t0 - start >= (int64_t)shown * period) {
+            uint32_t w, h;
+            const avi_frame_t *fr = &ix.frames[shown % ix.count];
+            CHECK(mjpeg_decode_rgb565(NULL, m.data + fr->offset + 8, fr->size, inline_buf, frame_bytes, &w, &h));
+            shown++;
+        }
+        ui_account(&before, &last, t0, thread_cpu_us() - c0, &ticks);
+        sleep_us(PIPE_TICK_US - (rig_now_us() - t0));
+    }
+    before.tick_avg_us /= ticks - 1;
+    before.busy_avg_us /= ticks;
+    free(inline_buf);
+
+    // After: demux and decode threads, the UI thread only presents
+    pipe_rig_t rig = {.file = &m, .ix = &ix};
+    pthread_mutex_init(&rig.lock, NULL);
+    pthread_cond_init(&rig.cond, NULL);
+    uint8_t *bufs[VIDEO_PIPE_MAX_FRAMES];
+    for (int i = 0; i < VIDEO_PIPE_MAX_FRAMES; i++) bufs[i] = malloc(frame_bytes);
+    video_pipe_os_t os = {.lock = rig_lock, .unlock = rig_unlock, .wake_decoder = rig_wake_decoder, .ctx = &rig};
+    video_pipe_init(&rig.vp, bufs, VIDEO_PIPE_MAX_FRAMES, frame_bytes, period, &os);
+    pthread_t th_demux, th_decode;
+    pthread_create(&th_demux, NULL, rig_demux_thread, &rig);
+    pthread_create(&th_decode, NULL, rig_decode_thread, &rig);
+
+    ui_times_t after = {0};
+    ticks = 0;
+    last = 0;
+    // Frames go forward in time and match their stamps; after the seek, the target first
+    uint32_t presented = 0, order_errors = 0, seek_at = 60, seek_to = 20;
+    int64_t last_pts = -1;
+    bool seeked = false;
+    int64_t seek_t0 = 0;
+    double seek_latency_us = 0;
+    video_pipe_play(&rig.vp, rig_now_us());
+    while (presented < ix.count + 20) {
+        int64_t t0 = rig_now_us(), c0 = thread_cpu_us();
+        video_pipe_frame_t *f = video_pipe_present(&rig.vp, t0);
+        if (f) {
+            if (f->pts_us <= last_pts || f->frame != f->pts_us / period % ix.count) order_errors++;
+            if (seek_t0) {
+                if (f->frame != seek_to) order_errors++;
+                seek_latency_us = (double)(t0 - seek_t0);
+                seek_t0 = 0;
+            }
+            last_pts = f->pts_us;
+            presented++;
+            if (presented == seek_at && !seeked) {
+                // Scrub back: the next frame shown must be the target
+                video_pipe_seek(&rig.vp, seek_to);
+                seeked = true;
+                seek_t0 = t0;
+                last_pts = -1;
+            }
+        }
+        ui_account(&after, &last, t0, thread_cpu_us() - c0, &ticks);
+        sleep_us(PIPE_TICK_US - (rig_now_us() - t0));
+    }
+    after.tick_avg_us /= ticks - 1;
+    after.busy_avg_us /= ticks;
+
+    pthread_mutex_lock(&rig.lock);
+    rig.stop = true;
+    pthread_cond_broadcast(&rig.cond);
+    pthread_mutex_unlock(&rig.lock);
+    pthread_join(th_demux, NULL);
+    pthread_join(th_decode, NULL);
+
+    video_pipe_stats_t st;
+    video_pipe_get_stats(&rig.vp, &st, NULL);
+    CHECK(order_errors == 0);
+    CHECK(st.presented == presented && st.decoded >= presented);
+    CHECK(seeked && seek_latency_us < 3 * period);
+    // The UI thread no longer pays for decoding
+    CHECK(after.busy_max_us < st.decode_us / st.decoded / 4);
+    printf("video pipeline (host, eye.avi at %dx, libjpeg-turbo):\n", PIPE_SPEEDUP);
+    printf("  demux  %.1f us/frame, queue depth %.2f avg / %u max of %d\n",
+           rig.demux_us / rig.demuxed, (double)rig.q_depth_sum / rig.q_depth_samples,
+           (unsigned)rig.q_depth_max, PIPE_DEMUX_SLOTS);
+    printf("  decode %.2f ms avg / %.2f ms max, %u decoded, %u discarded by the seek\n",
+           st.decode_us / 1e3 / st.decoded, st.decode_max_us / 1e3, (unsigned)st.decoded, (unsigned)st.discarded);
+    printf("  ready  %.2f avg / %u max of %d buffers, %u late, %u underruns, seek to first frame %.1f ms\n",
+           (double)st.depth_sum / st.depth_samples, (unsigned)st.depth_max, VIDEO_PIPE_MAX_FRAMES,
+           (unsigned)st.late, (unsigned)st.underruns, seek_latency_us / 1e3);
+    printf("  UI tick (%d us target): inline decode %.0f avg / %.0f max us, busy %.0f max us\n",
+           PIPE_TICK_US, before.tick_avg_us, before.tick_max_us, before.busy_max_us);
+    printf("                          pipelined     %.0f avg / %.0f max us, busy %.0f max us\n",
+           after.tick_avg_us, after.tick_max_us, after.busy_max_us);
+
+    for (int i = 0; i < VIDEO_PIPE_MAX_FRAMES; i++) free(bufs[i]);
+    pthread_mutex_destroy(&rig.lock);
+    pthread_cond_destroy(&rig.cond);
+    avi_index_free(&ix);
+    free(data);
+}
+
+// ---- Video plane ----
+
+#define BAND_ROWS   16          // as AVI_BAND_ROWS
+#define PANEL_W     600
+#define PANEL_H     446
+
+typedef struct {
+    uint8_t bufs[2][PANEL_W * BAND_ROWS * 2];
+    uint8_t *out;               // whole frame, as the panel would show it (NULL: just count)
+    uint32_t next, got, put, put_empty, next_y;
+    int fail_put_at;            // put() number that refuses, -1 never
+    bool fail_get;
+    bool order_ok;
+} band_sink_t;
+
+static uint8_t *band_get(void *ctx) {
+    band_sink_t *s = (band_sink_t *)ctx;
+    if (s->fail_get && s->got) return NULL;
+    s->got++;
+    return s->bufs[s->next++ & 1];
+}
+
+static bool band_put(void *ctx, uint32_t y, uint32_t rows, uint32_t width, uint8_t *band) {
+    band_sink_t *s = (band_sink_t *)ctx;
+    s->put++;
+    if (!rows) {
+        s->put_empty++;
+        return true;
+    }
+    if ((int)s->put == s->fail_put_at) return false;
+    if (y != s->next_y || rows > BAND_ROWS) s->order_ok = false;
+    s->next_y = y + rows;
+    if (s->out) memcpy(s->out + (size_t)y * width * 2, band, (size_t)rows * width * 2);
+    return true;
+}
+
+static mjpeg_band_sink_t band_sink(band_sink_t *s) {
+    memset(s, 0, sizeof(*s));
+    s->fail_put_at = -1;
+    s->order_ok = true;
+    return (mjpeg_band_sink_t){ .get = band_get, .put = band_put, .ctx = s, .rows = BAND_ROWS,
+                                .max_width = PANEL_W, .big_endian = true };
+}
+
+static void test_video_plane(void) {
+    mem_file_t m;
+    uint8_t *data = load_file("4_sd_card/eye.avi", &m.size);
+    CHECK(data != NULL);
+    if (!data) return;
+    m.data = data;
+    avi_info_t info;
+    avi_index_t ix;
+    uint8_t scratch[4096];
+    avi_index_init(&ix, host_realloc);
+    CHECK(avi_parse(mem_read, &m, m.size, &info));
+    CHECK(avi_index_load(&ix, &info, mem_read, &m, scratch, sizeof(scratch)) == AVI_INDEX_IDX1);
+    uint32_t frame_bytes = info.width * info.height * 2;
+    uint8_t *frame = malloc(frame_bytes);
+    uint8_t *bands = malloc(frame_bytes);
+    static band_sink_t s;
+
+    // Bands, top down, are the frame buffer decode byte-swapped
+    uint32_t same = 0;
+    for (uint32_t i = 0; i < ix.count; i++) {
+        const uint8_t *jpg = data + ix.frames[i].offset + 8;
+        uint32_t w, h, bw = 0, bh = 0;
+        CHECK(mjpeg_decode_rgb565(NULL, jpg, ix.frames[i].size, frame, frame_bytes, &w, &h));
+        mjpeg_band_sink_t sink = band_sink(&s);
+        s.out = bands;
+        CHECK(mjpeg_decode_bands(NULL, jpg, ix.frames[i].size, &sink, &bw, &bh));
+        CHECK(bw == w && bh == h && s.order_ok && s.next_y == h && s.got == s.put && !s.put_empty);
+        mjpeg_swap_rgb565(frame, w * h);
+        same += memcmp(frame, bands, (size_t)w * h * 2) == 0;
+    }
+    CHECK(same == ix.count);
+
+    // Aborts: every buffer taken is handed back
+    const uint8_t *jpg = data + ix.frames[0].offset + 8;
+    uint32_t jsize = ix.frames[0].size, w, h;
+    mjpeg_band_sink_t sink = band_sink(&s);
+    s.fail_put_at = 3;
+    CHECK(!mjpeg_decode_bands(NULL, jpg, jsize, &sink, &w, &h) && s.got == s.put && s.put == 3);
+    sink = band_sink(&s);
+    s.fail_get = true;
+    CHECK(!mjpeg_decode_bands(NULL, jpg, jsize, &sink, &w, &h) && s.got == 1 && s.put == 1);
+    uint8_t *bad = malloc(jsize);
+    memcpy(bad, jpg, jsize);
+    memset(bad + jsize / 2, 0xFF, 64);
+    memset(bad + jsize - 64, 0, 62);                    // corrupt scan data, no EOI
+    sink = band_sink(&s);
+    mjpeg_decode_bands(NULL, bad, jsize, &sink, &w, &h);
+    CHECK(s.got == s.put);
+    sink = band_sink(&s);
+    sink.max_width = info.width - 2;
+    CHECK(!mjpeg_decode_bands(NULL, jpg, jsize, &sink, &w, &h) && s.got == 0);
+    free(bad);
+
+    // Per frame, the LVGL path decodes into a frame buffer, the image draw copies it into
+    // the draw buffer, the flush swaps that and the DMA reads it: six passes over the
+    // frame through PSRAM. The plane path decodes and swaps in a band that stays in cache
+    // (internal RAM on the device) and the DMA reads it from there.
+    uint16_t *draw = malloc(PANEL_W * PANEL_H * 2);
+    uint32_t n = ix.count < 60 ? ix.count : 60;
+    double best_lvgl = 1e9, best_plane = 1e9;
+    volatile uint32_t dma_sum = 0;
+    for (int rep = 0; rep < 5; rep++) {
+        double t0 = now_ms();
+        for (uint32_t i = 0; i < n; i++) {
+            mjpeg_decode_rgb565(NULL, data + ix.frames[i].offset + 8, ix.frames[i].size, frame, frame_bytes, &w, &h);
+            for (uint32_t y = 0; y < h; y++) memcpy(draw + (y + 50) * PANEL_W + 30, frame + y * w * 2, w * 2);
+            for (uint32_t y = 0; y < h; y++) mjpeg_swap_rgb565((uint8_t *)(draw + (y + 50) * PANEL_W + 30), w);
+            uint32_t sum = 0;
+            for (uint32_t y = 0; y < h; y++) {
+                const uint32_t *row = (const uint32_t *)(draw + (y + 50) * PANEL_W + 30);
+                for (uint32_t x = 0; x < w / 2; x++) sum += row[x];
+            }
+            dma_sum += sum;
+        }
+        double t1 = now_ms();
+        for (uint32_t i = 0; i < n; i++) {
+            sink = band_sink(&s);
+            mjpeg_decode_bands(NULL, data + ix.frames[i].offset + 8, ix.frames[i].size, &sink, &w, &h);
+        }
+        double t2 = now_ms();
+        if (t1 - t0 < best_lvgl) best_lvgl = t1 - t0;
+        if (t2 - t1 < best_plane) best_plane = t2 - t1;
+    }
+    uint32_t lvgl_bytes = 6 * frame_bytes;
+    printf("video plane: %u frames of %ux%u, bands match the frame decode byte-swapped\n",
+           (unsigned)ix.count, (unsigned)info.width, (unsigned)info.height);
+    printf("  LVGL composition %6.1f fps (host), %u KB PSRAM pixel traffic per frame\n",
+           n * 1000.0 / best_lvgl, (unsigned)(lvgl_bytes / 1024));
+    printf("  video plane      %6.1f fps (host), 0 KB (two %u KB bands in internal RAM)\n",
+           n * 1000.0 / best_plane, (unsigned)(info.width * BAND_ROWS * 2 / 1024));
+    // On the host, with its caches, decoding dominates both and the passes over the frame
+    // cost little; on the device they are PSRAM traffic. Just no slower beyond noise.
+    CHECK(best_plane < best_lvgl * 1.25);
+
+    free(draw);
+    free(frame);
+    free(bands);
+    avi_index_free(&ix);
+    free(data);
+}
+
+// ---- Region decode ----
+
+// The media screen: video top-centred in a container 60% x 85% of the display, 50 px down.
+// Returns the part of the frame inside the container, in frame pixels.
+static mjpeg_rect_t media_visible(uint32_t disp_w, uint32_t disp_h, uint32_t w, uint32_t h) {
+    int32_t cw = (int32_t)disp_w * 60 / 100, ch = (int32_t)disp_h * 85 / 100;
+    int32_t x = (cw - (int32_t)w) / 2;
+    int32_t x1 = x < 0 ? -x : 0, x2 = x + (int32_t)w > cw ? cw - x : (int32_t)w;
+    int32_t y2 = (int32_t)h > ch ? ch : (int32_t)h;
+    return (mjpeg_rect_t){ (uint32_t)x1, 0, (uint32_t)(x2 - x1), (uint32_t)y2 };
+}
+
+// Pixels of `got` in a region decode against the whole decode; columns next to a crop edge
+// may differ by the upsampler's edge handling, so they are left out
+static bool region_matches(const uint8_t *full, uint32_t fw, const uint8_t *rgn, uint32_t stride,
+                           const mjpeg_rect_t *got, uint32_t img_w) {
+    uint32_t x1 = got->x ? got->x + 1 : 0;
+    uint32_t x2 = got->x + got->w < img_w ? got->x + got->w - 1 : img_w;
+    for (uint32_t y = 0; y < got->h; y++) {
+        const uint8_t *a = full + ((size_t)(got->y + y) * fw + x1) * 2;
+        const uint8_t *b = rgn + (size_t)y * stride + (x1 - got->x) * 2;
+        if (memcmp(a, b, (x2 - x1) * 2)) return false;
+    }
+    return true;
+}
+
+static void test_mjpeg_region(void) {
+    static const struct {
+        const char *name;
+        uint32_t w, h;
+    } rots[] = { {"landscape", 600, 446}, {"portrait", 446, 600} };
+    printf("region decode (host, all frames; visible part of the media screen's video):\n");
+    printf("  %-18s %-9s %-9s %-9s  whole   visible  saved\n", "video", "size", "rotation", "visible");
+    double tot_full[2] = {0}, tot_vis[2] = {0};
+    for (size_t i = 0; i < sizeof(s_avi_samples) / sizeof(s_avi_samples[0]); i++) {
+        char path[128];
+        snprintf(path, sizeof(path), "4_sd_card/%s.avi", s_avi_samples[i]);
+        mem_file_t m;
+        uint8_t *data = load_file(path, &m.size);
+        CHECK(data != NULL);
+        if (!data) continue;
+        m.data = data;
+        avi_info_t info;
+        avi_index_t ix;
+        uint8_t scratch[4096];
+        avi_index_init(&ix, host_realloc);
+        CHECK(avi_parse(mem_read, &m, m.size, &info));
+        avi_index_load(&ix, &info, mem_read, &m, scratch, sizeof(scratch));
+        if (!ix.count) walk_build(&ix, &info, mem_read, &m);
+        uint32_t fw = info.width, fh = info.height, fbytes = fw * fh * 2;
+        uint8_t *full = malloc(fbytes), *rgn = malloc(fbytes);
+
+        // Same pixels as the whole decode: a crop in the middle at each scale, packed and
+        // in place
+        const uint8_t *jpg = data + ix.frames[0].offset + 8;
+        uint32_t jsize = ix.frames[0].size;
+        for (uint8_t d = 1; d <= 8; d *= 2) {
+            uint32_t w, h, iw, ih;
+            mjpeg_rect_t all = {0}, got;
+            uint32_t sw = (fw + d - 1) / d;                 // libjpeg rounds up
+            CHECK(mjpeg_decode_region(NULL, jpg, jsize, d, &all, full, sw * 2, fbytes, false, &got, &w, &h));
+            CHECK(w == sw);
+            // The 1/1 whole decode is the frame buffer decode
+            if (d == 1) CHECK(mjpeg_decode_rgb565(NULL, jpg, jsize, rgn, fbytes, &w, &h) && !memcmp(full, rgn, fbytes));
+            CHECK(got.x == 0 && got.y == 0 && got.w == w && got.h == h);
+            mjpeg_rect_t want = { w / 3, h / 4 + 1, w / 3, h / 2 };
+            CHECK(mjpeg_decode_region(NULL, jpg, jsize, d, &want, rgn, want.w * 2 + 64, fbytes, false, &got, &iw, &ih));
+            CHECK(iw == w && ih == h && got.x <= want.x && got.x + got.w >= want.x + want.w);
+            CHECK(got.y <= want.y && got.y + got.h == want.y + want.h);
+            CHECK(region_matches(full, w, rgn, want.w * 2 + 64, &got, w));
+            memset(rgn, 0, fbytes);
+            CHECK(mjpeg_decode_region(NULL, jpg, jsize, d, &want, rgn, w * 2, fbytes, true, &got, NULL, NULL));
+            CHECK(region_matches(full, w, rgn + ((size_t)got.y * w + got.x) * 2, w * 2, &got, w));
+            // Too small a buffer is refused before decoding
+            CHECK(!mjpeg_decode_region(NULL, jpg, jsize, d, &want, rgn, want.w * 2 - 2, fbytes, false, &got, NULL, NULL));
+        }
+        uint32_t w, h;
+
+        for (size_t r = 0; r < 2; r++) {
+            mjpeg_rect_t vis = media_visible(rots[r].w, rots[r].h, fw, fh), got;
+            // Best of five, each frame both ways in turn
+            double t_full = 1e9, t_vis = 1e9;
+            for (int rep = 0; rep < 5; rep++) {
+                double sum_full = 0, sum_vis = 0;
+                for (uint32_t k = 0; k < ix.count; k++) {
+                    const uint8_t *fj = data + ix.frames[k].offset + 8;
+                    double t0 = now_ms();
+                    mjpeg_decode_rgb565(NULL, fj, ix.frames[k].size, full, fbytes, &w, &h);
+                    double t1 = now_ms();
+                    CHECK(mjpeg_decode_region(NULL, fj, ix.frames[k].size, 1, &vis, rgn, fw * 2, fbytes, true, &got, NULL, NULL));
+                    sum_vis += now_ms() - t1;
+                    sum_full += t1 - t0;
+                }
+                if (sum_full < t_full) t_full = sum_full;
+                if (sum_vis < t_vis) t_vis = sum_vis;
+            }
+            t_full /= ix.count;
+            t_vis /= ix.count;
+            tot_full[r] += t_full;
+            tot_vis[r] += t_vis;
+            char size[16], vsize[16];
+            snprintf(size, sizeof(size), "%ux%u", (unsigned)fw, (unsigned)fh);
+            snprintf(vsize, sizeof(vsize), "%ux%u", (unsigned)vis.w, (unsigned)vis.h);
+            printf("  %-18s %-9s %-9s %-9s %5.2f ms %5.2f ms %4.0f%%\n", s_avi_samples[i], size, rots[r].name, vsize,
+                   t_full, t_vis, 100.0 * (1.0 - t_vis / t_full));
+            CHECK(got.x <= vis.x && got.x + got.w >= vis.x + vis.w && got.y + got.h == vis.y + vis.h);
+        }
+        free(full);
+        free(rgn);
+        avi_index_free(&ix);
+        free(data);
+    }
+    // Landscape shows the whole frame; the narrower portrait container saves its share
+    CHECK(tot_vis[1] < tot_full[1]);
+}
+
+// A photo-sized JPEG made from a video frame scaled up 8x with some grain, as a camera
+// image would have
+static uint8_t *make_photo(uint32_t *out_size, uint32_t *pw, uint32_t *ph) {
+    uint32_t size;
+    uint8_t *avi = load_file("4_sd_card/eye.avi", &size);
+    if (!avi) return NULL;
+    mem_file_t m = { avi, size };
+    avi_info_t info;
+    avi_index_t ix;
+    uint8_t scratch[4096];
+    avi_index_init(&ix, host_realloc);
+    avi_parse(mem_read, &m, m.size, &info);
+    avi_index_load(&ix, &info, mem_read, &m, scratch, sizeof(scratch));
+    uint32_t w, h, k = 8;
+    uint16_t *px = malloc(info.width * info.height * 2);
+    mjpeg_decode_rgb565(NULL, avi + ix.frames[40].offset + 8, ix.frames[40].size, (uint8_t *)px,
+                        info.width * info.height * 2, &w, &h);
+    uint32_t W = w * k, H = h * k;
+    uint8_t *rgb = malloc((size_t)W * H * 3);
+    uint32_t seed = 1;
+    for (uint32_t y = 0; y < H; y++) {
+        for (uint32_t x = 0; x < W; x++) {
+            uint16_t c = px[(y / k) * w + x / k];
+            seed = seed * 1103515245u + 12345u;
+            int n = (int)((seed >> 16) & 15) - 8;
+            int v[3] = { (c >> 11) << 3, ((c >> 5) & 63) << 2, (c & 31) << 3 };
+            for (int i = 0; i < 3; i++) {
+                int t = v[i] + n;
+                rgb[((size_t)y * W + x) * 3 + i] = (uint8_t)(t < 0 ? 0 : t > 255 ? 255 : t);
+            }
+        }
+    }
+    struct jpeg_compress_struct c;
+    struct jpeg_error_mgr err;
+    c.err = jpeg_std_error(&err);
+    jpeg_create_compress(&c);
+    unsigned char *out = NULL;
+    unsigned long out_len = 0;
+    jpeg_mem_dest(&c, &out, &out_len);
+    c.image_width = W;
+    c.image_height = H;
+    c.input_components = 3;
+    c.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&c);
+    jpeg_set_quality(&c, 85, TRUE);
+    jpeg_start_compress(&c, TRUE);
+    while (c.next_scanline < H) {
+        JSAMPROW row = rgb + (size_t)c.next_scanline * W * 3;
+        jpeg_write_scanlines(&c, &row, 1);
+    }
+    jpeg_finish_compress(&c);
+    jpeg_destroy_compress(&c);
+    free(rgb);
+    free(px);
+    avi_index_free(&ix);
+    free(avi);
+    *out_size = (uint32_t)out_len;
+    *pw = W;
+    *ph = H;
+    return out;
+}
+
+// The viewer zoomed into the centre of a photo: before, the whole image at the sharpest
+// scale that fits the 6 MB cache; now the visible part and half its size around it at the
+// sharpest scale the zoom needs
+static void test_jpeg_view_region(void) {
+    uint32_t size, W, H;
+    uint8_t *jpg = make_photo(&size, &W, &H);
+    CHECK(jpg != NULL);
+    if (!jpg) return;
+    static const struct {
+        const char *name;
+        uint32_t w, h;
+    } views[] = { {"landscape", 360, 379}, {"portrait", 267, 510} };   // the media container
+    const size_t budget = 6 * 1024 * 1024;                               // JPEG_VIEW_CACHE_BYTES
+    uint8_t *buf = malloc((size_t)W * H * 2);
+    printf("viewer zoom (host, %ux%u JPEG, %u KB):\n", (unsigned)W, (unsigned)H, (unsigned)(size / 1024));
+    printf("  %-9s zoom  whole level               visible region\n", "rotation");
+    for (size_t v = 0; v < 2; v++) {
+        for (float zoom = 1.0f; zoom <= 8.0f; zoom *= 2.0f) {
+            float fit = fminf((float)views[v].w / W, (float)views[v].h / H);
+            float s = fit * zoom;
+            int sharp = 0;
+            while (sharp < 3 && s * (float)(2u << sharp) <= 1.0f) sharp++;
+            int lvl = sharp;
+            while (lvl < 3 && (size_t)((W + (1u << lvl) - 1) >> lvl) * ((H + (1u << lvl) - 1) >> lvl) * 2 > budget) lvl++;
+            // Visible source part, centred, plus half its size each side
+            float vw = fminf(views[v].w / s, (float)W), vh = fminf(views[v].h / s, (float)H);
+            uint32_t d = 1u << sharp;
+            float mw = fminf(vw * 2.0f, (float)W), mh = fminf(vh * 2.0f, (float)H);
+            mjpeg_rect_t want = { (uint32_t)((W - mw) / 2 / d), (uint32_t)((H - mh) / 2 / d),
+                                  (uint32_t)(mw / d), (uint32_t)(mh / d) }, got, all = {0};
+            size_t whole_px = (size_t)((W + d - 1) / d) * ((H + d - 1) / d);
+            bool region = whole_px * 2 > budget || whole_px > (size_t)want.w * want.h * 4;
+            double t0 = now_ms();
+            uint32_t lw, lh;
+            CHECK(mjpeg_decode_region(NULL, jpg, size, 1u << lvl, &all, buf, ((W >> lvl) + 1) * 2, (size_t)W * H * 2,
+                                      false, &got, &lw, &lh));
+            double t1 = now_ms();
+            double t_rgn = 0;
+            if (region) {
+                CHECK(mjpeg_decode_region(NULL, jpg, size, d, &want, buf, (want.w + 32) * 2, (size_t)W * H * 2,
+                                          false, &got, NULL, NULL));
+                t_rgn = now_ms() - t1;
+            }
+            printf("  %-9s %3.0fx  1/%u %4ux%-4u %6.1f ms   ", views[v].name, zoom, 1u << lvl,
+                   (unsigned)lw, (unsigned)lh, t1 - t0);
+            if (region) {
+                printf("1/%u %4ux%-4u %6.1f ms\n", (unsigned)d, (unsigned)got.w, (unsigned)got.h, t_rgn);
+                // Sharper than the level that fit, or as sharp and cheaper
+                CHECK(sharp < lvl || t_rgn < t1 - t0);
+            } else {
+                printf("(whole level used)\n");
+            }
+            // The visible part always gets at least one decoded pixel per screen pixel
+            CHECK(s * d <= 1.0f || sharp == 0);
+        }
+    }
+    free(buf);
+    free(jpg);
+}
+
+// The viewer's levels and zoomed regions come from the same decoder path, so switching
+// between them does not move a pixel
+static void test_jpeg_view_levels(void) {
+    uint32_t size, W, H;
+    uint8_t *jpg = make_photo(&size, &W, &H);
+    CHECK(jpg != NULL);
+    if (!jpg) return;
+    uint32_t sw = 0, sh = 0;
+    CHECK(mjpeg_read_size(NULL, jpg, size, &sw, &sh) && sw == W && sh == H);
+    uint8_t bad[64] = { 0xFF, 0xD8, 0xFF, 0xDB, 0x00, 0x43 };
+    CHECK(!mjpeg_read_size(NULL, bad, 6, &sw, &sh));
+
+    uint8_t *level = malloc((size_t)W * H * 2);
+    uint8_t *rgn = malloc((size_t)W * H * 2);
+    for (int idx = 0; idx < 4; idx++) {
+        uint32_t d = 1u << idx, lw = (W + d - 1) / d, lh = (H + d - 1) / d, w, h;
+        mjpeg_rect_t got, all = {0};
+        CHECK(mjpeg_decode_region(NULL, jpg, size, d, &all, level, lw * 2, lw * lh * 2, false, &got, &w, &h));
+        CHECK(w == lw && h == lh && got.w == lw && got.h == lh);
+        mjpeg_rect_t want = { lw / 3, lh / 3, lw / 4, lh / 4 };
+        uint32_t stride = (want.w + 32) * 2;
+        CHECK(mjpeg_decode_region(NULL, jpg, size, d, &want, rgn, stride, (size_t)W * H * 2, false, &got, NULL, NULL));
+        CHECK(region_matches(level, lw, rgn, stride, &got, lw));
+    }
+    free(rgn);
+    free(level);
+    free(jpg);
+}
+
+// ---- Persistent decoder ----
+
+// Heap allocations, libjpeg's included: glibc lets the test binary stand in for malloc
+extern void *__libc_malloc(size_t size);
+static volatile uint32_t s_mallocs;
+
+void *malloc(size_t size) {
+    __atomic_fetch_add(&s_mallocs, 1, __ATOMIC_RELAXED);
+    return __libc_malloc(size);
+}
+
+// Baseline RGB565 -> JPEG with the standard Huffman tables, or optimized ones
+static uint8_t *encode_rgb565(const uint16_t *px, uint32_t w, uint32_t h, bool optimize, uint32_t *out_size) {
+    uint8_t *rgb = malloc((size_t)w * h * 3);
+    for (uint32_t i = 0; i < w * h; i++) {
+        rgb[i * 3] = (uint8_t)((px[i] >> 11) << 3);
+        rgb[i * 3 + 1] = (uint8_t)(((px[i] >> 5) & 63) << 2);
+        rgb[i * 3 + 2] = (uint8_t)((px[i] & 31) << 3);
+    }
+    struct jpeg_compress_struct c;
+    struct jpeg_error_mgr err;
+    c.err = jpeg_std_error(&err);
+    jpeg_create_compress(&c);
+    unsigned char *out = NULL;
+    unsigned long out_len = 0;
+    jpeg_mem_dest(&c, &out, &out_len);
+    c.image_width = w;
+    c.image_height = h;
+    c.input_components = 3;
+    c.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&c);
+    jpeg_set_quality(&c, 80, TRUE);
+    c.optimize_coding = optimize;
+    jpeg_start_compress(&c, TRUE);
+    while (c.next_scanline < h) {
+        JSAMPROW row = rgb + (size_t)c.next_scanline * w * 3;
+        jpeg_write_scanlines(&c, &row, 1);
+    }
+    jpeg_finish_compress(&c);
+    jpeg_destroy_compress(&c);
+    free(rgb);
+    *out_size = (uint32_t)out_len;
+    return out;
+}
+
+// The same JPEG without its DHT segments, as AVI MJPEG writers leave them out
+static uint32_t strip_dht(const uint8_t *jpg, uint32_t size, uint8_t *out) {
+    uint32_t pos = 2, n = 2;
+    memcpy(out, jpg, 2);
+    while (pos + 4 <= size && jpg[pos + 1] != 0xDA) {
+        uint32_t len = 2 + ((uint32_t)jpg[pos + 2] << 8 | jpg[pos + 3]);
+        if (jpg[pos + 1] != 0xC4) {
+            memcpy(out + n, jpg + pos, len);
+            n += len;
+        }
+        pos += len;
+    }
+    memcpy(out + n, jpg + pos, size - pos);
+    return n + size - pos;
+}
+
+// One decoder per stream against setting libjpeg up for every frame: same pixels, no heap
+// allocations after the first frame, and frames without Huffman tables
+static void test_mjpeg_decoder(void) {
+    static const char *clips[] = { "circletriangle", "eye", "fallingcube", "hearttunnel", "pulpfictiondance",
+                                   "redplasma", "spacetime", "starspin", "waterrings" };
+    printf("persistent decoder (best of 5, host):\n");
+    printf("  %-16s %6s   %-17s  %-17s  %s\n", "", "", "set up each frame", "one per stream", "tables");
+    printf("  %-16s %6s  %9s %7s  %9s %7s  %s\n", "clip", "frames", "time", "allocs", "time", "allocs", "reused");
+    double total_once = 0, total_kept = 0;
+    uint32_t frame_bytes = 300 * 300 * 2;
+    uint8_t *a = malloc(frame_bytes), *b = malloc(frame_bytes);
+    for (size_t c = 0; c < sizeof(clips) / sizeof(clips[0]); c++) {
+        char path[64];
+        snprintf(path, sizeof(path), "4_sd_card/%s.avi", clips[c]);
+        mem_file_t m;
+        uint8_t *data = load_file(path, &m.size);
+        CHECK(data != NULL);
+        if (!data) continue;
+        m.data = data;
+        avi_info_t info;
+        avi_index_t ix;
+        uint8_t scratch[4096];
+        avi_index_init(&ix, host_realloc);
+        CHECK(avi_parse(mem_read, &m, m.size, &info));
+        avi_index_load(&ix, &info, mem_read, &m, scratch, sizeof(scratch));
+        CHECK(info.width * info.height * 2 <= frame_bytes);
+
+        // Same pixels either way
+        mjpeg_decoder_t *dec = mjpeg_decoder_create();
+        uint32_t same = 0, w, h;
+        for (uint32_t i = 0; i < ix.count; i++) {
+            const uint8_t *jpg = data + ix.frames[i].offset + 8;
+            CHECK(mjpeg_decode_rgb565(NULL, jpg, ix.frames[i].size, a, frame_bytes, &w, &h));
+            CHECK(mjpeg_decode_rgb565(dec, jpg, ix.frames[i].size, b, frame_bytes, &w, &h));
+            same += !memcmp(a, b, (size_t)w * h * 2);
+        }
+        CHECK(same == ix.count);
+        mjpeg_decoder_stats_t ds;
+        mjpeg_decoder_get_stats(dec, &ds);
+        CHECK(ds.frames == ix.count);
+        mjpeg_decoder_destroy(dec);
+
+        double best_once = 1e9, best_kept = 1e9;
+        uint32_t allocs_once = 0, allocs_kept = 0;
+        for (int rep = 0; rep < 5; rep++) {
+            uint32_t m0 = s_mallocs;
+            double t0 = now_ms();
+            for (uint32_t i = 0; i < ix.count; i++) {
+                mjpeg_decode_rgb565(NULL, data + ix.frames[i].offset + 8, ix.frames[i].size, a, frame_bytes, &w, &h);
+            }
+            double t1 = now_ms();
+            uint32_t m1 = s_mallocs;
+            dec = mjpeg_decoder_create();
+            // The first frame sizes the arena
+            mjpeg_decode_rgb565(dec, data + ix.frames[0].offset + 8, ix.frames[0].size, b, frame_bytes, &w, &h);
+            uint32_t m2 = s_mallocs;
+            double t2 = now_ms();
+            for (uint32_t i = 1; i < ix.count; i++) {
+                mjpeg_decode_rgb565(dec, data + ix.frames[i].offset + 8, ix.frames[i].size, b, frame_bytes, &w, &h);
+            }
+            double t3 = now_ms();
+            uint32_t m3 = s_mallocs;
+            mjpeg_decoder_get_stats(dec, &ds);
+            mjpeg_decoder_destroy(dec);
+            allocs_once = m1 - m0;
+            allocs_kept = m3 - m2;
+            if ((t1 - t0) / ix.count < best_once) best_once = (t1 - t0) / ix.count;
+            if ((t3 - t2) / (ix.count - 1) < best_kept) best_kept = (t3 - t2) / (ix.count - 1);
+        }
+        CHECK(allocs_kept == 0 && ds.pool_allocs > 0 && ds.arena_bytes > 0);
+        printf("  %-16s %6u  %6.0f us %7.1f  %6.0f us %7.1f  %u (%u KB arena)\n", clips[c], (unsigned)ix.count,
+               best_once * 1000, (double)allocs_once / ix.count, best_kept * 1000, (double)allocs_kept / (ix.count - 1),
+               (unsigned)ds.tables_reused, (unsigned)(ds.arena_bytes / 1024));
+        total_once += best_once;
+        total_kept += best_kept;
+        avi_index_free(&ix);
+        free(data);
+    }
+    printf("  average: %.0f us per frame set up each time, %.0f us kept\n",
+           total_once * 1000 / 9, total_kept * 1000 / 9);
+    // Saves the set-up, which is small next to decoding on the host; just never slower
+    // beyond noise
+    CHECK(total_kept < total_once * 1.1);
+
+    // Frames without a DHT decode with the standard tables, also on a decoder that has
+    // just loaded optimized ones from another frame
+    uint32_t size;
+    uint8_t *avi = load_file("4_sd_card/eye.avi", &size);
+    if (avi) {
+        mem_file_t m = { avi, size };
+        avi_info_t info;
+        avi_index_t ix;
+        uint8_t scratch[4096];
+        avi_index_init(&ix, host_realloc);
+        avi_parse(mem_read, &m, m.size, &info);
+        avi_index_load(&ix, &info, mem_read, &m, scratch, sizeof(scratch));
+        uint32_t w, h, std_size, opt_size;
+        const uint8_t *avi_jpg = avi + ix.frames[10].offset + 8;
+        mjpeg_decode_rgb565(NULL, avi_jpg, ix.frames[10].size, a, frame_bytes, &w, &h);
+        uint8_t *std_jpg = encode_rgb565((const uint16_t *)a, w, h, false, &std_size);
+        uint8_t *opt_jpg = encode_rgb565((const uint16_t *)a, w, h, true, &opt_size);
+        uint8_t *bare = malloc(std_size);
+        uint32_t bare_size = strip_dht(std_jpg, std_size, bare);
+        CHECK(bare_size < std_size);
+        uint8_t *ref = malloc(frame_bytes);
+        CHECK(mjpeg_decode_rgb565(NULL, std_jpg, std_size, ref, frame_bytes, &w, &h));
+        CHECK(mjpeg_decode_rgb565(NULL, bare, bare_size, b, frame_bytes, &w, &h) && !memcmp(ref, b, frame_bytes));
+
+        mjpeg_decoder_t *dec = mjpeg_decoder_create();
+        const uint8_t *seq[] = { opt_jpg, bare, avi_jpg, bare, bare, std_jpg, bare };
+        const uint32_t seq_size[] = { opt_size, bare_size, ix.frames[10].size, bare_size, bare_size, std_size,
+                                      bare_size };
+        for (int i = 0; i < 7; i++) {
+            memset(b, 0, frame_bytes);
+            CHECK(mjpeg_decode_rgb565(dec, seq[i], seq_size[i], b, frame_bytes, &w, &h));
+            if (seq[i] == bare) CHECK(!memcmp(ref, b, frame_bytes));
+        }
+        mjpeg_decoder_stats_t ds;
+        mjpeg_decoder_get_stats(dec, &ds);
+        // The second bare frame in a row skips its tables
+        CHECK(ds.dht_injected == 4 && ds.tables_reused == 1);
+
+        // A corrupt frame (tables cut short) does not spoil the next
+        uint8_t *bad = malloc(std_size);
+        memcpy(bad, std_jpg, std_size);
+        for (uint32_t i = 2; i + 3 < std_size; i++) {
+            if (bad[i] == 0xFF && bad[i + 1] == 0xC4) {
+                bad[i + 2] = 0;
+                bad[i + 3] = 5;
+                break;
+            }
+        }
+        CHECK(!mjpeg_decode_rgb565(dec, bad, std_size, b, frame_bytes, &w, &h));
+        CHECK(mjpeg_decode_rgb565(dec, bare, bare_size, b, frame_bytes, &w, &h) && !memcmp(ref, b, frame_bytes));
+        // Region and band decodes share it
+        mjpeg_rect_t want = { 40, 60, 200, 100 }, got;
+        CHECK(mjpeg_decode_region(dec, bare, bare_size, 1, &want, b, w * 2, frame_bytes, true, &got, NULL, NULL));
+        CHECK(region_matches(ref, w, b + ((size_t)got.y * w + got.x) * 2, w * 2, &got, w));
+        mjpeg_decoder_destroy(dec);
+        printf("  frames without a DHT: standard tables, also after optimized ones\n");
+
+        free(bad);
+        free(ref);
+        free(bare);
+        free(std_jpg);
+        free(opt_jpg);
+        avi_index_free(&ix);
+        free(avi);
+    }
+    free(a);
+    free(b);
+}
+
+// ---- Raw output ----
+
+// The frame decode as it was: libjpeg's RGB565 output, one row a call, with its default
+// interpolated chroma and dither
+static bool decode_libjpeg_default(const uint8_t *jpg, uint32_t size, uint8_t *dst) {
+    struct jpeg_decompress_struct c;
+    struct jpeg_error_mgr err;
+    c.err = jpeg_std_error(&err);
+    jpeg_create_decompress(&c);
+    jpeg_mem_src(&c, (unsigned char *)jpg, size);
+    jpeg_read_header(&c, TRUE);
+    c.out_color_space = JCS_RGB565;
+    c.dct_method = JDCT_IFAST;
+    jpeg_start_decompress(&c);
+    while (c.output_scanline < c.output_height) {
+        JSAMPROW row = dst + (size_t)c.output_scanline * c.output_width * 2;
+        jpeg_read_scanlines(&c, &row, 1);
+    }
+    jpeg_finish_decompress(&c);
+    jpeg_destroy_decompress(&c);
+    return true;
+}
+
+// The converter on raw components against libjpeg's own RGB565 output: the same pixels,
+// little- and big-endian, and the time per frame for every sample video and photo
+static void test_mjpeg_raw(void) {
+    static const char *files[] = { "circletriangle.avi", "eye.avi", "fallingcube.avi", "hearttunnel.avi",
+                                   "pulpfictiondance.avi", "redplasma.avi", "spacetime.avi", "starspin.avi",
+                                   "waterrings.avi", "cube_lady.jpg", "day_dead.jpg", "twist_face.jpg" };
+    uint32_t frame_bytes = 300 * 300 * 2;
+    uint8_t *a = malloc(frame_bytes), *b = malloc(frame_bytes), *bands = malloc(frame_bytes);
+    mjpeg_decoder_t *lib = mjpeg_decoder_create(), *raw = mjpeg_decoder_create();
+    mjpeg_decoder_set_raw(lib, false);
+    printf("raw output (best of 5, host, per frame):\n");
+    printf("  %-22s %6s  %9s  %9s  %9s  %9s\n", "file", "frames", "default", "libjpeg", "converter", "BE bands");
+    double sum_def = 0, sum_lib = 0, sum_raw = 0, sum_be = 0;
+    for (size_t fi = 0; fi < sizeof(files) / sizeof(files[0]); fi++) {
+        char path[64];
+        snprintf(path, sizeof(path), "4_sd_card/%s", files[fi]);
+        uint32_t size;
+        uint8_t *data = load_file(path, &size);
+        CHECK(data != NULL);
+        if (!data) continue;
+        // Frames as (offset, size): the AVI's index, or the one JPEG
+        uint32_t count = 1;
+        avi_index_t ix;
+        avi_index_init(&ix, host_realloc);
+        avi_frame_t one = { 0, size };
+        const avi_frame_t *frames = &one;
+        uint32_t skip = 0;
+        if (strstr(files[fi], ".avi")) {
+            mem_file_t m = { data, size };
+            avi_info_t info;
+            uint8_t scratch[4096];
+            avi_parse(mem_read, &m, m.size, &info);
+            avi_index_load(&ix, &info, mem_read, &m, scratch, sizeof(scratch));
+            frames = ix.frames;
+            count = ix.count;
+            skip = 8;
+        }
+
+        uint32_t same = 0, same_be = 0, w, h, bw, bh;
+        static band_sink_t bs;
+        for (uint32_t i = 0; i < count; i++) {
+            const uint8_t *jpg = data + frames[i].offset + skip;
+            CHECK(mjpeg_decode_rgb565(lib, jpg, frames[i].size, a, frame_bytes, &w, &h));
+            CHECK(mjpeg_decode_rgb565(raw, jpg, frames[i].size, b, frame_bytes, &w, &h));
+            same += !memcmp(a, b, (size_t)w * h * 2);
+            mjpeg_band_sink_t sink = band_sink(&bs);
+            bs.out = bands;
+            CHECK(mjpeg_decode_bands(raw, jpg, frames[i].size, &sink, &bw, &bh) && bs.order_ok && bs.next_y == h);
+            mjpeg_swap_rgb565(a, w * h);
+            same_be += !memcmp(a, bands, (size_t)w * h * 2);
+        }
+        CHECK(same == count && same_be == count);
+
+        double best[4] = { 1e9, 1e9, 1e9, 1e9 };
+        for (int rep = 0; rep < 5; rep++) {
+            double t[5];
+            t[0] = now_ms();
+            for (uint32_t i = 0; i < count; i++) decode_libjpeg_default(data + frames[i].offset + skip, frames[i].size, a);
+            t[1] = now_ms();
+            for (uint32_t i = 0; i < count; i++) {
+                mjpeg_decode_rgb565(lib, data + frames[i].offset + skip, frames[i].size, a, frame_bytes, &w, &h);
+            }
+            t[2] = now_ms();
+            for (uint32_t i = 0; i < count; i++) {
+                mjpeg_decode_rgb565(raw, data + frames[i].offset + skip, frames[i].size, b, frame_bytes, &w, &h);
+            }
+            t[3] = now_ms();
+            for (uint32_t i = 0; i < count; i++) {
+                mjpeg_band_sink_t sink = band_sink(&bs);
+                mjpeg_decode_bands(raw, data + frames[i].offset + skip, frames[i].size, &sink, &bw, &bh);
+            }
+            t[4] = now_ms();
+            for (int k = 0; k < 4; k++) {
+                if ((t[k + 1] - t[k]) / count < best[k]) best[k] = (t[k + 1] - t[k]) / count;
+            }
+        }
+        printf("  %-22s %6u  %6.0f us  %6.0f us  %6.0f us  %6.0f us\n", files[fi], (unsigned)count,
+               best[0] * 1000, best[1] * 1000, best[2] * 1000, best[3] * 1000);
+        sum_def += best[0];
+        sum_lib += best[1];
+        sum_raw += best[2];
+        sum_be += best[3];
+        avi_index_free(&ix);
+        free(data);
+    }
+    size_t n = sizeof(files) / sizeof(files[0]);
+    printf("  %-22s %6s  %6.0f us  %6.0f us  %6.0f us  %6.0f us\n", "average", "", sum_def * 1000 / n,
+           sum_lib * 1000 / n, sum_raw * 1000 / n, sum_be * 1000 / n);
+    // Noisy on the host; no slower than libjpeg's own output beyond that
+    CHECK(sum_raw < sum_lib * 1.1);
+    mjpeg_decoder_destroy(lib);
+    mjpeg_decoder_destroy(raw);
+    free(a);
+    free(b);
+    free(bands);
+}
+
+// --- Frames streamed out of the SD read-ahead ---
+
+#define STREAM_GUARD        4096        // SD_READER_MAX_CHUNK
+#define STREAM_BUS_KBPS     2200        // sustained SD-over-SPI reads (sd_card host test)
+#define STREAM_OLD_WORK     (100 * 1024)
+#define STREAM_OLD_RING     (64 * 1024)
+#define STREAM_OLD_GUARD    (32 * 1024)
+
+// As sd_reader_open() sizes the ring: `ahead` plus a slot, in whole slots, 64 KB at most
+static uint32_t stream_ring_size(uint32_t slot, uint32_t ahead) {
+    uint32_t max = 64 * 1024 / slot * slot;
+    if (!ahead || ahead >= max) return max;
+    uint32_t ring = (ahead + slot - 1) / slot * slot + slot;
+    if (ring < 2 * slot) ring = 2 * slot;
+    return ring < max ? ring : max;
+}
+
+// The stream with a reader thread that takes the bus time of each read, as the I/O task
+typedef struct {
+    sd_stream_t s;
+    mem_file_t file;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    bool threaded;
+    bool busy;                          // a read is in flight
+    bool stop;
+} stream_rig_t;
+
+static int32_t stream_rig_read(void *ctx, uint32_t offset, void *buf, uint32_t len) {
+    return mem_read(&((stream_rig_t *)ctx)->file, offset, buf, len);
+}
+
+static void *stream_reader_thread(void *arg) {
+    stream_rig_t *r = (stream_rig_t *)arg;
+    pthread_mutex_lock(&r->lock);
+    while (!r->stop) {
+        sd_stream_req_t req;
+        if (!sd_stream_fill_begin(&r->s, &req)) {
+            pthread_cond_wait(&r->cond, &r->lock);
+            continue;
+        }
+        r->busy = true;
+        pthread_mutex_unlock(&r->lock);
+        int32_t got = stream_rig_read(r, req.offset, req.buf, req.len);
+        sleep_us((int64_t)req.len * 1000 / STREAM_BUS_KBPS);
+        pthread_mutex_lock(&r->lock);
+        r->busy = false;
+        sd_stream_fill_end(&r->s, &req, got);
+        pthread_cond_broadcast(&r->cond);
+    }
+    pthread_mutex_unlock(&r->lock);
+    return NULL;
+}
+
+// Without the thread the consumer reads a slot itself whenever it would wait
+static void stream_rig_wait(stream_rig_t *r) {
+    if (r->threaded) {
+        pthread_cond_wait(&r->cond, &r->lock);
+    } else {
+        sd_stream_fill(&r->s);
+    }
+}
+
+// As avi_more_streamed()
+static uint32_t stream_more(void *ctx, const uint8_t **data) {
+    stream_rig_t *r = (stream_rig_t *)ctx;
+    uint32_t len = 0;
+    pthread_mutex_lock(&r->lock);
+    sd_stream_res_t res;
+    while ((res = sd_stream_more(&r->s, data, &len)) == SD_STREAM_AGAIN) stream_rig_wait(r);
+    pthread_cond_broadcast(&r->cond);
+    pthread_mutex_unlock(&r->lock);
+    return res == SD_STREAM_OK ? len : 0;
+}
+
+// Next video chunk, in parts or whole
+static bool stream_next(stream_rig_t *r, const avi_info_t *info, bool part, sd_stream_chunk_t *ch) {
+    pthread_mutex_lock(&r->lock);
+    sd_stream_res_t res;
+    for (;;) {
+        res = part ? sd_stream_next_part(&r->s, ch, MJPEG_HEAD_BYTES) : sd_stream_next(&r->s, ch);
+        pthread_cond_broadcast(&r->cond);
+        if (res == SD_STREAM_AGAIN) {
+            stream_rig_wait(r);
+            continue;
+        }
+        if (res != SD_STREAM_OK || (avi_is_video_chunk(info, ch->id) && ch->size)) break;
+    }
+    pthread_mutex_unlock(&r->lock);
+    return res == SD_STREAM_OK;
+}
+
+static void stream_rig_start(stream_rig_t *r, const mem_file_t *file, const avi_info_t *info, uint8_t *mem,
+                             uint32_t ring, uint32_t slot, uint32_t guard, bool threaded, pthread_t *th) {
+    r->file = *file;
+    r->threaded = threaded;
+    r->busy = false;
+    r->stop = false;
+    pthread_mutex_init(&r->lock, NULL);
+    pthread_cond_init(&r->cond, NULL);
+    CHECK(sd_stream_init(&r->s, mem, ring, slot, guard, stream_rig_read, r));
+    sd_stream_open(&r->s, info->movi_start, info->movi_end, true);
+    if (threaded) pthread_create(th, NULL, stream_reader_thread, r);
+}
+
+static void stream_rig_stop(stream_rig_t *r, pthread_t th) {
+    if (r->threaded) {
+        pthread_mutex_lock(&r->lock);
+        r->stop = true;
+        pthread_cond_broadcast(&r->cond);
+        pthread_mutex_unlock(&r->lock);
+        pthread_join(th, NULL);
+    }
+    pthread_mutex_destroy(&r->lock);
+    pthread_cond_destroy(&r->cond);
+}
+
+// Cold read + decode of frame `k`: seek there with nothing buffered and the bus idle, then
+// decode it whole once it is all in (as before) or from its first part on
+static double stream_latency_us(stream_rig_t *r, const avi_info_t *info, const avi_index_t *ix, uint32_t k,
+                                bool part, mjpeg_decoder_t *dec, uint8_t *dst) {
+    pthread_mutex_lock(&r->lock);
+    while (r->busy) pthread_cond_wait(&r->cond, &r->lock);
+    sd_stream_seek(&r->s, ix->frames[k].offset);
+    pthread_cond_broadcast(&r->cond);
+    pthread_mutex_unlock(&r->lock);
+    int64_t t0 = rig_now_us();
+    sd_stream_chunk_t ch;
+    uint32_t w = 0, h = 0;
+    bool ok = stream_next(r, info, part, &ch) &&
+              mjpeg_decode_rgb565(dec, ch.data, part ? ch.avail : ch.size, dst, 300 * 300 * 2, &w, &h);
+    int64_t t1 = rig_now_us();
+    CHECK(ok && w == 300 && h == 300);
+    pthread_mutex_lock(&r->lock);
+    sd_stream_release(&r->s);
+    pthread_cond_broadcast(&r->cond);
+    pthread_mutex_unlock(&r->lock);
+    return (double)(t1 - t0);
+}
+
+static void test_mjpeg_stream(void) {
+    static const uint32_t slots[] = { 4096, 32 * 1024 };    // FAT16 4 KB clusters, raw contiguous
+    uint32_t frame_bytes = 300 * 300 * 2;
+    uint8_t *a = malloc(frame_bytes), *b = malloc(frame_bytes);
+    mjpeg_decoder_t *whole = mjpeg_decoder_create(), *parts = mjpeg_decoder_create();
+    printf("streamed frames (host, bus %u KB/s, cold read + decode per frame, every 8th frame):\n",
+           STREAM_BUS_KBPS);
+    printf("  %-16s %8s  %5s  %9s %9s  %9s %9s\n", "clip", "largest", "slot", "whole", "streamed", "old mem",
+           "new mem");
+    double sum_whole[2] = {0}, sum_part[2] = {0};
+    uint32_t sum_old = 0, sum_new[2] = {0}, clips = 0, mismatches = 0, too_big = 0;
+    for (size_t c = 0; c < sizeof(s_avi_samples) / sizeof(s_avi_samples[0]); c++) {
+        char path[64];
+        snprintf(path, sizeof(path), "4_sd_card/%s.avi", s_avi_samples[c]);
+        uint32_t size;
+        uint8_t *data = load_file(path, &size);
+        CHECK(data != NULL);
+        if (!data) continue;
+        mem_file_t m = { data, size };
+        avi_info_t info;
+        avi_index_t ix;
+        uint8_t scratch[4096];
+        avi_index_init(&ix, host_realloc);
+        CHECK(avi_parse(mem_read, &m, m.size, &info));
+        avi_index_load(&ix, &info, mem_read, &m, scratch, sizeof(scratch));
+        uint32_t largest = 0;
+        for (uint32_t i = 0; i < ix.count; i++) {
+            if (ix.frames[i].size > largest) largest = ix.frames[i].size;
+        }
+        // The video stream's dwSuggestedBufferSize, not the 1 MB of avih
+        CHECK(info.suggested_buffer == largest);
+
+        // Every frame through a ring smaller than most of them, pulled a slot at a time,
+        // gives the pixels of the frame decoded from memory
+        {
+            const uint32_t ring = 8 * 1024, slot = 2048;
+            uint8_t *mem = malloc(ring + STREAM_GUARD);
+            stream_rig_t r;
+            pthread_t th;
+            stream_rig_start(&r, &m, &info, mem, ring, slot, STREAM_GUARD, false, &th);
+            mjpeg_more_t more = { stream_more, &r };
+            mjpeg_decoder_set_more(parts, &more);
+            for (uint32_t i = 0; i < ix.count; i++) {
+                sd_stream_chunk_t ch;
+                uint32_t w, h, w2, h2;
+                if (!stream_next(&r, &info, true, &ch)) {
+                    CHECK(!"stream ended");
+                    break;
+                }
+                too_big += ch.size > ring;
+                bool ok = mjpeg_decode_rgb565(parts, ch.data, ch.avail, a, frame_bytes, &w, &h);
+                sd_stream_release(&r.s);
+                CHECK(ok);
+                ok = ok && mjpeg_decode_rgb565(whole, data + ix.frames[i].offset + 8, ix.frames[i].size, b,
+                                               frame_bytes, &w2, &h2);
+                if (!ok || w != w2 || h != h2 || memcmp(a, b, frame_bytes)) mismatches++;
+            }
+            // A region stops reading early; the next frame starts clean
+            sd_stream_chunk_t ch;
+            mjpeg_rect_t want = { 40, 60, 100, 80 }, got;
+            uint32_t iw, ih, w2, h2;
+            CHECK(stream_next(&r, &info, true, &ch));
+            memset(a, 0, frame_bytes);
+            CHECK(mjpeg_decode_region(parts, ch.data, ch.avail, 1, &want, a, 300 * 2, frame_bytes, true, &got, &iw,
+                                      &ih));
+            sd_stream_release(&r.s);
+            CHECK(mjpeg_decode_rgb565(whole, data + ix.frames[0].offset + 8, ix.frames[0].size, b, frame_bytes, &w2,
+                                      &h2));
+            CHECK(region_matches(b, w2, a + (got.y * w2 + got.x) * 2, w2 * 2, &got, w2));
+            CHECK(stream_next(&r, &info, true, &ch));
+            CHECK(mjpeg_decode_rgb565(parts, ch.data, ch.avail, a, frame_bytes, &w2, &h2));
+            sd_stream_release(&r.s);
+            CHECK(mjpeg_decode_rgb565(whole, data + ix.frames[1].offset + 8, ix.frames[1].size, b, frame_bytes, &w2,
+                                      &h2));
+            CHECK(!memcmp(a, b, frame_bytes));
+            stream_rig_stop(&r, th);
+            free(mem);
+        }
+
+        // Latency and memory: whole chunks out of the old 64 KB ring with its 32 KB guard,
+        // against parts out of a ring sized from the suggested buffer
+        uint32_t old_mem = STREAM_OLD_WORK + STREAM_OLD_RING + STREAM_OLD_GUARD;
+        for (int si = 0; si < 2; si++) {
+            uint32_t slot = slots[si];
+            uint32_t ring = stream_ring_size(slot, info.suggested_buffer);
+            double lat[2] = {0};
+            for (int mode = 0; mode < 2; mode++) {
+                bool part = mode == 1;
+                uint32_t rs = part ? ring : STREAM_OLD_RING, guard = part ? STREAM_GUARD : STREAM_OLD_GUARD;
+                uint8_t *mem = malloc(rs + guard);
+                stream_rig_t r;
+                pthread_t th;
+                stream_rig_start(&r, &m, &info, mem, rs, slot, guard, true, &th);
+                mjpeg_more_t more = { stream_more, &r };
+                mjpeg_decoder_set_more(parts, part ? &more : NULL);
+                uint32_t n = 0;
+                for (uint32_t k = 0; k < ix.count; k += 8, n++) {
+                    lat[mode] += stream_latency_us(&r, &info, &ix, k, part, parts, a);
+                }
+                lat[mode] /= n;
+                stream_rig_stop(&r, th);
+                free(mem);
+            }
+            uint32_t new_mem = ring + STREAM_GUARD;
+            char big[16] = "";
+            if (!si) snprintf(big, sizeof(big), "%u", (unsigned)largest);
+            printf("  %-16s %8s  %2u KB  %6.2f ms %6.2f ms  %6u KB %6u KB\n", si ? "" : s_avi_samples[c],
+                   big, (unsigned)(slot / 1024), lat[0] / 1000, lat[1] / 1000,
+                   (unsigned)(old_mem / 1024), (unsigned)(new_mem / 1024));
+            sum_whole[si] += lat[0];
+            sum_part[si] += lat[1];
+            sum_new[si] += new_mem;
+        }
+        sum_old += old_mem;
+        clips++;
+        avi_index_free(&ix);
+        free(data);
+    }
+    for (int si = 0; si < 2; si++) {
+        printf("  %-16s %8s  %2u KB  %6.2f ms %6.2f ms  %6u KB %6u KB\n", si ? "" : "average", "",
+               (unsigned)(slots[si] / 1024), sum_whole[si] / clips / 1000, sum_part[si] / clips / 1000,
+               (unsigned)(sum_old / clips / 1024), (unsigned)(sum_new[si] / clips / 1024));
+        // Never worse beyond the host's noise; less memory always
+        CHECK(sum_part[si] < sum_whole[si] * 1.05);
+        CHECK(sum_new[si] < sum_old);
+    }
+    CHECK(mismatches == 0);
+    CHECK(too_big > 0);
+    mjpeg_decoder_destroy(whole);
+    mjpeg_decoder_destroy(parts);
+    free(a);
+    free(b);
+}
+
+// --- Split decodes on restart markers ---
+
+// Runs the bottom parts on a thread of its own, as the helper task on the other core
+typedef struct {
+    pthread_t th;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    void (*fn)(void *arg);
+    void *arg;
+    bool quit;
+    int64_t cpu_us;                     // spent in calls so far
+} split_worker_t;
+
+static void *split_worker_thread(void *p) {
+    split_worker_t *w = (split_worker_t *)p;
+    pthread_mutex_lock(&w->lock);
+    for (;;) {
+        while (!w->fn && !w->quit) pthread_cond_wait(&w->cond, &w->lock);
+        if (w->quit) break;
+        void (*fn)(void *) = w->fn;
+        pthread_mutex_unlock(&w->lock);
+        int64_t t0 = thread_cpu_us();
+        fn(w->arg);
+        int64_t spent = thread_cpu_us() - t0;
+        pthread_mutex_lock(&w->lock);
+        w->cpu_us += spent;
+        w->fn = NULL;
+        pthread_cond_broadcast(&w->cond);
+    }
+    pthread_mutex_unlock(&w->lock);
+    return NULL;
+}
+
+static void split_worker_start(void *ctx, void (*fn)(void *arg), void *arg) {
+    split_worker_t *w = (split_worker_t *)ctx;
+    pthread_mutex_lock(&w->lock);
+    w->fn = fn;
+    w->arg = arg;
+    pthread_cond_broadcast(&w->cond);
+    pthread_mutex_unlock(&w->lock);
+}
+
+static void split_worker_wait(void *ctx) {
+    split_worker_t *w = (split_worker_t *)ctx;
+    pthread_mutex_lock(&w->lock);
+    while (w->fn) pthread_cond_wait(&w->cond, &w->lock);
+    pthread_mutex_unlock(&w->lock);
+}
+
+static int64_t split_worker_cpu(split_worker_t *w) {
+    pthread_mutex_lock(&w->lock);
+    int64_t us = w->cpu_us;
+    pthread_mutex_unlock(&w->lock);
+    return us;
+}
+
+// Lossless re-encode with a restart marker every `rows` rows of MCUs, or every `mcus` MCUs,
+// and the standard Huffman tables: what tools/avi_restart.c does to a frame
+static uint8_t *add_restarts(const uint8_t *jpg, uint32_t size, int rows, int mcus, uint32_t *out_size) {
+    struct jpeg_decompress_struct d;
+    struct jpeg_compress_struct c;
+    struct jpeg_error_mgr derr, cerr;
+    d.err = jpeg_std_error(&derr);
+    c.err = jpeg_std_error(&cerr);
+    jpeg_create_decompress(&d);
+    jpeg_create_compress(&c);
+    jpeg_mem_src(&d, jpg, size);
+    jpeg_read_header(&d, TRUE);
+    jvirt_barray_ptr *coef = jpeg_read_coefficients(&d);
+    unsigned char *out = NULL;
+    unsigned long out_len = 0;
+    jpeg_mem_dest(&c, &out, &out_len);
+    jpeg_copy_critical_parameters(&d, &c);
+    c.write_JFIF_header = FALSE;
+    c.restart_in_rows = rows;
+    c.restart_interval = mcus;
+    jpeg_write_coefficients(&c, coef);
+    jpeg_finish_compress(&c);
+    jpeg_finish_decompress(&d);
+    jpeg_destroy_compress(&c);
+    jpeg_destroy_decompress(&d);
+    *out_size = (uint32_t)out_len;
+    return out;
+}
+
+// The first part of a frame given, the rest through this
+typedef struct {
+    const uint8_t *rest;
+    uint32_t len;
+} split_more_t;
+
+static uint32_t split_more(void *ctx, const uint8_t **data) {
+    split_more_t *m = (split_more_t *)ctx;
+    uint32_t len = m->len;
+    *data = m->rest;
+    m->len = 0;
+    return len;
+}
+
+// A frame's decode time: on one core, and split (the caller's and the worker's CPU time,
+// the larger of them what two cores take, and the wall time)
+typedef struct {
+    double one;
+    double top;
+    double bottom;
+    double two;
+    double wall;
+} split_time_t;
+
+static split_time_t split_measure(mjpeg_decoder_t *one, mjpeg_decoder_t *two, split_worker_t *wk,
+                                  uint8_t *const *frames, const uint32_t *sizes, uint32_t count, uint8_t *dst,
+                                  uint32_t dst_size) {
+    split_time_t best = { 1e9, 1e9, 1e9, 1e9, 1e9 };
+    uint32_t w, h;
+    for (int rep = 0; rep < 5; rep++) {
+        split_time_t t = {0};
+        int64_t c0 = thread_cpu_us();
+        for (uint32_t i = 0; i < count; i++) mjpeg_decode_rgb565(one, frames[i], sizes[i], dst, dst_size, &w, &h);
+        t.one = (double)(thread_cpu_us() - c0) / count;
+        double w0 = now_ms();
+        for (uint32_t i = 0; i < count; i++) {
+            int64_t top0 = thread_cpu_us(), bottom0 = split_worker_cpu(wk);
+            mjpeg_decode_rgb565(two, frames[i], sizes[i], dst, dst_size, &w, &h);
+            double top = (double)(thread_cpu_us() - top0), bottom = (double)(split_worker_cpu(wk) - bottom0);
+            t.top += top / count;
+            t.bottom += bottom / count;
+            t.two += (top > bottom ? top : bottom) / count;
+        }
+        t.wall = (now_ms() - w0) * 1000 / count;
+        if (t.two < best.two) best = t;
+    }
+    return best;
+}
+
+static void split_print(const char *name, uint32_t count, double grow, const split_time_t *t) {
+    printf("  %-16s %6u  %+5.1f%%  %6.0f us  %6.0f + %4.0f us  %6.0f us  %6.0f us  %4.2fx\n", name, (unsigned)count,
+           grow, t->one, t->top, t->bottom, t->two, t->wall, t->one / t->two);
+}
+
+// Frames re-encoded with restart markers decode in two parts to the same pixels as the
+// original frames do in one; frames without them, or not all in hand, in one part. The
+// time of each part is measured for the sample videos and for them at 600 x 450.
+static void test_mjpeg_split(void) {
+    int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    split_worker_t wk = {0};
+    pthread_mutex_init(&wk.lock, NULL);
+    pthread_cond_init(&wk.cond, NULL);
+    pthread_create(&wk.th, NULL, split_worker_thread, &wk);
+    mjpeg_worker_t worker = { .start = split_worker_start, .wait = split_worker_wait, .ctx = &wk };
+    mjpeg_decoder_t *one = mjpeg_decoder_create(), *two = mjpeg_decoder_create();
+    CHECK(mjpeg_decoder_set_worker(two, &worker));
+    uint32_t big_w = 600, big_h = 450, frame_bytes = big_w * big_h * 2;
+    uint8_t *a = malloc(frame_bytes), *b = malloc(frame_bytes);
+    uint16_t *up = malloc(frame_bytes);
+    printf("split decode, restart marker every MCU row (best of 5, host with %d core%s; two cores = "
+           "larger part's CPU time):\n", cores, cores > 1 ? "s" : "");
+    printf("  %-16s %6s  %6s  %9s  %14s  %9s  %9s  %s\n", "clip", "frames", "size", "one core", "top + bottom",
+           "two cores", "wall", "speed-up");
+    uint32_t mismatches = 0, split_missed = 0, not_whole_split = 0, clips = 0;
+    double sum_one[2] = {0}, sum_two[2] = {0}, sum_wall[2] = {0};
+    for (size_t c = 0; c < sizeof(s_avi_samples) / sizeof(s_avi_samples[0]); c++) {
+        char path[64];
+        snprintf(path, sizeof(path), "4_sd_card/%s.avi", s_avi_samples[c]);
+        uint32_t size;
+        uint8_t *data = load_file(path, &size);
+        CHECK(data != NULL);
+        if (!data) continue;
+        mem_file_t m = { data, size };
+        avi_info_t info;
+        avi_index_t ix;
+        uint8_t scratch[4096];
+        avi_index_init(&ix, host_realloc);
+        avi_parse(mem_read, &m, m.size, &info);
+        avi_index_load(&ix, &info, mem_read, &m, scratch, sizeof(scratch));
+        uint32_t n = ix.count, big_n = n < 8 ? n : 8;
+        uint8_t **rst = calloc(n, sizeof(*rst)), **big = calloc(big_n, sizeof(*big));
+        uint32_t *rst_size = calloc(n, sizeof(*rst_size)), *big_size = calloc(big_n, sizeof(*big_size));
+        uint64_t bytes = 0, rst_bytes = 0, big_bytes = 0, big_rst_bytes = 0;
+        uint32_t w, h, w2, h2;
+        for (uint32_t i = 0; i < n; i++) {
+            const uint8_t *jpg = data + ix.frames[i].offset + 8;
+            uint32_t len = ix.frames[i].size;
+            mjpeg_decoder_stats_t s0, s1;
+            // No markers: one part
+            mjpeg_decoder_get_stats(two, &s0);
+            CHECK(mjpeg_decode_rgb565(one, jpg, len, a, frame_bytes, &w, &h));
+            CHECK(mjpeg_decode_rgb565(two, jpg, len, b, frame_bytes, &w2, &h2));
+            mjpeg_decoder_get_stats(two, &s1);
+            CHECK(s1.split == s0.split);
+            mismatches += w != w2 || h != h2 || memcmp(a, b, (size_t)w * h * 2);
+            // A marker every row: two parts, the same pixels
+            rst[i] = add_restarts(jpg, len, 1, 0, &rst_size[i]);
+            bytes += len;
+            rst_bytes += rst_size[i];
+            memset(b, 0, frame_bytes);
+            CHECK(mjpeg_decode_rgb565(two, rst[i], rst_size[i], b, frame_bytes, &w2, &h2));
+            mjpeg_decoder_get_stats(two, &s0);
+            split_missed += s0.split != s1.split + 1;
+            mismatches += w != w2 || h != h2 || memcmp(a, b, (size_t)w * h * 2);
+            if (i == 0) {
+                // Every five MCUs: cut at the row nearest the middle where a marker falls
+                uint32_t len5;
+                uint8_t *rst5 = add_restarts(jpg, len, 0, 5, &len5);
+                memset(b, 0, frame_bytes);
+                CHECK(mjpeg_decode_rgb565(two, rst5, len5, b, frame_bytes, &w2, &h2));
+                mjpeg_decoder_get_stats(two, &s1);
+                split_missed += s1.split != s0.split + 1;
+                mismatches += memcmp(a, b, (size_t)w * h * 2) != 0;
+                // Only its start in hand: one part, the rest pulled as before
+                split_more_t more = { rst5 + MJPEG_HEAD_BYTES, len5 - MJPEG_HEAD_BYTES };
+                mjpeg_more_t mm = { .more = split_more, .ctx = &more };
+                mjpeg_decoder_set_more(two, &mm);
+                CHECK(mjpeg_decode_rgb565(two, rst5, MJPEG_HEAD_BYTES, b, frame_bytes, &w2, &h2));
+                mjpeg_decoder_get_stats(two, &s0);
+                not_whole_split += s0.split != s1.split;
+                mismatches += memcmp(a, b, (size_t)w * h * 2) != 0;
+                // All of it in hand, ending in its EOI: two parts again
+                CHECK(mjpeg_decode_rgb565(two, rst5, len5, b, frame_bytes, &w2, &h2));
+                mjpeg_decoder_set_more(two, NULL);
+                mjpeg_decoder_get_stats(two, &s0);
+                split_missed += s0.split != s1.split + 1;
+                mismatches += memcmp(a, b, (size_t)w * h * 2) != 0;
+                // A damaged marker in the bottom part: decoded somehow, nothing overrun
+                for (uint32_t k = len5 - 3; k > len5 / 2; k--) {
+                    if (rst5[k] == 0xFF && rst5[k + 1] >= 0xD0 && rst5[k + 1] <= 0xD7) {
+                        rst5[k + 1] = 0xD0 + ((rst5[k + 1] + 3) & 7);
+                        break;
+                    }
+                }
+                mjpeg_decode_rgb565(two, rst5, len5, b, frame_bytes, &w2, &h2);
+                free(rst5);
+            }
+            if (i < big_n) {
+                // 600 x 450: the frame doubled, the bottom rows cut
+                for (uint32_t y = 0; y < big_h; y++) {
+                    for (uint32_t x = 0; x < big_w; x++) up[y * big_w + x] = ((uint16_t *)a)[(y / 2) * w + x / 2];
+                }
+                uint32_t plain_len;
+                uint8_t *plain = encode_rgb565(up, big_w, big_h, false, &plain_len);
+                big[i] = add_restarts(plain, plain_len, 1, 0, &big_size[i]);
+                big_bytes += plain_len;
+                big_rst_bytes += big_size[i];
+                CHECK(mjpeg_decode_rgb565(one, plain, plain_len, a, frame_bytes, &w, &h));
+                CHECK(mjpeg_decode_rgb565(two, big[i], big_size[i], b, frame_bytes, &w2, &h2));
+                mismatches += w != big_w || h != big_h || w2 != w || h2 != h || memcmp(a, b, (size_t)w * h * 2);
+                free(plain);
+            }
+        }
+
+        split_time_t t[2];
+        t[0] = split_measure(one, two, &wk, rst, rst_size, n, a, frame_bytes);
+        t[1] = split_measure(one, two, &wk, big, big_size, big_n, a, frame_bytes);
+        split_print(s_avi_samples[c], n, 100.0 * rst_bytes / bytes - 100, &t[0]);
+        split_print("  at 600 x 450", big_n, 100.0 * big_rst_bytes / big_bytes - 100, &t[1]);
+        for (int k = 0; k < 2; k++) {
+            sum_one[k] += t[k].one;
+            sum_two[k] += t[k].two;
+            sum_wall[k] += t[k].wall;
+        }
+        clips++;
+        for (uint32_t i = 0; i < n; i++) free(rst[i]);
+        for (uint32_t i = 0; i < big_n; i++) free(big[i]);
+        free(rst);
+        free(big);
+        free(rst_size);
+        free(big_size);
+        avi_index_free(&ix);
+        free(data);
+    }
+    for (int k = 0; k < 2; k++) {
+        printf("  %-16s %6s  %6s  %6.0f us  %14s  %6.0f us  %6.0f us  %4.2fx\n", k ? "  at 600 x 450" : "average",
+               "", "", sum_one[k] / clips, "", sum_two[k] / clips, sum_wall[k] / clips, sum_one[k] / sum_two[k]);
+        // Each part about half the frame
+        CHECK(sum_two[k] < sum_one[k] * 0.7);
+        // Measured only where there are two cores to run them on
+        if (cores > 1) CHECK(sum_wall[k] < sum_one[k] * 0.8);
+    }
+    CHECK(mismatches == 0);
+    CHECK(split_missed == 0);
+    CHECK(not_whole_split == 0);
+
+    mjpeg_decoder_destroy(one);
+    mjpeg_decoder_destroy(two);
+    pthread_mutex_lock(&wk.lock);
+    wk.quit = true;
+    pthread_cond_broadcast(&wk.cond);
+    pthread_mutex_unlock(&wk.lock);
+    pthread_join(wk.th, NULL);
+    pthread_mutex_destroy(&wk.lock);
+    pthread_cond_destroy(&wk.cond);
+    free(a);
+    free(b);
+    free(up);
+}
+
+// ---- Changed-region invalidation ----
+
+typedef struct {
+    uint32_t *grid;
+    uint32_t w;
+} diff_hook_t;
+
+static void diff_hash_rows(void *ctx, uint32_t y, uint32_t count, const uint8_t *px, uint32_t stride) {
+    diff_hook_t *d = ctx;
+    frame_diff_hash_rows(d->grid, d->w, y, count, px, stride);
+}
+
+// Tiles whose pixels differ between two frames, by comparing them
+static void diff_tiles_exact(const uint8_t *a, const uint8_t *b, uint32_t w, uint32_t h, bool *changed) {
+    uint32_t cols = (w + FRAME_DIFF_TILE_W - 1) / FRAME_DIFF_TILE_W;
+    memset(changed, 0, frame_diff_grid_words(w, h) * sizeof(bool));
+    for (uint32_t y = 0; y < h; y++) {
+        for (uint32_t c = 0; c < cols; c++) {
+            uint32_t x = c * FRAME_DIFF_TILE_W, n = w - x < FRAME_DIFF_TILE_W ? w - x : FRAME_DIFF_TILE_W;
+            size_t at = ((size_t)y * w + x) * 2;
+            if (memcmp(a + at, b + at, n * 2)) changed[(y / FRAME_DIFF_TILE_H) * cols + c] = true;
+        }
+    }
+}
+
+static bool diff_covered(const frame_diff_box_t *boxes, uint32_t n, uint32_t x, uint32_t y) {
+    for (uint32_t i = 0; i < n; i++) {
+        if (x >= boxes[i].x && x < boxes[i].x + boxes[i].w && y >= boxes[i].y && y < boxes[i].y + boxes[i].h) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// What LVGL does with the invalidated areas: the image draw copies them into the draw
+// buffer, the flush swaps them and the DMA reads them
+static uint32_t diff_compose(uint16_t *draw, const uint8_t *frame, uint32_t w, const frame_diff_box_t *boxes,
+                             uint32_t n) {
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        const frame_diff_box_t *b = &boxes[i];
+        for (uint32_t y = b->y; y < b->y + b->h; y++) {
+            uint16_t *row = draw + (y + 50) * PANEL_W + 30 + b->x;
+            memcpy(row, frame + ((size_t)y * w + b->x) * 2, b->w * 2);
+            mjpeg_swap_rgb565((uint8_t *)row, b->w);
+            for (uint32_t x = 0; x < b->w; x++) sum += row[x];
+        }
+    }
+    return sum;
+}
+
+static void test_frame_diff(void) {
+    // Boxes from hand-made grids of a 100 x 30 frame: 7 x 4 tiles, the last column 4 wide
+    // and the last row 6 high
+    uint32_t g0[28] = {0}, g1[28] = {0};
+    frame_diff_box_t boxes[FRAME_DIFF_MAX_BOXES];
+    uint32_t changed;
+    CHECK(frame_diff_grid_words(100, 30) == 28);
+    CHECK(frame_diff_boxes(g0, g1, 100, 30, boxes, FRAME_DIFF_MAX_BOXES, &changed) == 0 && changed == 0);
+    g1[1 * 7 + 2] = 1;
+    CHECK(frame_diff_boxes(g0, g1, 100, 30, boxes, FRAME_DIFF_MAX_BOXES, &changed) == 1 && changed == 1);
+    CHECK(boxes[0].x == 32 && boxes[0].y == 8 && boxes[0].w == 16 && boxes[0].h == 8);
+    g1[2 * 7 + 2] = g1[2 * 7 + 3] = 1;                  // overlaps the row above: one box
+    g1[3 * 7 + 6] = 1;                                  // the corner, clipped
+    CHECK(frame_diff_boxes(g0, g1, 100, 30, boxes, FRAME_DIFF_MAX_BOXES, &changed) == 2 && changed == 4);
+    CHECK(boxes[0].x == 32 && boxes[0].y == 8 && boxes[0].w == 32 && boxes[0].h == 16);
+    CHECK(boxes[1].x == 96 && boxes[1].y == 24 && boxes[1].w == 4 && boxes[1].h == 6);
+    // Five apart in 160 x 80 is more boxes than allowed: merged, still covering every change
+    uint32_t h0[100] = {0}, h1[100] = {0};
+    for (uint32_t ty = 0; ty < 10; ty += 2) h1[ty * 10 + ty * 3 % 10] = 1;
+    uint32_t n = frame_diff_boxes(h0, h1, 160, 80, boxes, 3, &changed);
+    CHECK(n == 3 && changed == 5);
+    uint32_t missed = 0;
+    for (uint32_t i = 0; i < 100; i++) missed += h1[i] && !diff_covered(boxes, n, (i % 10) * 16, (i / 10) * 8);
+    CHECK(missed == 0);
+    // Top bits flipped in two words of a tile
+    uint16_t two[2][16] = {{0}};
+    two[1][1] = two[1][3] = 0x8000;
+    frame_diff_hash_rows(h0, 16, 0, 1, (const uint8_t *)two[0], 32);
+    frame_diff_hash_rows(h1, 16, 0, 1, (const uint8_t *)two[1], 32);
+    CHECK(h0[0] != h1[0]);
+
+    // Rows hashed in pieces, as the decoder hands them over, hash as in one go
+    uint8_t px[100 * 30 * 2];
+    for (size_t i = 0; i < sizeof(px); i++) px[i] = (uint8_t)(i * 7 + i / 200);
+    for (uint32_t i = 0; i < 28; i++) g0[i] = g1[i] = 0xDEAD;
+    frame_diff_hash_rows(g0, 100, 0, 30, px, 200);
+    for (uint32_t y = 0; y < 30; y += 3) frame_diff_hash_rows(g1, 100, y, 3, px + y * 200, 200);
+    CHECK(!memcmp(g0, g1, sizeof(g0)));
+    // A pixel changed changes its tile's hash only
+    px[(13 * 100 + 50) * 2] ^= 1;
+    frame_diff_hash_rows(g1, 100, 0, 30, px, 200);
+    CHECK(frame_diff_boxes(g0, g1, 100, 30, boxes, FRAME_DIFF_MAX_BOXES, &changed) == 1 && changed == 1);
+    CHECK(boxes[0].x == 48 && boxes[0].y == 8);
+
+    // The sample clips: each frame hashed by the decoder against the one before, the boxes
+    // against a comparison of the pixels
+    split_worker_t wk = {0};
+    pthread_mutex_init(&wk.lock, NULL);
+    pthread_cond_init(&wk.cond, NULL);
+    pthread_create(&wk.th, NULL, split_worker_thread, &wk);
+    mjpeg_worker_t worker = { .start = split_worker_start, .wait = split_worker_wait, .ctx = &wk };
+    mjpeg_decoder_t *dec = mjpeg_decoder_create(), *plain = mjpeg_decoder_create();
+    CHECK(mjpeg_decoder_set_worker(dec, &worker));
+    uint16_t *draw = malloc(PANEL_W * PANEL_H * 2);
+    printf("changed-region invalidation, %ux%u tiles, up to %u boxes (best of 5; compose = draw copy + "
+           "swap + DMA read):\n", FRAME_DIFF_TILE_W, FRAME_DIFF_TILE_H, FRAME_DIFF_MAX_BOXES);
+    printf("  %-16s %6s  %7s  %8s  %9s  %9s  %9s  %9s  %s\n", "clip", "frames", "tiles", "redrawn", "hash",
+           "compose", "diff", "fps full", "fps diff");
+    uint32_t uncovered = 0, hash_missed = 0, grid_mismatch = 0, clips = 0;
+    double sum_px = 0, sum_full = 0, sum_diff = 0;
+    for (size_t c = 0; c < sizeof(s_avi_samples) / sizeof(s_avi_samples[0]); c++) {
+        char path[64];
+        snprintf(path, sizeof(path), "4_sd_card/%s.avi", s_avi_samples[c]);
+        uint32_t size;
+        uint8_t *data = load_file(path, &size);
+        CHECK(data != NULL);
+        if (!data) continue;
+        mem_file_t m = { data, size };
+        avi_info_t info;
+        avi_index_t ix;
+        uint8_t scratch[4096];
+        avi_index_init(&ix, host_realloc);
+        avi_parse(mem_read, &m, m.size, &info);
+        avi_index_load(&ix, &info, mem_read, &m, scratch, sizeof(scratch));
+        uint32_t w = info.width, h = info.height, n = ix.count < 60 ? ix.count : 60;
+        uint32_t frame_bytes = w * h * 2, words = frame_diff_grid_words(w, h);
+        uint8_t *frames = malloc((size_t)frame_bytes * n);
+        uint32_t *grids = malloc((size_t)words * 4 * n), *check = malloc(words * 4);
+        frame_diff_box_t *all = malloc(sizeof(*all) * FRAME_DIFF_MAX_BOXES * n);
+        uint32_t *counts = calloc(n, sizeof(*counts));
+        bool *exact = malloc(words * sizeof(bool));
+        uint64_t tiles = 0, redrawn = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            const uint8_t *jpg = data + ix.frames[i].offset + 8;
+            uint8_t *fr = frames + (size_t)frame_bytes * i;
+            uint32_t *grid = grids + (size_t)words * i, fw, fh;
+            diff_hook_t hd = { grid, w };
+            mjpeg_rows_hook_t hook = { .rows = diff_hash_rows, .ctx = &hd };
+            mjpeg_decoder_set_rows_hook(dec, &hook);
+            CHECK(mjpeg_decode_rgb565(dec, jpg, ix.frames[i].size, fr, frame_bytes, &fw, &fh) && fw == w && fh == h);
+            frame_diff_hash_rows(check, w, 0, h, fr, w * 2);
+            grid_mismatch += memcmp(check, grid, words * 4) != 0;
+            if (i == 0) {
+                // Split in two parts at once, each hashing its own tiles
+                uint32_t rst_len;
+                uint8_t *rst = add_restarts(jpg, ix.frames[i].size, 1, 0, &rst_len);
+                uint8_t *tmp = malloc(frame_bytes);
+                memset(grid, 0, words * 4);
+                CHECK(mjpeg_decode_rgb565(dec, rst, rst_len, tmp, frame_bytes, &fw, &fh));
+                grid_mismatch += memcmp(check, grid, words * 4) != 0;
+                free(tmp);
+                free(rst);
+            }
+            mjpeg_decoder_set_rows_hook(dec, NULL);
+            if (i == 0) {
+                // The first frame is drawn whole
+                counts[0] = 1;
+                all[0] = (frame_diff_box_t){ 0, 0, w, h };
+                redrawn += (uint64_t)w * h;
+                continue;
+            }
+            frame_diff_box_t *b = all + FRAME_DIFF_MAX_BOXES * i;
+            counts[i] = frame_diff_boxes(grid - words, grid, w, h, b, FRAME_DIFF_MAX_BOXES, &changed);
+            diff_tiles_exact(fr - frame_bytes, fr, w, h, exact);
+            uint32_t cols = (w + FRAME_DIFF_TILE_W - 1) / FRAME_DIFF_TILE_W, exact_n = 0;
+            for (uint32_t t = 0; t < words; t++) {
+                if (!exact[t]) continue;
+                exact_n++;
+                uncovered += !diff_covered(b, counts[i], (t % cols) * FRAME_DIFF_TILE_W, (t / cols) * FRAME_DIFF_TILE_H);
+            }
+            // Equal pixels hash equal; changed ones all changed their hash here
+            hash_missed += exact_n != changed;
+            tiles += changed;
+            for (uint32_t k = 0; k < counts[i]; k++) redrawn += (uint64_t)b[k].w * b[k].h;
+        }
+
+        // Decoding, hashing the rows (in cache here, as in the decoder's hook), and what is
+        // composed per frame: all of it or the boxes
+        double best_hash = 1e9, best_plain = 1e9, best_full = 1e9, best_diff = 1e9;
+        volatile uint32_t dma_sum = 0;
+        frame_diff_box_t whole = { 0, 0, w, h };
+        uint8_t *out = malloc(frame_bytes);
+        for (int rep = 0; rep < 5; rep++) {
+            uint32_t fw, fh;
+            double t0 = now_ms();
+            for (uint32_t i = 0; i < n; i++) {
+                mjpeg_decode_rgb565(plain, data + ix.frames[i].offset + 8, ix.frames[i].size, out, frame_bytes, &fw, &fh);
+            }
+            double t1 = now_ms();
+            for (uint32_t i = 0; i < n; i++) frame_diff_hash_rows(check, w, 0, h, frames + (size_t)frame_bytes * i, w * 2);
+            double t2 = now_ms();
+            for (uint32_t i = 0; i < n; i++) dma_sum += diff_compose(draw, frames + (size_t)frame_bytes * i, w, &whole, 1);
+            double t3 = now_ms();
+            for (uint32_t i = 0; i < n; i++) {
+                dma_sum += diff_compose(draw, frames + (size_t)frame_bytes * i, w, all + FRAME_DIFF_MAX_BOXES * i,
+                                        counts[i]);
+            }
+            double t4 = now_ms();
+            if (t1 - t0 < best_plain) best_plain = t1 - t0;
+            if (t2 - t1 < best_hash) best_hash = t2 - t1;
+            if (t3 - t2 < best_full) best_full = t3 - t2;
+            if (t4 - t3 < best_diff) best_diff = t4 - t3;
+        }
+        double hash_us = best_hash * 1000 / n, full_us = best_full * 1000 / n;
+        double diff_us = best_diff * 1000 / n, dec_us = best_plain * 1000 / n;
+        double px_pct = 100.0 * redrawn / ((double)w * h * n);
+        printf("  %-16s %6u  %6.1f%%  %7.1f%%  %6.0f us  %6.0f us  %6.0f us  %9.1f  %8.1f\n", s_avi_samples[c],
+               (unsigned)n, 100.0 * tiles / ((double)words * (n - 1)), px_pct, hash_us, full_us, diff_us,
+               1e6 / (dec_us + full_us), 1e6 / (dec_us + hash_us + diff_us));
+        sum_px += px_pct;
+        sum_full += full_us;
+        sum_diff += diff_us;
+        clips++;
+        free(out);
+        free(frames);
+        free(grids);
+        free(check);
+        free(all);
+        free(counts);
+        free(exact);
+        avi_index_free(&ix);
+        free(data);
+    }
+    // Through PSRAM on the device: the decoder writes the frame, the other five passes
+    // cover only what was invalidated
+    uint32_t frame_kb = 300 * 300 * 2 / 1024;
+    printf("  average: %.1f%% of pixels redrawn, compose %.0f -> %.0f us/frame, PSRAM %u -> %.0f KB/frame\n",
+           sum_px / clips, sum_full / clips, sum_diff / clips, (unsigned)(frame_kb * 6),
+           frame_kb + frame_kb * 5 * sum_px / clips / 100);
+    CHECK(grid_mismatch == 0);
+    CHECK(uncovered == 0);
+    CHECK(hash_missed == 0);
+    CHECK(sum_diff <= sum_full * 1.1);
+
+    mjpeg_decoder_destroy(dec);
+    mjpeg_decoder_destroy(plain);
+    pthread_mutex_lock(&wk.lock);
+    wk.quit = true;
+    pthread_cond_broadcast(&wk.cond);
+    pthread_mutex_unlock(&wk.lock);
+    pthread_join(wk.th, NULL);
+    pthread_mutex_destroy(&wk.lock);
+    pthread_cond_destroy(&wk.cond);
+    free(draw);
+}
+
+// Merges that leave one box inside another: the pair must merge next, for less than no area
+static void test_frame_diff_overlap(void) {
+    static const char *rows[12] = {
+        "..........", "#...#.....", "........#.", "....#.....", ".#........", ".#.......#",
+        "..........", "....#.....", "....#..#..", "#.........", ".....#....", "..........",
+    };
+    uint32_t g0[120] = {0}, g1[120] = {0};
+    for (uint32_t i = 0; i < 120; i++) g1[i] = rows[i / 10][i % 10] == '#';
+    frame_diff_box_t boxes[FRAME_DIFF_MAX_BOXES];
+    uint32_t changed;
+    uint32_t n = frame_diff_boxes(g0, g1, 160, 96, boxes, 3, &changed);
+    CHECK(n == 3 && changed == 12);
+    // Rows 1-8 across, the changes below them apart
+    CHECK(boxes[0].x == 0 && boxes[0].y == 8 && boxes[0].w == 160 && boxes[0].h == 64);
+    CHECK(boxes[1].x == 0 && boxes[1].y == 72 && boxes[1].w == 16 && boxes[1].h == 8);
+    CHECK(boxes[2].x == 80 && boxes[2].y == 80 && boxes[2].w == 16 && boxes[2].h == 8);
+    uint32_t missed = 0;
+    for (uint32_t i = 0; i < 120; i++) missed += g1[i] && !diff_covered(boxes, n, (i % 10) * 16, (i / 10) * 8);
+    CHECK(missed == 0);
+}
+
+int main(void) {
+    test_pinch_out();
+    test_rotate();
+    test_pan();
+    test_hold_is_ignored();
+    test_single_finger_is_ignored();
+    test_third_finger_and_lift();
+    test_spin_unwraps();
+    test_restart_after_end();
+    test_asset_bundle();
+    test_avi_index();
+    test_video_pipe_logic();
+    test_video_pacing();
+    test_video_pipe_direct();
+    test_video_pipe_threads();
+    test_video_plane();
+    test_mjpeg_region();
+    test_jpeg_view_region();
+    test_jpeg_view_levels();
+    test_mjpeg_decoder();
+    test_mjpeg_raw();
+    test_mjpeg_stream();
+    test_mjpeg_split();
+    test_frame_diff();
+    test_frame_diff_overlap();
+
+    if (s_failures) {
+        printf("%d check(s) failed\n", s_failures);
+        return 1;
+    }
+    printf("lv_ui host tests passed\n");
+    return 0;
+}
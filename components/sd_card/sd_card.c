@@ -3,9 +3,37 @@
 #include "esp_vfs_fat.h"
 #include "sdmmc_cmd.h"
 #include "driver/sdspi_host.h"
+#include "diskio_sdmmc.h"
+#include "ff.h"
+#include "sd_fat_map.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include <stdlib.h>
+#include <string.h>
 
 static const char *TAG = "sd_card";
 static bool s_is_mounted = false;
+static uint32_t s_cluster_size = 0;
+
+// Raw path state: the card, the FATFS drive ("0:") and the volume geometry
+static sdmmc_card_t *s_card = NULL;
+static char s_drv[3];
+static sd_fat_vol_t s_vol;
+static bool s_raw_ok = false;
+static sd_card_read_stats_t s_stats;
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+struct sd_card_file {
+    bool raw;
+    sd_fat_extent_t ext;    // raw path
+    uint8_t *bounce;
+    FIL *fil;               // FATFS path
+    uint32_t size;
+    uint64_t bytes;
+    uint64_t us;
+};
 
 // Pin Definitions from docs/t4s3pins.txt
 #define SD_PIN_MOSI 2
@@ -74,6 +102,29 @@ esp_err_t sd_card_init(void) {
     ESP_LOGI(TAG, "Filesystem mounted at %s", mount_point);
     sdmmc_card_print_info(stdout, card);
     s_is_mounted = true;
+
+    // Cluster size, so streaming readers can align their reads to it
+    BYTE pdrv = ff_diskio_get_pdrv_card(card);
+    char drv[3] = {(char)('0' + pdrv), ':', 0};
+    FATFS *fs;
+    DWORD free_clusters;
+    if (pdrv != 0xFF && f_getfree(drv, &free_clusters, &fs) == FR_OK) {
+        s_cluster_size = fs->csize * card->csd.sector_size;
+        ESP_LOGI(TAG, "Cluster size: %lu bytes", (unsigned long)s_cluster_size);
+
+        // Geometry for the contiguous-file fast path; FATFS's offsets are absolute sectors
+        s_card = card;
+        memcpy(s_drv, drv, sizeof(s_drv));
+        // FAT32 and exFAT both have 32-bit FAT entries
+        s_vol.fat_bits = fs->fs_type == FS_FAT12 ? 12 : fs->fs_type == FS_FAT16 ? 16 : 32;
+        s_vol.sector_size = card->csd.sector_size;
+        s_vol.fat_lba = (uint32_t)fs->fatbase;
+        s_vol.data_lba = (uint32_t)fs->database;
+        s_vol.cluster_sectors = fs->csize;
+        s_vol.clusters = fs->n_fatent - 2;
+        s_raw_ok = fs->fs_type != FS_FAT12;
+        if (!s_raw_ok) ESP_LOGW(TAG, "FAT12 volume: raw reads disabled");
+    }
     
     return ESP_OK;
 }
@@ -81,3 +132,180 @@ esp_err_t sd_card_init(void) {
 bool sd_card_is_mounted(void) {
     return s_is_mounted;
 }
+
+uint32_t sd_card_get_cluster_size(void) {
+    return s_cluster_size;
+}
+
+// --- Files: raw sector reads for contiguous files, FATFS otherwise ---
+
+// Raw reads share the card with FATFS, whose calls on other tasks hold the volume's lock
+// around their sector I/O. Each sdspi command is one transaction, but nothing orders a raw
+// read against a FATFS update in progress, so raw reads take the same lock.
+static bool vol_lock(void) {
+#if FF_FS_REENTRANT
+    return ff_mutex_take(s_drv[0] - '0') != 0;
+#else
+    return true;
+#endif
+}
+
+static void vol_unlock(void) {
+#if FF_FS_REENTRANT
+    ff_mutex_give(s_drv[0] - '0');
+#endif
+}
+
+// With the volume lock held
+static int raw_read(void *ctx, uint32_t lba, uint32_t count, void *buf) {
+    return sdmmc_read_sectors(s_card, buf, lba, count) == ESP_OK ? 0 : -1;
+}
+
+// FAT sectors for the cluster map, with the volume lock held. FATFS keeps one sector in
+// its window, written back only when the window moves or a file is synced: that one may
+// be newer than the card, so it comes from the window.
+static int fat_read(void *ctx, uint32_t lba, uint32_t count, void *buf) {
+    FATFS *fs = (FATFS *)ctx;
+    if (raw_read(NULL, lba, count, buf) != 0) return -1;
+    if (fs->winsect >= lba && fs->winsect < (LBA_t)lba + count) {
+        memcpy((uint8_t *)buf + (size_t)(fs->winsect - lba) * s_vol.sector_size, fs->win, s_vol.sector_size);
+    }
+    return 0;
+}
+
+// "/sdcard/a/b.avi" -> "0:/a/b.avi"
+static bool to_fatfs_path(const char *path, char *out, size_t size) {
+    size_t n = strlen(MOUNT_POINT);
+    if (strncmp(path, MOUNT_POINT, n) != 0 || path[n] != '/') return false;
+    return snprintf(out, size, "%s%s", s_drv, path + n) < (int)size;
+}
+
+// Contiguous: the chain is one run of clusters (exFAT records that in the directory entry).
+// The FAT is read from the card, or FATFS's window for the sector it holds. A file still
+// being written keeps its size and chain in its own FIL until it is synced, so a file open
+// for writing elsewhere may at worst be mapped short or go down the FATFS path.
+static bool map_raw(sd_card_file_t *f) {
+    f->bounce = (uint8_t *)heap_caps_aligned_alloc(4, SD_CARD_RAW_BOUNCE_SIZE, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (!f->bounce) return false;
+    uint32_t sclust = (uint32_t)f->fil->obj.sclust;
+#if FF_FS_EXFAT
+    if (f->fil->obj.fs->fs_type == FS_EXFAT && (f->fil->obj.stat & 2)) {
+        f->ext.lba = s_vol.data_lba + (sclust - 2) * s_vol.cluster_sectors;
+        f->ext.size = f->size;
+        f->ext.sector_size = s_vol.sector_size;
+        return true;
+    }
+#endif
+    uint32_t fat_reads = 0;
+    if (!vol_lock()) return false;
+    sd_fat_layout_t layout = sd_fat_map_file(&s_vol, sclust, f->size, fat_read, f->fil->obj.fs, f->bounce,
+                                             &fat_reads, &f->ext);
+    vol_unlock();
+    ESP_LOGD(TAG, "Cluster chain: %s after %lu FAT sector(s)",
+             layout == SD_FAT_CONTIGUOUS ? "contiguous" : layout == SD_FAT_FRAGMENTED ? "fragmented" : "unreadable",
+             (unsigned long)fat_reads);
+    return layout == SD_FAT_CONTIGUOUS;
+}
+
+esp_err_t sd_card_file_open(const char *path, sd_card_file_t **out) {
+    if (!path || !out) return ESP_ERR_INVALID_ARG;
+    *out = NULL;
+    char fpath[FF_MAX_LFN + 8];
+    if (!s_is_mounted || !s_card) return ESP_ERR_INVALID_STATE;
+    if (!to_fatfs_path(path, fpath, sizeof(fpath))) return ESP_ERR_NOT_FOUND;
+
+    sd_card_file_t *f = (sd_card_file_t *)calloc(1, sizeof(sd_card_file_t));
+    if (f) f->fil = (FIL *)calloc(1, sizeof(FIL));
+    if (!f || !f->fil) {
+        free(f);
+        return ESP_ERR_NO_MEM;
+    }
+    FRESULT fr = f_open(f->fil, fpath, FA_READ);
+    if (fr != FR_OK) {
+        free(f->fil);
+        free(f);
+        return fr == FR_NO_FILE || fr == FR_NO_PATH ? ESP_ERR_NOT_FOUND : ESP_FAIL;
+    }
+    f->size = (uint32_t)f_size(f->fil);
+
+    f->raw = s_raw_ok && map_raw(f);
+    if (f->raw) {
+        // Everything needed is in the extent
+        f_close(f->fil);
+        free(f->fil);
+        f->fil = NULL;
+    } else {
+        heap_caps_free(f->bounce);
+        f->bounce = NULL;
+    }
+    taskENTER_CRITICAL(&s_stats_lock);
+    if (f->raw) s_stats.raw_files++;
+    else s_stats.fat_files++;
+    taskEXIT_CRITICAL(&s_stats_lock);
+    *out = f;
+    return ESP_OK;
+}
+
+int32_t sd_card_file_read(sd_card_file_t *f, uint32_t offset, void *buf, uint32_t len) {
+    if (!f || !buf) return -1;
+    int64_t t0 = esp_timer_get_time();
+    int32_t got;
+    if (f->raw) {
+        // Whole sectors go straight into buffers the SPI DMA can write to
+        bool direct = esp_ptr_dma_capable(buf) && ((uintptr_t)buf & 3) == 0;
+        got = -1;
+        if (vol_lock()) {
+            got = sd_fat_extent_read(&f->ext, offset, buf, len, direct, f->bounce, SD_CARD_RAW_BOUNCE_SIZE,
+                                     raw_read, NULL, NULL);
+            vol_unlock();
+        }
+    } else {
+        UINT n = 0;
+        got = f_lseek(f->fil, offset) == FR_OK && f_read(f->fil, buf, len, &n) == FR_OK ? (int32_t)n : -1;
+    }
+    int64_t dt = esp_timer_get_time() - t0;
+    if (got > 0) {
+        f->bytes += (uint32_t)got;
+        f->us += (uint64_t)dt;
+        taskENTER_CRITICAL(&s_stats_lock);
+        if (f->raw) {
+            s_stats.raw_bytes += (uint32_t)got;
+            s_stats.raw_us += (uint64_t)dt;
+        } else {
+            s_stats.fat_bytes += (uint32_t)got;
+            s_stats.fat_us += (uint64_t)dt;
+        }
+        taskEXIT_CRITICAL(&s_stats_lock);
+    }
+    return got;
+}
+
+uint32_t sd_card_file_size(const sd_card_file_t *f) {
+    return f ? f->size : 0;
+}
+
+bool sd_card_file_is_raw(const sd_card_file_t *f) {
+    return f && f->raw;
+}
+
+void sd_card_file_close(sd_card_file_t *f) {
+    if (!f) return;
+    // Streams worth a throughput figure (not header peeks)
+    if (f->bytes >= 256 * 1024 && f->us) {
+        ESP_LOGI(TAG, "Read %lu KB %s at %lu KB/s", (unsigned long)(f->bytes / 1024),
+                 f->raw ? "raw" : "through FATFS", (unsigned long)(f->bytes * 1000 / f->us));
+    }
+    if (f->fil) {
+        f_close(f->fil);
+        free(f->fil);
+    }
+    heap_caps_free(f->bounce);
+    free(f);
+}
+
+void sd_card_get_read_stats(sd_card_read_stats_t *stats) {
+    if (!stats) return;
+    taskENTER_CRITICAL(&s_stats_lock);
+    *stats = s_stats;
+    taskEXIT_CRITICAL(&s_stats_lock);
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "esp_err.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -24,6 +25,60 @@ esp_err_t sd_card_init(void);
  */
 bool sd_card_is_mounted(void);
 
+/**
+ * @brief FAT cluster size of the mounted card in bytes.
+ * 
+ * @return cluster size, 0 if not mounted
+ */
+uint32_t sd_card_get_cluster_size(void);
+
+// Read-only file access with a fast path for contiguous files: their reads go straight to
+// the card as multi-block sector reads, skipping VFS and FATFS. Fragmented files are read
+// through FATFS.
+typedef struct sd_card_file sd_card_file_t;
+
+// DMA-capable bounce buffer per raw file, for partial sectors and non-DMA destinations
+#ifndef SD_CARD_RAW_BOUNCE_SIZE
+#define SD_CARD_RAW_BOUNCE_SIZE 4096
+#endif
+
+typedef struct {
+    uint32_t raw_files;         // opened on the raw path
+    uint64_t raw_bytes;
+    uint64_t raw_us;
+    uint32_t fat_files;         // fragmented, read through FATFS
+    uint64_t fat_bytes;
+    uint64_t fat_us;
+} sd_card_read_stats_t;
+
+/**
+ * @brief Open a file under the mount point for reading, checking its cluster chain.
+ * 
+ * @return ESP_OK, ESP_ERR_NOT_FOUND, or ESP_ERR_INVALID_STATE if the card is not mounted
+ */
+esp_err_t sd_card_file_open(const char *path, sd_card_file_t **out);
+
+/**
+ * @brief Read up to `len` bytes at `offset` (either path; safe from any one task per file).
+ * 
+ * @return Bytes read (0 at the end of the file), -1 on error
+ */
+int32_t sd_card_file_read(sd_card_file_t *file, uint32_t offset, void *buf, uint32_t len);
+
+uint32_t sd_card_file_size(const sd_card_file_t *file);
+
+/**
+ * @brief Whether the file is contiguous and read below FATFS.
+ */
+bool sd_card_file_is_raw(const sd_card_file_t *file);
+
+void sd_card_file_close(sd_card_file_t *file);
+
+/**
+ * @brief Bytes read and time spent on each path since mount.
+ */
+void sd_card_get_read_stats(sd_card_read_stats_t *stats);
+
 #ifdef __cplusplus
 }
 #endif
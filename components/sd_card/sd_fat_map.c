@@ -0,0 +1,136 @@
+#include "sd_fat_map.h"
+#include <string.h>
+
+static uint16_t rd16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t rd32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+bool sd_fat_parse_bpb(const uint8_t *boot, uint32_t vol_lba, sd_fat_vol_t *vol) {
+    if (rd16(boot + 510) != 0xAA55) return false;
+    uint32_t bps = rd16(boot + 11);
+    uint32_t spc = boot[13];
+    uint32_t rsvd = rd16(boot + 14);
+    uint32_t nfats = boot[16];
+    uint32_t root_entries = rd16(boot + 17);
+    uint32_t total = rd16(boot + 19) ? rd16(boot + 19) : rd32(boot + 32);
+    uint32_t fat_size = rd16(boot + 22) ? rd16(boot + 22) : rd32(boot + 36);
+    // Power-of-two sector and cluster sizes, as FATFS itself requires
+    if (bps < 512 || bps > 4096 || (bps & (bps - 1))) return false;
+    if (!spc || (spc & (spc - 1)) || !rsvd || !nfats || !fat_size) return false;
+
+    uint32_t root_sectors = (root_entries * 32 + bps - 1) / bps;
+    uint32_t data_start = rsvd + nfats * fat_size + root_sectors;
+    if (total <= data_start) return false;
+
+    vol->sector_size = bps;
+    vol->cluster_sectors = spc;
+    vol->fat_lba = vol_lba + rsvd;
+    vol->data_lba = vol_lba + data_start;
+    vol->clusters = (total - data_start) / spc;
+    // The FAT type follows from the cluster count alone
+    vol->fat_bits = vol->clusters < 4085 ? 12 : vol->clusters < 65525 ? 16 : 32;
+    return true;
+}
+
+typedef struct {
+    const sd_fat_vol_t *vol;
+    sd_fat_read_fn read;
+    void *ctx;
+    uint8_t *buf;
+    int64_t cached;         // FAT sector held in buf
+    uint32_t reads;
+} fat_cursor_t;
+
+// Next cluster in the chain; false on a read failure
+static bool fat_next(fat_cursor_t *c, uint32_t cluster, uint32_t *next) {
+    uint32_t bytes = c->vol->fat_bits / 8;
+    uint32_t off = cluster * bytes;
+    uint32_t sector = c->vol->fat_lba + off / c->vol->sector_size;
+    if (c->cached != sector) {
+        if (c->read(c->ctx, sector, 1, c->buf) != 0) return false;
+        c->cached = sector;
+        c->reads++;
+    }
+    const uint8_t *p = c->buf + off % c->vol->sector_size;
+    *next = bytes == 2 ? rd16(p) : rd32(p) & 0x0FFFFFFF;
+    return true;
+}
+
+sd_fat_layout_t sd_fat_map_file(const sd_fat_vol_t *vol, uint32_t first_cluster, uint32_t size,
+                                sd_fat_read_fn read, void *ctx, uint8_t *sector_buf,
+                                uint32_t *fat_reads, sd_fat_extent_t *out) {
+    if (fat_reads) *fat_reads = 0;
+    if (vol->fat_bits != 16 && vol->fat_bits != 32) return SD_FAT_UNSUPPORTED;
+
+    memset(out, 0, sizeof(*out));
+    out->sector_size = vol->sector_size;
+    if (size == 0) return SD_FAT_CONTIGUOUS;
+
+    uint32_t cluster_bytes = vol->cluster_sectors * vol->sector_size;
+    uint32_t n = (uint32_t)(((uint64_t)size + cluster_bytes - 1) / cluster_bytes);
+    uint32_t last_valid = vol->clusters + 1;
+    if (first_cluster < 2 || first_cluster > last_valid) return SD_FAT_ERR;
+    // Longer than the run from here to the end of the volume
+    if (n > last_valid - first_cluster + 1) return SD_FAT_FRAGMENTED;
+
+    fat_cursor_t c = {.vol = vol, .read = read, .ctx = ctx, .buf = sector_buf, .cached = -1};
+    sd_fat_layout_t res = SD_FAT_CONTIGUOUS;
+    for (uint32_t i = 1, cl = first_cluster; i < n; i++, cl++) {
+        uint32_t next;
+        if (!fat_next(&c, cl, &next)) {
+            res = SD_FAT_ERR;
+            break;
+        }
+        if (next == cl + 1) continue;
+        // A link out of range (free, bad, end of chain) before the file's last cluster
+        res = next < 2 || next > last_valid ? SD_FAT_ERR : SD_FAT_FRAGMENTED;
+        break;
+    }
+    if (fat_reads) *fat_reads = c.reads;
+    if (res != SD_FAT_CONTIGUOUS) return res;
+
+    out->lba = vol->data_lba + (first_cluster - 2) * vol->cluster_sectors;
+    out->size = size;
+    return SD_FAT_CONTIGUOUS;
+}
+
+int32_t sd_fat_extent_read(const sd_fat_extent_t *ext, uint32_t offset, void *buf, uint32_t len,
+                           bool direct, uint8_t *bounce, uint32_t bounce_size,
+                           sd_fat_read_fn read, void *ctx, uint32_t *commands) {
+    if (offset >= ext->size) return 0;
+    if (len > ext->size - offset) len = ext->size - offset;
+    uint32_t ss = ext->sector_size;
+    uint8_t *dst = (uint8_t *)buf;
+    uint32_t done = 0;
+    uint32_t cmds = 0;
+
+    while (done < len) {
+        uint32_t pos = offset + done;
+        uint32_t lba = ext->lba + pos / ss;
+        uint32_t in_sector = pos % ss;
+        uint32_t left = len - done;
+        if (direct && !in_sector && left >= ss) {
+            // Whole sectors straight into the caller's buffer
+            uint32_t n = left / ss;
+            if (read(ctx, lba, n, dst + done) != 0) return -1;
+            cmds++;
+            done += n * ss;
+            continue;
+        }
+        // Partial sectors, or a buffer the card cannot write into: through the bounce
+        uint32_t n = (in_sector + left + ss - 1) / ss;
+        if (n > bounce_size / ss) n = bounce_size / ss;
+        if (read(ctx, lba, n, bounce) != 0) return -1;
+        cmds++;
+        uint32_t take = n * ss - in_sector;
+        if (take > left) take = left;
+        memcpy(dst + done, bounce + in_sector, take);
+        done += take;
+    }
+    if (commands) *commands += cmds;
+    return (int32_t)done;
+}
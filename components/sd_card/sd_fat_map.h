@@ -0,0 +1,72 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Contiguous-file detection and raw sector reads below FATFS.
+// A file whose cluster chain is one unbroken run of clusters occupies consecutive sectors,
+// so any byte range of it maps straight to sectors: reads skip VFS, the cluster-chain walk
+// and FATFS's one-sector window and become a single multi-block command. Fragmented files
+// (and FAT12 volumes) are left to FATFS.
+// No IDF dependencies: the caller supplies the sector reads, so it runs on the host against
+// a FAT image file.
+
+typedef struct {
+    uint8_t fat_bits;           // 12, 16 or 32
+    uint32_t sector_size;
+    uint32_t fat_lba;           // first sector of the first FAT (absolute)
+    uint32_t data_lba;          // first sector of cluster 2 (absolute)
+    uint32_t cluster_sectors;
+    uint32_t clusters;          // data clusters; valid cluster numbers are 2 .. clusters + 1
+} sd_fat_vol_t;
+
+// Read `count` sectors starting at absolute sector `lba`; 0 on success
+typedef int (*sd_fat_read_fn)(void *ctx, uint32_t lba, uint32_t count, void *buf);
+
+typedef enum {
+    SD_FAT_CONTIGUOUS = 0,
+    SD_FAT_FRAGMENTED,
+    SD_FAT_UNSUPPORTED,         // FAT12
+    SD_FAT_ERR,                 // read failure or a broken chain
+} sd_fat_layout_t;
+
+typedef struct {
+    uint32_t lba;               // first sector of the file
+    uint32_t size;              // bytes
+    uint32_t sector_size;
+} sd_fat_extent_t;
+
+/**
+ * @brief Volume geometry from a FAT boot sector (BPB) found at absolute sector `vol_lba`
+ * @return false if it is not a FAT boot sector
+ */
+bool sd_fat_parse_bpb(const uint8_t *boot, uint32_t vol_lba, sd_fat_vol_t *vol);
+
+/**
+ * @brief Walk the cluster chain of a file of `size` bytes starting at `first_cluster`.
+ * @param sector_buf One sector of scratch space for FAT reads
+ * @param fat_reads  Optional: FAT sectors read
+ * @return SD_FAT_CONTIGUOUS with `out` filled in, otherwise why not
+ */
+sd_fat_layout_t sd_fat_map_file(const sd_fat_vol_t *vol, uint32_t first_cluster, uint32_t size,
+                                sd_fat_read_fn read, void *ctx, uint8_t *sector_buf,
+                                uint32_t *fat_reads, sd_fat_extent_t *out);
+
+/**
+ * @brief Read [offset, offset + len) of a contiguous file, clamped to its size.
+ * Whole sectors go straight into `buf` in one read when `direct` (the buffer suits the
+ * card's DMA); otherwise, and for partial sectors, they go through `bounce` in batches of
+ * `bounce_size` bytes (a multiple of the sector size).
+ * @param commands Optional: sector reads issued
+ * @return Bytes read, -1 on a read failure
+ */
+int32_t sd_fat_extent_read(const sd_fat_extent_t *ext, uint32_t offset, void *buf, uint32_t len,
+                           bool direct, uint8_t *bounce, uint32_t bounce_size,
+                           sd_fat_read_fn read, void *ctx, uint32_t *commands);
+
+#ifdef __cplusplus
+}
+#endif
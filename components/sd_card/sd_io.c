@@ -0,0 +1,208 @@
+#include "sd_io.h"
+#include "sd_card.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <errno.h>
+
+static const char *TAG = "sd_io";
+
+#define SD_IO_TASK_PRIO     4       // below sd_reader (6), so playback reads go first
+#define SD_IO_TASK_CORE     0       // LVGL renders on core 1
+
+static sd_ioq_t s_q;
+static SemaphoreHandle_t s_lock = NULL;
+static TaskHandle_t s_task = NULL;
+static sd_io_notify_fn s_notify = NULL;
+static void *s_notify_arg = NULL;
+
+// --- Backend: VFS / FATFS, only ever called from the worker ---
+
+typedef struct {
+    DIR *d;
+    char path[SD_IO_PATH_MAX];
+} io_dir_t;
+
+// Contiguous files are read raw, in multi-block batches even into PSRAM buffers
+static int32_t io_read(void *ctx, const char *path, uint32_t offset, void *buf, uint32_t len) {
+    sd_card_file_t *f;
+    esp_err_t err = sd_card_file_open(path, &f);
+    if (err != ESP_OK) return err == ESP_ERR_NOT_FOUND ? -2 : -1;
+    uint32_t done = 0;
+    while (done < len) {
+        int32_t n = sd_card_file_read(f, offset + done, (uint8_t *)buf + done, len - done);
+        if (n < 0) {
+            sd_card_file_close(f);
+            return -1;
+        }
+        if (n == 0) break;
+        done += (uint32_t)n;
+    }
+    sd_card_file_close(f);
+    return (int32_t)done;
+}
+
+static int32_t io_size(void *ctx, const char *path) {
+    struct stat st;
+    if (stat(path, &st) != 0) return errno == ENOENT ? -2 : -1;
+    return (int32_t)st.st_size;
+}
+
+static void *io_dir_open(void *ctx, const char *path) {
+    io_dir_t *dir = (io_dir_t *)calloc(1, sizeof(io_dir_t));
+    if (!dir) return NULL;
+    dir->d = opendir(path);
+    if (!dir->d) {
+        free(dir);
+        return NULL;
+    }
+    snprintf(dir->path, sizeof(dir->path), "%s", path);
+    return dir;
+}
+
+static bool io_dir_next(void *ctx, void *handle, sd_io_dirent_t *out) {
+    io_dir_t *dir = (io_dir_t *)handle;
+    struct dirent *e = readdir(dir->d);
+    if (!e) return false;
+    snprintf(out->name, sizeof(out->name), "%s", e->d_name);
+    out->is_dir = e->d_type == DT_DIR;
+    out->size = 0;
+    if (!out->is_dir) {
+        char path[SD_IO_PATH_MAX + SD_IO_NAME_MAX + 1];
+        struct stat st;
+        snprintf(path, sizeof(path), "%s/%s", dir->path, e->d_name);
+        if (stat(path, &st) == 0) out->size = (uint32_t)st.st_size;
+    }
+    return true;
+}
+
+static void io_dir_close(void *ctx, void *handle) {
+    io_dir_t *dir = (io_dir_t *)handle;
+    closedir(dir->d);
+    free(dir);
+}
+
+static void *io_write_open(void *ctx, const char *path, bool append) {
+    return fopen(path, append ? "ab" : "wb");
+}
+
+static int32_t io_write(void *ctx, void *file, const void *data, uint32_t len) {
+    return (int32_t)fwrite(data, 1, len, (FILE *)file);
+}
+
+static int io_write_close(void *ctx, void *file) {
+    return fclose((FILE *)file);
+}
+
+static void *io_alloc(void *ctx, size_t size) {
+    void *p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    return p ? p : malloc(size);
+}
+
+static void io_free(void *ctx, void *p) {
+    heap_caps_free(p);
+}
+
+// --- OS hooks ---
+
+static void io_lock(void *ctx) {
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+}
+
+static void io_unlock(void *ctx) {
+    xSemaphoreGive(s_lock);
+}
+
+static void io_wake_worker(void *ctx) {
+    if (s_task) xTaskNotifyGive(s_task);
+}
+
+static void io_notify(void *ctx) {
+    if (s_notify) s_notify(s_notify_arg);
+}
+
+static void sd_io_task(void *arg) {
+    while (1) {
+        while (sd_ioq_work(&s_q)) {}
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+
+esp_err_t sd_io_start(sd_io_notify_fn notify, void *arg) {
+    if (s_task) return ESP_ERR_INVALID_STATE;
+    s_lock = xSemaphoreCreateMutex();
+    if (!s_lock) return ESP_ERR_NO_MEM;
+    s_notify = notify;
+    s_notify_arg = arg;
+
+    const sd_io_backend_t be = {
+        .read = io_read, .size = io_size,
+        .dir_open = io_dir_open, .dir_next = io_dir_next, .dir_close = io_dir_close,
+        .write_open = io_write_open, .write = io_write, .write_close = io_write_close,
+        .alloc = io_alloc, .free = io_free,
+    };
+    const sd_io_os_t os = {
+        .lock = io_lock, .unlock = io_unlock, .wake_worker = io_wake_worker, .notify = io_notify,
+    };
+    sd_ioq_init(&s_q, &be, &os);
+
+    if (xTaskCreatePinnedToCore(sd_io_task, "sd_io", 4096, NULL, SD_IO_TASK_PRIO, &s_task, SD_IO_TASK_CORE) != pdPASS) {
+        vSemaphoreDelete(s_lock);
+        s_lock = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "Async file I/O started (%d requests)", SD_IO_MAX_REQUESTS);
+    return ESP_OK;
+}
+
+uint32_t sd_io_read(const char *path, uint32_t offset, uint32_t len, uint32_t max_len, void *buf,
+                    const sd_io_opts_t *opts) {
+    if (!s_task) return 0;
+    uint32_t id = sd_ioq_read(&s_q, path, offset, len, max_len, buf, opts);
+    if (!id) ESP_LOGW(TAG, "Read of %s not queued", path ? path : "(null)");
+    return id;
+}
+
+uint32_t sd_io_list(const char *path, const sd_io_opts_t *opts) {
+    if (!s_task) return 0;
+    uint32_t id = sd_ioq_list(&s_q, path, opts);
+    if (!id) ESP_LOGW(TAG, "Listing of %s not queued", path ? path : "(null)");
+    return id;
+}
+
+uint32_t sd_io_write_open(const char *path, bool append, const sd_io_opts_t *opts) {
+    if (!s_task) return 0;
+    return sd_ioq_write_open(&s_q, path, append, opts);
+}
+
+sd_io_status_t sd_io_write(uint32_t stream, const void *data, uint32_t len) {
+    if (!s_task) return SD_IO_ERR_ARG;
+    return sd_ioq_write(&s_q, stream, data, len);
+}
+
+sd_io_status_t sd_io_write_close(uint32_t stream) {
+    if (!s_task) return SD_IO_ERR_ARG;
+    return sd_ioq_write_close(&s_q, stream);
+}
+
+void sd_io_cancel(uint32_t id) {
+    if (s_task) sd_ioq_cancel(&s_q, id);
+}
+
+void sd_io_cancel_owner(const void *owner) {
+    if (s_task) sd_ioq_cancel_owner(&s_q, owner);
+}
+
+uint32_t sd_io_dispatch(void) {
+    return s_task ? sd_ioq_dispatch(&s_q, 0) : 0;
+}
+
+void sd_io_get_stats(sd_io_stats_t *stats) {
+    if (s_task && stats) sd_ioq_get_stats(&s_q, stats);
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include "esp_err.h"
+#include "sd_io_queue.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Asynchronous file service: one worker task on core 0 does all the file system calls;
+// callers never wait on the card. Callbacks run on whichever thread calls sd_io_dispatch()
+// (the LVGL task), woken through the notify hook given to sd_io_start().
+// Video playback does not go through here: sd_reader has its own higher-priority task.
+
+typedef void (*sd_io_notify_fn)(void *arg);
+
+/**
+ * @brief Start the worker.
+ * @param notify Called from the worker when completions are waiting; it should get
+ *               sd_io_dispatch() to run on the callback thread (it must not block)
+ */
+esp_err_t sd_io_start(sd_io_notify_fn notify, void *arg);
+
+/**
+ * @brief Read `len` bytes at `offset` (`len` 0: the rest of the file, refused above
+ * `max_len` when non-zero). `buf` NULL allocates the result in PSRAM; see sd_io_result_t
+ * for keeping it.
+ * @return Request id, 0 if the service is not running or the queue is full
+ */
+uint32_t sd_io_read(const char *path, uint32_t offset, uint32_t len, uint32_t max_len, void *buf,
+                    const sd_io_opts_t *opts);
+
+/**
+ * @brief List a directory; the callback runs once per batch of entries (with sizes)
+ */
+uint32_t sd_io_list(const char *path, const sd_io_opts_t *opts);
+
+/**
+ * @brief Open a write stream. Data passed to sd_io_write() is copied and written in order;
+ * the callback runs once after sd_io_write_close() with the bytes written.
+ */
+uint32_t sd_io_write_open(const char *path, bool append, const sd_io_opts_t *opts);
+sd_io_status_t sd_io_write(uint32_t stream, const void *data, uint32_t len);
+sd_io_status_t sd_io_write_close(uint32_t stream);
+
+/**
+ * @brief Cancel a request. Called from the callback thread, its callback is guaranteed not
+ * to run afterwards.
+ */
+void sd_io_cancel(uint32_t id);
+
+/**
+ * @brief Cancel everything submitted with `owner` (e.g. from a view's LV_EVENT_DELETE)
+ */
+void sd_io_cancel_owner(const void *owner);
+
+/**
+ * @brief Run the callbacks of finished requests (on the callback thread)
+ * @return Number of callbacks run
+ */
+uint32_t sd_io_dispatch(void);
+
+void sd_io_get_stats(sd_io_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,503 @@
+#include "sd_io_queue.h"
+#include <string.h>
+
+struct sd_ioq_chunk {
+    sd_ioq_chunk_t *next;
+    uint32_t len;
+    uint8_t data[];
+};
+
+static void lock(sd_ioq_t *q) {
+    if (q->os.lock) q->os.lock(q->os.ctx);
+}
+
+static void unlock(sd_ioq_t *q) {
+    if (q->os.unlock) q->os.unlock(q->os.ctx);
+}
+
+static void wake_worker(sd_ioq_t *q) {
+    if (q->os.wake_worker) q->os.wake_worker(q->os.ctx);
+}
+
+static void notify(sd_ioq_t *q) {
+    if (q->os.notify) q->os.notify(q->os.ctx);
+}
+
+void sd_ioq_init(sd_ioq_t *q, const sd_io_backend_t *be, const sd_io_os_t *os) {
+    memset(q, 0, sizeof(*q));
+    q->be = *be;
+    if (os) q->os = *os;
+    for (int p = 0; p < SD_IO_PRIO_COUNT; p++) q->head[p] = q->tail[p] = -1;
+    q->done_head = q->done_tail = -1;
+}
+
+// --- Lists (lock held) ---
+
+static sd_ioq_req_t *find(sd_ioq_t *q, uint32_t id) {
+    uint32_t idx = id & 0xFF;
+    if (idx >= SD_IO_MAX_REQUESTS) return NULL;
+    sd_ioq_req_t *r = &q->req[idx];
+    return (r->state != SD_IOQ_FREE && r->id == id) ? r : NULL;
+}
+
+static sd_ioq_req_t *slot_alloc(sd_ioq_t *q, sd_io_kind_t kind, const char *path, const sd_io_opts_t *opts) {
+    for (int i = 0; i < SD_IO_MAX_REQUESTS; i++) {
+        sd_ioq_req_t *r = &q->req[i];
+        if (r->state != SD_IOQ_FREE) continue;
+        uint8_t gen = (uint8_t)(r->gen + 1);
+        if (gen == 0) gen = 1;
+        memset(r, 0, sizeof(*r));
+        r->gen = gen;
+        r->id = ((uint32_t)gen << 8) | (uint32_t)i;
+        r->kind = (uint8_t)kind;
+        r->next = -1;
+        strcpy(r->path, path);
+        if (opts) r->opts = *opts;
+        if (r->opts.prio >= SD_IO_PRIO_COUNT) r->opts.prio = SD_IO_PRIO_LOW;
+        r->prio = (uint8_t)r->opts.prio;
+        q->stats.submitted++;
+        return r;
+    }
+    q->stats.rejected++;
+    return NULL;
+}
+
+static void slot_free(sd_ioq_req_t *r) {
+    r->state = SD_IOQ_FREE;
+    r->id = 0;
+}
+
+static void enqueue(sd_ioq_t *q, sd_ioq_req_t *r) {
+    int8_t idx = (int8_t)(r - q->req);
+    r->state = SD_IOQ_QUEUED;
+    r->next = -1;
+    if (q->tail[r->prio] >= 0) q->req[q->tail[r->prio]].next = idx;
+    else q->head[r->prio] = idx;
+    q->tail[r->prio] = idx;
+    if (++q->depth > q->stats.max_depth) q->stats.max_depth = q->depth;
+}
+
+static sd_ioq_req_t *dequeue(sd_ioq_t *q) {
+    for (int p = 0; p < SD_IO_PRIO_COUNT; p++) {
+        int8_t idx = q->head[p];
+        if (idx < 0) continue;
+        sd_ioq_req_t *r = &q->req[idx];
+        q->head[p] = r->next;
+        if (q->head[p] < 0) q->tail[p] = -1;
+        r->next = -1;
+        q->depth--;
+        return r;
+    }
+    return NULL;
+}
+
+// Returns true when the completion list was empty
+static bool done_push(sd_ioq_t *q, sd_ioq_req_t *r) {
+    int8_t idx = (int8_t)(r - q->req);
+    bool was_empty = q->done_head < 0;
+    r->state = SD_IOQ_DONE;
+    r->next = -1;
+    if (q->done_tail >= 0) q->req[q->done_tail].next = idx;
+    else q->done_head = idx;
+    q->done_tail = idx;
+    return was_empty;
+}
+
+static sd_ioq_req_t *done_pop(sd_ioq_t *q) {
+    if (q->done_head < 0) return NULL;
+    sd_ioq_req_t *r = &q->req[q->done_head];
+    q->done_head = r->next;
+    if (q->done_head < 0) q->done_tail = -1;
+    r->next = -1;
+    return r;
+}
+
+// --- Resources (no lock: only the thread that currently owns the request touches them) ---
+
+static void release_buffers(sd_ioq_t *q, sd_ioq_req_t *r) {
+    if (r->own_buf && r->buf) q->be.free(q->be.ctx, r->buf);
+    r->buf = NULL;
+    r->own_buf = false;
+    if (r->batch) q->be.free(q->be.ctx, r->batch);
+    r->batch = NULL;
+}
+
+// Closes handles too, so only the worker calls this with a handle open
+static void release_all(sd_ioq_t *q, sd_ioq_req_t *r) {
+    if (r->handle) {
+        if (r->kind == SD_IO_LIST) q->be.dir_close(q->be.ctx, r->handle);
+        else q->be.write_close(q->be.ctx, r->handle);
+        r->handle = NULL;
+    }
+    lock(q);
+    sd_ioq_chunk_t *c = r->chunks;
+    r->chunks = r->chunks_tail = NULL;
+    r->pending = 0;
+    unlock(q);
+    while (c) {
+        sd_ioq_chunk_t *next = c->next;
+        q->be.free(q->be.ctx, c);
+        c = next;
+    }
+    release_buffers(q, r);
+}
+
+static void retire(sd_ioq_t *q, sd_ioq_req_t *r) {
+    release_all(q, r);
+    lock(q);
+    slot_free(r);
+    q->stats.cancelled++;
+    unlock(q);
+}
+
+// Hand a finished request to the completion thread (or drop it if it was cancelled meanwhile)
+static void finish(sd_ioq_t *q, sd_ioq_req_t *r) {
+    lock(q);
+    if (r->cancelled) {
+        unlock(q);
+        retire(q, r);
+        return;
+    }
+    if (r->status != SD_IO_OK) q->stats.failed++;
+    bool first = done_push(q, r);
+    unlock(q);
+    if (first) notify(q);
+}
+
+static sd_io_status_t status_of(int32_t err) {
+    return err == -2 ? SD_IO_ERR_NOT_FOUND : SD_IO_ERR_IO;
+}
+
+// --- Submission ---
+
+uint32_t sd_ioq_read(sd_ioq_t *q, const char *path, uint32_t offset, uint32_t len, uint32_t max_len,
+                     void *buf, const sd_io_opts_t *opts) {
+    if (!path || strlen(path) >= SD_IO_PATH_MAX || (buf && len == 0)) return 0;
+    lock(q);
+    sd_ioq_req_t *r = slot_alloc(q, SD_IO_READ, path, opts);
+    uint32_t id = 0;
+    if (r) {
+        r->offset = offset;
+        r->len = len;
+        r->max_len = max_len;
+        r->buf = (uint8_t *)buf;
+        enqueue(q, r);
+        id = r->id;
+    }
+    unlock(q);
+    if (id) wake_worker(q);
+    return id;
+}
+
+uint32_t sd_ioq_list(sd_ioq_t *q, const char *path, const sd_io_opts_t *opts) {
+    if (!path || strlen(path) >= SD_IO_PATH_MAX) return 0;
+    lock(q);
+    sd_ioq_req_t *r = slot_alloc(q, SD_IO_LIST, path, opts);
+    uint32_t id = 0;
+    if (r) {
+        enqueue(q, r);
+        id = r->id;
+    }
+    unlock(q);
+    if (id) wake_worker(q);
+    return id;
+}
+
+uint32_t sd_ioq_write_open(sd_ioq_t *q, const char *path, bool append, const sd_io_opts_t *opts) {
+    if (!path || strlen(path) >= SD_IO_PATH_MAX) return 0;
+    lock(q);
+    sd_ioq_req_t *r = slot_alloc(q, SD_IO_WRITE, path, opts);
+    uint32_t id = 0;
+    if (r) {
+        // Opened by the worker with the first chunk (or on close)
+        r->append = append;
+        r->state = SD_IOQ_IDLE;
+        id = r->id;
+    }
+    unlock(q);
+    return id;
+}
+
+sd_io_status_t sd_ioq_write(sd_ioq_t *q, uint32_t stream, const void *data, uint32_t len) {
+    if (!data || len == 0) return SD_IO_ERR_ARG;
+    // Copied outside the lock; the caller's buffer is free again on return
+    sd_ioq_chunk_t *c = (sd_ioq_chunk_t *)q->be.alloc(q->be.ctx, sizeof(sd_ioq_chunk_t) + len);
+    if (!c) return SD_IO_ERR_NO_MEM;
+    c->next = NULL;
+    c->len = len;
+    memcpy(c->data, data, len);
+
+    sd_io_status_t res = SD_IO_OK;
+    bool queued = false;
+    lock(q);
+    sd_ioq_req_t *r = find(q, stream);
+    if (!r || r->kind != SD_IO_WRITE || r->closing || r->cancelled) {
+        res = SD_IO_ERR_ARG;
+    } else if (r->status != SD_IO_OK) {
+        res = r->status;    // sticky: the stream already failed
+    } else if (r->pending + len > SD_IO_WRITE_MAX_PENDING) {
+        res = SD_IO_ERR_BUSY;
+    } else {
+        if (r->chunks_tail) r->chunks_tail->next = c;
+        else r->chunks = c;
+        r->chunks_tail = c;
+        r->pending += len;
+        if (r->state == SD_IOQ_IDLE) {
+            enqueue(q, r);
+            queued = true;
+        }
+        c = NULL;
+    }
+    unlock(q);
+    if (c) q->be.free(q->be.ctx, c);
+    if (queued) wake_worker(q);
+    return res;
+}
+
+sd_io_status_t sd_ioq_write_close(sd_ioq_t *q, uint32_t stream) {
+    bool queued = false;
+    lock(q);
+    sd_ioq_req_t *r = find(q, stream);
+    if (!r || r->kind != SD_IO_WRITE || r->closing) {
+        unlock(q);
+        return SD_IO_ERR_ARG;
+    }
+    r->closing = true;
+    if (r->state == SD_IOQ_IDLE) {
+        enqueue(q, r);
+        queued = true;
+    }
+    unlock(q);
+    if (queued) wake_worker(q);
+    return SD_IO_OK;
+}
+
+// Lock held. Returns true if the worker has to run to release it.
+static bool cancel_locked(sd_ioq_t *q, sd_ioq_req_t *r) {
+    if (r->cancelled) return false;
+    r->cancelled = true;
+    switch (r->state) {
+    case SD_IOQ_IDLE:
+        enqueue(q, r);      // the worker closes the stream
+        return true;
+    case SD_IOQ_QUEUED:
+        return true;        // retired when the worker reaches it
+    default:
+        // RUNNING: dropped when the worker finishes it. DONE / DISPATCHING: dropped by
+        // sd_ioq_dispatch(), which never calls a cancelled request's callback.
+        return false;
+    }
+}
+
+void sd_ioq_cancel(sd_ioq_t *q, uint32_t id) {
+    lock(q);
+    sd_ioq_req_t *r = find(q, id);
+    bool wake = r && cancel_locked(q, r);
+    unlock(q);
+    if (wake) wake_worker(q);
+}
+
+void sd_ioq_cancel_owner(sd_ioq_t *q, const void *owner) {
+    if (!owner) return;
+    bool wake = false;
+    lock(q);
+    for (int i = 0; i < SD_IO_MAX_REQUESTS; i++) {
+        sd_ioq_req_t *r = &q->req[i];
+        if (r->state != SD_IOQ_FREE && r->opts.owner == owner) wake |= cancel_locked(q, r);
+    }
+    unlock(q);
+    if (wake) wake_worker(q);
+}
+
+// --- Worker ---
+
+static void run_read(sd_ioq_t *q, sd_ioq_req_t *r) {
+    int32_t size = q->be.size(q->be.ctx, r->path);
+    if (size < 0) {
+        r->status = status_of(size);
+        return;
+    }
+    r->file_size = (uint32_t)size;
+    uint32_t want = r->len;
+    if (want == 0) {
+        want = r->offset < r->file_size ? r->file_size - r->offset : 0;
+        if (r->max_len && want > r->max_len) {
+            r->status = SD_IO_ERR_TOO_BIG;
+            return;
+        }
+    }
+    if (!r->buf) {
+        r->buf = (uint8_t *)q->be.alloc(q->be.ctx, want ? want : 1);
+        if (!r->buf) {
+            r->status = SD_IO_ERR_NO_MEM;
+            return;
+        }
+        r->own_buf = true;
+    }
+    if (want == 0) return;
+    int32_t n = q->be.read(q->be.ctx, r->path, r->offset, r->buf, want);
+    if (n < 0) r->status = status_of(n);
+    else r->got = (uint32_t)n;
+}
+
+static void run_list(sd_ioq_t *q, sd_ioq_req_t *r) {
+    r->count = 0;
+    r->more = false;
+    if (!r->handle) {
+        r->handle = q->be.dir_open(q->be.ctx, r->path);
+        if (!r->handle) {
+            r->status = SD_IO_ERR_NOT_FOUND;
+            return;
+        }
+    }
+    if (!r->batch) {
+        r->batch = (sd_io_dirent_t *)q->be.alloc(q->be.ctx, sizeof(sd_io_dirent_t) * SD_IO_DIR_BATCH);
+        if (!r->batch) {
+            r->status = SD_IO_ERR_NO_MEM;
+            q->be.dir_close(q->be.ctx, r->handle);
+            r->handle = NULL;
+            return;
+        }
+    }
+    while (r->count < SD_IO_DIR_BATCH && !r->cancelled) {
+        if (!q->be.dir_next(q->be.ctx, r->handle, &r->batch[r->count])) break;
+        r->count++;
+    }
+    r->more = r->count == SD_IO_DIR_BATCH;
+    if (!r->more) {
+        q->be.dir_close(q->be.ctx, r->handle);
+        r->handle = NULL;
+    }
+}
+
+// Writes what is queued; returns true when the stream is finished (closed or failed)
+static bool run_write(sd_ioq_t *q, sd_ioq_req_t *r) {
+    lock(q);
+    sd_ioq_chunk_t *c = r->chunks;
+    r->chunks = r->chunks_tail = NULL;
+    unlock(q);
+
+    if (!r->handle && r->status == SD_IO_OK) {
+        r->handle = q->be.write_open(q->be.ctx, r->path, r->append);
+        if (!r->handle) r->status = SD_IO_ERR_IO;
+    }
+    uint32_t done = 0;
+    while (c) {
+        sd_ioq_chunk_t *next = c->next;
+        if (r->status == SD_IO_OK && !r->cancelled) {
+            int32_t n = q->be.write(q->be.ctx, r->handle, c->data, c->len);
+            if (n != (int32_t)c->len) r->status = SD_IO_ERR_IO;
+            else r->len += c->len;
+        }
+        done += c->len;
+        q->be.free(q->be.ctx, c);
+        c = next;
+    }
+
+    lock(q);
+    r->pending -= done;
+    if (r->cancelled) {
+        unlock(q);
+        return true;
+    }
+    if (r->chunks) {
+        enqueue(q, r);
+        unlock(q);
+        return false;
+    }
+    if (!r->closing) {
+        r->state = SD_IOQ_IDLE;
+        unlock(q);
+        return false;
+    }
+    unlock(q);
+    if (r->handle) {
+        if (q->be.write_close(q->be.ctx, r->handle) != 0 && r->status == SD_IO_OK) r->status = SD_IO_ERR_IO;
+        r->handle = NULL;
+    }
+    return true;
+}
+
+bool sd_ioq_work(sd_ioq_t *q) {
+    lock(q);
+    sd_ioq_req_t *r = dequeue(q);
+    if (r) r->state = SD_IOQ_RUNNING;
+    unlock(q);
+    if (!r) return false;
+
+    if (r->cancelled) {
+        retire(q, r);
+        return true;
+    }
+    switch (r->kind) {
+    case SD_IO_READ:
+        run_read(q, r);
+        break;
+    case SD_IO_LIST:
+        run_list(q, r);
+        break;
+    case SD_IO_WRITE:
+        if (!run_write(q, r)) return true;
+        break;
+    }
+    finish(q, r);
+    return true;
+}
+
+// --- Completion thread ---
+
+uint32_t sd_ioq_dispatch(sd_ioq_t *q, uint32_t max) {
+    uint32_t ran = 0;
+    bool wake = false;
+    while (max == 0 || ran < max) {
+        lock(q);
+        sd_ioq_req_t *r = done_pop(q);
+        if (r) r->state = SD_IOQ_DISPATCHING;
+        unlock(q);
+        if (!r) break;
+
+        if (!r->cancelled && r->opts.cb) {
+            sd_io_result_t res = {
+                .id = r->id,
+                .kind = (sd_io_kind_t)r->kind,
+                .status = r->status,
+                .data = r->kind == SD_IO_READ ? r->buf : NULL,
+                .len = r->kind == SD_IO_READ ? r->got : r->len,
+                .file_size = r->file_size,
+                .entries = r->kind == SD_IO_LIST ? r->batch : NULL,
+                .count = r->kind == SD_IO_LIST ? r->count : 0,
+                .more = r->more,
+            };
+            r->opts.cb(&res, r->opts.user);
+            ran++;
+            if (r->kind == SD_IO_READ && r->own_buf && res.data == NULL) {
+                r->buf = NULL;      // the callback kept it
+                r->own_buf = false;
+            }
+        }
+
+        lock(q);
+        if (r->handle) {
+            // Next batch of a listing, or a cancelled one whose directory the worker closes
+            enqueue(q, r);
+            wake = true;
+            unlock(q);
+            continue;
+        }
+        if (r->cancelled) q->stats.cancelled++;
+        else q->stats.completed++;
+        unlock(q);
+        release_buffers(q, r);
+        lock(q);
+        slot_free(r);
+        unlock(q);
+    }
+    if (wake) wake_worker(q);
+    return ran;
+}
+
+void sd_ioq_get_stats(sd_ioq_t *q, sd_io_stats_t *out) {
+    lock(q);
+    *out = q->stats;
+    unlock(q);
+}
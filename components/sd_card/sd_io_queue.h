@@ -0,0 +1,206 @@
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Request queue behind the asynchronous file service (sd_io).
+//   - callers submit reads, directory listings and streaming writes and get an id back at once
+//   - one worker runs them, highest priority first (FIFO within a priority), calling the
+//     backend without the lock held
+//   - results are queued as completions and delivered by sd_ioq_dispatch() on the thread
+//     that owns the callbacks (the LVGL task on the device)
+//   - cancelling a request (or everything of one owner) guarantees its callback never runs
+//     once the cancel returns on the dispatching thread; the worker releases what it held
+// The caller provides the lock and the wake-ups; no IDF dependencies so the whole flow can
+// be driven on the host against an injected-latency backend.
+
+#ifndef SD_IO_MAX_REQUESTS
+#define SD_IO_MAX_REQUESTS      16
+#endif
+#ifndef SD_IO_PATH_MAX
+#define SD_IO_PATH_MAX          128
+#endif
+#ifndef SD_IO_NAME_MAX
+#define SD_IO_NAME_MAX          128
+#endif
+// Directory entries per completion; the next batch is read once this one is dispatched
+#ifndef SD_IO_DIR_BATCH
+#define SD_IO_DIR_BATCH         16
+#endif
+// Bytes a write stream may have queued before sd_ioq_write() refuses more
+#ifndef SD_IO_WRITE_MAX_PENDING
+#define SD_IO_WRITE_MAX_PENDING (64 * 1024)
+#endif
+
+typedef enum {
+    SD_IO_PRIO_HIGH = 0,    // what the user is waiting for (the file they opened)
+    SD_IO_PRIO_NORMAL,      // listings
+    SD_IO_PRIO_LOW,         // thumbnails, metadata, logs
+    SD_IO_PRIO_COUNT,
+} sd_io_prio_t;
+
+typedef enum {
+    SD_IO_READ = 0,
+    SD_IO_LIST,
+    SD_IO_WRITE,
+} sd_io_kind_t;
+
+typedef enum {
+    SD_IO_OK = 0,
+    SD_IO_ERR_NOT_FOUND,
+    SD_IO_ERR_IO,
+    SD_IO_ERR_NO_MEM,
+    SD_IO_ERR_TOO_BIG,
+    SD_IO_ERR_BUSY,         // write stream backlog full; try again later
+    SD_IO_ERR_ARG,
+} sd_io_status_t;
+
+typedef struct {
+    char name[SD_IO_NAME_MAX];
+    uint32_t size;
+    bool is_dir;
+} sd_io_dirent_t;
+
+typedef struct {
+    uint32_t id;
+    sd_io_kind_t kind;
+    sd_io_status_t status;
+    // SD_IO_READ: the bytes read. A buffer the service allocated is freed after the
+    // callback unless the callback takes it by setting `data` to NULL.
+    uint8_t *data;
+    uint32_t len;           // READ: bytes read; WRITE: bytes written
+    uint32_t file_size;     // READ
+    // SD_IO_LIST: one batch of entries; `more` when another batch follows
+    const sd_io_dirent_t *entries;
+    uint32_t count;
+    bool more;
+} sd_io_result_t;
+
+typedef void (*sd_io_cb_t)(sd_io_result_t *res, void *user);
+
+typedef struct {
+    sd_io_prio_t prio;
+    const void *owner;      // for sd_ioq_cancel_owner() (e.g. the view the request belongs to)
+    sd_io_cb_t cb;          // may be NULL
+    void *user;
+} sd_io_opts_t;
+
+typedef struct {
+    // Returns bytes read, < 0 on error (-2: not found)
+    int32_t (*read)(void *ctx, const char *path, uint32_t offset, void *buf, uint32_t len);
+    // File size, < 0 on error (-2: not found)
+    int32_t (*size)(void *ctx, const char *path);
+    void *(*dir_open)(void *ctx, const char *path);
+    bool (*dir_next)(void *ctx, void *dir, sd_io_dirent_t *out);
+    void (*dir_close)(void *ctx, void *dir);
+    void *(*write_open)(void *ctx, const char *path, bool append);
+    int32_t (*write)(void *ctx, void *file, const void *data, uint32_t len);
+    int (*write_close)(void *ctx, void *file);  // 0 on success
+    void *(*alloc)(void *ctx, size_t size);
+    void (*free)(void *ctx, void *p);
+    void *ctx;
+} sd_io_backend_t;
+
+typedef struct {
+    void (*lock)(void *ctx);
+    void (*unlock)(void *ctx);
+    void (*wake_worker)(void *ctx);     // a request was queued
+    void (*notify)(void *ctx);          // completions are waiting for sd_ioq_dispatch()
+    void *ctx;
+} sd_io_os_t;
+
+typedef struct {
+    uint32_t submitted;
+    uint32_t completed;     // callbacks delivered (list batches count once per request)
+    uint32_t cancelled;
+    uint32_t failed;
+    uint32_t rejected;      // no free request slot
+    uint32_t max_depth;     // most requests queued at once
+} sd_io_stats_t;
+
+typedef struct sd_ioq_chunk sd_ioq_chunk_t;
+
+typedef enum {
+    SD_IOQ_FREE = 0,
+    SD_IOQ_QUEUED,
+    SD_IOQ_RUNNING,
+    SD_IOQ_IDLE,            // write stream with nothing to write yet
+    SD_IOQ_DONE,            // in the completion list
+    SD_IOQ_DISPATCHING,
+} sd_ioq_state_t;
+
+typedef struct {
+    uint32_t id;
+    uint8_t gen;
+    uint8_t state;
+    uint8_t kind;
+    uint8_t prio;
+    volatile bool cancelled;
+    bool own_buf;           // `buf` was allocated by the service
+    bool closing;           // write stream: close requested
+    bool more;              // list: another batch follows
+    bool append;            // write stream: append instead of truncating
+    int8_t next;            // queue / completion list link
+    char path[SD_IO_PATH_MAX];
+    uint32_t offset;
+    uint32_t len;           // READ: bytes wanted (0: to the end); WRITE: bytes written
+    uint32_t max_len;       // READ to the end: refuse larger files
+    uint8_t *buf;
+    uint32_t got;
+    uint32_t file_size;
+    sd_io_status_t status;
+    void *handle;           // open directory or write stream
+    sd_io_dirent_t *batch;
+    uint32_t count;
+    sd_ioq_chunk_t *chunks; // write stream backlog
+    sd_ioq_chunk_t *chunks_tail;
+    uint32_t pending;
+    sd_io_opts_t opts;
+} sd_ioq_req_t;
+
+typedef struct {
+    sd_ioq_req_t req[SD_IO_MAX_REQUESTS];
+    int8_t head[SD_IO_PRIO_COUNT];
+    int8_t tail[SD_IO_PRIO_COUNT];
+    int8_t done_head;
+    int8_t done_tail;
+    uint32_t depth;
+    sd_io_backend_t be;
+    sd_io_os_t os;
+    sd_io_stats_t stats;
+} sd_ioq_t;
+
+void sd_ioq_init(sd_ioq_t *q, const sd_io_backend_t *be, const sd_io_os_t *os);
+
+// --- Submission (any thread). Each returns the request id, 0 when no slot is free. ---
+// Read `len` bytes at `offset` into `buf`; `buf` NULL allocates, `len` 0 reads to the end
+// of the file (refusing files over `max_len` when it is non-zero)
+uint32_t sd_ioq_read(sd_ioq_t *q, const char *path, uint32_t offset, uint32_t len, uint32_t max_len,
+                     void *buf, const sd_io_opts_t *opts);
+// Enumerate a directory in batches of SD_IO_DIR_BATCH entries
+uint32_t sd_ioq_list(sd_ioq_t *q, const char *path, const sd_io_opts_t *opts);
+// Write stream: chunks are copied and written in order; the callback runs once, after close
+uint32_t sd_ioq_write_open(sd_ioq_t *q, const char *path, bool append, const sd_io_opts_t *opts);
+sd_io_status_t sd_ioq_write(sd_ioq_t *q, uint32_t stream, const void *data, uint32_t len);
+sd_io_status_t sd_ioq_write_close(sd_ioq_t *q, uint32_t stream);
+
+void sd_ioq_cancel(sd_ioq_t *q, uint32_t id);
+void sd_ioq_cancel_owner(sd_ioq_t *q, const void *owner);
+
+// --- Worker ---
+// Run the highest-priority queued request; false when there was nothing to do
+bool sd_ioq_work(sd_ioq_t *q);
+
+// --- Completion thread ---
+// Deliver up to `max` completions (0: all); returns how many callbacks ran
+uint32_t sd_ioq_dispatch(sd_ioq_t *q, uint32_t max);
+
+void sd_ioq_get_stats(sd_ioq_t *q, sd_io_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
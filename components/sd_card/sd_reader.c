@@ -0,0 +1,210 @@
+#include "sd_reader.h"
+#include "sd_card.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdlib.h>
+
+static const char *TAG = "sd_reader";
+
+#define READER_TASK_PRIO    6       // above the LVGL task; it spends its time blocked on the bus
+#define READER_TASK_CORE    0       // LVGL renders on core 1
+
+struct sd_reader {
+    sd_card_file_t *file;
+    sd_stream_t stream;
+    uint8_t *mem;
+    bool dma_ring;
+    SemaphoreHandle_t lock;
+    SemaphoreHandle_t done;
+    SemaphoreHandle_t filled;   // given after each read, for sd_reader_wait()
+    TaskHandle_t task;
+    volatile bool closing;
+    uint64_t read_us;
+};
+
+static int32_t reader_read(void *ctx, uint32_t offset, void *buf, uint32_t len) {
+    sd_reader_t *r = (sd_reader_t *)ctx;
+    return sd_card_file_read(r->file, offset, buf, len);
+}
+
+// Keeps the ring full; the lock is only held to claim and publish slots, never across a read
+static void reader_task(void *arg) {
+    sd_reader_t *r = (sd_reader_t *)arg;
+    while (!r->closing) {
+        sd_stream_req_t req;
+        xSemaphoreTake(r->lock, portMAX_DELAY);
+        bool claimed = sd_stream_fill_begin(&r->stream, &req);
+        xSemaphoreGive(r->lock);
+        if (!claimed) {
+            // Ring full (or stream stopped): wait for the consumer to free a slot
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+            continue;
+        }
+        int64_t t0 = esp_timer_get_time();
+        int32_t got = reader_read(r, req.offset, req.buf, req.len);
+        int64_t dt = esp_timer_get_time() - t0;
+        xSemaphoreTake(r->lock, portMAX_DELAY);
+        sd_stream_fill_end(&r->stream, &req, got);
+        r->read_us += (uint64_t)dt;
+        xSemaphoreGive(r->lock);
+        xSemaphoreGive(r->filled);
+        if (got < 0) ESP_LOGE(TAG, "Read failed at %lu", (unsigned long)req.offset);
+    }
+    xSemaphoreGive(r->done);
+    vTaskDelete(NULL);
+}
+
+// One read per slot. FATFS splits reads at cluster boundaries, so through it a slot is a
+// cluster when that fits the SPI transfer limit, else a power-of-two part of it; a contiguous
+// file read raw takes the largest slot regardless of the cluster size.
+static uint32_t reader_slot_size(bool raw) {
+    uint32_t slot = raw ? SD_READER_MAX_SLOT : sd_card_get_cluster_size();
+    if (slot < SD_READER_MIN_SLOT) slot = SD_READER_MIN_SLOT;
+    while (slot > SD_READER_MAX_SLOT || slot > SD_READER_RING_SIZE / 2) slot /= 2;
+    return slot;
+}
+
+// Room for `ahead` bytes past a chunk that starts mid-slot, in whole slots
+static uint32_t reader_ring_size(uint32_t slot, uint32_t ahead) {
+    uint32_t max = SD_READER_RING_SIZE / slot * slot;
+    if (!ahead || ahead >= max) return max;
+    uint32_t ring = (ahead + slot - 1) / slot * slot + slot;
+    if (ring < 2 * slot) ring = 2 * slot;
+    return ring < max ? ring : max;
+}
+
+esp_err_t sd_reader_open(const char *path, uint32_t start, uint32_t end, bool loop, uint32_t ahead,
+                         sd_reader_t **out) {
+    if (!path || !out || end <= start) return ESP_ERR_INVALID_ARG;
+    *out = NULL;
+
+    sd_reader_t *r = (sd_reader_t *)calloc(1, sizeof(sd_reader_t));
+    if (!r) return ESP_ERR_NO_MEM;
+    esp_err_t ret = sd_card_file_open(path, &r->file);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open %s (%s)", path, esp_err_to_name(ret));
+        free(r);
+        return ret;
+    }
+
+    uint32_t slot = reader_slot_size(sd_card_file_is_raw(r->file));
+    uint32_t ring = reader_ring_size(slot, ahead);
+    size_t mem_size = ring + SD_READER_MAX_CHUNK;
+    r->mem = (uint8_t *)heap_caps_aligned_alloc(4, mem_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    r->dma_ring = r->mem != NULL;
+    if (!r->mem) {
+        ESP_LOGW(TAG, "No internal DMA memory for the %u byte ring, using PSRAM (single-block reads)", (unsigned)mem_size);
+        r->mem = (uint8_t *)heap_caps_aligned_alloc(4, mem_size, MALLOC_CAP_SPIRAM);
+    }
+    ret = ESP_ERR_NO_MEM;
+    r->lock = xSemaphoreCreateMutex();
+    r->done = xSemaphoreCreateBinary();
+    r->filled = xSemaphoreCreateBinary();
+    if (!r->mem || !r->lock || !r->done || !r->filled) goto fail;
+
+    if (!sd_stream_init(&r->stream, r->mem, ring, slot, SD_READER_MAX_CHUNK, reader_read, r)) {
+        ret = ESP_ERR_INVALID_SIZE;
+        goto fail;
+    }
+    sd_stream_open(&r->stream, start, end, loop);
+
+    if (xTaskCreatePinnedToCore(reader_task, "sd_reader", 4096, r, READER_TASK_PRIO, &r->task, READER_TASK_CORE) != pdPASS) {
+        goto fail;
+    }
+    ESP_LOGI(TAG, "Streaming %s [%lu, %lu): %lu KB ring (%s), %lu KB reads %s",
+             path, (unsigned long)start, (unsigned long)end, (unsigned long)(ring / 1024),
+             r->dma_ring ? "DMA" : "PSRAM", (unsigned long)(slot / 1024),
+             sd_card_file_is_raw(r->file) ? "raw (contiguous)" : "through FATFS (fragmented)");
+    *out = r;
+    return ESP_OK;
+
+fail:
+    sd_card_file_close(r->file);
+    if (r->lock) vSemaphoreDelete(r->lock);
+    if (r->done) vSemaphoreDelete(r->done);
+    if (r->filled) vSemaphoreDelete(r->filled);
+    heap_caps_free(r->mem);
+    free(r);
+    return ret;
+}
+
+sd_stream_res_t sd_reader_next(sd_reader_t *r, sd_stream_chunk_t *chunk) {
+    if (!r) return SD_STREAM_ERR;
+    xSemaphoreTake(r->lock, portMAX_DELAY);
+    sd_stream_res_t res = sd_stream_next(&r->stream, chunk);
+    xSemaphoreGive(r->lock);
+    // The previous chunk was released: there may be room for the next read
+    xTaskNotifyGive(r->task);
+    return res;
+}
+
+sd_stream_res_t sd_reader_next_part(sd_reader_t *r, sd_stream_chunk_t *chunk, uint32_t head) {
+    if (!r) return SD_STREAM_ERR;
+    xSemaphoreTake(r->lock, portMAX_DELAY);
+    sd_stream_res_t res = sd_stream_next_part(&r->stream, chunk, head);
+    xSemaphoreGive(r->lock);
+    xTaskNotifyGive(r->task);
+    return res;
+}
+
+sd_stream_res_t sd_reader_more(sd_reader_t *r, const uint8_t **data, uint32_t *len) {
+    if (!r) return SD_STREAM_ERR;
+    xSemaphoreTake(r->lock, portMAX_DELAY);
+    sd_stream_res_t res = sd_stream_more(&r->stream, data, len);
+    xSemaphoreGive(r->lock);
+    // The part before this one was released
+    xTaskNotifyGive(r->task);
+    return res;
+}
+
+void sd_reader_wait(sd_reader_t *r, uint32_t timeout_ms) {
+    if (!r) return;
+    xSemaphoreTake(r->filled, pdMS_TO_TICKS(timeout_ms));
+}
+
+void sd_reader_release(sd_reader_t *r) {
+    if (!r) return;
+    xSemaphoreTake(r->lock, portMAX_DELAY);
+    sd_stream_release(&r->stream);
+    xSemaphoreGive(r->lock);
+    xTaskNotifyGive(r->task);
+}
+
+void sd_reader_seek(sd_reader_t *r, uint32_t pos) {
+    if (!r) return;
+    xSemaphoreTake(r->lock, portMAX_DELAY);
+    sd_stream_seek(&r->stream, pos);
+    xSemaphoreGive(r->lock);
+    xTaskNotifyGive(r->task);
+}
+
+void sd_reader_get_stats(sd_reader_t *r, sd_reader_stats_t *stats) {
+    if (!r || !stats) return;
+    xSemaphoreTake(r->lock, portMAX_DELAY);
+    sd_stream_get_stats(&r->stream, &stats->stream);
+    stats->read_us = r->read_us;
+    stats->slot_size = r->stream.slot_size;
+    stats->ring_size = r->stream.ring_size;
+    xSemaphoreGive(r->lock);
+    stats->dma_ring = r->dma_ring;
+    stats->raw = sd_card_file_is_raw(r->file);
+    // bytes per ms is KB/s (1000-byte KB)
+    stats->kb_per_s = stats->read_us ? (uint32_t)(stats->stream.bytes_read * 1000 / stats->read_us) : 0;
+}
+
+void sd_reader_close(sd_reader_t *r) {
+    if (!r) return;
+    r->closing = true;
+    xTaskNotifyGive(r->task);
+    xSemaphoreTake(r->done, portMAX_DELAY);
+    sd_card_file_close(r->file);
+    vSemaphoreDelete(r->lock);
+    vSemaphoreDelete(r->done);
+    vSemaphoreDelete(r->filled);
+    heap_caps_free(r->mem);
+    free(r);
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include "esp_err.h"
+#include "sd_stream.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Largest ring and the zero-copy chunk limit. The ring is DMA-capable internal RAM so FATFS
+// reads straight into it with multi-block transfers; it falls back to PSRAM if that runs
+// out. Chunks read in parts only need their first part to fit the limit.
+#ifndef SD_READER_RING_SIZE
+#define SD_READER_RING_SIZE     (64 * 1024)
+#endif
+#ifndef SD_READER_MAX_CHUNK
+#define SD_READER_MAX_CHUNK     (4 * 1024)
+#endif
+// Largest single read: the SPI bus max_transfer_sz
+#ifndef SD_READER_MAX_SLOT
+#define SD_READER_MAX_SLOT      (32 * 1024)
+#endif
+#define SD_READER_MIN_SLOT      4096
+
+typedef struct sd_reader sd_reader_t;
+
+typedef struct {
+    sd_stream_stats_t stream;
+    uint64_t read_us;           // time the I/O task spent in reads
+    uint32_t kb_per_s;          // sustained read throughput while reading (1000-byte KB)
+    uint32_t slot_size;
+    uint32_t ring_size;
+    bool dma_ring;              // ring is in DMA-capable internal RAM
+    bool raw;                   // contiguous file, read below FATFS
+} sd_reader_stats_t;
+
+/**
+ * @brief Open `path` and stream the RIFF chunks in [start, end) from a dedicated I/O task
+ * that reads ahead of the consumer in cluster-aligned slots (raw sector reads when the file
+ * is contiguous, see sd_card_file_open()).
+ * @param loop Continue at `start` after `end` (looping playback)
+ * @param ahead Bytes to read ahead of the chunk being consumed, e.g. the largest chunk as
+ * the file suggests; the ring is that plus a slot (0 or too much: SD_READER_RING_SIZE)
+ */
+esp_err_t sd_reader_open(const char *path, uint32_t start, uint32_t end, bool loop, uint32_t ahead,
+                         sd_reader_t **out);
+
+/**
+ * @brief Next chunk, zero-copy. Never blocks: SD_STREAM_AGAIN when the I/O task has not
+ * read it yet. The data stays valid until released, the next call, a seek or close.
+ */
+sd_stream_res_t sd_reader_next(sd_reader_t *r, sd_stream_chunk_t *chunk);
+
+/**
+ * @brief Next chunk in parts (see sd_stream_next_part()): once its first `head` bytes are
+ * read. Never blocks.
+ */
+sd_stream_res_t sd_reader_next_part(sd_reader_t *r, sd_stream_chunk_t *chunk, uint32_t head);
+
+/**
+ * @brief Next part of that chunk, the one before released (see sd_stream_more()). Never
+ * blocks: wait with sd_reader_wait() on SD_STREAM_AGAIN.
+ */
+sd_stream_res_t sd_reader_more(sd_reader_t *r, const uint8_t **data, uint32_t *len);
+
+/**
+ * @brief Block until the I/O task has read more (or `timeout_ms`), for a consumer task
+ * that got SD_STREAM_AGAIN
+ */
+void sd_reader_wait(sd_reader_t *r, uint32_t timeout_ms);
+
+/**
+ * @brief Hand the last chunk back once it is decoded, so the I/O task can refill its space
+ * while the consumer waits for its next frame
+ */
+void sd_reader_release(sd_reader_t *r);
+
+/**
+ * @brief Drop the read-ahead and continue at file offset `pos`
+ */
+void sd_reader_seek(sd_reader_t *r, uint32_t pos);
+
+void sd_reader_get_stats(sd_reader_t *r, sd_reader_stats_t *stats);
+
+/**
+ * @brief Stop the I/O task (waits for an in-flight read) and free everything
+ */
+void sd_reader_close(sd_reader_t *r);
+
+#ifdef __cplusplus
+}
+#endif
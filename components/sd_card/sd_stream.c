@@ -0,0 +1,234 @@
+#include "sd_stream.h"
+#include <string.h>
+
+#define HDR_SIZE    8
+
+uint32_t sd_stream_max_chunk(const sd_stream_t *s) {
+    // The producer must still be able to fill around a chunk that starts mid-slot
+    uint32_t lim = s->ring_size - s->slot_size;
+    return lim < s->guard ? lim : s->guard;
+}
+
+bool sd_stream_init(sd_stream_t *s, void *mem, uint32_t ring_size, uint32_t slot_size, uint32_t guard,
+                    sd_stream_read_fn read, void *read_ctx) {
+    memset(s, 0, sizeof(*s));
+    if (!mem || !read || slot_size == 0 || (slot_size & 3) || ring_size < 2 * slot_size ||
+        ring_size % slot_size || guard < HDR_SIZE) {
+        return false;
+    }
+    s->ring = (uint8_t *)mem;
+    s->ring_size = ring_size;
+    s->slot_size = slot_size;
+    s->guard = guard;
+    s->read = read;
+    s->read_ctx = read_ctx;
+    s->eof = true;  // nothing to read until a range is opened
+    return true;
+}
+
+// File offset of virtual position `v`
+static uint32_t file_of(const sd_stream_t *s, uint64_t v) {
+    return s->origin + (uint32_t)(s->loop ? v % s->pass_len : v);
+}
+
+static void reset(sd_stream_t *s, uint32_t pos) {
+    uint64_t v = pos - s->origin;
+    s->head = v - v % s->slot_size;
+    s->tail = v;
+    s->cursor = v;
+    s->part = v;
+    s->part_end = v;
+    s->gen++;
+    s->eof = false;
+    s->waiting = false;
+}
+
+void sd_stream_open(sd_stream_t *s, uint32_t start, uint32_t end, bool loop) {
+    s->origin = start - start % s->slot_size;
+    s->start = start;
+    s->end = end;
+    s->loop = loop;
+    s->pass_len = end > s->origin ? (end - s->origin + s->slot_size - 1) / s->slot_size * s->slot_size : s->slot_size;
+    s->failed = end < start + HDR_SIZE;
+    reset(s, start);
+}
+
+void sd_stream_seek(sd_stream_t *s, uint32_t pos) {
+    if (pos < s->start) pos = s->start;
+    if (pos > s->end) pos = s->end;
+    reset(s, pos);
+    s->stats.seeks++;
+}
+
+bool sd_stream_fill_begin(sd_stream_t *s, sd_stream_req_t *req) {
+    if (s->failed || s->eof) return false;
+    uint64_t tail_slot = s->tail - s->tail % s->slot_size;
+    if (s->head + s->slot_size > tail_slot + s->ring_size) return false;
+    uint32_t off = file_of(s, s->head);
+    if (off >= s->end) {
+        s->eof = true;
+        return false;
+    }
+    req->buf = s->ring + s->head % s->ring_size;
+    req->offset = off;
+    req->len = s->end - off < s->slot_size ? s->end - off : s->slot_size;
+    req->vpos = s->head;
+    req->gen = s->gen;
+    return true;
+}
+
+void sd_stream_fill_end(sd_stream_t *s, const sd_stream_req_t *req, int32_t got) {
+    if (req->gen != s->gen) return;     // a seek dropped this slot
+    if (got < 0 || (uint32_t)got < req->len) {
+        s->failed = true;
+        s->stats.errors++;
+        return;
+    }
+    s->head = req->vpos + s->slot_size;
+    s->stats.bytes_read += (uint32_t)got;
+    s->stats.reads++;
+}
+
+bool sd_stream_fill(sd_stream_t *s) {
+    sd_stream_req_t req;
+    if (!sd_stream_fill_begin(s, &req)) return false;
+    sd_stream_fill_end(s, &req, s->read(s->read_ctx, req.offset, req.buf, req.len));
+    return true;
+}
+
+uint32_t sd_stream_buffered(const sd_stream_t *s) {
+    return s->head > s->cursor ? (uint32_t)(s->head - s->cursor) : 0;
+}
+
+static uint32_t ring_u32(const sd_stream_t *s, uint64_t v) {
+    uint8_t b[4];
+    for (int i = 0; i < 4; i++) b[i] = s->ring[(v + i) % s->ring_size];
+    return (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+}
+
+// Continue at the start of the range (looping) or report the end
+static bool end_of_range(sd_stream_t *s) {
+    if (!s->loop) return false;
+    uint64_t pass = s->cursor / s->pass_len;
+    s->cursor = (pass + 1) * s->pass_len + (s->start - s->origin);
+    s->tail = s->cursor;
+    s->stats.loops++;
+    return true;
+}
+
+// The next chunk: whole (`part` false), or once `head` bytes of it are in
+static sd_stream_res_t next_chunk(sd_stream_t *s, sd_stream_chunk_t *out, bool part, uint32_t head) {
+    s->tail = s->cursor;    // release the previous chunk
+    s->part = s->cursor;
+    s->part_end = s->cursor;
+    for (int guard = 0; guard < 4; guard++) {
+        if (s->failed) return SD_STREAM_ERR;
+        uint32_t off = file_of(s, s->cursor);
+        if (off + HDR_SIZE > s->end) {
+            if (end_of_range(s)) continue;
+            return SD_STREAM_END;
+        }
+        if (s->head < s->cursor + HDR_SIZE) break;
+
+        uint32_t id = ring_u32(s, s->cursor);
+        uint32_t size = ring_u32(s, s->cursor + 4);
+        if (size > s->end - off - HDR_SIZE) {
+            // Runs past the range: truncated file or garbage
+            s->stats.errors++;
+            if (end_of_range(s)) continue;
+            return SD_STREAM_END;
+        }
+        uint32_t need = HDR_SIZE + size;
+        uint32_t total = need + (size & 1);
+        uint32_t avail = size;
+        if (part) {
+            // The first part has to fit the guard when it wraps
+            uint32_t lim = sd_stream_max_chunk(s) - HDR_SIZE;
+            if (head > lim) head = lim;
+            avail = size < head ? size : head;
+            need = HDR_SIZE + avail;
+        } else if (need > sd_stream_max_chunk(s)) {
+            s->stats.too_big++;
+            reset(s, off + total < s->end ? off + total : s->end);
+            continue;
+        }
+        if (s->head < s->cursor + need) break;
+
+        uint32_t r = (uint32_t)(s->cursor % s->ring_size);
+        if (part && avail < size) {
+            // Take what else is in and contiguous
+            uint64_t in = s->head - s->cursor - HDR_SIZE;
+            uint32_t more = (uint32_t)(in < size ? in : size);
+            if (r + HDR_SIZE + more > s->ring_size) more = r + need >= s->ring_size ? avail : s->ring_size - r - HDR_SIZE;
+            if (more > avail) avail = more;
+            need = HDR_SIZE + avail;
+        }
+        if (r + need > s->ring_size) {
+            uint32_t over = r + need - s->ring_size;
+            memcpy(s->ring + s->ring_size, s->ring, over);
+            s->stats.wrap_copies++;
+            s->stats.wrap_bytes += over;
+        }
+        out->data = s->ring + r + HDR_SIZE;
+        out->id = id;
+        out->size = size;
+        out->offset = off + HDR_SIZE;
+        out->avail = avail;
+        s->part = s->cursor + HDR_SIZE + avail;
+        s->part_end = s->cursor + HDR_SIZE + size;
+        s->cursor += total;
+        s->waiting = false;
+        s->stats.chunks++;
+        return SD_STREAM_OK;
+    }
+
+    // Not buffered yet
+    if (s->eof && s->head <= s->cursor) return SD_STREAM_END;
+    if (!s->waiting) {
+        s->waiting = true;
+        s->stats.stalls++;
+    }
+    return SD_STREAM_AGAIN;
+}
+
+sd_stream_res_t sd_stream_next(sd_stream_t *s, sd_stream_chunk_t *out) {
+    return next_chunk(s, out, false, 0);
+}
+
+sd_stream_res_t sd_stream_next_part(sd_stream_t *s, sd_stream_chunk_t *out, uint32_t head) {
+    return next_chunk(s, out, true, head);
+}
+
+sd_stream_res_t sd_stream_more(sd_stream_t *s, const uint8_t **data, uint32_t *len) {
+    if (s->part >= s->part_end) return SD_STREAM_END;
+    if (s->failed) return SD_STREAM_ERR;
+    // The consumer is done with what it had: the producer may refill it
+    s->tail = s->part;
+    if (s->head <= s->part) {
+        if (!s->waiting) {
+            s->waiting = true;
+            s->stats.part_stalls++;
+        }
+        return SD_STREAM_AGAIN;
+    }
+    uint32_t r = (uint32_t)(s->part % s->ring_size);
+    uint64_t n = s->head - s->part;
+    if (n > s->part_end - s->part) n = s->part_end - s->part;
+    if (n > s->ring_size - r) n = s->ring_size - r;
+    *data = s->ring + r;
+    *len = (uint32_t)n;
+    s->part += n;
+    s->waiting = false;
+    s->stats.parts++;
+    return SD_STREAM_OK;
+}
+
+void sd_stream_release(sd_stream_t *s) {
+    s->tail = s->cursor;
+    s->part = s->part_end;
+    s->waiting = false;
+}
+
+void sd_stream_get_stats(const sd_stream_t *s, sd_stream_stats_t *out) {
+    *out = s->stats;
+}
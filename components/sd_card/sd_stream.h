@@ -0,0 +1,139 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Read-ahead ring for streaming RIFF chunks (AVI `movi` data) off the SD card.
+//   - the producer (an I/O task) reads whole slots: `slot_size` bytes at slot-aligned file
+//     offsets, so FATFS turns each read into one multi-block transfer straight into the
+//     ring (the ring must be DMA-capable memory for that)
+//   - the consumer gets each chunk as a pointer into the ring (no copy); a chunk that wraps
+//     past the end of the ring has its wrapped part copied into a guard area behind it
+//   - a looping range continues at the start once the producer reaches the end, so
+//     playback loops without a refill stall
+//   - or a chunk is handed out in parts as they are read (sd_stream_next_part() and
+//     sd_stream_more()): the consumer starts on it before it is all in, and the space of
+//     each part is refilled once the next is asked for, so a chunk may be larger than the
+//     ring
+// No locking inside: the caller serializes calls, but the backend read itself runs
+// between sd_stream_fill_begin() and sd_stream_fill_end() without the lock held. No IDF
+// dependencies so it can be exercised on the host against a file.
+
+typedef enum {
+    SD_STREAM_OK = 0,
+    SD_STREAM_AGAIN,        // the next chunk is not buffered yet
+    SD_STREAM_END,          // end of a non-looping range
+    SD_STREAM_ERR,          // read error or malformed chunk; the stream has stopped
+} sd_stream_res_t;
+
+// Backend: read `len` bytes at file offset `offset`; returns bytes read or < 0 on error
+typedef int32_t (*sd_stream_read_fn)(void *ctx, uint32_t offset, void *buf, uint32_t len);
+
+typedef struct {
+    const uint8_t *data;    // payload, valid until released, the next sd_stream_next() or a seek
+    uint32_t id;            // FourCC as read (little-endian)
+    uint32_t size;          // payload bytes
+    uint32_t offset;        // file offset of the payload
+    uint32_t avail;         // bytes at `data`: `size`, or the first part from sd_stream_next_part()
+} sd_stream_chunk_t;
+
+typedef struct {
+    uint64_t bytes_read;
+    uint32_t reads;
+    uint32_t chunks;
+    uint32_t stalls;        // chunks that were not buffered when first asked for
+    uint32_t wrap_copies;   // chunks that wrapped the ring end
+    uint64_t wrap_bytes;
+    uint32_t too_big;       // chunks larger than the zero-copy limit, skipped
+    uint32_t parts;         // handed out by sd_stream_more()
+    uint32_t part_stalls;   // sd_stream_more() calls that found nothing read yet
+    uint32_t errors;
+    uint32_t loops;
+    uint32_t seeks;
+} sd_stream_stats_t;
+
+typedef struct {
+    uint8_t *ring;          // ring_size + guard bytes
+    uint32_t ring_size;     // multiple of slot_size
+    uint32_t slot_size;
+    uint32_t guard;
+    sd_stream_read_fn read;
+    void *read_ctx;
+    // Range: virtual position 0 is `origin` (slot-aligned); each pass of a looping range
+    // takes `pass_len` (rounded up to a slot) of virtual space
+    uint32_t origin;
+    uint32_t start;
+    uint32_t end;
+    uint32_t pass_len;
+    bool loop;
+    // Virtual positions
+    uint64_t head;          // producer: next slot to read
+    uint64_t tail;          // consumer: start of the chunk it still holds
+    uint64_t cursor;        // consumer: next chunk header
+    uint64_t part;          // consumer: next byte of the chunk to hand out in parts
+    uint64_t part_end;      // consumer: end of its payload
+    uint32_t gen;           // bumped on seek; in-flight reads of an older generation are dropped
+    bool eof;               // producer reached the end of a non-looping range
+    bool failed;
+    bool waiting;           // the current chunk has already been counted as a stall
+    sd_stream_stats_t stats;
+} sd_stream_t;
+
+typedef struct {
+    uint8_t *buf;
+    uint32_t offset;
+    uint32_t len;
+    uint64_t vpos;
+    uint32_t gen;
+} sd_stream_req_t;
+
+// Largest chunk (header + payload) that can be handed out without copying it
+uint32_t sd_stream_max_chunk(const sd_stream_t *s);
+
+/**
+ * @brief Set up the ring. `mem` holds `ring_size + guard` bytes; `ring_size` must be a
+ * multiple of `slot_size`, which must be a multiple of 4.
+ */
+bool sd_stream_init(sd_stream_t *s, void *mem, uint32_t ring_size, uint32_t slot_size, uint32_t guard,
+                    sd_stream_read_fn read, void *read_ctx);
+
+// Stream chunks from [start, end); with `loop` the stream wraps back to `start`
+void sd_stream_open(sd_stream_t *s, uint32_t start, uint32_t end, bool loop);
+// Drop everything buffered and continue at file offset `pos` (inside the range)
+void sd_stream_seek(sd_stream_t *s, uint32_t pos);
+
+// --- Producer ---
+// Claim the next free slot; false when the ring is full or the range is done
+bool sd_stream_fill_begin(sd_stream_t *s, sd_stream_req_t *req);
+// Publish a finished read (`got` bytes, < 0 on error); dropped if a seek happened meanwhile
+void sd_stream_fill_end(sd_stream_t *s, const sd_stream_req_t *req, int32_t got);
+// begin + backend read + end in one call (single-threaded use)
+bool sd_stream_fill(sd_stream_t *s);
+// Bytes buffered ahead of the consumer
+uint32_t sd_stream_buffered(const sd_stream_t *s);
+
+// --- Consumer ---
+// Release the previous chunk and return the next one
+sd_stream_res_t sd_stream_next(sd_stream_t *s, sd_stream_chunk_t *out);
+/**
+ * @brief Release the previous chunk and return the next one as soon as its first `head`
+ * bytes are buffered (all of it if smaller; at most the zero-copy limit less 8), with as
+ * much more as is buffered and contiguous. Chunks of any size.
+ */
+sd_stream_res_t sd_stream_next_part(sd_stream_t *s, sd_stream_chunk_t *out, uint32_t head);
+/**
+ * @brief Next part of the chunk from sd_stream_next_part(), the part before it released
+ * @return SD_STREAM_AGAIN until more is read, SD_STREAM_END after its last byte
+ */
+sd_stream_res_t sd_stream_more(sd_stream_t *s, const uint8_t **data, uint32_t *len);
+// Release the current chunk early (once it has been decoded) so its space can be refilled
+void sd_stream_release(sd_stream_t *s);
+
+void sd_stream_get_stats(const sd_stream_t *s, sd_stream_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,1538 @@
+// Host-side test for the SD read-ahead stream and the async file service.
+// Stream, using the sample AVIs in 4_sd_card/ as a file-backed block device:
+//  - every chunk handed out (zero-copy, across ring wraps, loops and seeks) matches the file,
+//    also when handed out in parts through a ring smaller than the largest chunk
+//  - playback of each sample at its own frame rate against an SD-over-SPI timing model:
+//    sustained read throughput and stalls with the I/O task reading ahead, compared with
+//    the old per-frame fseek/fread on the LVGL task
+// Async service, against an in-memory file system with injected latency:
+//  - priorities, directory batches, streaming writes, cancellation (no callback after cancel,
+//    nothing leaked)
+//  - a UI thread at 60 fps next to a worker thread: the UI's calls never wait on a read
+// Contiguous-file fast path, against FAT16 and FAT32 image files holding the sample media:
+//  - cluster-chain walk tells contiguous files from a fragmented one; raw sector reads
+//    (aligned or not, direct or through the bounce buffer) match the files
+//  - read throughput of the raw path against FATFS for playback reads and whole-file loads
+//
+// Run from the repository root:
+// gcc -std=gnu11 -O2 -Wall -pthread -I components/sd_card -o /tmp/sd_card_host_test components/sd_card/test/host_test.c components/sd_card/sd_stream.c components/sd_card/sd_io_queue.c components/sd_card/sd_fat_map.c
+// /tmp/sd_card_host_test
+
+#include <ctype.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "sd_stream.h"
+#include "sd_io_queue.h"
+#include "sd_fat_map.h"
+
+static int s_failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); s_failures++; } \
+} while (0)
+
+static const char *s_samples[] = {
+    "circletriangle", "eye", "fallingcube", "hearttunnel", "pulpfictiondance",
+    "redplasma", "spacetime", "starspin", "waterrings",
+};
+
+typedef struct {
+    uint8_t *data;
+    uint32_t size;
+    uint32_t movi_start;    // first chunk header inside the movi LIST
+    uint32_t movi_end;      // end of the movi LIST
+    uint32_t usec_per_frame;
+} avi_file_t;
+
+static uint32_t le32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static bool avi_load(const char *name, avi_file_t *a) {
+    char path[128];
+    snprintf(path, sizeof(path), "4_sd_card/%s.avi", name);
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    fseek(f, 0, SEEK_END);
+    a->size = (uint32_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    a->data = malloc(a->size);
+    bool ok = a->data && fread(a->data, 1, a->size, f) == a->size;
+    fclose(f);
+    if (!ok) return false;
+    a->movi_start = a->movi_end = 0;
+    a->usec_per_frame = 66666;
+    for (uint32_t p = 12; p + 12 <= a->size; ) {
+        uint32_t id = le32(a->data + p), size = le32(a->data + p + 4);
+        if (id == 0x5453494C && le32(a->data + p + 8) == 0x6C726468) {         // LIST hdrl
+            if (le32(a->data + p + 12) == 0x68697661) a->usec_per_frame = le32(a->data + p + 20);  // avih
+        }
+        if (id == 0x5453494C && le32(a->data + p + 8) == 0x69766F6D) {         // LIST movi
+            a->movi_start = p + 12;
+            a->movi_end = p + 8 + size;
+            break;
+        }
+        p += 8 + size + (size & 1);
+    }
+    return a->movi_start != 0;
+}
+
+// --- File-backed block device with an SD-over-SPI timing model ---
+// 20 MHz SPI: a 512-byte block takes ~205 us on the wire plus the data token and the card's
+// access gap. Each command costs its own round trip; multi-block reads end with CMD12.
+// FATFS reads whole sectors straight into the caller's buffer (one multi-block command per
+// cluster) only if it is DMA-capable; otherwise it reads one sector at a time through a
+// bounce buffer. Partial sectors always go through its one-sector window.
+#define SPI_BLOCK_US    225
+#define SPI_CMD_US      150
+#define SPI_STOP_US     50
+#define VFS_CALL_US     30      // VFS + FATFS bookkeeping per read call
+#define SECTOR          512
+#define CLUSTER         (16 * 1024)
+
+typedef struct {
+    const avi_file_t *avi;
+    uint64_t busy_us;       // modeled bus time
+    uint32_t commands;
+} blockdev_t;
+
+static uint32_t cost_single(blockdev_t *d, uint32_t blocks) {
+    d->commands += blocks;
+    return blocks * (SPI_CMD_US + SPI_BLOCK_US);
+}
+
+static uint32_t cost_multi(blockdev_t *d, uint32_t blocks) {
+    d->commands++;
+    return SPI_CMD_US + blocks * SPI_BLOCK_US + SPI_STOP_US;
+}
+
+// Modeled duration of a FATFS read of [off, off + len) into a DMA-capable buffer or not;
+// `window` tracks the sector cached in FATFS's window
+static uint32_t fat_read_cost(blockdev_t *d, uint32_t off, uint32_t len, bool dma, int64_t *window) {
+    uint32_t us = VFS_CALL_US;
+    uint32_t end = off + len;
+    while (off < end) {
+        uint32_t sector = off / SECTOR;
+        uint32_t in_sector = off % SECTOR;
+        if (in_sector || end - off < SECTOR) {
+            if (*window != sector) us += cost_single(d, 1);
+            *window = sector;
+            off += (end - off < SECTOR - in_sector) ? end - off : SECTOR - in_sector;
+            continue;
+        }
+        // Whole sectors up to the end of the cluster
+        uint32_t to_cluster = CLUSTER - off % CLUSTER;
+        uint32_t n = ((end - off) < to_cluster ? (end - off) : to_cluster) / SECTOR;
+        us += dma ? cost_multi(d, n) : cost_single(d, n);
+        off += n * SECTOR;
+    }
+    d->busy_us += us;
+    return us;
+}
+
+static int32_t blockdev_read(void *ctx, uint32_t offset, void *buf, uint32_t len) {
+    blockdev_t *d = (blockdev_t *)ctx;
+    if (offset >= d->avi->size) return 0;
+    if (len > d->avi->size - offset) len = d->avi->size - offset;
+    memcpy(buf, d->avi->data + offset, len);
+    return (int32_t)len;
+}
+
+static bool is_video(uint32_t id) {
+    return (id & 0xFFFF0000) == 0x63640000;     // "##dc"
+}
+
+// --- Correctness ---
+
+// Walk the chunks of the movi list directly from the file
+static uint32_t count_chunks(const avi_file_t *a, uint64_t *payload_bytes) {
+    uint32_t n = 0;
+    if (payload_bytes) *payload_bytes = 0;
+    for (uint32_t p = a->movi_start; p + 8 <= a->movi_end; ) {
+        uint32_t size = le32(a->data + p + 4);
+        if (p + 8 + size > a->movi_end) break;
+        if (payload_bytes) *payload_bytes += size;
+        n++;
+        p += 8 + size + (size & 1);
+    }
+    return n;
+}
+
+static void test_stream_matches_file(void) {
+    static const struct { uint32_t ring, slot, guard; } cfg[] = {
+        {64 * 1024, 16 * 1024, 32 * 1024},
+        {40 * 1024, 4096, 36 * 1024},      // small ring: wraps on most frames
+        {96 * 1024, 32 * 1024, 32 * 1024},
+    };
+    uint32_t wraps = 0;
+    for (size_t c = 0; c < sizeof(cfg) / sizeof(cfg[0]); c++) {
+        for (size_t i = 0; i < sizeof(s_samples) / sizeof(s_samples[0]); i++) {
+            avi_file_t a;
+            if (!avi_load(s_samples[i], &a)) { CHECK(!"sample missing"); continue; }
+            blockdev_t dev = {.avi = &a};
+            sd_stream_t s;
+            uint8_t *mem = malloc(cfg[c].ring + cfg[c].guard);
+            CHECK(sd_stream_init(&s, mem, cfg[c].ring, cfg[c].slot, cfg[c].guard, blockdev_read, &dev));
+            sd_stream_open(&s, a.movi_start, a.movi_end, true);
+
+            // Two and a half passes, filling a slot between chunks
+            uint32_t per_pass = count_chunks(&a, NULL);
+            uint32_t want = per_pass * 5 / 2, got = 0, mismatches = 0;
+            uint32_t expect = a.movi_start;
+            for (int guard = 0; got < want && guard < 100000; guard++) {
+                sd_stream_chunk_t ch;
+                sd_stream_res_t res = sd_stream_next(&s, &ch);
+                if (res == SD_STREAM_AGAIN) {
+                    sd_stream_fill(&s);
+                    continue;
+                }
+                CHECK(res == SD_STREAM_OK);
+                if (res != SD_STREAM_OK) break;
+                if (ch.offset != expect + 8 || memcmp(ch.data, a.data + ch.offset, ch.size) != 0) mismatches++;
+                expect = ch.offset + ch.size + (ch.size & 1);
+                if (expect + 8 > a.movi_end) expect = a.movi_start;
+                got++;
+                if (got % 3 == 0) sd_stream_fill(&s);
+            }
+            sd_stream_stats_t st;
+            sd_stream_get_stats(&s, &st);
+            CHECK(got == want);
+            CHECK(mismatches == 0);
+            CHECK(st.loops == 2);
+            CHECK(st.errors == 0 && st.too_big == 0);
+            wraps += st.wrap_copies;
+            free(mem);
+            free(a.data);
+        }
+    }
+    CHECK(wraps > 0);
+}
+
+static void test_seek_and_end(void) {
+    avi_file_t a;
+    if (!avi_load("eye", &a)) { CHECK(!"sample missing"); return; }
+    blockdev_t dev = {.avi = &a};
+    sd_stream_t s;
+    const uint32_t ring = 64 * 1024, slot = 16 * 1024, guard = 32 * 1024;
+    uint8_t *mem = malloc(ring + guard);
+    CHECK(sd_stream_init(&s, mem, ring, slot, guard, blockdev_read, &dev));
+    sd_stream_open(&s, a.movi_start, a.movi_end, false);
+
+    // A read that was in flight across a seek is dropped
+    sd_stream_req_t req;
+    CHECK(sd_stream_fill_begin(&s, &req));
+    CHECK(req.offset % slot == 0 && req.len == slot);
+    int32_t n = blockdev_read(&dev, req.offset, req.buf, req.len);
+    sd_stream_seek(&s, a.movi_start);
+    sd_stream_fill_end(&s, &req, n);
+    CHECK(sd_stream_buffered(&s) == 0);
+
+    // Non-looping: every chunk once, then END
+    sd_stream_chunk_t ch;
+    uint64_t payload, seen = 0;
+    uint32_t chunks = count_chunks(&a, &payload), got = 0;
+    for (int guard_n = 0; guard_n < 100000; guard_n++) {
+        sd_stream_res_t res = sd_stream_next(&s, &ch);
+        if (res == SD_STREAM_AGAIN) { sd_stream_fill(&s); continue; }
+        if (res != SD_STREAM_OK) { CHECK(res == SD_STREAM_END); break; }
+        seen += ch.size;
+        got++;
+    }
+    CHECK(got == chunks && seen == payload);
+    CHECK(sd_stream_next(&s, &ch) == SD_STREAM_END);
+
+    // Seek back into the middle: the stream restarts at that chunk
+    uint32_t second = a.movi_start + 8 + le32(a.data + a.movi_start + 4);
+    second += second & 1;
+    sd_stream_seek(&s, second);
+    while (sd_stream_next(&s, &ch) == SD_STREAM_AGAIN) sd_stream_fill(&s);
+    CHECK(ch.offset == second + 8);
+
+    // Chunks over the zero-copy limit are skipped, not returned
+    free(mem);
+    const uint32_t small_guard = 16 * 1024;
+    mem = malloc(32 * 1024 + small_guard);
+    CHECK(sd_stream_init(&s, mem, 32 * 1024, 4096, small_guard, blockdev_read, &dev));
+    sd_stream_open(&s, a.movi_start, a.movi_end, false);
+    got = 0;
+    for (int guard_n = 0; guard_n < 100000; guard_n++) {
+        sd_stream_res_t res = sd_stream_next(&s, &ch);
+        if (res == SD_STREAM_AGAIN) { sd_stream_fill(&s); continue; }
+        if (res != SD_STREAM_OK) break;
+        CHECK(ch.size + 8 <= small_guard);
+        got++;
+    }
+    sd_stream_stats_t st;
+    sd_stream_get_stats(&s, &st);
+    CHECK(st.too_big > 0 && got + st.too_big == chunks);
+    free(mem);
+    free(a.data);
+}
+
+// Chunks handed out in parts reassemble to the file, also through a ring smaller than the
+// largest of them and when some are left halfway
+static void test_stream_parts(void) {
+    const uint32_t ring = 16 * 1024, slot = 4096, guard = 4096, head = 2048;
+    uint32_t largest = 0, parts = 0;
+    for (size_t i = 0; i < sizeof(s_samples) / sizeof(s_samples[0]); i++) {
+        avi_file_t a;
+        if (!avi_load(s_samples[i], &a)) { CHECK(!"sample missing"); continue; }
+        blockdev_t dev = {.avi = &a};
+        sd_stream_t s;
+        uint8_t *mem = malloc(ring + guard);
+        uint8_t *chunk = malloc(a.size);
+        CHECK(sd_stream_init(&s, mem, ring, slot, guard, blockdev_read, &dev));
+        sd_stream_open(&s, a.movi_start, a.movi_end, true);
+
+        uint32_t want = count_chunks(&a, NULL) * 3 / 2, got = 0, mismatches = 0;
+        uint32_t expect = a.movi_start;
+        for (int guard_n = 0; got < want && guard_n < 1000000; guard_n++) {
+            sd_stream_chunk_t ch;
+            sd_stream_res_t res = sd_stream_next_part(&s, &ch, head);
+            if (res == SD_STREAM_AGAIN) { sd_stream_fill(&s); continue; }
+            CHECK(res == SD_STREAM_OK);
+            if (res != SD_STREAM_OK) break;
+            CHECK(ch.avail >= (ch.size < head ? ch.size : head) && ch.avail <= ch.size);
+            if (ch.offset != expect + 8) mismatches++;
+            if (ch.size > largest) largest = ch.size;
+            // Every third chunk is dropped halfway, as a decoder giving up on a frame would
+            bool partial = got % 3 == 2;
+            uint32_t len = ch.avail, piece;
+            const uint8_t *p;
+            memcpy(chunk, ch.data, ch.avail);
+            while (!(partial && len >= ch.size / 2) && (res = sd_stream_more(&s, &p, &piece)) != SD_STREAM_END) {
+                if (res == SD_STREAM_AGAIN) { sd_stream_fill(&s); continue; }
+                CHECK(res == SD_STREAM_OK && len + piece <= ch.size);
+                if (res != SD_STREAM_OK || len + piece > ch.size) break;
+                memcpy(chunk + len, p, piece);
+                len += piece;
+            }
+            if (!partial) CHECK(len == ch.size);
+            if (memcmp(chunk, a.data + ch.offset, len) != 0) mismatches++;
+            sd_stream_release(&s);
+            expect = ch.offset + ch.size + (ch.size & 1);
+            if (expect + 8 > a.movi_end) expect = a.movi_start;
+            got++;
+        }
+        sd_stream_stats_t st;
+        sd_stream_get_stats(&s, &st);
+        CHECK(got == want);
+        CHECK(mismatches == 0);
+        CHECK(st.errors == 0 && st.too_big == 0);
+        parts += st.parts;
+        free(chunk);
+        free(mem);
+        free(a.data);
+    }
+    // Frames larger than the ring went through
+    CHECK(largest > ring);
+    CHECK(parts > 0);
+}
+
+// --- Playback against the timing model ---
+
+typedef struct {
+    uint32_t frames;
+    uint32_t stalls;
+    uint64_t bytes;
+    uint64_t read_us;       // bus time spent reading
+    uint64_t blocked_us;    // time the LVGL task spent waiting on reads
+    uint32_t max_blocked_us;
+    uint32_t commands;
+} play_result_t;
+
+// The old path: per frame tick, fseek + header reads + fread of the payload into the PSRAM
+// work buffer, all on the LVGL task
+static play_result_t play_stdio(const avi_file_t *a, uint32_t frames) {
+    play_result_t r = {0};
+    blockdev_t dev = {.avi = a};
+    int64_t window = -1;
+    uint32_t pos = a->movi_start;
+    while (r.frames < frames) {
+        uint32_t us = 0;
+        for (;;) {
+            if (pos + 8 > a->movi_end) pos = a->movi_start;
+            uint32_t id = le32(a->data + pos), size = le32(a->data + pos + 4);
+            us += fat_read_cost(&dev, pos, 8, false, &window);
+            if (is_video(id)) us += fat_read_cost(&dev, pos + 8, size, false, &window);
+            pos += 8 + size + (size & 1);
+            r.bytes += 8 + size;
+            if (is_video(id)) break;
+        }
+        r.frames++;
+        r.blocked_us += us;
+        if (us > r.max_blocked_us) r.max_blocked_us = us;
+    }
+    r.read_us = dev.busy_us;
+    r.commands = dev.commands;
+    return r;
+}
+
+// The stream: an I/O task keeps slots in flight while the LVGL task takes a frame per tick.
+// `period_us` 0 plays as fast as the reads allow (stalls then measure the bus limit).
+static play_result_t play_stream(const avi_file_t *a, uint32_t frames, uint32_t period_us,
+                                 uint32_t ring, uint32_t slot) {
+    play_result_t r = {0};
+    blockdev_t dev = {.avi = a};
+    sd_stream_t s;
+    uint8_t *mem = malloc(ring + 32 * 1024);
+    sd_stream_init(&s, mem, ring, slot, 32 * 1024, blockdev_read, &dev);
+    sd_stream_open(&s, a->movi_start, a->movi_end, true);
+
+    int64_t now = 0, io_done = -1, next_tick = period_us;
+    int64_t window = -1;
+    sd_stream_req_t req;
+    while (r.frames < frames) {
+        // I/O task: start the next read whenever the previous one is done and a slot is free
+        if (io_done < 0 && sd_stream_fill_begin(&s, &req)) {
+            int32_t n = blockdev_read(&dev, req.offset, req.buf, req.len);
+            io_done = now + fat_read_cost(&dev, req.offset, req.len, true, &window);
+            req.len = (uint32_t)n;
+        }
+        int64_t next = next_tick;
+        if (io_done >= 0 && io_done < next) next = io_done;
+        now = next;
+        if (io_done >= 0 && now >= io_done) {
+            sd_stream_fill_end(&s, &req, (int32_t)req.len);
+            io_done = -1;
+        }
+        if (now < next_tick) continue;
+
+        // LVGL task: never waits; a frame that is not buffered is retried on the next tick
+        sd_stream_chunk_t ch;
+        sd_stream_res_t res;
+        while ((res = sd_stream_next(&s, &ch)) == SD_STREAM_OK && !is_video(ch.id)) {}
+        if (res == SD_STREAM_OK) {
+            sd_stream_release(&s);  // decoded
+            r.frames++;
+            next_tick = now + period_us;
+        } else {
+            // As-fast-as-possible playback retries as soon as the next read lands
+            next_tick = period_us ? now + period_us : (io_done >= 0 ? io_done : now + 1);
+        }
+    }
+    sd_stream_stats_t st;
+    sd_stream_get_stats(&s, &st);
+    r.stalls = st.stalls;
+    r.bytes = st.bytes_read;
+    r.read_us = dev.busy_us;
+    r.commands = dev.commands;
+    r.blocked_us = 0;
+    r.max_blocked_us = 0;
+    // Elapsed time for the as-fast-as-possible case
+    if (!period_us) r.blocked_us = (uint64_t)now;
+    free(mem);
+    return r;
+}
+
+static void test_playback(void) {
+    printf("%-17s %6s %6s | %-40s | %-35s | %s\n", "sample", "frames", "MB", "stdio on the LVGL task",
+           "read-ahead stream", "unthrottled");
+    for (size_t i = 0; i < sizeof(s_samples) / sizeof(s_samples[0]); i++) {
+        avi_file_t a;
+        if (!avi_load(s_samples[i], &a)) { CHECK(!"sample missing"); continue; }
+        // Three loops of the clip
+        uint32_t video = 0;
+        for (uint32_t p = a.movi_start; p + 8 <= a.movi_end; ) {
+            uint32_t size = le32(a.data + p + 4);
+            if (is_video(le32(a.data + p))) video++;
+            p += 8 + size + (size & 1);
+        }
+        uint32_t frames = video * 3;
+
+        play_result_t old = play_stdio(&a, frames);
+        play_result_t str = play_stream(&a, frames, a.usec_per_frame, 64 * 1024, CLUSTER);
+        play_result_t fast = play_stream(&a, frames, 0, 64 * 1024, CLUSTER);
+
+        double old_mbs = old.bytes / (double)old.read_us;
+        double str_mbs = str.bytes / (double)str.read_us;
+        double fast_fps = fast.frames * 1e6 / fast.blocked_us;
+        printf("%-17s %6u %6.2f | %4.2f MB/s, %4.1f cmd/frame, %4.1f ms max | "
+               "%4.2f MB/s, %3.1f cmd/frame, %u stalls | %5.1f fps (clip %.0f fps)\n",
+               s_samples[i], (unsigned)frames, str.bytes / 1e6,
+               old_mbs, old.commands / (double)frames, old.max_blocked_us / 1000.0,
+               str_mbs, str.commands / (double)frames, (unsigned)str.stalls,
+               fast_fps, 1e6 / a.usec_per_frame);
+
+        // Multi-block reads sustain well over the single-block path, playback never stalls,
+        // and the bus could keep up with several times the clip's frame rate
+        CHECK(str_mbs > old_mbs * 1.5);
+        CHECK(str.stalls == 0);
+        CHECK(fast_fps > 2e6 / a.usec_per_frame);
+        CHECK(str.commands < old.commands / 8);
+        free(a.data);
+    }
+}
+
+// --- Async file service ---
+
+// In-memory file system; every call sleeps for its injected latency
+#define MEMFS_FILES 64
+
+typedef struct {
+    char name[SD_IO_PATH_MAX];
+    uint8_t *data;
+    uint32_t size;
+} mem_file_t;
+
+typedef struct {
+    pthread_mutex_t m;
+    mem_file_t files[MEMFS_FILES];
+    int nfiles;
+    uint32_t read_us;       // per read call
+    uint32_t stat_us;       // per size lookup
+    uint32_t entry_us;      // per directory entry (readdir + stat)
+    uint32_t write_us;      // per write call
+    int open_dirs;
+    int open_writes;
+    long allocs;            // outstanding allocations
+    bool fail_writes;
+    char order[64][SD_IO_PATH_MAX];     // reads, in the order the worker ran them
+    int norder;
+    void (*on_read)(const char *path);
+} memfs_t;
+
+typedef struct {
+    char prefix[SD_IO_PATH_MAX];
+    int pos;
+} memfs_dir_t;
+
+typedef struct {
+    mem_file_t *f;
+} memfs_wfile_t;
+
+static memfs_t s_fs;
+
+static void memfs_reset(void) {
+    for (int i = 0; i < s_fs.nfiles; i++) free(s_fs.files[i].data);
+    pthread_mutex_destroy(&s_fs.m);
+    memset(&s_fs, 0, sizeof(s_fs));
+    pthread_mutex_init(&s_fs.m, NULL);
+}
+
+static mem_file_t *memfs_find(const char *path) {
+    for (int i = 0; i < s_fs.nfiles; i++) {
+        if (strcmp(s_fs.files[i].name, path) == 0) return &s_fs.files[i];
+    }
+    return NULL;
+}
+
+static mem_file_t *memfs_add(const char *path, uint32_t size) {
+    mem_file_t *f = &s_fs.files[s_fs.nfiles++];
+    snprintf(f->name, sizeof(f->name), "%s", path);
+    f->size = size;
+    f->data = malloc(size ? size : 1);
+    for (uint32_t i = 0; i < size; i++) f->data[i] = (uint8_t)(i * 7 + strlen(path));
+    return f;
+}
+
+static void lat(uint32_t us) {
+    if (us) usleep(us);
+}
+
+static int32_t memfs_read(void *ctx, const char *path, uint32_t offset, void *buf, uint32_t len) {
+    lat(s_fs.read_us);
+    pthread_mutex_lock(&s_fs.m);
+    if (s_fs.norder < 64) snprintf(s_fs.order[s_fs.norder++], SD_IO_PATH_MAX, "%s", path);
+    mem_file_t *f = memfs_find(path);
+    int32_t n = -2;
+    if (f) {
+        n = offset < f->size ? (int32_t)(f->size - offset < len ? f->size - offset : len) : 0;
+        memcpy(buf, f->data + offset, n);
+    }
+    pthread_mutex_unlock(&s_fs.m);
+    if (s_fs.on_read) s_fs.on_read(path);
+    return n;
+}
+
+static int32_t memfs_size(void *ctx, const char *path) {
+    lat(s_fs.stat_us);
+    pthread_mutex_lock(&s_fs.m);
+    mem_file_t *f = memfs_find(path);
+    int32_t n = f ? (int32_t)f->size : -2;
+    pthread_mutex_unlock(&s_fs.m);
+    return n;
+}
+
+static void *memfs_alloc(void *ctx, size_t size) {
+    __atomic_add_fetch(&s_fs.allocs, 1, __ATOMIC_RELAXED);
+    return malloc(size);
+}
+
+static void memfs_free(void *ctx, void *p) {
+    if (!p) return;
+    __atomic_sub_fetch(&s_fs.allocs, 1, __ATOMIC_RELAXED);
+    free(p);
+}
+
+static void *memfs_dir_open(void *ctx, const char *path) {
+    lat(s_fs.stat_us);
+    memfs_dir_t *d = calloc(1, sizeof(*d));
+    snprintf(d->prefix, sizeof(d->prefix), "%s/", path);
+    __atomic_add_fetch(&s_fs.open_dirs, 1, __ATOMIC_RELAXED);
+    return d;
+}
+
+static bool memfs_dir_next(void *ctx, void *dir, sd_io_dirent_t *out) {
+    memfs_dir_t *d = (memfs_dir_t *)dir;
+    size_t n = strlen(d->prefix);
+    pthread_mutex_lock(&s_fs.m);
+    while (d->pos < s_fs.nfiles && strncmp(s_fs.files[d->pos].name, d->prefix, n) != 0) d->pos++;
+    bool found = d->pos < s_fs.nfiles;
+    if (found) {
+        snprintf(out->name, sizeof(out->name), "%s", s_fs.files[d->pos].name + n);
+        out->size = s_fs.files[d->pos].size;
+        out->is_dir = false;
+        d->pos++;
+    }
+    pthread_mutex_unlock(&s_fs.m);
+    if (found) lat(s_fs.entry_us);
+    return found;
+}
+
+static void memfs_dir_close(void *ctx, void *dir) {
+    __atomic_sub_fetch(&s_fs.open_dirs, 1, __ATOMIC_RELAXED);
+    free(dir);
+}
+
+static void *memfs_write_open(void *ctx, const char *path, bool append) {
+    lat(s_fs.stat_us);
+    pthread_mutex_lock(&s_fs.m);
+    mem_file_t *f = memfs_find(path);
+    if (!f) f = memfs_add(path, 0);
+    if (!append) f->size = 0;
+    pthread_mutex_unlock(&s_fs.m);
+    memfs_wfile_t *w = calloc(1, sizeof(*w));
+    w->f = f;
+    __atomic_add_fetch(&s_fs.open_writes, 1, __ATOMIC_RELAXED);
+    return w;
+}
+
+static int32_t memfs_write(void *ctx, void *file, const void *data, uint32_t len) {
+    lat(s_fs.write_us);
+    if (s_fs.fail_writes) return -1;
+    memfs_wfile_t *w = (memfs_wfile_t *)file;
+    pthread_mutex_lock(&s_fs.m);
+    w->f->data = realloc(w->f->data, w->f->size + len);
+    memcpy(w->f->data + w->f->size, data, len);
+    w->f->size += len;
+    pthread_mutex_unlock(&s_fs.m);
+    return (int32_t)len;
+}
+
+static int memfs_write_close(void *ctx, void *file) {
+    __atomic_sub_fetch(&s_fs.open_writes, 1, __ATOMIC_RELAXED);
+    free(file);
+    return 0;
+}
+
+static const sd_io_backend_t s_memfs_be = {
+    .read = memfs_read, .size = memfs_size,
+    .dir_open = memfs_dir_open, .dir_next = memfs_dir_next, .dir_close = memfs_dir_close,
+    .write_open = memfs_write_open, .write = memfs_write, .write_close = memfs_write_close,
+    .alloc = memfs_alloc, .free = memfs_free,
+};
+
+// Callback bookkeeping
+typedef struct {
+    int calls;
+    sd_io_status_t status;
+    uint32_t len;
+    uint32_t file_size;
+    uint32_t entries;
+    int batches;
+    bool alive;             // the "view" the request belongs to still exists
+    int calls_after_teardown;
+    int64_t done_us;
+    uint8_t first;
+} io_probe_t;
+
+static int64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void probe_cb(sd_io_result_t *res, void *user) {
+    io_probe_t *p = (io_probe_t *)user;
+    p->calls++;
+    if (!p->alive) p->calls_after_teardown++;
+    p->status = res->status;
+    p->len = res->len;
+    p->file_size = res->file_size;
+    p->done_us = now_us();
+    if (res->data && res->len) p->first = res->data[0];
+    if (res->kind == SD_IO_LIST) {
+        p->entries += res->count;
+        p->batches++;
+    }
+}
+
+static sd_io_opts_t opts_of(sd_io_prio_t prio, const void *owner, io_probe_t *p) {
+    sd_io_opts_t o = {.prio = prio, .owner = owner, .cb = probe_cb, .user = p};
+    return o;
+}
+
+static void run_all(sd_ioq_t *q) {
+    while (sd_ioq_work(q) || sd_ioq_dispatch(q, 0)) {}
+}
+
+static void test_io_priorities_and_reads(void) {
+    memfs_reset();
+    memfs_add("/sdcard/low1.jpg", 3000);
+    memfs_add("/sdcard/low2.jpg", 3000);
+    memfs_add("/sdcard/list.txt", 10);
+    memfs_add("/sdcard/open.jpg", 50000);
+    sd_ioq_t q;
+    sd_ioq_init(&q, &s_memfs_be, NULL);
+
+    io_probe_t p[6] = {0};
+    for (int i = 0; i < 6; i++) p[i].alive = true;
+    sd_io_opts_t o;
+    o = opts_of(SD_IO_PRIO_LOW, NULL, &p[0]);
+    CHECK(sd_ioq_read(&q, "/sdcard/low1.jpg", 0, 256, 0, NULL, &o));
+    o = opts_of(SD_IO_PRIO_LOW, NULL, &p[1]);
+    CHECK(sd_ioq_read(&q, "/sdcard/low2.jpg", 0, 256, 0, NULL, &o));
+    o = opts_of(SD_IO_PRIO_NORMAL, NULL, &p[2]);
+    CHECK(sd_ioq_read(&q, "/sdcard/list.txt", 0, 0, 0, NULL, &o));
+    o = opts_of(SD_IO_PRIO_HIGH, NULL, &p[3]);
+    CHECK(sd_ioq_read(&q, "/sdcard/open.jpg", 0, 0, 100000, NULL, &o));
+    o = opts_of(SD_IO_PRIO_HIGH, NULL, &p[4]);
+    CHECK(sd_ioq_read(&q, "/sdcard/missing.jpg", 0, 0, 0, NULL, &o));
+    o = opts_of(SD_IO_PRIO_HIGH, NULL, &p[5]);
+    CHECK(sd_ioq_read(&q, "/sdcard/open.jpg", 0, 0, 1000, NULL, &o));    // over max_len
+    run_all(&q);
+
+    // Highest priority first, FIFO within one
+    CHECK(s_fs.norder == 4);
+    CHECK(strcmp(s_fs.order[0], "/sdcard/open.jpg") == 0);
+    CHECK(strcmp(s_fs.order[1], "/sdcard/list.txt") == 0);
+    CHECK(strcmp(s_fs.order[2], "/sdcard/low1.jpg") == 0);
+    CHECK(strcmp(s_fs.order[3], "/sdcard/low2.jpg") == 0);
+    for (int i = 0; i < 6; i++) CHECK(p[i].calls == 1);
+    CHECK(p[0].status == SD_IO_OK && p[0].len == 256 && p[0].file_size == 3000);
+    CHECK(p[2].status == SD_IO_OK && p[2].len == 10);
+    CHECK(p[3].status == SD_IO_OK && p[3].len == 50000 && p[3].first == memfs_find("/sdcard/open.jpg")->data[0]);
+    CHECK(p[4].status == SD_IO_ERR_NOT_FOUND);
+    CHECK(p[5].status == SD_IO_ERR_TOO_BIG);
+
+    // Caller buffer, and a callback keeping an allocated one
+    uint8_t buf[100];
+    io_probe_t pb = {.alive = true};
+    o = opts_of(SD_IO_PRIO_NORMAL, NULL, &pb);
+    CHECK(sd_ioq_read(&q, "/sdcard/low1.jpg", 1000, 100, 0, buf, &o));
+    run_all(&q);
+    CHECK(pb.len == 100 && buf[0] == memfs_find("/sdcard/low1.jpg")->data[1000]);
+    CHECK(s_fs.allocs == 0);
+
+    // Pool exhaustion is reported, not waited on
+    uint32_t ids = 0;
+    for (int i = 0; i < SD_IO_MAX_REQUESTS + 2; i++) {
+        if (sd_ioq_read(&q, "/sdcard/low1.jpg", 0, 4, 0, NULL, NULL)) ids++;
+    }
+    CHECK(ids == SD_IO_MAX_REQUESTS);
+    run_all(&q);
+    sd_io_stats_t st;
+    sd_ioq_get_stats(&q, &st);
+    CHECK(st.rejected == 2 && st.failed == 2);
+    CHECK(s_fs.allocs == 0);
+}
+
+static void keep_cb(sd_io_result_t *res, void *user) {
+    *(uint8_t **)user = res->data;
+    res->data = NULL;
+}
+
+static void test_io_list_and_write(void) {
+    memfs_reset();
+    char path[64];
+    for (int i = 0; i < 40; i++) {
+        snprintf(path, sizeof(path), "/sdcard/clip%02d.avi", i);
+        memfs_add(path, 1000 + i);
+    }
+    memfs_add("/other/x.bin", 5);
+    sd_ioq_t q;
+    sd_ioq_init(&q, &s_memfs_be, NULL);
+
+    io_probe_t p = {.alive = true};
+    sd_io_opts_t o = opts_of(SD_IO_PRIO_NORMAL, NULL, &p);
+    CHECK(sd_ioq_list(&q, "/sdcard", &o));
+    run_all(&q);
+    CHECK(p.entries == 40 && p.batches == 3 && p.status == SD_IO_OK);
+    CHECK(s_fs.open_dirs == 0 && s_fs.allocs == 0);
+
+    // A callback may keep the buffer of a read
+    uint8_t *kept = NULL;
+    sd_io_opts_t ko = {.prio = SD_IO_PRIO_HIGH, .cb = keep_cb, .user = &kept};
+    CHECK(sd_ioq_read(&q, "/sdcard/clip03.avi", 0, 0, 0, NULL, &ko));
+    run_all(&q);
+    CHECK(kept && s_fs.allocs == 1);
+    memfs_free(NULL, kept);
+
+    // Streaming write: chunks land in order, one callback after close
+    io_probe_t pw = {.alive = true};
+    o = opts_of(SD_IO_PRIO_LOW, NULL, &pw);
+    uint32_t w = sd_ioq_write_open(&q, "/sdcard/log.bin", false, &o);
+    CHECK(w);
+    uint8_t chunk[1000];
+    for (int i = 0; i < 5; i++) {
+        memset(chunk, 'a' + i, sizeof(chunk));
+        CHECK(sd_ioq_write(&q, w, chunk, sizeof(chunk)) == SD_IO_OK);
+        if (i == 2) run_all(&q);
+    }
+    // Backlog limit while the worker is behind
+    uint8_t *big = calloc(1, SD_IO_WRITE_MAX_PENDING);
+    CHECK(sd_ioq_write(&q, w, big, SD_IO_WRITE_MAX_PENDING) == SD_IO_ERR_BUSY);
+    free(big);
+    CHECK(pw.calls == 0);
+    CHECK(sd_ioq_write_close(&q, w) == SD_IO_OK);
+    CHECK(sd_ioq_write(&q, w, chunk, 10) == SD_IO_ERR_ARG);
+    run_all(&q);
+    mem_file_t *f = memfs_find("/sdcard/log.bin");
+    CHECK(pw.calls == 1 && pw.status == SD_IO_OK && pw.len == 5000);
+    CHECK(f && f->size == 5000 && f->data[0] == 'a' && f->data[4999] == 'e' && f->data[2500] == 'c');
+    CHECK(s_fs.open_writes == 0 && s_fs.allocs == 0);
+
+    // Append, and a failing write is reported once at close
+    io_probe_t pf = {.alive = true};
+    o = opts_of(SD_IO_PRIO_LOW, NULL, &pf);
+    w = sd_ioq_write_open(&q, "/sdcard/log.bin", true, &o);
+    CHECK(sd_ioq_write(&q, w, chunk, 100) == SD_IO_OK);
+    run_all(&q);
+    CHECK(f->size == 5100);
+    s_fs.fail_writes = true;
+    CHECK(sd_ioq_write(&q, w, chunk, 100) == SD_IO_OK);
+    run_all(&q);
+    CHECK(sd_ioq_write(&q, w, chunk, 100) == SD_IO_ERR_IO);
+    sd_ioq_write_close(&q, w);
+    run_all(&q);
+    s_fs.fail_writes = false;
+    CHECK(pf.calls == 1 && pf.status == SD_IO_ERR_IO && pf.len == 100);
+    CHECK(s_fs.open_writes == 0 && s_fs.allocs == 0);
+}
+
+static sd_ioq_t *s_cancel_q;
+static const void *s_cancel_owner;
+
+static void cancel_during_read(const char *path) {
+    if (s_cancel_owner) sd_ioq_cancel_owner(s_cancel_q, s_cancel_owner);
+}
+
+static void cancel_in_cb(sd_io_result_t *res, void *user) {
+    io_probe_t *p = (io_probe_t *)user;
+    p->calls++;
+    p->batches++;
+    sd_ioq_cancel(s_cancel_q, res->id);
+}
+
+static void test_io_cancel(void) {
+    memfs_reset();
+    char path[64];
+    for (int i = 0; i < 40; i++) {
+        snprintf(path, sizeof(path), "/sdcard/f%02d.jpg", i);
+        memfs_add(path, 2000);
+    }
+    sd_ioq_t q;
+    sd_ioq_init(&q, &s_memfs_be, NULL);
+    s_cancel_q = &q;
+    int view_a, view_b;
+    io_probe_t pa[4] = {0}, pb = {.alive = true};
+    sd_io_opts_t o;
+
+    // Queued, done-but-undelivered and open write streams of a torn-down view
+    for (int i = 0; i < 3; i++) {
+        pa[i].alive = true;
+        o = opts_of(SD_IO_PRIO_LOW, &view_a, &pa[i]);
+        sd_ioq_read(&q, "/sdcard/f01.jpg", 0, 0, 0, NULL, &o);
+    }
+    pa[3].alive = true;
+    o = opts_of(SD_IO_PRIO_LOW, &view_a, &pa[3]);
+    uint32_t w = sd_ioq_write_open(&q, "/sdcard/out.bin", false, &o);
+    sd_ioq_write(&q, w, "abc", 3);
+    o = opts_of(SD_IO_PRIO_LOW, &view_b, &pb);
+    sd_ioq_read(&q, "/sdcard/f02.jpg", 0, 0, 0, NULL, &o);
+    CHECK(sd_ioq_work(&q));     // first read of view A finishes, not dispatched yet
+    for (int i = 0; i < 4; i++) pa[i].alive = false;
+    sd_ioq_cancel_owner(&q, &view_a);
+    run_all(&q);
+    for (int i = 0; i < 4; i++) CHECK(pa[i].calls == 0);
+    CHECK(pb.calls == 1);
+    CHECK(s_fs.open_writes == 0 && s_fs.allocs == 0);
+
+    // Cancelled while the worker is in the read
+    io_probe_t pr = {.alive = true};
+    o = opts_of(SD_IO_PRIO_HIGH, &view_a, &pr);
+    sd_ioq_read(&q, "/sdcard/f03.jpg", 0, 0, 0, NULL, &o);
+    s_cancel_owner = &view_a;
+    s_fs.on_read = cancel_during_read;
+    run_all(&q);
+    s_fs.on_read = NULL;
+    s_cancel_owner = NULL;
+    CHECK(pr.calls == 0 && s_fs.allocs == 0);
+
+    // A listing stopped between batches, from its own callback: the directory is closed
+    io_probe_t pl = {.alive = true};
+    sd_io_opts_t lo = {.prio = SD_IO_PRIO_NORMAL, .cb = cancel_in_cb, .user = &pl};
+    sd_ioq_list(&q, "/sdcard", &lo);
+    run_all(&q);
+    CHECK(pl.calls == 1);
+    CHECK(s_fs.open_dirs == 0 && s_fs.allocs == 0);
+
+    sd_io_stats_t st;
+    sd_ioq_get_stats(&q, &st);
+    CHECK(st.cancelled == 6);
+    for (int i = 0; i < SD_IO_MAX_REQUESTS; i++) CHECK(q.req[i].state == SD_IOQ_FREE);
+}
+
+// Threaded: a worker thread over a slow card, and a UI thread rendering at 60 fps that
+// submits, dispatches and cancels without ever waiting on I/O
+typedef struct {
+    pthread_mutex_t m;
+    pthread_cond_t cv;
+    bool work;
+    bool stop;
+    volatile int notified;
+} io_os_t;
+
+static void os_lock(void *ctx) { pthread_mutex_lock(&((io_os_t *)ctx)->m); }
+static void os_unlock(void *ctx) { pthread_mutex_unlock(&((io_os_t *)ctx)->m); }
+
+static pthread_mutex_t s_wake_m = PTHREAD_MUTEX_INITIALIZER;
+
+static void os_wake(void *ctx) {
+    io_os_t *os = (io_os_t *)ctx;
+    pthread_mutex_lock(&s_wake_m);
+    os->work = true;
+    pthread_cond_signal(&os->cv);
+    pthread_mutex_unlock(&s_wake_m);
+}
+
+static void os_notify(void *ctx) {
+    __atomic_add_fetch(&((io_os_t *)ctx)->notified, 1, __ATOMIC_RELAXED);
+}
+
+typedef struct {
+    sd_ioq_t *q;
+    io_os_t *os;
+    int64_t busy_us;
+} worker_arg_t;
+
+static void *worker_main(void *arg) {
+    worker_arg_t *w = (worker_arg_t *)arg;
+    for (;;) {
+        pthread_mutex_lock(&s_wake_m);
+        while (!w->os->work && !w->os->stop) pthread_cond_wait(&w->os->cv, &s_wake_m);
+        if (w->os->stop) {
+            pthread_mutex_unlock(&s_wake_m);
+            break;
+        }
+        w->os->work = false;
+        pthread_mutex_unlock(&s_wake_m);
+        int64_t t0 = now_us();
+        while (sd_ioq_work(w->q)) {}
+        w->busy_us += now_us() - t0;
+    }
+    return NULL;
+}
+
+static void test_io_ui_never_blocks(void) {
+    memfs_reset();
+    char path[64];
+    for (int i = 0; i < 24; i++) {
+        snprintf(path, sizeof(path), "/sdcard/pic%02d.jpg", i);
+        memfs_add(path, 40000);
+    }
+    // Single-sector-ish SD timings: 15 ms per file read, 2 ms per lookup or directory entry
+    s_fs.read_us = 15000;
+    s_fs.stat_us = 2000;
+    s_fs.entry_us = 2000;
+    s_fs.write_us = 3000;
+
+    io_os_t os = {.m = PTHREAD_MUTEX_INITIALIZER, .cv = PTHREAD_COND_INITIALIZER};
+    sd_io_os_t osi = {.lock = os_lock, .unlock = os_unlock, .wake_worker = os_wake, .notify = os_notify, .ctx = &os};
+    sd_ioq_t q;
+    sd_ioq_init(&q, &s_memfs_be, &osi);
+    worker_arg_t wa = {.q = &q, .os = &os};
+    pthread_t th;
+    pthread_create(&th, NULL, worker_main, &wa);
+
+    // Media view opens: list the card, thumbnail every file at low priority. After a few
+    // frames the user opens a picture (high priority), then leaves the view mid-way.
+    int view;
+    io_probe_t list = {.alive = true}, thumbs[24], open = {.alive = true}, log = {.alive = true};
+    memset(thumbs, 0, sizeof(thumbs));
+    int64_t max_call_us = 0, sync_us = 0, open_submit = 0;
+    int frames = 0, log_ok = 0;
+    uint32_t log_id = 0;
+    sd_io_opts_t o = opts_of(SD_IO_PRIO_NORMAL, &view, &list);
+    int64_t t_start = now_us();
+    for (frames = 0; frames < 30; frames++) {
+        int64_t frame_start = now_us();
+        int64_t t0 = now_us();
+        if (frames == 0) {
+            sd_ioq_list(&q, "/sdcard", &o);
+            sync_us += 2000 + 24 * 2000;
+            for (int i = 0; i < SD_IO_MAX_REQUESTS - 3; i++) {
+                thumbs[i].alive = true;
+                snprintf(path, sizeof(path), "/sdcard/pic%02d.jpg", i);
+                sd_io_opts_t to = opts_of(SD_IO_PRIO_LOW, &view, &thumbs[i]);
+                sd_ioq_read(&q, path, 0, 256, 0, NULL, &to);
+                sync_us += 2000 + 15000;
+            }
+            sd_io_opts_t lo = opts_of(SD_IO_PRIO_LOW, NULL, &log);
+            log_id = sd_ioq_write_open(&q, "/sdcard/ui.log", true, &lo);
+        }
+        if (frames == 3) {
+            sd_io_opts_t oo = opts_of(SD_IO_PRIO_HIGH, &view, &open);
+            sd_ioq_read(&q, "/sdcard/pic20.jpg", 0, 0, 0, NULL, &oo);
+            open_submit = now_us();
+            sync_us += 2000 + 15000;
+        }
+        if (log_id && sd_ioq_write(&q, log_id, "frame\n", 6) == SD_IO_OK) log_ok++;
+        if (frames == 10) {
+            // Leaving the view: nothing of it may call back after this
+            list.alive = open.alive = false;
+            for (int i = 0; i < 24; i++) thumbs[i].alive = false;
+            sd_ioq_cancel_owner(&q, &view);
+            sd_ioq_write_close(&q, log_id);
+        }
+        sd_ioq_dispatch(&q, 0);
+        int64_t call = now_us() - t0;
+        if (call > max_call_us) max_call_us = call;
+        // Rest of the 16 ms frame
+        int64_t left = 16667 - (now_us() - frame_start);
+        if (left > 0) usleep((useconds_t)left);
+    }
+    // Drain, then stop the worker
+    while (sd_ioq_dispatch(&q, 0) || q.depth) usleep(1000);
+    usleep(50000);
+    sd_ioq_dispatch(&q, 0);
+    pthread_mutex_lock(&s_wake_m);
+    os.stop = true;
+    pthread_cond_signal(&os.cv);
+    pthread_mutex_unlock(&s_wake_m);
+    pthread_join(th, NULL);
+    int64_t elapsed = now_us() - t_start;
+
+    int thumbs_done = 0, after = list.calls_after_teardown + open.calls_after_teardown;
+    for (int i = 0; i < 24; i++) {
+        thumbs_done += thumbs[i].calls;
+        after += thumbs[i].calls_after_teardown;
+    }
+    int64_t open_latency = open.calls ? open.done_us - open_submit : -1;
+    sd_io_stats_t st;
+    sd_ioq_get_stats(&q, &st);
+    printf("async I/O: %d UI frames in %.0f ms, longest sd_io call on the UI thread %lld us; "
+           "worker busy %lld ms; same requests inline would block the UI %lld ms\n",
+           frames, elapsed / 1000.0, (long long)max_call_us, (long long)(wa.busy_us / 1000), (long long)(sync_us / 1000));
+    printf("           listing %u entries in %d batches, %d thumbnails before leaving, opened file after %.1f ms "
+           "(behind %u queued low-priority reads), %u cancelled on teardown, %d callbacks after it\n",
+           (unsigned)list.entries, list.batches, thumbs_done, open_latency / 1000.0,
+           (unsigned)(SD_IO_MAX_REQUESTS - 3), (unsigned)st.cancelled, after);
+
+    CHECK(max_call_us < 2000);              // never one read's worth of waiting
+    CHECK(sync_us > 100000);
+    CHECK(open.calls == 1 && open.status == SD_IO_OK && open.len == 40000);
+    CHECK(open_latency < 3 * 17000 + 17000);    // at most one low read ahead of it, plus a frame
+    CHECK(list.calls >= 1);
+    CHECK(after == 0);
+    CHECK(st.cancelled > 0);
+    CHECK(log.calls == 1 && log.status == SD_IO_OK && log.len == 6u * (uint32_t)log_ok && log_ok == 11);
+    CHECK(os.notified > 0);
+    CHECK(s_fs.allocs == 0 && s_fs.open_dirs == 0 && s_fs.open_writes == 0);
+    for (int i = 0; i < SD_IO_MAX_REQUESTS; i++) CHECK(q.req[i].state == SD_IOQ_FREE);
+}
+
+// --- Contiguous-file fast path ---
+
+// FAT image files built from the sample media: an MBR with one partition at LBA 2048, then
+// a FAT16 (4 KB clusters) or FAT32 (16 KB clusters, sparse) volume. Every sample is written
+// in one go, so it is contiguous, except eye.avi, which is written interleaved with a log
+// file (as when recording while logging) and ends up fragmented.
+#define IMG_VOL_LBA     2048
+#define IMG_MAX_FILES   16
+
+typedef struct {
+    char name[11];          // 8.3, space padded
+    uint32_t first;
+    uint32_t last;
+    uint32_t size;
+} img_file_t;
+
+typedef struct {
+    int fd;
+    uint32_t fat_bits;
+    uint32_t spc;
+    uint32_t rsvd;
+    uint32_t fat_size;
+    uint32_t root_entries;
+    uint32_t total;         // volume sectors
+    uint32_t data_lba;      // absolute
+    uint32_t clusters;
+    uint32_t *fat;
+    uint32_t next_free;
+    uint32_t root_cluster;  // FAT32
+    img_file_t files[IMG_MAX_FILES];
+    int nfiles;
+} img_t;
+
+static void wr16(uint8_t *p, uint32_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+static void wr32(uint8_t *p, uint32_t v) { wr16(p, v); wr16(p + 2, v >> 16); }
+
+static bool img_format(img_t *img, const char *path, uint32_t fat_bits, uint32_t spc, uint32_t clusters) {
+    memset(img, 0, sizeof(*img));
+    img->fat_bits = fat_bits;
+    img->spc = spc;
+    img->rsvd = fat_bits == 32 ? 32 : 4;
+    img->root_entries = fat_bits == 32 ? 0 : 512;
+    img->fat_size = ((clusters + 2) * (fat_bits / 8) + SECTOR - 1) / SECTOR;
+    uint32_t data_start = img->rsvd + 2 * img->fat_size + img->root_entries * 32 / SECTOR;
+    img->total = data_start + clusters * spc;
+    img->data_lba = IMG_VOL_LBA + data_start;
+    img->clusters = clusters;
+    img->fat = calloc(clusters + 2, sizeof(uint32_t));
+    img->fat[0] = 0x0FFFFFF8;
+    img->fat[1] = 0x0FFFFFFF;
+    img->next_free = 2;
+    img->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (img->fd < 0 || !img->fat) return false;
+    if (ftruncate(img->fd, (off_t)(IMG_VOL_LBA + img->total) * SECTOR) != 0) return false;
+    if (fat_bits == 32) {
+        img->root_cluster = img->next_free++;
+        img->fat[img->root_cluster] = 0x0FFFFFFF;
+    }
+    return true;
+}
+
+static void img_name83(const char *name, const char *ext, char out[11]) {
+    memset(out, ' ', 11);
+    size_t n = strlen(name);
+    for (size_t i = 0; i < 8 && i < n; i++) out[i] = (char)toupper((unsigned char)name[i]);
+    if (n > 8) { out[6] = '~'; out[7] = '1'; }
+    for (size_t i = 0; i < 3 && ext[i]; i++) out[8 + i] = (char)toupper((unsigned char)ext[i]);
+}
+
+static img_file_t *img_create(img_t *img, const char *name, const char *ext) {
+    img_file_t *f = &img->files[img->nfiles++];
+    memset(f, 0, sizeof(*f));
+    img_name83(name, ext, f->name);
+    return f;
+}
+
+// Append `len` bytes (whole clusters except at the end of the file) at the next free clusters
+static void img_append(img_t *img, img_file_t *f, const uint8_t *data, uint32_t len) {
+    uint32_t cluster_bytes = img->spc * SECTOR;
+    for (uint32_t done = 0; done < len; done += cluster_bytes) {
+        uint32_t cl = img->next_free++;
+        img->fat[cl] = 0x0FFFFFFF;
+        if (f->last) img->fat[f->last] = cl;
+        else f->first = cl;
+        f->last = cl;
+        uint32_t n = len - done < cluster_bytes ? len - done : cluster_bytes;
+        off_t at = ((off_t)img->data_lba + (off_t)(cl - 2) * img->spc) * SECTOR;
+        CHECK(pwrite(img->fd, data + done, n, at) == (ssize_t)n);
+    }
+    f->size += len;
+}
+
+static void img_finish(img_t *img) {
+    uint8_t sec[SECTOR] = {0};
+    // MBR
+    uint8_t *pe = sec + 446;
+    pe[4] = img->fat_bits == 32 ? 0x0C : 0x0E;
+    wr32(pe + 8, IMG_VOL_LBA);
+    wr32(pe + 12, img->total);
+    wr16(sec + 510, 0xAA55);
+    CHECK(pwrite(img->fd, sec, SECTOR, 0) == SECTOR);
+    // Boot sector
+    memset(sec, 0, sizeof(sec));
+    sec[0] = 0xEB; sec[1] = 0x58; sec[2] = 0x90;
+    memcpy(sec + 3, "MSWIN4.1", 8);
+    wr16(sec + 11, SECTOR);
+    sec[13] = (uint8_t)img->spc;
+    wr16(sec + 14, img->rsvd);
+    sec[16] = 2;
+    wr16(sec + 17, img->root_entries);
+    sec[21] = 0xF8;
+    if (img->total < 65536) wr16(sec + 19, img->total);
+    else wr32(sec + 32, img->total);
+    if (img->fat_bits == 32) {
+        wr32(sec + 36, img->fat_size);
+        wr32(sec + 44, img->root_cluster);
+    } else {
+        wr16(sec + 22, img->fat_size);
+    }
+    wr16(sec + 510, 0xAA55);
+    CHECK(pwrite(img->fd, sec, SECTOR, (off_t)IMG_VOL_LBA * SECTOR) == SECTOR);
+    // Both FATs
+    uint32_t bytes = img->fat_size * SECTOR;
+    uint8_t *fat = calloc(1, bytes);
+    for (uint32_t i = 0; i < img->clusters + 2; i++) {
+        if (img->fat_bits == 32) wr32(fat + i * 4, img->fat[i]);
+        else wr16(fat + i * 2, img->fat[i] >= 0x0FFFFFF8 ? 0xFFFF : img->fat[i]);
+    }
+    for (int k = 0; k < 2; k++) {
+        off_t at = (off_t)(IMG_VOL_LBA + img->rsvd + k * img->fat_size) * SECTOR;
+        CHECK(pwrite(img->fd, fat, bytes, at) == (ssize_t)bytes);
+    }
+    free(fat);
+    // Root directory
+    uint8_t dir[IMG_MAX_FILES * 32] = {0};
+    for (int i = 0; i < img->nfiles; i++) {
+        uint8_t *e = dir + i * 32;
+        memcpy(e, img->files[i].name, 11);
+        e[11] = 0x20;
+        wr16(e + 20, img->files[i].first >> 16);
+        wr16(e + 26, img->files[i].first & 0xFFFF);
+        wr32(e + 28, img->files[i].size);
+    }
+    off_t root = img->fat_bits == 32
+        ? ((off_t)img->data_lba + (off_t)(img->root_cluster - 2) * img->spc) * SECTOR
+        : (off_t)(IMG_VOL_LBA + img->rsvd + 2 * img->fat_size) * SECTOR;
+    CHECK(pwrite(img->fd, dir, sizeof(dir), root) == (ssize_t)sizeof(dir));
+}
+
+// Block device over the image, with the same SD-over-SPI timing model as the playback test
+typedef struct {
+    int fd;
+    uint64_t busy_us;
+    uint32_t commands;
+} imgdev_t;
+
+static int imgdev_read(void *ctx, uint32_t lba, uint32_t count, void *buf) {
+    imgdev_t *d = (imgdev_t *)ctx;
+    d->commands++;
+    d->busy_us += count == 1 ? SPI_CMD_US + SPI_BLOCK_US : SPI_CMD_US + count * SPI_BLOCK_US + SPI_STOP_US;
+    ssize_t n = pread(d->fd, buf, (size_t)count * SECTOR, (off_t)lba * SECTOR);
+    return n == (ssize_t)count * SECTOR ? 0 : -1;
+}
+
+// What FATFS knows after f_open: the volume from the partition's boot sector, the file's
+// first cluster and size from its directory entry (root directory, 8.3 names)
+static bool img_mount(imgdev_t *d, sd_fat_vol_t *vol, uint32_t *root) {
+    uint8_t sec[SECTOR];
+    if (imgdev_read(d, 0, 1, sec) != 0) return false;
+    uint32_t vol_lba = le32(sec + 446 + 8);
+    if (imgdev_read(d, vol_lba, 1, sec) != 0 || !sd_fat_parse_bpb(sec, vol_lba, vol)) return false;
+    *root = vol->fat_bits == 32 ? vol->data_lba + (le32(sec + 44) - 2) * vol->cluster_sectors
+                                : vol->data_lba - 512 * 32 / SECTOR;
+    return true;
+}
+
+static bool img_lookup(imgdev_t *d, uint32_t root, const char *name83, uint32_t *first, uint32_t *size) {
+    uint8_t dir[IMG_MAX_FILES * 32];
+    if (imgdev_read(d, root, sizeof(dir) / SECTOR, dir) != 0) return false;
+    for (int i = 0; i < IMG_MAX_FILES && dir[i * 32]; i++) {
+        const uint8_t *e = dir + i * 32;
+        if (memcmp(e, name83, 11) != 0) continue;
+        *first = ((uint32_t)(e[20] | (e[21] << 8)) << 16) | (uint32_t)(e[26] | (e[27] << 8));
+        *size = le32(e + 28);
+        return true;
+    }
+    return false;
+}
+
+typedef struct {
+    const char *name;
+    const char *ext;
+    uint8_t *data;
+    uint32_t size;
+} media_t;
+
+static uint32_t load_media(media_t *m, uint32_t max) {
+    static const char *jpgs[] = {"cube_lady", "day_dead", "twist_face"};
+    uint32_t n = 0;
+    for (size_t i = 0; i < sizeof(s_samples) / sizeof(s_samples[0]) + 3 && n < max; i++) {
+        bool jpg = i >= sizeof(s_samples) / sizeof(s_samples[0]);
+        media_t *e = &m[n];
+        e->name = jpg ? jpgs[i - sizeof(s_samples) / sizeof(s_samples[0])] : s_samples[i];
+        e->ext = jpg ? "jpg" : "avi";
+        char path[128];
+        snprintf(path, sizeof(path), "4_sd_card/%s.%s", e->name, e->ext);
+        FILE *f = fopen(path, "rb");
+        if (!f) { CHECK(!"sample missing"); continue; }
+        fseek(f, 0, SEEK_END);
+        e->size = (uint32_t)ftell(f);
+        fseek(f, 0, SEEK_SET);
+        e->data = malloc(e->size);
+        CHECK(fread(e->data, 1, e->size, f) == e->size);
+        fclose(f);
+        n++;
+    }
+    return n;
+}
+
+static bool build_image(img_t *img, const char *path, uint32_t fat_bits, uint32_t spc, uint32_t clusters,
+                        media_t *m, uint32_t n) {
+    if (!img_format(img, path, fat_bits, spc, clusters)) return false;
+    uint32_t cluster_bytes = spc * SECTOR;
+    uint8_t *log = malloc(cluster_bytes);
+    memset(log, 'L', cluster_bytes);
+    for (uint32_t i = 0; i < n; i++) {
+        img_file_t *f = img_create(img, m[i].name, m[i].ext);
+        if (strcmp(m[i].name, "eye") != 0) {
+            img_append(img, f, m[i].data, m[i].size);
+            continue;
+        }
+        // Eight clusters of video, one of log, ...
+        img_file_t *lf = img_create(img, "log", "txt");
+        for (uint32_t off = 0; off < m[i].size; off += 8 * cluster_bytes) {
+            uint32_t len = m[i].size - off < 8 * cluster_bytes ? m[i].size - off : 8 * cluster_bytes;
+            img_append(img, f, m[i].data + off, len);
+            img_append(img, lf, log, cluster_bytes);
+        }
+    }
+    free(log);
+    img_finish(img);
+    return true;
+}
+
+// FATFS reading a file, modeled: each call pays the VFS/FATFS overhead; crossing into a
+// cluster follows one FAT link (a FAT sector read unless it is in the volume window); whole
+// sectors within a cluster are one multi-block read into a DMA-capable buffer and single
+// blocks otherwise; partial sectors go through the file's one-sector buffer.
+typedef struct {
+    uint32_t first;
+    uint32_t cluster_bytes;
+    uint32_t fat_bits;
+    int64_t fat_window;
+    int64_t file_window;
+    int64_t cluster_idx;
+} fatfs_model_t;
+
+static void fatfs_cost(imgdev_t *d, fatfs_model_t *m, uint32_t off, uint32_t len, bool dma) {
+    d->busy_us += VFS_CALL_US;
+    uint32_t end = off + len;
+    uint32_t per_fat_sector = SECTOR / (m->fat_bits / 8);
+    while (off < end) {
+        int64_t idx = off / m->cluster_bytes;
+        // A backward seek walks the chain again from the start
+        if (idx < m->cluster_idx) m->cluster_idx = 0;
+        for (; m->cluster_idx < idx; m->cluster_idx++) {
+            int64_t fs = (m->first + m->cluster_idx) / per_fat_sector;
+            if (fs != m->fat_window) {
+                d->commands++;
+                d->busy_us += SPI_CMD_US + SPI_BLOCK_US;
+                m->fat_window = fs;
+            }
+        }
+        uint32_t in_sector = off % SECTOR;
+        if (in_sector || end - off < SECTOR) {
+            if (m->file_window != off / SECTOR) {
+                d->commands++;
+                d->busy_us += SPI_CMD_US + SPI_BLOCK_US;
+                m->file_window = off / SECTOR;
+            }
+            off += end - off < SECTOR - in_sector ? end - off : SECTOR - in_sector;
+            continue;
+        }
+        uint32_t to_cluster = m->cluster_bytes - off % m->cluster_bytes;
+        uint32_t n = ((end - off) < to_cluster ? (end - off) : to_cluster) / SECTOR;
+        if (dma) {
+            d->commands++;
+            d->busy_us += SPI_CMD_US + n * SPI_BLOCK_US + SPI_STOP_US;
+        } else {
+            d->commands += n;
+            d->busy_us += n * (SPI_CMD_US + SPI_BLOCK_US);
+        }
+        off += n * SECTOR;
+    }
+}
+
+static void test_fat_layout(void) {
+    // FAT12 volumes are left to FATFS
+    uint8_t boot[SECTOR] = {0};
+    wr16(boot + 11, SECTOR);
+    boot[13] = 4;
+    wr16(boot + 14, 1);
+    boot[16] = 2;
+    wr16(boot + 17, 224);
+    wr16(boot + 19, 2880);
+    wr16(boot + 22, 9);
+    wr16(boot + 510, 0xAA55);
+    sd_fat_vol_t vol;
+    sd_fat_extent_t ext;
+    CHECK(sd_fat_parse_bpb(boot, 0, &vol) && vol.fat_bits == 12);
+    CHECK(sd_fat_map_file(&vol, 2, 1000, imgdev_read, NULL, NULL, NULL, &ext) == SD_FAT_UNSUPPORTED);
+    wr16(boot + 510, 0);
+    CHECK(!sd_fat_parse_bpb(boot, 0, &vol));
+
+    media_t m[16];
+    uint32_t n = load_media(m, 16);
+    static const struct { const char *path; uint32_t bits, spc, clusters; } cfg[] = {
+        {"/tmp/sd_card_fat16.img", 16, 8, 12000},       // 47 MB, 4 KB clusters
+        {"/tmp/sd_card_fat32.img", 32, 32, 66000},      // 1 GB sparse, 16 KB clusters
+    };
+    for (size_t c = 0; c < sizeof(cfg) / sizeof(cfg[0]); c++) {
+        img_t img;
+        CHECK(build_image(&img, cfg[c].path, cfg[c].bits, cfg[c].spc, cfg[c].clusters, m, n));
+        imgdev_t dev = {.fd = img.fd};
+        uint32_t root = 0;
+        CHECK(img_mount(&dev, &vol, &root));
+        CHECK(vol.fat_bits == cfg[c].bits && vol.cluster_sectors == cfg[c].spc && vol.data_lba == img.data_lba);
+
+        uint8_t sector[SECTOR];
+        uint8_t bounce[4096];
+        uint8_t *buf = malloc(3 * 1024 * 1024);
+        srand(1234);
+        for (uint32_t i = 0; i < n; i++) {
+            char name83[11];
+            img_name83(m[i].name, m[i].ext, name83);
+            uint32_t first = 0, size = 0, fat_reads = 0;
+            CHECK(img_lookup(&dev, root, name83, &first, &size) && size == m[i].size);
+            sd_fat_layout_t layout = sd_fat_map_file(&vol, first, size, imgdev_read, &dev, sector,
+                                                     &fat_reads, &ext);
+            bool eye = strcmp(m[i].name, "eye") == 0;
+            CHECK(layout == (eye ? SD_FAT_FRAGMENTED : SD_FAT_CONTIGUOUS));
+            // One FAT sector covers 256 (FAT16) or 128 (FAT32) clusters
+            CHECK(fat_reads <= size / (vol.cluster_sectors * SECTOR) / (SECTOR / (vol.fat_bits / 8)) + 2);
+            if (layout != SD_FAT_CONTIGUOUS) continue;
+
+            // The whole file in one read, then random ranges both ways
+            CHECK(sd_fat_extent_read(&ext, 0, buf, size + 100, true, bounce, sizeof(bounce),
+                                     imgdev_read, &dev, NULL) == (int32_t)size);
+            CHECK(memcmp(buf, m[i].data, size) == 0);
+            for (int k = 0; k < 200; k++) {
+                uint32_t off = (uint32_t)rand() % size;
+                uint32_t len = (uint32_t)rand() % (k & 1 ? 600 : 40000) + 1;
+                uint32_t want = len < size - off ? len : size - off;
+                memset(buf, 0xA5, want);
+                int32_t got = sd_fat_extent_read(&ext, off, buf, len, k & 2, bounce, sizeof(bounce),
+                                                 imgdev_read, &dev, NULL);
+                CHECK(got == (int32_t)want && memcmp(buf, m[i].data + off, want) == 0);
+            }
+            CHECK(sd_fat_extent_read(&ext, size, buf, 10, true, bounce, sizeof(bounce),
+                                     imgdev_read, &dev, NULL) == 0);
+        }
+        free(buf);
+
+        // Empty files, and chains that are broken or run off the volume
+        CHECK(sd_fat_map_file(&vol, 0, 0, imgdev_read, &dev, sector, NULL, &ext) == SD_FAT_CONTIGUOUS && ext.size == 0);
+        CHECK(sd_fat_map_file(&vol, 0, 100, imgdev_read, &dev, sector, NULL, &ext) == SD_FAT_ERR);
+        CHECK(sd_fat_map_file(&vol, vol.clusters, 3 * vol.cluster_sectors * SECTOR, imgdev_read, &dev,
+                              sector, NULL, &ext) == SD_FAT_FRAGMENTED);
+        img_file_t *f = &img.files[0];
+        CHECK(sd_fat_map_file(&vol, f->first, f->size + 4 * vol.cluster_sectors * SECTOR, imgdev_read, &dev,
+                              sector, NULL, &ext) == SD_FAT_ERR);
+        dev.fd = -1;
+        CHECK(sd_fat_map_file(&vol, f->first, f->size, imgdev_read, &dev, sector, NULL, &ext) == SD_FAT_ERR);
+
+        close(img.fd);
+        free(img.fat);
+        unlink(cfg[c].path);
+    }
+    for (uint32_t i = 0; i < n; i++) free(m[i].data);
+}
+
+static void test_fat_throughput(void) {
+    media_t m[16];
+    uint32_t n = load_media(m, 16);
+    static const struct { const char *path; uint32_t bits, spc, clusters; } cfg[] = {
+        {"/tmp/sd_card_fat16.img", 16, 8, 12000},
+        {"/tmp/sd_card_fat32.img", 32, 32, 66000},
+    };
+    printf("%-24s | %-25s | %-25s | %s\n", "volume", "playback reads, DMA ring", "whole-file loads, PSRAM",
+           "fragmented");
+    for (size_t c = 0; c < sizeof(cfg) / sizeof(cfg[0]); c++) {
+        img_t img;
+        CHECK(build_image(&img, cfg[c].path, cfg[c].bits, cfg[c].spc, cfg[c].clusters, m, n));
+        imgdev_t dev = {.fd = img.fd};
+        sd_fat_vol_t vol;
+        uint32_t root = 0;
+        CHECK(img_mount(&dev, &vol, &root));
+        uint32_t cluster_bytes = vol.cluster_sectors * SECTOR;
+        // sd_reader's slots: a cluster through FATFS (it splits reads there anyway), the
+        // largest SPI transfer on the raw path
+        uint32_t fat_slot = cluster_bytes < 4096 ? 4096 : cluster_bytes > 32768 ? 32768 : cluster_bytes;
+        uint32_t raw_slot = 32768;
+
+        imgdev_t fat_play = {.fd = img.fd}, raw_play = {.fd = img.fd};
+        imgdev_t fat_load = {.fd = img.fd}, raw_load = {.fd = img.fd};
+        uint64_t play_bytes = 0, load_bytes = 0;
+        uint32_t fragmented = 0;
+        uint8_t sector[SECTOR];
+        uint8_t bounce[4096];
+        uint8_t *buf = malloc(3 * 1024 * 1024);
+        for (uint32_t i = 0; i < n; i++) {
+            char name83[11];
+            img_name83(m[i].name, m[i].ext, name83);
+            uint32_t first = 0, size = 0;
+            CHECK(img_lookup(&dev, root, name83, &first, &size));
+            sd_fat_extent_t ext;
+            if (sd_fat_map_file(&vol, first, size, imgdev_read, &raw_play, sector, NULL, &ext) != SD_FAT_CONTIGUOUS) {
+                fragmented++;
+                continue;
+            }
+            bool avi = strcmp(m[i].ext, "avi") == 0;
+            fatfs_model_t fm = {.first = first, .cluster_bytes = cluster_bytes, .fat_bits = vol.fat_bits,
+                                .fat_window = -1, .file_window = -1};
+            if (avi) {
+                for (uint32_t off = 0; off < size; off += fat_slot) {
+                    fatfs_cost(&fat_play, &fm, off, size - off < fat_slot ? size - off : fat_slot, true);
+                }
+                for (uint32_t off = 0; off < size; off += raw_slot) {
+                    CHECK(sd_fat_extent_read(&ext, off, buf, raw_slot, true, bounce, sizeof(bounce),
+                                             imgdev_read, &raw_play, NULL) > 0);
+                }
+                play_bytes += size;
+            }
+            // sd_io loading a whole file into a PSRAM buffer
+            fm.fat_window = fm.file_window = -1;
+            fm.cluster_idx = 0;
+            fatfs_cost(&fat_load, &fm, 0, size, false);
+            CHECK(sd_fat_extent_read(&ext, 0, buf, size, false, bounce, sizeof(bounce),
+                                     imgdev_read, &raw_load, NULL) == (int32_t)size);
+            CHECK(memcmp(buf, m[i].data, size) == 0);
+            load_bytes += size;
+        }
+        free(buf);
+
+        double fp = play_bytes / (double)fat_play.busy_us, rp = play_bytes / (double)raw_play.busy_us;
+        double fl = load_bytes / (double)fat_load.busy_us, rl = load_bytes / (double)raw_load.busy_us;
+        char label[32];
+        snprintf(label, sizeof(label), "FAT%u, %u KB clusters", (unsigned)vol.fat_bits, (unsigned)(cluster_bytes / 1024));
+        printf("%-24s | FATFS %4.2f, raw %4.2f MB/s | FATFS %4.2f, raw %4.2f MB/s | %u file(s) stay on FATFS\n",
+               label, fp, rp, fl, rl, (unsigned)fragmented);
+        printf("%-24s | %5.1f vs %4.1f cmd/MB      | %6.0f vs %4.0f cmd/MB     |\n", "",
+               fat_play.commands * 1e6 / play_bytes, raw_play.commands * 1e6 / play_bytes,
+               fat_load.commands * 1e6 / load_bytes, raw_load.commands * 1e6 / load_bytes);
+
+        // The raw path never loses (with 16 KB clusters the bus is already the limit for
+        // playback), and wins where FATFS is held back: small clusters and buffers it cannot
+        // DMA into
+        CHECK(fragmented == 1);
+        CHECK(rp > fp);
+        if (cluster_bytes < 16384) CHECK(rp > fp * 1.1);
+        CHECK(rl > fl * 1.5);
+
+        close(img.fd);
+        free(img.fat);
+        unlink(cfg[c].path);
+    }
+    for (uint32_t i = 0; i < n; i++) free(m[i].data);
+}
+
+int main(void) {
+    test_stream_matches_file();
+    test_seek_and_end();
+    test_stream_parts();
+    test_playback();
+    test_io_priorities_and_reads();
+    test_io_list_and_write();
+    test_io_cancel();
+    test_io_ui_never_blocks();
+    test_fat_layout();
+    test_fat_throughput();
+
+    if (s_failures) {
+        printf("%d check(s) failed\n", s_failures);
+        return 1;
+    }
+    printf("sd_card host tests passed\n");
+    return 0;
+}
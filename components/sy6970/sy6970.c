@@ -1,12 +1,17 @@
 #include "sy6970.h"
+#include "sy6970_shadow.h"
+#include "sy6970_monitor.h"
+#include "sy6970_adc.h"
 #include <stdbool.h>
 #include <string.h>
 #include <esp_err.h>
 #include "driver/i2c_master.h"
+#include "driver/gpio.h"
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 
 #define I2C_MASTER_FREQ_HZ          400000 // 400kHz
 #define I2C_TIMEOUT_MS              1000   // 1 second timeout for I2C operations
@@ -15,6 +20,29 @@ static const char *TAG = "sy6970";
 
 static i2c_master_bus_handle_t bus_handle = NULL;
 static i2c_master_dev_handle_t dev_handle = NULL;
+static sy6970_bus_hook_t s_bus_hook = NULL;
+static void *s_bus_hook_ctx = NULL;
+
+// Register shadow: status snapshot + write-through config cache. The recursive lock
+// guards it and is held across sy6970_burst_begin()/end().
+static sy6970_shadow_t s_shadow;
+static SemaphoreHandle_t s_lock = NULL;
+static esp_err_t s_last_err = ESP_OK;
+
+// INT line: the ISR only wakes the waiting task, the monitor decides what to read.
+// The same semaphore wakes the task when ADC consumers change (s_int_fired tells them apart).
+static sy6970_monitor_t s_monitor;
+static sy6970_adc_t s_adc;
+static SemaphoreHandle_t s_int_sem = NULL;
+static portMUX_TYPE s_int_mux = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool s_int_fired = false;
+static bool s_int_armed = false;
+static volatile bool s_int_wake = false;    // INT armed as a low-level light-sleep wake source
+
+void sy6970_set_bus_hook(sy6970_bus_hook_t hook, void *user_ctx) {
+    s_bus_hook_ctx = user_ctx;
+    s_bus_hook = hook;
+}
 
 esp_err_t sy6970_enable_stat_led(bool enable) {
     // STAT_DIS bit: 0 = Enable STAT output (hardware-controlled), 1 = Disable STAT output
@@ -25,6 +53,13 @@ esp_err_t sy6970_enable_stat_led(bool enable) {
 esp_err_t sy6970_deinit(void) {
     // Enable STAT pin for hardware control on cleanup
     sy6970_update_reg(SY6970_REG_07, SY6970_REG07_STAT_DIS, 0);
+
+    if (s_int_armed) {
+        gpio_isr_handler_remove(SY6970_INT_PIN);
+        if (s_int_wake) gpio_wakeup_disable(SY6970_INT_PIN);
+        s_int_armed = false;
+        s_int_wake = false;
+    }
     
     // Delete I2C device handle
     if (dev_handle) {
@@ -42,26 +77,250 @@ esp_err_t sy6970_deinit(void) {
     return ESP_OK;
 }
 
+// --- Bus access (used by the shadow) ---
+static bool bus_read(void *ctx, uint8_t reg, uint8_t *buf, size_t len) {
+    if (s_bus_hook) s_bus_hook(true, s_bus_hook_ctx);
+    s_last_err = i2c_master_transmit_receive(dev_handle, &reg, 1, buf, len, I2C_TIMEOUT_MS);
+    if (s_bus_hook) s_bus_hook(false, s_bus_hook_ctx);
+    return s_last_err == ESP_OK;
+}
+
+static bool bus_write(void *ctx, uint8_t reg, uint8_t val) {
+    uint8_t write_buf[2] = {reg, val};
+    if (s_bus_hook) s_bus_hook(true, s_bus_hook_ctx);
+    s_last_err = i2c_master_transmit(dev_handle, write_buf, sizeof(write_buf), I2C_TIMEOUT_MS);
+    if (s_bus_hook) s_bus_hook(false, s_bus_hook_ctx);
+    return s_last_err == ESP_OK;
+}
+
+static void shadow_lock(void) {
+    if (s_lock) xSemaphoreTakeRecursive(s_lock, portMAX_DELAY);
+}
+
+static void shadow_unlock(void) {
+    if (s_lock) xSemaphoreGiveRecursive(s_lock);
+}
+
+void sy6970_burst_begin(void) {
+    shadow_lock();
+    if (s_bus_hook) s_bus_hook(true, s_bus_hook_ctx);
+}
+
+void sy6970_burst_end(void) {
+    if (s_bus_hook) s_bus_hook(false, s_bus_hook_ctx);
+    shadow_unlock();
+}
+
 esp_err_t sy6970_write_reg(uint8_t reg, uint8_t data) {
-    uint8_t write_buf[2] = {reg, data};
-    return i2c_master_transmit(dev_handle, write_buf, sizeof(write_buf), I2C_TIMEOUT_MS);
+    shadow_lock();
+    bool ok = sy6970_shadow_write(&s_shadow, reg, data);
+    esp_err_t ret = ok ? ESP_OK : s_last_err;
+    shadow_unlock();
+    return ret;
 }
 
+// Served from the shadow: status registers from a snapshot no older than the max age,
+// configuration registers from the write-through cache
 esp_err_t sy6970_read_reg(uint8_t reg, uint8_t *data) {
-    return i2c_master_transmit_receive(dev_handle, &reg, 1, data, 1, I2C_TIMEOUT_MS);
+    shadow_lock();
+    bool ok = sy6970_shadow_read(&s_shadow, reg, esp_timer_get_time(), data);
+    esp_err_t ret = ok ? ESP_OK : s_last_err;
+    shadow_unlock();
+    if (!ok && ret == ESP_OK) ret = ESP_ERR_INVALID_ARG;  // outside the register map
+    return ret;
+}
+
+// Always goes to the chip (e.g. to verify a write); the result refreshes the shadow
+static esp_err_t read_reg_direct(uint8_t reg, uint8_t *data) {
+    shadow_lock();
+    esp_err_t ret = bus_read(NULL, reg, data, 1) ? ESP_OK : s_last_err;
+    if (ret == ESP_OK) sy6970_shadow_note(&s_shadow, reg, *data);
+    shadow_unlock();
+    return ret;
 }
 
 esp_err_t sy6970_update_reg(uint8_t reg, uint8_t mask, uint8_t val) {
-    uint8_t data;
-    esp_err_t ret = sy6970_read_reg(reg, &data);
-    if (ret != ESP_OK) return ret;
-    data &= ~mask;
-    data |= (val & mask);
-    return sy6970_write_reg(reg, data);
+    shadow_lock();
+    bool ok = sy6970_shadow_update(&s_shadow, reg, mask, val, esp_timer_get_time());
+    esp_err_t ret = ok ? ESP_OK : s_last_err;
+    shadow_unlock();
+    return ret;
+}
+
+esp_err_t sy6970_refresh_status(bool force) {
+    shadow_lock();
+    bool ok = sy6970_shadow_refresh(&s_shadow, esp_timer_get_time(), force);
+    esp_err_t ret = ok ? ESP_OK : s_last_err;
+    shadow_unlock();
+    return ret;
+}
+
+bool sy6970_get_snapshot(sy6970_snapshot_t *snap) {
+    if (!snap) return false;
+    shadow_lock();
+    *snap = s_shadow.snap;
+    shadow_unlock();
+    return snap->valid;
+}
+
+void sy6970_set_snapshot_max_age(uint32_t max_age_ms) {
+    shadow_lock();
+    s_shadow.max_age_us = max_age_ms * 1000;
+    shadow_unlock();
+}
+
+void sy6970_get_shadow_stats(sy6970_shadow_stats_t *stats) {
+    if (!stats) return;
+    shadow_lock();
+    *stats = s_shadow.stats;
+    shadow_unlock();
+}
+
+static void IRAM_ATTR sy6970_isr_handler(void *arg) {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    // A level interrupt repeats for the whole 256 us pulse; masked until the next wait
+    if (s_int_wake) gpio_intr_disable(SY6970_INT_PIN);
+    portENTER_CRITICAL_ISR(&s_int_mux);
+    s_int_fired = true;
+    portEXIT_CRITICAL_ISR(&s_int_mux);
+    if (s_int_sem) {
+        xSemaphoreGiveFromISR(s_int_sem, &xHigherPriorityTaskWoken);
+    }
+    if (xHigherPriorityTaskWoken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+esp_err_t sy6970_enable_int(void) {
+    if (s_int_armed) return ESP_OK;
+    if (s_int_sem == NULL) {
+        s_int_sem = xSemaphoreCreateBinary();
+        if (s_int_sem == NULL) return ESP_ERR_NO_MEM;
+    }
+
+    // Open drain with an external 10K pull-up (R26); the chip pulls it low for 256 us
+    gpio_config_t int_conf = {
+        .pin_bit_mask = (1ULL << SY6970_INT_PIN),
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = 1,
+        .pull_down_en = 0,
+        .intr_type = GPIO_INTR_NEGEDGE,
+    };
+    esp_err_t ret = gpio_config(&int_conf);
+    if (ret == ESP_OK) ret = gpio_isr_handler_add(SY6970_INT_PIN, sy6970_isr_handler, NULL);
+    if (ret != ESP_OK) {
+        // Without INT the status registers have to be polled again
+        ESP_LOGW(TAG, "INT unavailable (%s), polling status every %d ms",
+                 esp_err_to_name(ret), SY6970_STATUS_POLL_MS);
+        shadow_lock();
+        s_monitor.cfg.status_poll_us = SY6970_STATUS_POLL_MS * 1000;
+        shadow_unlock();
+        return ret;
+    }
+    s_int_armed = true;
+    return ESP_OK;
+}
+
+bool sy6970_wait_event(uint32_t timeout_ms) {
+    if (!s_int_sem) {
+        vTaskDelay(pdMS_TO_TICKS(timeout_ms == SY6970_WAIT_FOREVER ? 1000 : timeout_ms));
+        return false;
+    }
+    TickType_t ticks = (timeout_ms == SY6970_WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    if (s_int_wake) gpio_intr_enable(SY6970_INT_PIN);
+    if (xSemaphoreTake(s_int_sem, ticks) != pdTRUE) return false;
+    portENTER_CRITICAL(&s_int_mux);
+    bool fired = s_int_fired;
+    s_int_fired = false;
+    portEXIT_CRITICAL(&s_int_mux);
+    return fired;
+}
+
+esp_err_t sy6970_enable_wakeup(void) {
+    if (!s_int_armed) return ESP_ERR_INVALID_STATE;
+    // Only a low-level interrupt wakes the chip from light sleep
+    esp_err_t ret = gpio_wakeup_enable(SY6970_INT_PIN, GPIO_INTR_LOW_LEVEL);
+    if (ret == ESP_OK) s_int_wake = true;
+    return ret;
+}
+
+// Wake sy6970_wait_event() early without reporting INT (new ADC demand)
+static void wake_event_task(void) {
+    if (s_int_sem) xSemaphoreGive(s_int_sem);
+}
+
+uint32_t sy6970_poll_events(bool irq, uint32_t *next_ms) {
+    uint32_t wait_us = 0, adc_wait_us = 0;
+    uint32_t events = 0;
+    shadow_lock();
+    int64_t now = esp_timer_get_time();
+    // ADC first: its burst also carries the status registers, which the monitor then reuses
+    if (sy6970_adc_poll(&s_adc, &s_shadow, now, &adc_wait_us)) events |= SY6970_EVT_ADC;
+    events |= sy6970_monitor_poll(&s_monitor, &s_shadow, irq, now, &wait_us);
+    shadow_unlock();
+    if (adc_wait_us < wait_us) wait_us = adc_wait_us;
+    // Round up so the task does not wake just before the deadline and poll for nothing
+    if (next_ms) *next_ms = (wait_us == UINT32_MAX) ? SY6970_WAIT_FOREVER : (wait_us + 999) / 1000;
+    return events;
+}
+
+int sy6970_adc_request(uint8_t channels, uint32_t max_age_ms) {
+    shadow_lock();
+    int handle = sy6970_adc_add(&s_adc, channels, max_age_ms * 1000);
+    shadow_unlock();
+    if (handle < 0) ESP_LOGW(TAG, "No free ADC consumer slot");
+    wake_event_task();
+    return handle;
+}
+
+void sy6970_adc_change(int handle, uint8_t channels, uint32_t max_age_ms) {
+    shadow_lock();
+    sy6970_adc_update(&s_adc, handle, channels, max_age_ms * 1000);
+    shadow_unlock();
+    wake_event_task();
+}
+
+void sy6970_adc_release(int handle) {
+    shadow_lock();
+    sy6970_adc_remove(&s_adc, handle);
+    shadow_unlock();
+    wake_event_task();
+}
+
+bool sy6970_get_adc_values(sy6970_adc_values_t *values) {
+    if (!values) return false;
+    shadow_lock();
+    bool ok = sy6970_adc_get(&s_adc, values);
+    shadow_unlock();
+    return ok;
+}
+
+void sy6970_get_adc_stats(sy6970_adc_stats_t *stats) {
+    if (!stats) return;
+    shadow_lock();
+    sy6970_adc_get_stats(&s_adc, esp_timer_get_time(), stats);
+    shadow_unlock();
+}
+
+void sy6970_get_monitor_stats(sy6970_monitor_stats_t *stats) {
+    if (!stats) return;
+    shadow_lock();
+    *stats = s_monitor.stats;
+    shadow_unlock();
 }
 
 esp_err_t sy6970_init(void) {
     ESP_LOGI(TAG, "Initializing SY6970 PMIC...");
+
+    if (!s_lock) s_lock = xSemaphoreCreateRecursiveMutex();
+    if (!s_lock) return ESP_ERR_NO_MEM;
+    sy6970_shadow_init(&s_shadow, bus_read, bus_write, NULL, SY6970_SNAPSHOT_MAX_AGE_MS * 1000);
+    sy6970_monitor_config_t mon_cfg;
+    sy6970_monitor_config_default(&mon_cfg);
+    sy6970_monitor_init(&s_monitor, &mon_cfg);
+    sy6970_adc_init(&s_adc, esp_timer_get_time());
+    if (!s_int_sem) s_int_sem = xSemaphoreCreateBinary();
+    if (!s_int_sem) return ESP_ERR_NO_MEM;
     
     // Initialize I2C Master Bus
     i2c_master_bus_config_t bus_config = {
@@ -93,7 +352,7 @@ esp_err_t sy6970_init(void) {
     }
 
     uint8_t chip_id = 0;
-    ret = sy6970_read_reg(SY6970_REG_14, &chip_id);
+    ret = read_reg_direct(SY6970_REG_14, &chip_id);
     if (ret == ESP_OK) {
         ESP_LOGI(TAG, "SY6970 Chip ID/Rev: 0x%02X", chip_id);
     } else {
@@ -112,10 +371,10 @@ esp_err_t sy6970_init(void) {
     // REG_01: VINDPM default, temp default (0x1B)
     sy6970_update_reg(SY6970_REG_01, 0xFF, 0x1B);
 
-    // REG_02: ADC/Boost Freq default (0x3C in most docs, but we explicitly set ADC bits)
-    // Enable ADC (Bit 7) and Continuous Mode (Bit 6) to ensure all ADC channels are monitored
-    // constantly (VBUS, VBAT, VSYS, IBUS, IBAT, Temp, etc.)
-    sy6970_update_reg(SY6970_REG_02, 0xFF, 0x3C | SY6970_REG02_EN_ADC | SY6970_REG02_ADC_CONT);
+    // REG_02: ADC/Boost Freq default (0x3C)
+    // ADC idle: the conversion scheduler sets CONV_START (Bit 7) / CONV_RATE (Bit 6) on demand
+    // once consumers register (see sy6970_adc_request)
+    sy6970_update_reg(SY6970_REG_02, 0xFF, 0x3C);
 
     // REG_03: SYS_MIN=3.5V, OTG=0, CHG=1 (0x18)
     sy6970_update_reg(SY6970_REG_03, 0xFF, 0x18);
@@ -208,7 +467,7 @@ esp_err_t sy6970_set_input_voltage_limit(uint16_t voltage_mv) {
     
     // Immediate Readback Verification
     uint8_t verify_val = 0;
-    sy6970_read_reg(SY6970_REG_0D, &verify_val);
+    read_reg_direct(SY6970_REG_0D, &verify_val);
     
     if (ret == ESP_OK) {
         ESP_LOGI(TAG, "Set VINDPM to %d mV (Write: 0x%02X). Readback: 0x%02X", voltage_mv, write_val, verify_val);
@@ -354,58 +613,44 @@ esp_err_t sy6970_set_watchdog_timer(sy6970_wdt_t timeout) {
 }
 
 esp_err_t sy6970_enable_adc(bool enable, bool continuous) {
-    uint8_t val = 0;
-    if (enable) val |= SY6970_REG02_EN_ADC;
-    if (continuous) val |= SY6970_REG02_ADC_CONT;
-    return sy6970_update_reg(SY6970_REG_02, SY6970_REG02_EN_ADC | SY6970_REG02_ADC_CONT, val);
+    // REG_02 is written by the scheduler on the next poll
+    shadow_lock();
+    sy6970_adc_set_enabled(&s_adc, enable, continuous);
+    shadow_unlock();
+    wake_event_task();
+    return ESP_OK;
 }
 
 uint16_t sy6970_get_vbus_voltage(void) {
     uint8_t val;
     sy6970_read_reg(SY6970_REG_11, &val);
-    if (!(val & 0x80)) return 0; // BUS_GD not set
-    val &= 0x7F;
-    return 2600 + (val * 100);
+    return sy6970_adc_decode_vbus(val);
 }
 
 uint16_t sy6970_get_battery_voltage(void) {
     uint8_t val;
     sy6970_read_reg(SY6970_REG_0E, &val);
-    val &= 0x7F;
-    return 2304 + (val * 20);
+    return sy6970_adc_decode_vbat(val);
 }
 
 uint16_t sy6970_get_system_voltage(void) {
     uint8_t val;
     sy6970_read_reg(SY6970_REG_0F, &val);
-    val &= 0x7F;
-    return 2304 + (val * 20);
+    return sy6970_adc_decode_vsys(val);
 }
 
 uint16_t sy6970_get_charge_current(void) {
-    // Check charge status first
-    uint8_t status_reg;
+    // Charge status masks the ADC offset/noise when not charging
+    uint8_t status_reg, val;
     sy6970_read_reg(SY6970_REG_0B, &status_reg);
-    uint8_t chg_stat = (status_reg >> 3) & 0x03;
-
-    // If Not Charging or Done, return 0 mA to mask ADC offset/noise
-    if (chg_stat == SY6970_CHG_NOT_CHARGING || chg_stat == SY6970_CHG_TERM_DONE) {
-        return 0;
-    }
-
-    uint8_t val;
     sy6970_read_reg(SY6970_REG_12, &val);
-    val &= 0x7F;
-    return val * 50;
+    return sy6970_adc_decode_ichg(val, status_reg);
 }
 
 uint8_t sy6970_get_ntc_percentage(void) {
     uint8_t val;
     sy6970_read_reg(SY6970_REG_10, &val);
-    val &= 0x7F;
-    // NTC/REGN = 21% + [val]*0.465%
-    // We return integer percentage, so roughly:
-    return 21 + (val * 465 / 1000);
+    return sy6970_adc_decode_ntc(val);
 }
 
 const char* sy6970_get_ntc_temperature_status(uint8_t ntc_percent) {
@@ -5,6 +5,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "driver/i2c_master.h"
+#include "sy6970_shadow.h"
+#include "sy6970_monitor.h"
+#include "sy6970_adc.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -13,6 +16,14 @@ extern "C" {
 #define SY6970_I2C_ADDR 0x6A
 #define SY6970_SDA_PIN  6
 #define SY6970_SCL_PIN  7
+// 6970_INT: open drain, pulled up by R26, pulses low on a status change or new fault
+#ifndef SY6970_INT_PIN
+#define SY6970_INT_PIN  5
+#endif
+// Datasheet limit; other devices on the shared bus must not clock faster than this
+#ifndef SY6970_I2C_MAX_FREQ_HZ
+#define SY6970_I2C_MAX_FREQ_HZ 400000
+#endif
 
 // Register Map
 #define SY6970_REG_00 0x00 // Input Current Limit
@@ -41,8 +52,8 @@ extern "C" {
 #define SY6970_REG00_EN_HIZ         (1 << 7)
 #define SY6970_REG00_EN_ILIM        (1 << 6)
 #define SY6970_REG00_IINLIM_MASK    0x3F
-#define SY6970_REG02_EN_ADC         (1 << 7)
-#define SY6970_REG02_ADC_CONT       (1 << 6)
+#define SY6970_REG02_EN_ADC         (1 << 7)    // CONV_START: self-clears after a one-shot
+#define SY6970_REG02_ADC_CONT       (1 << 6)    // CONV_RATE: 1 = convert every second
 #define SY6970_REG03_WD_RST         (1 << 6)
 #define SY6970_REG03_OTG_CONFIG     (1 << 5)
 #define SY6970_REG03_CHG_CONFIG     (1 << 4)
@@ -89,12 +100,49 @@ esp_err_t sy6970_deinit(void);
 // can share the same I2C bus. Returns NULL if the bus hasn't been created.
 i2c_master_bus_handle_t sy6970_get_bus_handle(void);
 
+// Optional bus arbitration: called with acquire=true before and acquire=false after
+// every register transfer, so the owner of the shared bus can schedule PMIC traffic.
+typedef void (*sy6970_bus_hook_t)(bool acquire, void *user_ctx);
+void sy6970_set_bus_hook(sy6970_bus_hook_t hook, void *user_ctx);
+
 // Register Access (Exposed for debugging)
+// Reads are served from the register shadow: REG_0B..REG_14 from a snapshot refreshed by
+// one burst read once it is older than the max age, REG_00..REG_0A from a write-through cache.
 esp_err_t sy6970_read_reg(uint8_t reg_addr, uint8_t *data);
 esp_err_t sy6970_write_reg(uint8_t reg_addr, uint8_t data);
 esp_err_t sy6970_update_reg(uint8_t reg_addr, uint8_t mask, uint8_t val);
 
-esp_err_t sy6970_enable_adc(bool enable, bool continuous);  // Enable/disable ADC monitoring
+// Status snapshot control
+esp_err_t sy6970_refresh_status(bool force);            // burst-read REG_0B..REG_14 if stale (or always)
+bool sy6970_get_snapshot(sy6970_snapshot_t *snap);      // copy of the last snapshot; false if none yet
+void sy6970_set_snapshot_max_age(uint32_t max_age_ms);  // default SY6970_SNAPSHOT_MAX_AGE_MS
+void sy6970_get_shadow_stats(sy6970_shadow_stats_t *stats);
+
+// Charger events (INT line). sy6970_enable_int() needs gpio_install_isr_service(); if the
+// line cannot be armed the monitor falls back to polling status every SY6970_STATUS_POLL_MS.
+#define SY6970_WAIT_FOREVER UINT32_MAX
+esp_err_t sy6970_enable_int(void);
+bool sy6970_wait_event(uint32_t timeout_ms);                // true if INT fired
+esp_err_t sy6970_enable_wakeup(void);                       // INT also wakes light sleep (after sy6970_enable_int())
+// Read status/faults if INT fired or something is due; returns SY6970_EVT_* flags and
+// sets *next_ms to how long the caller may wait for INT before calling again
+uint32_t sy6970_poll_events(bool irq, uint32_t *next_ms);
+void sy6970_get_monitor_stats(sy6970_monitor_stats_t *stats);
+
+// ADC conversions on demand: register the SY6970_ADC_* channels you read and how old a
+// value may be. Results arrive as SY6970_EVT_ADC from sy6970_poll_events().
+int sy6970_adc_request(uint8_t channels, uint32_t max_age_ms);     // handle, or -1
+void sy6970_adc_change(int handle, uint8_t channels, uint32_t max_age_ms);
+void sy6970_adc_release(int handle);
+bool sy6970_get_adc_values(sy6970_adc_values_t *values);           // last sample; false if none yet
+void sy6970_get_adc_stats(sy6970_adc_stats_t *stats);
+
+// Hold the driver (and the bus, through the hook) across several accesses
+void sy6970_burst_begin(void);
+void sy6970_burst_end(void);
+
+// Master switch for the ADC scheduler; `continuous` pins continuous conversion while enabled
+esp_err_t sy6970_enable_adc(bool enable, bool continuous);
 esp_err_t sy6970_enable_charging(bool enable);  
 esp_err_t sy6970_enable_otg(bool enable);  // Enable/disable Boost OTG (On The Go) mode
 // HIZ - enabled the input Field-Effect Transistor turns OFF as if the USB cable is unplugged. Data + & - 
@@ -0,0 +1,188 @@
+#include "sy6970_adc.h"
+#include <string.h>
+
+#define REG02_CONV_START    0x80    // one-shot: self-clears when done; continuous: ADC on
+#define REG02_CONV_RATE     0x40    // 1 = continuous
+#define ADC_RETRY_US        1000000
+
+void sy6970_adc_init(sy6970_adc_t *a, int64_t now_us) {
+    memset(a, 0, sizeof(*a));
+    a->enabled = true;
+    a->mode = SY6970_ADC_MODE_OFF;
+    a->mode_since_us = now_us;
+}
+
+int sy6970_adc_add(sy6970_adc_t *a, uint8_t channels, uint32_t max_age_us) {
+    if (!channels) return -1;
+    for (int i = 0; i < SY6970_ADC_MAX_CONSUMERS; i++) {
+        if (a->consumers[i].channels == 0) {
+            a->consumers[i].channels = channels;
+            a->consumers[i].max_age_us = max_age_us;
+            return i;
+        }
+    }
+    return -1;
+}
+
+void sy6970_adc_update(sy6970_adc_t *a, int handle, uint8_t channels, uint32_t max_age_us) {
+    if (handle < 0 || handle >= SY6970_ADC_MAX_CONSUMERS) return;
+    a->consumers[handle].channels = channels;
+    a->consumers[handle].max_age_us = max_age_us;
+}
+
+void sy6970_adc_remove(sy6970_adc_t *a, int handle) {
+    sy6970_adc_update(a, handle, 0, 0);
+}
+
+void sy6970_adc_set_enabled(sy6970_adc_t *a, bool enabled, bool force_continuous) {
+    a->enabled = enabled;
+    a->force_continuous = force_continuous;
+}
+
+// Tightest freshness any consumer asked for; 0 if nobody needs the ADC
+static uint32_t required_period(const sy6970_adc_t *a) {
+    uint32_t period = 0;
+    for (int i = 0; i < SY6970_ADC_MAX_CONSUMERS; i++) {
+        const sy6970_adc_consumer_t *c = &a->consumers[i];
+        if (c->channels && (period == 0 || c->max_age_us < period)) period = c->max_age_us;
+    }
+    if (period == 0 && a->force_continuous) period = SY6970_ADC_CONT_PERIOD_MS * 1000;
+    return period;
+}
+
+static sy6970_adc_mode_t wanted_mode(const sy6970_adc_t *a, uint32_t period) {
+    if (!a->enabled || period == 0) return SY6970_ADC_MODE_OFF;
+    if (a->force_continuous || period < SY6970_ADC_CONT_THRESHOLD_MS * 1000) return SY6970_ADC_MODE_CONTINUOUS;
+    return SY6970_ADC_MODE_ONESHOT;
+}
+
+static uint8_t reg(const sy6970_snapshot_t *snap, uint8_t r) {
+    return snap->regs[r - SY6970_SHADOW_STATUS_FIRST];
+}
+
+// One burst brings every channel in together
+static bool read_sample(sy6970_adc_t *a, sy6970_shadow_t *sh, int64_t now_us) {
+    if (!sy6970_shadow_refresh(sh, now_us, true)) return false;
+    const sy6970_snapshot_t *snap = &sh->snap;
+    a->sample.vbat_mv = sy6970_adc_decode_vbat(reg(snap, 0x0E));
+    a->sample.vsys_mv = sy6970_adc_decode_vsys(reg(snap, 0x0F));
+    a->sample.ntc_pct = sy6970_adc_decode_ntc(reg(snap, 0x10));
+    a->sample.vbus_mv = sy6970_adc_decode_vbus(reg(snap, 0x11));
+    a->sample.ichg_ma = sy6970_adc_decode_ichg(reg(snap, 0x12), reg(snap, 0x0B));
+    a->sample.t_us = now_us;
+    a->have_sample = true;
+    a->stats.reads++;
+    return true;
+}
+
+bool sy6970_adc_poll(sy6970_adc_t *a, sy6970_shadow_t *sh, int64_t now_us, uint32_t *wait_us) {
+    uint32_t period = required_period(a);
+    sy6970_adc_mode_t want = wanted_mode(a, period);
+    int64_t next = INT64_MAX;
+    bool fresh = false;
+
+    if (want != a->mode) {
+        uint8_t val = (want == SY6970_ADC_MODE_CONTINUOUS) ? (REG02_CONV_START | REG02_CONV_RATE) : 0;
+        if (!sy6970_shadow_update(sh, 0x02, REG02_CONV_START | REG02_CONV_RATE, val, now_us)) {
+            a->stats.errors++;
+            if (wait_us) *wait_us = ADC_RETRY_US;
+            return false;
+        }
+        if (a->mode == SY6970_ADC_MODE_CONTINUOUS) a->cont_us += (uint64_t)(now_us - a->mode_since_us);
+        a->mode = want;
+        a->mode_since_us = now_us;
+        a->converting = false;
+        a->stats.mode_changes++;
+    }
+
+    if (a->mode == SY6970_ADC_MODE_CONTINUOUS) {
+        // The chip refreshes every second on its own; just collect often enough
+        int64_t due = a->have_sample ? a->sample.t_us + period : now_us;
+        if (due < a->mode_since_us + SY6970_ADC_CONV_MS * 1000) due = a->mode_since_us + SY6970_ADC_CONV_MS * 1000;
+        if (now_us >= due) {
+            fresh = read_sample(a, sh, now_us);
+            if (!fresh) a->stats.errors++;
+            due = fresh ? now_us + period : now_us + ADC_RETRY_US;
+        }
+        next = due;
+    } else if (a->mode == SY6970_ADC_MODE_ONESHOT) {
+        if (!a->converting) {
+            // Start just early enough for the result to be ready when the sample expires
+            int64_t start = a->have_sample ? a->sample.t_us + period - SY6970_ADC_CONV_MS * 1000 : now_us;
+            if (now_us < start) {
+                next = start;
+            } else if (sy6970_shadow_update(sh, 0x02, REG02_CONV_START, REG02_CONV_START, now_us)) {
+                a->converting = true;
+                a->conv_done_us = now_us + SY6970_ADC_CONV_MS * 1000;
+                a->stats.conversions++;
+            } else {
+                a->stats.errors++;
+                next = now_us + ADC_RETRY_US;
+            }
+        }
+        if (a->converting) {
+            if (now_us < a->conv_done_us) {
+                next = a->conv_done_us;
+            } else if (read_sample(a, sh, now_us)) {
+                fresh = true;
+                a->converting = false;
+                next = now_us + period - SY6970_ADC_CONV_MS * 1000;
+            } else {
+                a->stats.errors++;
+                next = now_us + ADC_RETRY_US;
+            }
+        }
+    }
+
+    if (wait_us) {
+        if (next == INT64_MAX) *wait_us = UINT32_MAX;
+        else *wait_us = next > now_us ? (uint32_t)(next - now_us) : 0;
+    }
+    return fresh;
+}
+
+bool sy6970_adc_get(const sy6970_adc_t *a, sy6970_adc_values_t *out) {
+    if (!a->have_sample) return false;
+    *out = a->sample;
+    return true;
+}
+
+void sy6970_adc_get_stats(const sy6970_adc_t *a, int64_t now_us, sy6970_adc_stats_t *out) {
+    uint64_t cont_us = a->cont_us;
+    if (a->mode == SY6970_ADC_MODE_CONTINUOUS) cont_us += (uint64_t)(now_us - a->mode_since_us);
+    *out = a->stats;
+    out->conversions += (uint32_t)(cont_us / (SY6970_ADC_CONT_PERIOD_MS * 1000));
+}
+
+uint32_t sy6970_adc_saved_ua(uint32_t conversions, uint64_t elapsed_us) {
+    uint64_t continuous = elapsed_us / (SY6970_ADC_CONT_PERIOD_MS * 1000);
+    if (elapsed_us == 0 || conversions >= continuous) return 0;
+    // Average current = conversions * conversion time * active current / elapsed time
+    uint64_t saved_ua_us = (continuous - conversions) * (uint64_t)SY6970_ADC_CONV_MS * 1000 * SY6970_ADC_ACTIVE_UA;
+    return (uint32_t)(saved_ua_us / elapsed_us);
+}
+
+uint16_t sy6970_adc_decode_vbat(uint8_t reg0e) {
+    return 2304 + ((reg0e & 0x7F) * 20);
+}
+
+uint16_t sy6970_adc_decode_vsys(uint8_t reg0f) {
+    return 2304 + ((reg0f & 0x7F) * 20);
+}
+
+uint8_t sy6970_adc_decode_ntc(uint8_t reg10) {
+    // NTC/REGN = 21% + [val]*0.465%
+    return 21 + ((reg10 & 0x7F) * 465 / 1000);
+}
+
+uint16_t sy6970_adc_decode_vbus(uint8_t reg11) {
+    if (!(reg11 & 0x80)) return 0; // BUS_GD not set
+    return 2600 + ((reg11 & 0x7F) * 100);
+}
+
+uint16_t sy6970_adc_decode_ichg(uint8_t reg12, uint8_t reg0b) {
+    // If Not Charging or Done, return 0 mA to mask ADC offset/noise
+    uint8_t chg_stat = (reg0b >> 3) & 0x03;
+    if (chg_stat == 0 || chg_stat == 3) return 0;
+    return (reg12 & 0x7F) * 50;
+}
@@ -0,0 +1,131 @@
+#ifndef SY6970_ADC_H
+#define SY6970_ADC_H
+
+// On-demand ADC conversion scheduler for the SY6970, kept free of IDF dependencies so it
+// can be exercised on the host against a simulated chip.
+//
+// Consumers register the channels they read and how old a value may be. From the
+// tightest freshness the scheduler picks a mode:
+//   - nobody registered (or disabled): no conversions
+//   - max age < SY6970_ADC_CONT_THRESHOLD_MS: continuous (the chip converts once a second)
+//   - otherwise: one-shot, started (CONV_START) just early enough to be ready in time
+// Each result is collected by one burst of REG_0B..REG_14 through the register shadow,
+// so every channel (and the status registers) arrives together.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sy6970_shadow.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Channels; one conversion always measures all of them
+#define SY6970_ADC_VBAT     (1u << 0)   // REG_0E
+#define SY6970_ADC_VSYS     (1u << 1)   // REG_0F
+#define SY6970_ADC_TS       (1u << 2)   // REG_10 (NTC)
+#define SY6970_ADC_VBUS     (1u << 3)   // REG_11
+#define SY6970_ADC_ICHG     (1u << 4)   // REG_12
+#define SY6970_ADC_ALL      0x1F
+
+#ifndef SY6970_ADC_MAX_CONSUMERS
+#define SY6970_ADC_MAX_CONSUMERS 4
+#endif
+// Below this freshness continuous mode is cheaper than repeated one-shots
+#ifndef SY6970_ADC_CONT_THRESHOLD_MS
+#define SY6970_ADC_CONT_THRESHOLD_MS 2000
+#endif
+// Time from CONV_START until every channel holds a result (conservative)
+#ifndef SY6970_ADC_CONV_MS
+#define SY6970_ADC_CONV_MS 100
+#endif
+// Extra supply current while a conversion runs; used for the savings estimate only
+#ifndef SY6970_ADC_ACTIVE_UA
+#define SY6970_ADC_ACTIVE_UA 500
+#endif
+#define SY6970_ADC_CONT_PERIOD_MS 1000  // continuous conversion rate (fixed by the chip)
+
+typedef enum {
+    SY6970_ADC_MODE_OFF = 0,
+    SY6970_ADC_MODE_ONESHOT,
+    SY6970_ADC_MODE_CONTINUOUS,
+} sy6970_adc_mode_t;
+
+typedef struct {
+    uint8_t channels;           // 0 = slot free
+    uint32_t max_age_us;
+} sy6970_adc_consumer_t;
+
+typedef struct {
+    uint16_t vbat_mv;
+    uint16_t vsys_mv;
+    uint16_t vbus_mv;           // 0 when VBUS is not good
+    uint16_t ichg_ma;           // 0 unless pre/fast charging
+    uint8_t ntc_pct;            // TS as % of REGN
+    int64_t t_us;               // when the burst was read
+} sy6970_adc_values_t;
+
+typedef struct {
+    uint32_t conversions;       // one-shots started + continuous cycles
+    uint32_t reads;             // result bursts
+    uint32_t mode_changes;
+    uint32_t errors;
+} sy6970_adc_stats_t;
+
+typedef struct {
+    sy6970_adc_consumer_t consumers[SY6970_ADC_MAX_CONSUMERS];
+    bool enabled;
+    bool force_continuous;
+    sy6970_adc_mode_t mode;     // what REG_02 is set to
+    int64_t mode_since_us;
+    bool converting;            // one-shot in flight
+    int64_t conv_done_us;
+    bool retry;                 // last bus access failed
+    bool have_sample;
+    sy6970_adc_values_t sample;
+    uint64_t cont_us;           // time spent in continuous mode before mode_since_us
+    sy6970_adc_stats_t stats;
+} sy6970_adc_t;
+
+void sy6970_adc_init(sy6970_adc_t *a, int64_t now_us);
+
+/**
+ * Register a consumer. Returns a handle for sy6970_adc_update()/sy6970_adc_remove(),
+ * or -1 when every slot is taken.
+ */
+int sy6970_adc_add(sy6970_adc_t *a, uint8_t channels, uint32_t max_age_us);
+void sy6970_adc_update(sy6970_adc_t *a, int handle, uint8_t channels, uint32_t max_age_us);
+void sy6970_adc_remove(sy6970_adc_t *a, int handle);
+
+// Master switch; `force_continuous` pins continuous mode while enabled
+void sy6970_adc_set_enabled(sy6970_adc_t *a, bool enabled, bool force_continuous);
+
+/**
+ * Switch mode, start a one-shot or collect a result as needed. Returns true when a new
+ * sample was read. `*wait_us` is how long the caller may sleep before the next call
+ * (UINT32_MAX when the ADC is off).
+ */
+bool sy6970_adc_poll(sy6970_adc_t *a, sy6970_shadow_t *sh, int64_t now_us, uint32_t *wait_us);
+
+// Last sample; false if none yet
+bool sy6970_adc_get(const sy6970_adc_t *a, sy6970_adc_values_t *out);
+
+// Stats with continuous cycles counted up to now_us
+void sy6970_adc_get_stats(const sy6970_adc_t *a, int64_t now_us, sy6970_adc_stats_t *out);
+
+// Estimated average current saved against continuous conversion, given how many
+// conversions ran over `elapsed_us`
+uint32_t sy6970_adc_saved_ua(uint32_t conversions, uint64_t elapsed_us);
+
+// Raw register decoding, shared with the single-value getters
+uint16_t sy6970_adc_decode_vbat(uint8_t reg0e);
+uint16_t sy6970_adc_decode_vsys(uint8_t reg0f);
+uint8_t sy6970_adc_decode_ntc(uint8_t reg10);
+uint16_t sy6970_adc_decode_vbus(uint8_t reg11);
+uint16_t sy6970_adc_decode_ichg(uint8_t reg12, uint8_t reg0b);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SY6970_ADC_H
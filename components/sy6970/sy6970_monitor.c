@@ -0,0 +1,102 @@
+#include "sy6970_monitor.h"
+#include <string.h>
+
+#define REG0B_VBUS_STAT 0xC0
+#define REG0B_CHRG_STAT 0x18
+#define REG0B_PG_STAT   0x04
+
+void sy6970_monitor_config_default(sy6970_monitor_config_t *cfg) {
+    cfg->recheck_us = SY6970_STATUS_RECHECK_MS * 1000;
+    cfg->fault_recheck_us = 1000000;
+    cfg->charge_debounce_us = 1000000;
+    cfg->status_poll_us = 0;
+}
+
+void sy6970_monitor_init(sy6970_monitor_t *m, const sy6970_monitor_config_t *cfg) {
+    memset(m, 0, sizeof(*m));
+    m->cfg = *cfg;
+}
+
+static bool elapsed(int64_t now_us, int64_t since_us, uint32_t period_us) {
+    return now_us - since_us >= (int64_t)period_us;
+}
+
+static uint32_t evaluate(sy6970_monitor_t *m, const sy6970_snapshot_t *snap, int64_t now_us) {
+    uint8_t status = snap->regs[0x0B - SY6970_SHADOW_STATUS_FIRST];
+    uint8_t faults = snap->regs[0x0C - SY6970_SHADOW_STATUS_FIRST];
+    bool power_good = (status & REG0B_PG_STAT) != 0;
+    bool vbus = (status & REG0B_VBUS_STAT) != 0 || power_good;
+    bool charging = (status & REG0B_CHRG_STAT) != 0;
+    uint32_t events = 0;
+
+    if (vbus != m->vbus) events |= SY6970_EVT_VBUS;
+    if (power_good != m->power_good) events |= SY6970_EVT_POWER_GOOD;
+    if (faults != m->faults) events |= SY6970_EVT_FAULT;
+    m->vbus = vbus;
+    m->power_good = power_good;
+    m->faults = faults;
+
+    // Pre-charge -> fast charge -> done all raise INT; only report a charging state
+    // that has held for the debounce time
+    if (charging == m->charging) {
+        m->charge_pending = false;
+    } else {
+        if (!m->charge_pending) {
+            m->charge_pending = true;
+            m->charge_due_us = now_us + m->cfg.charge_debounce_us;
+        }
+        if (now_us >= m->charge_due_us) {
+            m->charging = charging;
+            m->charge_pending = false;
+            events |= SY6970_EVT_CHARGE;
+        }
+    }
+    return events;
+}
+
+static int64_t next_deadline(const sy6970_monitor_t *m, int64_t now_us) {
+    // After a failed burst every deadline may already be due: back off instead of spinning
+    if (m->retry) return now_us + m->cfg.fault_recheck_us;
+    int64_t next = m->last_read_us + m->cfg.recheck_us;
+    int64_t t;
+    if (m->cfg.status_poll_us && (t = m->last_read_us + m->cfg.status_poll_us) < next) next = t;
+    if (m->faults && (t = m->last_read_us + m->cfg.fault_recheck_us) < next) next = t;
+    if (m->charge_pending && m->charge_due_us < next) next = m->charge_due_us;
+    return next;
+}
+
+uint32_t sy6970_monitor_poll(sy6970_monitor_t *m, sy6970_shadow_t *sh, bool irq, int64_t now_us,
+                             uint32_t *wait_us) {
+    uint32_t events = 0;
+    if (irq) m->stats.interrupts++;
+    // Somebody else refreshed the snapshot since our last read (ADC sample, UI): use it
+    if (m->primed && sh->snap.valid && sh->snap.t_us > m->last_read_us) {
+        events |= evaluate(m, &sh->snap, now_us);
+        m->last_read_us = sh->snap.t_us;
+    }
+    bool recheck_due = elapsed(now_us, m->last_read_us, m->cfg.recheck_us);
+    bool status_due = irq || !m->primed || m->retry ||
+                      (m->cfg.status_poll_us && elapsed(now_us, m->last_read_us, m->cfg.status_poll_us)) ||
+                      (m->faults && elapsed(now_us, m->last_read_us, m->cfg.fault_recheck_us)) ||
+                      (m->charge_pending && now_us >= m->charge_due_us);
+    if (recheck_due || status_due) {
+        // Forced so an INT never sees a stale snapshot
+        m->stats.reads++;
+        if (sy6970_shadow_refresh(sh, now_us, true)) {
+            m->retry = false;
+            m->last_read_us = now_us;
+            events |= evaluate(m, &sh->snap, now_us);
+            m->primed = true;
+            if (!status_due) m->stats.rechecks++;
+        } else {
+            m->retry = true;
+            m->stats.errors++;
+        }
+    }
+
+    if (wait_us) {
+        int64_t wait = next_deadline(m, now_us) - now_us;
+        *wait_us = wait > 0 ? (uint32_t)wait : 0;
+    }
+    return events;
+}
@@ -0,0 +1,81 @@
+#ifndef SY6970_MONITOR_H
+#define SY6970_MONITOR_H
+
+// Event-driven status monitor for the SY6970, kept free of IDF dependencies so it can be
+// exercised on the host against a simulated chip.
+//
+// The charger pulses INT low (256 us) whenever VBUS, power good or the charge state
+// changes and when a new fault is latched. Status and fault registers are only read
+// after such a pulse; between pulses the monitor sleeps, except for:
+//   - a slow periodic re-check, in case an INT pulse was missed
+//   - re-reads while a fault is reported (INT is not raised when a fault clears)
+//   - the charge debounce confirmation read
+//   - status_poll_us, when INT is not available
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sy6970_shadow.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Event flags returned by sy6970_monitor_poll()
+#define SY6970_EVT_VBUS         (1u << 0)   // VBUS attached/removed
+#define SY6970_EVT_POWER_GOOD   (1u << 1)
+#define SY6970_EVT_CHARGE       (1u << 2)   // charging started/stopped (debounced)
+#define SY6970_EVT_FAULT        (1u << 3)   // REG_0C changed
+#define SY6970_EVT_ADC          (1u << 4)   // new ADC sample (set by the driver, see sy6970_adc.h)
+
+#ifndef SY6970_STATUS_RECHECK_MS
+#define SY6970_STATUS_RECHECK_MS 10000
+#endif
+// Fallback status poll when the INT line cannot be armed
+#ifndef SY6970_STATUS_POLL_MS
+#define SY6970_STATUS_POLL_MS 250
+#endif
+
+typedef struct {
+    uint32_t recheck_us;            // status re-read without INT, catches a missed pulse
+    uint32_t fault_recheck_us;      // re-read period while a fault is reported
+    uint32_t charge_debounce_us;    // charging state must hold this long to be reported
+    uint32_t status_poll_us;        // periodic status read without INT (0 = INT only)
+} sy6970_monitor_config_t;
+
+typedef struct {
+    uint32_t interrupts;    // INT pulses handled
+    uint32_t reads;         // status bursts issued
+    uint32_t rechecks;      // of which periodic
+    uint32_t errors;
+} sy6970_monitor_stats_t;
+
+typedef struct {
+    sy6970_monitor_config_t cfg;
+    bool primed;                // first read done
+    bool vbus;                  // last reported states
+    bool power_good;
+    bool charging;
+    uint8_t faults;
+    bool charge_pending;        // raw charging state differs from the reported one
+    int64_t charge_due_us;
+    int64_t last_read_us;
+    bool retry;                 // last burst failed
+    sy6970_monitor_stats_t stats;
+} sy6970_monitor_t;
+
+void sy6970_monitor_config_default(sy6970_monitor_config_t *cfg);
+void sy6970_monitor_init(sy6970_monitor_t *m, const sy6970_monitor_config_t *cfg);
+
+/**
+ * Handle an INT pulse (`irq`) and any due work: reads REG_0B..REG_14 through the shadow
+ * when needed and returns the SY6970_EVT_* flags for what changed.
+ * `*wait_us` is set to how long the caller may sleep before the next call unless INT fires.
+ */
+uint32_t sy6970_monitor_poll(sy6970_monitor_t *m, sy6970_shadow_t *sh, bool irq, int64_t now_us,
+                             uint32_t *wait_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SY6970_MONITOR_H
@@ -0,0 +1,128 @@
+#include "sy6970_shadow.h"
+#include <string.h>
+
+// Self-clearing bits must not be replayed from the cache by a later read-modify-write
+static uint8_t volatile_bits(uint8_t reg, uint8_t val) {
+    switch (reg) {
+    // CONV_START self-clears unless CONV_RATE is set; FORCE_DPDM always does
+    case 0x02: return ((val & 0x40) ? 0x00 : 0x80) | 0x02;
+    case 0x03: return 0x40;     // WD_RST
+    case 0x09: return 0x80;     // FORCE_ICO
+    default:   return 0x00;
+    }
+}
+
+static bool is_status(uint8_t reg) {
+    return reg >= SY6970_SHADOW_STATUS_FIRST && reg <= SY6970_SHADOW_STATUS_LAST;
+}
+
+// Configuration the chip keeps to itself between reads
+static bool is_cached(uint8_t reg) {
+    return reg < SY6970_SHADOW_CFG_COUNT && !(SY6970_SHADOW_UNCACHED & (1u << reg));
+}
+
+// A new input source makes the chip redo DP/DM detection (and ICO), which rewrites the
+// input limits: whatever was cached may be stale
+static void check_input(sy6970_shadow_t *sh, uint8_t old, uint8_t now) {
+    if ((old ^ now) & SY6970_SHADOW_INPUT_MASK) sh->cfg_valid = 0;
+}
+
+void sy6970_shadow_init(sy6970_shadow_t *sh, sy6970_shadow_read_fn read, sy6970_shadow_write_fn write,
+                        void *ctx, uint32_t max_age_us) {
+    memset(sh, 0, sizeof(*sh));
+    sh->read = read;
+    sh->write = write;
+    sh->ctx = ctx;
+    sh->max_age_us = max_age_us;
+}
+
+void sy6970_shadow_invalidate(sy6970_shadow_t *sh) {
+    sh->snap.valid = false;
+    sh->cfg_valid = 0;
+}
+
+static bool bus_read(sy6970_shadow_t *sh, uint8_t reg, uint8_t *buf, size_t len) {
+    sh->stats.transactions++;
+    sh->stats.bytes += 1 + len;
+    if (!sh->read(sh->ctx, reg, buf, len)) {
+        sh->stats.errors++;
+        return false;
+    }
+    return true;
+}
+
+bool sy6970_shadow_refresh(sy6970_shadow_t *sh, int64_t now_us, bool force) {
+    if (!force && sh->snap.valid && now_us - sh->snap.t_us < (int64_t)sh->max_age_us) return true;
+    uint8_t buf[SY6970_SHADOW_STATUS_COUNT];
+    if (!bus_read(sh, SY6970_SHADOW_STATUS_FIRST, buf, sizeof(buf))) return false;
+    if (sh->snap.valid) check_input(sh, sh->snap.regs[0], buf[0]);
+    memcpy(sh->snap.regs, buf, sizeof(buf));
+    // An expired watchdog puts the configuration registers back to their defaults
+    if (buf[0x0C - SY6970_SHADOW_STATUS_FIRST] & 0x80) sh->cfg_valid = 0;
+    sh->snap.t_us = now_us;
+    sh->snap.valid = true;
+    sh->stats.bursts++;
+    return true;
+}
+
+bool sy6970_shadow_read(sy6970_shadow_t *sh, uint8_t reg, int64_t now_us, uint8_t *val) {
+    if (is_status(reg)) {
+        bool fresh = sh->snap.valid && now_us - sh->snap.t_us < (int64_t)sh->max_age_us;
+        if (fresh) sh->stats.hits++;
+        else if (!sy6970_shadow_refresh(sh, now_us, true)) return false;
+        *val = sh->snap.regs[reg - SY6970_SHADOW_STATUS_FIRST];
+        return true;
+    }
+    if (reg >= SY6970_SHADOW_CFG_COUNT) return false;
+    if (!is_cached(reg)) return bus_read(sh, reg, val, 1);
+
+    if (sh->cfg_valid & (1u << reg)) {
+        sh->stats.hits++;
+    } else {
+        if (!bus_read(sh, reg, &sh->cfg[reg], 1)) return false;
+        sh->cfg_valid |= 1u << reg;
+    }
+    *val = sh->cfg[reg];
+    return true;
+}
+
+bool sy6970_shadow_write(sy6970_shadow_t *sh, uint8_t reg, uint8_t val) {
+    sh->stats.transactions++;
+    sh->stats.bytes += 2;
+    if (!sh->write(sh->ctx, reg, val)) {
+        sh->stats.errors++;
+        // The chip may or may not have taken it
+        if (reg < SY6970_SHADOW_CFG_COUNT) sh->cfg_valid &= ~(1u << reg);
+        else if (is_status(reg)) sh->snap.valid = false;
+        return false;
+    }
+
+    if (reg == SY6970_SHADOW_STATUS_LAST && (val & SY6970_SHADOW_REG_RST)) {
+        sy6970_shadow_invalidate(sh);
+    } else if (is_cached(reg)) {
+        sh->cfg[reg] = val & ~volatile_bits(reg, val);
+        sh->cfg_valid |= 1u << reg;
+    } else if (is_status(reg)) {
+        sh->snap.valid = false;
+    }
+    return true;
+}
+
+bool sy6970_shadow_update(sy6970_shadow_t *sh, uint8_t reg, uint8_t mask, uint8_t val, int64_t now_us) {
+    uint8_t cur;
+    if (!sy6970_shadow_read(sh, reg, now_us, &cur)) return false;
+    uint8_t next = (cur & ~mask) | (val & mask);
+    // Self-clearing bits are never cached, so a command like WD_RST always differs
+    if (next == cur) return true;
+    return sy6970_shadow_write(sh, reg, next);
+}
+
+void sy6970_shadow_note(sy6970_shadow_t *sh, uint8_t reg, uint8_t val) {
+    if (is_cached(reg)) {
+        sh->cfg[reg] = val & ~volatile_bits(reg, val);
+        sh->cfg_valid |= 1u << reg;
+    } else if (is_status(reg) && sh->snap.valid) {
+        if (reg == SY6970_SHADOW_STATUS_FIRST) check_input(sh, sh->snap.regs[0], val);
+        sh->snap.regs[reg - SY6970_SHADOW_STATUS_FIRST] = val;
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef SY6970_SHADOW_H
+#define SY6970_SHADOW_H
+
+// Register shadow for the SY6970, kept free of IDF dependencies so it can be
+// exercised on the host against a fake bus.
+//
+//   REG_00..REG_0A  configuration: write-through cache, read from the chip once,
+//                   except REG_00, which is always read from the chip
+//   REG_0B..REG_14  status/ADC: refreshed together by one 10-byte burst read and
+//                   served from that snapshot until it is older than max_age_us
+//
+// Writes inside the status block (REG_0D VINDPM) expire the snapshot: the chip clamps
+// VINDPM, so the value written is not necessarily the value it holds.
+// Setting REG_RST (REG_14 bit 7) restores chip defaults, so everything is dropped.
+// Self-clearing command bits (WD_RST, FORCE_ICO, FORCE_DPDM, one-shot CONV_START) are never
+// cached. The chip sets IINLIM (REG_00) itself after DP/DM detection and ICO, so REG_00 is
+// not cached, and a change of VBUS_STAT or PG_STAT in a snapshot drops the whole cache.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SY6970_SHADOW_CFG_COUNT     0x0B    // REG_00..REG_0A
+#define SY6970_SHADOW_STATUS_FIRST  0x0B
+#define SY6970_SHADOW_STATUS_LAST   0x14
+#define SY6970_SHADOW_STATUS_COUNT  (SY6970_SHADOW_STATUS_LAST - SY6970_SHADOW_STATUS_FIRST + 1)
+
+#define SY6970_SHADOW_REG_RST       0x80    // REG_14 bit 7
+#define SY6970_SHADOW_UNCACHED      (1u << 0x00)    // config registers the chip rewrites
+#define SY6970_SHADOW_INPUT_MASK    0xE4    // REG_0B VBUS_STAT and PG_STAT
+
+// Default freshness of the status snapshot; getters called within this window share one burst
+#ifndef SY6970_SNAPSHOT_MAX_AGE_MS
+#define SY6970_SNAPSHOT_MAX_AGE_MS 100
+#endif
+
+// Bus accessors; return true on success. Reads auto-increment from `reg`.
+typedef bool (*sy6970_shadow_read_fn)(void *ctx, uint8_t reg, uint8_t *buf, size_t len);
+typedef bool (*sy6970_shadow_write_fn)(void *ctx, uint8_t reg, uint8_t val);
+
+typedef struct {
+    uint8_t regs[SY6970_SHADOW_STATUS_COUNT];   // REG_0B..REG_14
+    int64_t t_us;                               // when the burst completed
+    bool valid;
+} sy6970_snapshot_t;
+
+typedef struct {
+    uint32_t transactions;      // bus transfers issued
+    uint32_t bytes;             // register pointer + payload bytes
+    uint32_t bursts;            // status snapshot refreshes
+    uint32_t hits;              // reads answered without touching the bus
+    uint32_t errors;
+} sy6970_shadow_stats_t;
+
+typedef struct {
+    sy6970_shadow_read_fn read;
+    sy6970_shadow_write_fn write;
+    void *ctx;
+    uint32_t max_age_us;
+    sy6970_snapshot_t snap;
+    uint8_t cfg[SY6970_SHADOW_CFG_COUNT];
+    uint16_t cfg_valid;         // bit n set when cfg[n] mirrors the chip
+    sy6970_shadow_stats_t stats;
+} sy6970_shadow_t;
+
+void sy6970_shadow_init(sy6970_shadow_t *sh, sy6970_shadow_read_fn read, sy6970_shadow_write_fn write,
+                        void *ctx, uint32_t max_age_us);
+
+// Forget every cached value (e.g. after a chip reset or bus recovery)
+void sy6970_shadow_invalidate(sy6970_shadow_t *sh);
+
+/**
+ * Re-read REG_0B..REG_14 in one burst if the snapshot is older than max_age_us
+ * (always when `force`). Returns false on a bus error; the old snapshot is kept.
+ */
+bool sy6970_shadow_refresh(sy6970_shadow_t *sh, int64_t now_us, bool force);
+
+// Cached register value (config cache or status snapshot)
+bool sy6970_shadow_read(sy6970_shadow_t *sh, uint8_t reg, int64_t now_us, uint8_t *val);
+
+// Write to the chip, then update the cache on success
+bool sy6970_shadow_write(sy6970_shadow_t *sh, uint8_t reg, uint8_t val);
+
+// Read-modify-write using the cached value; skips the bus when nothing changes
+bool sy6970_shadow_update(sy6970_shadow_t *sh, uint8_t reg, uint8_t mask, uint8_t val, int64_t now_us);
+
+// Store a value read from the chip outside the shadow (keeps the cache coherent)
+void sy6970_shadow_note(sy6970_shadow_t *sh, uint8_t reg, uint8_t val);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SY6970_SHADOW_H
@@ -0,0 +1,500 @@
+// Host-side test for the SY6970 register shadow and event monitor: runs the status-task
+// and UI access patterns against a fake chip, injects INT edges and register changes
+// (including an input limit the chip rewrites on its own), drives the ADC scheduler, and
+// counts I2C transactions, wake-ups and conversions.
+//
+// gcc -std=gnu11 -Wall -I components/sy6970 -o /tmp/sy6970_host_test components/sy6970/test/host_test.c components/sy6970/sy6970_shadow.c components/sy6970/sy6970_monitor.c components/sy6970/sy6970_adc.c
+// /tmp/sy6970_host_test
+
+#include <stdio.h>
+#include <string.h>
+#include "sy6970_shadow.h"
+#include "sy6970_monitor.h"
+#include "sy6970_adc.h"
+
+static int s_failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); s_failures++; } \
+} while (0)
+
+// Fake chip: register file with auto-increment reads, plus a transaction log
+typedef struct {
+    uint8_t regs[0x15];
+    int reads;
+    int writes;
+    int fail_reads;             // number of upcoming reads that NACK
+    uint8_t fault_now;          // REG_0C latches: a read returns the latch, then reloads it from this
+    int oneshots;               // one-shot ADC conversions started
+} fake_chip_t;
+
+static bool fake_read(void *ctx, uint8_t reg, uint8_t *buf, size_t len)
+{
+    fake_chip_t *chip = ctx;
+    chip->reads++;
+    if (chip->fail_reads > 0) {
+        chip->fail_reads--;
+        return false;
+    }
+    if (reg + len > sizeof(chip->regs)) return false;
+    memcpy(buf, &chip->regs[reg], len);
+    if (reg <= 0x0C && reg + len > 0x0C) chip->regs[0x0C] = chip->fault_now;
+    return true;
+}
+
+static bool fake_write(void *ctx, uint8_t reg, uint8_t val)
+{
+    fake_chip_t *chip = ctx;
+    chip->writes++;
+    if (reg >= sizeof(chip->regs)) return false;
+    chip->regs[reg] = val;
+    // One-shot conversion: new battery reading, CONV_START clears itself
+    if (reg == 0x02 && (val & 0x80) && !(val & 0x40)) {
+        chip->oneshots++;
+        chip->regs[0x0E]++;
+        chip->regs[0x02] &= ~0x80;
+    }
+    return true;
+}
+
+// Charging from USB, 3.9 V battery, no faults
+static void chip_reset(fake_chip_t *chip)
+{
+    static const uint8_t defaults[0x15] = {
+        0x3A, 0x1B, 0xFC, 0x18, 0x10, 0x11, 0x5C, 0x89, 0x7B, 0x8C, 0x20,  // 00..0A
+        0x5C, 0x00, 0x85, 0x50, 0x52, 0x3A, 0xA4, 0x14, 0x00, 0x01,        // 0B..14
+    };
+    memset(chip, 0, sizeof(*chip));
+    memcpy(chip->regs, defaults, sizeof(defaults));
+}
+
+static void test_status_snapshot(void)
+{
+    fake_chip_t chip;
+    sy6970_shadow_t sh;
+    uint8_t v;
+    chip_reset(&chip);
+    sy6970_shadow_init(&sh, fake_read, fake_write, &chip, 100000);
+
+    // Every status/ADC register inside the max age comes from one burst
+    for (uint8_t reg = 0x0B; reg <= 0x14; reg++) {
+        CHECK(sy6970_shadow_read(&sh, reg, 1000 + reg, &v));
+        CHECK(v == chip.regs[reg]);
+    }
+    CHECK(chip.reads == 1);
+    CHECK(sh.stats.bursts == 1 && sh.stats.bytes == 11);
+
+    // Stale after max age: the next read refreshes everything at once
+    chip.regs[0x0E] = 0x55;
+    CHECK(sy6970_shadow_read(&sh, 0x0E, 50000, &v) && v == 0x50);
+    CHECK(sy6970_shadow_read(&sh, 0x0E, 102000, &v) && v == 0x55);
+    CHECK(chip.reads == 2);
+
+    // A failed burst keeps the last good values and retries on the next read
+    chip.fail_reads = 1;
+    CHECK(!sy6970_shadow_read(&sh, 0x0B, 300000, &v));
+    CHECK(sy6970_shadow_read(&sh, 0x0B, 300001, &v) && v == 0x5C);
+    CHECK(sh.stats.errors == 1);
+}
+
+static void test_config_cache(void)
+{
+    fake_chip_t chip;
+    sy6970_shadow_t sh;
+    uint8_t v;
+    chip_reset(&chip);
+    sy6970_shadow_init(&sh, fake_read, fake_write, &chip, 100000);
+
+    // First read goes to the chip, later ones never do
+    CHECK(sy6970_shadow_read(&sh, 0x04, 0, &v) && v == 0x10);
+    CHECK(sy6970_shadow_read(&sh, 0x04, 10000000, &v) && v == 0x10);
+    CHECK(chip.reads == 1);
+
+    // Read-modify-write needs no read back, and a no-op update skips the bus
+    CHECK(sy6970_shadow_update(&sh, 0x04, 0x7F, 0x20, 0));
+    CHECK(chip.writes == 1 && chip.reads == 1 && chip.regs[0x04] == 0x20);
+    CHECK(sy6970_shadow_update(&sh, 0x04, 0x7F, 0x20, 0));
+    CHECK(chip.writes == 1);
+    CHECK(sy6970_shadow_read(&sh, 0x04, 0, &v) && v == 0x20);
+
+    // Write to an uncached register: no read needed afterwards
+    CHECK(sy6970_shadow_write(&sh, 0x06, 0x5C));
+    CHECK(sy6970_shadow_read(&sh, 0x06, 0, &v) && v == 0x5C);
+    CHECK(chip.reads == 1);
+
+    // Self-clearing WD_RST is a command: every kick reaches the chip
+    CHECK(sy6970_shadow_update(&sh, 0x03, 0x40, 0x40, 0));
+    CHECK(sy6970_shadow_update(&sh, 0x03, 0x40, 0x40, 0));
+    CHECK(chip.writes == 4);
+    CHECK(sy6970_shadow_read(&sh, 0x03, 0, &v) && !(v & 0x40));
+
+    // VINDPM lives in the status block and the chip clamps it: a write expires the
+    // snapshot so the next read shows what the chip actually holds
+    CHECK(sy6970_shadow_read(&sh, 0x0D, 0, &v) && v == 0x85);
+    int reads = chip.reads;
+    CHECK(sy6970_shadow_update(&sh, 0x0D, 0x7F, 0x08, 1000));
+    CHECK(chip.reads == reads);
+    chip.regs[0x0D] = 0x8D;     // clamped to 3.9 V
+    CHECK(sy6970_shadow_read(&sh, 0x0D, 2000, &v) && v == 0x8D);
+    CHECK(chip.reads == reads + 1);
+
+    // REG_RST puts the chip back to defaults: nothing cached may survive
+    CHECK(sy6970_shadow_write(&sh, 0x14, 0x80));
+    CHECK(sh.cfg_valid == 0 && !sh.snap.valid);
+
+    // So does an expired watchdog, reported in REG_0C
+    CHECK(sy6970_shadow_read(&sh, 0x04, 0, &v));
+    chip.regs[0x0C] = 0x80;
+    CHECK(sy6970_shadow_refresh(&sh, 0, true));
+    CHECK(sh.cfg_valid == 0);
+}
+
+// The chip sets IINLIM itself after DP/DM detection or ICO, behind the shadow's back
+static void test_input_limit_rewrite(void)
+{
+    fake_chip_t chip;
+    sy6970_shadow_t sh;
+    uint8_t v;
+    chip_reset(&chip);
+    sy6970_shadow_init(&sh, fake_read, fake_write, &chip, 100000);
+
+    // REG_00 always comes from the chip: the limit read is the one it holds
+    CHECK(sy6970_shadow_update(&sh, 0x00, 0x3F, 0x08, 0));
+    CHECK(chip.regs[0x00] == ((0x3A & 0xC0) | 0x08));
+    chip.regs[0x00] = (chip.regs[0x00] & 0xC0) | 0x3A;     // ICO settled on 3.0 A
+    CHECK(sy6970_shadow_read(&sh, 0x00, 0, &v) && (v & 0x3F) == 0x3A);
+    // HIZ read-modify-write keeps the chip's limit, not the last one written
+    CHECK(sy6970_shadow_update(&sh, 0x00, 0x80, 0x80, 0));
+    CHECK(chip.regs[0x00] == 0xBA);
+    // Setting back the limit written before is not skipped as a no-op
+    int writes = chip.writes;
+    CHECK(sy6970_shadow_update(&sh, 0x00, 0x3F, 0x08, 0));
+    CHECK(chip.writes == writes + 1 && (chip.regs[0x00] & 0x3F) == 0x08);
+
+    // FORCE_DPDM clears itself: a second request still reaches the chip
+    CHECK(sy6970_shadow_update(&sh, 0x02, 0x02, 0x02, 0));
+    chip.regs[0x02] &= ~0x02;
+    writes = chip.writes;
+    CHECK(sy6970_shadow_update(&sh, 0x02, 0x02, 0x02, 0));
+    CHECK(chip.writes == writes + 1);
+
+    // A new input source drops the cached configuration
+    CHECK(sy6970_shadow_read(&sh, 0x04, 0, &v));
+    CHECK(sy6970_shadow_refresh(&sh, 0, true) && (sh.cfg_valid & (1u << 0x04)));
+    chip.regs[0x0B] = 0x00;     // unplugged: no input, power not good
+    CHECK(sy6970_shadow_refresh(&sh, 1000, true));
+    CHECK(sh.cfg_valid == 0);
+    // Only charge status changing keeps it
+    CHECK(sy6970_shadow_read(&sh, 0x04, 0, &v));
+    chip.regs[0x0B] = 0x18;
+    CHECK(sy6970_shadow_refresh(&sh, 2000, true) && (sh.cfg_valid & (1u << 0x04)));
+}
+
+// Old access pattern: one transaction per register read, as the getters used to issue
+typedef struct {
+    const uint8_t *regs;
+    int count;
+} access_list_t;
+
+// hal_mgr_status_task every 250 ms: vbus, power good, faults, charge status x3
+// (+ battery voltage every 4th loop)
+static const uint8_t s_status_regs[] = {0x0B, 0x0B, 0x0C, 0x0B, 0x0B, 0x0B};
+// update_stats_timer_cb every 500 ms: sys, bat, charge current (0B + 12), vbus, ntc,
+// vbus connected, charge status, faults, power good, charge status
+static const uint8_t s_ui_regs[] = {0x0F, 0x0E, 0x0B, 0x12, 0x11, 0x10, 0x0B, 0x0B, 0x0C, 0x0B, 0x0B};
+
+static int run_pattern(bool shadowed, int seconds)
+{
+    fake_chip_t chip;
+    sy6970_shadow_t sh;
+    uint8_t v;
+    chip_reset(&chip);
+    sy6970_shadow_init(&sh, fake_read, fake_write, &chip, SY6970_SNAPSHOT_MAX_AGE_MS * 1000);
+
+    int loops = 0;
+    for (int64_t t = 0; t < (int64_t)seconds * 1000000; t += 1000) {
+        access_list_t lists[2];
+        int n = 0;
+        if (t % 250000 == 0) lists[n++] = (access_list_t){s_status_regs, sizeof(s_status_regs)};
+        if (t % 500000 == 120000) lists[n++] = (access_list_t){s_ui_regs, sizeof(s_ui_regs)};
+        for (int l = 0; l < n; l++) {
+            for (int i = 0; i < lists[l].count; i++) {
+                if (shadowed) sy6970_shadow_read(&sh, lists[l].regs[i], t, &v);
+                else fake_read(&chip, lists[l].regs[i], &v, 1);
+            }
+            // Battery voltage on every 4th status loop
+            if (lists[l].regs == s_status_regs && ++loops % 4 == 0) {
+                if (shadowed) sy6970_shadow_read(&sh, 0x0E, t, &v);
+                else fake_read(&chip, 0x0E, &v, 1);
+            }
+        }
+    }
+    return chip.reads + chip.writes;
+}
+
+static void test_transactions_per_second(void)
+{
+    const int seconds = 60;
+    int before = run_pattern(false, seconds);
+    int after = run_pattern(true, seconds);
+    printf("status+UI polling: %.1f I2C transactions/s before, %.1f after\n",
+           (double)before / seconds, (double)after / seconds);
+    // Status task and UI each need one burst per visit
+    CHECK(after <= 6 * seconds);
+    CHECK(after * 6 < before);
+}
+
+// Simulated status task: wakes on an INT edge or when the monitor's wait runs out
+typedef struct {
+    fake_chip_t chip;
+    sy6970_shadow_t sh;
+    sy6970_monitor_t mon;
+    int64_t now;
+    int64_t wake_at;
+    int wakeups;
+    uint32_t events;            // accumulated since the last check
+    int64_t event_at[5];        // when each SY6970_EVT_* bit last fired
+} sim_t;
+
+static void sim_init(sim_t *sim)
+{
+    sy6970_monitor_config_t cfg;
+    memset(sim, 0, sizeof(*sim));
+    chip_reset(&sim->chip);
+    sim->chip.regs[0x0B] = 0x00;    // battery only
+    sy6970_shadow_init(&sim->sh, fake_read, fake_write, &sim->chip, SY6970_SNAPSHOT_MAX_AGE_MS * 1000);
+    sy6970_monitor_config_default(&cfg);
+    sy6970_monitor_init(&sim->mon, &cfg);
+}
+
+static void sim_wake(sim_t *sim, bool irq)
+{
+    uint32_t wait_us;
+    uint32_t ev = sy6970_monitor_poll(&sim->mon, &sim->sh, irq, sim->now, &wait_us);
+    sim->wakeups++;
+    sim->events |= ev;
+    for (int b = 0; b < 5; b++) {
+        if (ev & (1u << b)) sim->event_at[b] = sim->now;
+    }
+    sim->wake_at = sim->now + wait_us;
+}
+
+// Advance to `until`, waking at every deadline on the way
+static void sim_run(sim_t *sim, int64_t until)
+{
+    while (sim->wake_at <= until) {
+        sim->now = sim->wake_at;
+        sim_wake(sim, false);
+    }
+    sim->now = until;
+}
+
+// The chip changes state and (unless `missed`) pulses INT
+static void sim_change(sim_t *sim, int64_t t, uint8_t reg0b, bool missed)
+{
+    sim_run(sim, t);
+    sim->chip.regs[0x0B] = reg0b;
+    if (!missed) sim_wake(sim, true);
+}
+
+static void sim_fault(sim_t *sim, int64_t t, uint8_t fault)
+{
+    sim_run(sim, t);
+    sim->chip.regs[0x0C] |= fault;
+    sim->chip.fault_now = fault;
+    if (fault) sim_wake(sim, true);    // no INT when a fault clears
+}
+
+static void test_int_events(void)
+{
+    sim_t sim;
+    sim_init(&sim);
+    sim_wake(&sim, false);
+    CHECK(sim.events == 0);
+
+    // Idle on battery: only the slow re-check touches the bus
+    sim_run(&sim, 20000000);
+    CHECK(sim.wakeups <= 3);
+    CHECK(sim.chip.reads <= 3);
+    CHECK(sim.events == 0);
+
+    // USB plugged: reported on the INT edge itself
+    sim_change(&sim, 20000000, 0x44, false);
+    CHECK(sim.events == (SY6970_EVT_VBUS | SY6970_EVT_POWER_GOOD));
+    CHECK(sim.event_at[0] == 20000000 && sim.mon.vbus && sim.mon.power_good);
+    sim.events = 0;
+
+    // Fast charge starts: reported once it has held for the debounce time
+    sim_change(&sim, 20300000, 0x54, false);
+    CHECK(sim.events == 0);
+    sim_run(&sim, 22000000);
+    CHECK(sim.events == SY6970_EVT_CHARGE && sim.event_at[2] == 21300000 && sim.mon.charging);
+    sim.events = 0;
+
+    // A short blip out of charging never gets reported
+    sim_change(&sim, 25000000, 0x44, false);
+    sim_change(&sim, 25400000, 0x54, false);
+    sim_run(&sim, 29000000);
+    CHECK(sim.events == 0 && sim.mon.charging);
+
+    // Input fault: INT on the new fault, then re-read until it clears (no INT for that)
+    sim_fault(&sim, 40000000, 0x20);
+    CHECK((sim.events & SY6970_EVT_FAULT) && sim.event_at[3] == 40000000 && sim.mon.faults == 0x20);
+    sim.events = 0;
+    sim_fault(&sim, 45000000, 0);
+    sim_run(&sim, 47000000);
+    CHECK((sim.events & SY6970_EVT_FAULT) && sim.mon.faults == 0);
+    // The latch still holds the fault at the first read after it clears
+    CHECK(sim.event_at[3] > 45000000 && sim.event_at[3] <= 47000000);
+    sim.events = 0;
+
+    // Unplug: VBUS immediately, charging stops after the debounce
+    sim_change(&sim, 60000000, 0x00, false);
+    CHECK(sim.event_at[0] == 60000000 && !sim.mon.vbus);
+    sim_run(&sim, 62000000);
+    CHECK((sim.events & SY6970_EVT_CHARGE) && !sim.mon.charging);
+    sim.events = 0;
+
+    // A missed INT pulse is caught by the next re-check at the latest
+    sim_change(&sim, 80000000, 0x44, true);
+    sim_run(&sim, 80000000 + SY6970_STATUS_RECHECK_MS * 1000);
+    CHECK((sim.events & SY6970_EVT_VBUS) && sim.mon.vbus);
+
+    // Bus error: back off and retry without spinning
+    sim.events = 0;
+    sim.chip.fail_reads = 3;
+    sim_change(&sim, 100000000, 0x00, false);
+    int wakeups = sim.wakeups;
+    sim_run(&sim, 104000000);
+    CHECK(sim.wakeups - wakeups <= 4);
+    CHECK((sim.events & SY6970_EVT_VBUS) && !sim.mon.vbus);
+    CHECK(sim.mon.stats.errors == 3);
+}
+
+static void test_idle_wakeups(void)
+{
+    const int seconds = 600;
+    sim_t sim;
+    sim_init(&sim);
+    sim_wake(&sim, false);
+    sim_run(&sim, (int64_t)seconds * 1000000);
+    // The old status task woke and read the chip every 250 ms
+    int polled = seconds * 4;
+    printf("idle PMIC monitoring over %d s: %d wake-ups / %d I2C transactions (was %d / %d)\n",
+           seconds, sim.wakeups, sim.chip.reads, polled, polled * 6);
+    CHECK(sim.wakeups <= seconds / (SY6970_STATUS_RECHECK_MS / 1000) + 1);
+    CHECK(sim.chip.reads == sim.wakeups);
+}
+
+static void test_adc_modes(void)
+{
+    fake_chip_t chip;
+    sy6970_shadow_t sh;
+    sy6970_adc_t adc;
+    sy6970_adc_values_t v;
+    uint32_t wait;
+    chip_reset(&chip);
+    chip.regs[0x02] = 0x3C;     // ADC idle
+    sy6970_shadow_init(&sh, fake_read, fake_write, &chip, SY6970_SNAPSHOT_MAX_AGE_MS * 1000);
+    sy6970_adc_init(&adc, 0);
+
+    // Nobody asked: no conversions, nothing to wake up for
+    CHECK(!sy6970_adc_poll(&adc, &sh, 0, &wait) && wait == UINT32_MAX);
+    CHECK(adc.mode == SY6970_ADC_MODE_OFF && chip.reads + chip.writes == 0);
+    CHECK(!sy6970_adc_get(&adc, &v));
+
+    // A slow consumer gets one-shots; the result is collected after the conversion time
+    int log = sy6970_adc_add(&adc, SY6970_ADC_VBAT, 10000000);
+    CHECK(!sy6970_adc_poll(&adc, &sh, 1000, &wait));
+    CHECK(adc.mode == SY6970_ADC_MODE_ONESHOT && chip.oneshots == 1 && wait == SY6970_ADC_CONV_MS * 1000);
+    CHECK(sy6970_adc_poll(&adc, &sh, 1000 + wait, &wait));
+    CHECK(sy6970_adc_get(&adc, &v) && v.vbat_mv == 2304 + 0x51 * 20);
+    // Next conversion starts just early enough to be ready when the sample expires
+    CHECK(wait == 10000000 - SY6970_ADC_CONV_MS * 1000);
+    CHECK(chip.oneshots == 1);
+
+    // A view that wants all channels every second switches to continuous mode
+    int view = sy6970_adc_add(&adc, SY6970_ADC_ALL, 1000000);
+    CHECK(view >= 0 && view != log);
+    sy6970_adc_poll(&adc, &sh, 200000, &wait);
+    CHECK(adc.mode == SY6970_ADC_MODE_CONTINUOUS && (chip.regs[0x02] & 0xC0) == 0xC0);
+    CHECK(wait <= 1000000);     // the one-shot sample is still good for now
+    int reads = chip.reads;
+    for (int64_t t = 200000; t < 10200000; t += 100000) sy6970_adc_poll(&adc, &sh, t, &wait);
+    CHECK(chip.reads - reads >= 9 && chip.reads - reads <= 11);
+    CHECK(chip.oneshots == 1);
+
+    // View closed: back to one-shots, CONV_RATE cleared
+    sy6970_adc_remove(&adc, view);
+    sy6970_adc_poll(&adc, &sh, 10300000, &wait);
+    CHECK(adc.mode == SY6970_ADC_MODE_ONESHOT && (chip.regs[0x02] & 0xC0) == 0);
+
+    // One-shot CONV_START is never cached: every trigger reaches the chip
+    for (int64_t t = 10300000; t < 40300000; t += 50000) sy6970_adc_poll(&adc, &sh, t, &wait);
+    CHECK(chip.oneshots == 4);
+
+    // Master switch off: ADC idle whatever the consumers want
+    sy6970_adc_set_enabled(&adc, false, false);
+    sy6970_adc_poll(&adc, &sh, 40400000, &wait);
+    CHECK(adc.mode == SY6970_ADC_MODE_OFF && wait == UINT32_MAX);
+    sy6970_adc_set_enabled(&adc, true, true);
+    sy6970_adc_poll(&adc, &sh, 40500000, &wait);
+    CHECK(adc.mode == SY6970_ADC_MODE_CONTINUOUS);
+
+    // Decoding matches the single-register getters
+    CHECK(sy6970_adc_decode_vbus(0x14) == 0 && sy6970_adc_decode_vbus(0x94) == 4600);
+    CHECK(sy6970_adc_decode_ichg(0x14, 0x5C) == 0 && sy6970_adc_decode_ichg(0x14, 0x54) == 1000);
+}
+
+// Home screen: only the status task's battery log (10 s) needs the ADC
+static void test_adc_home_screen(void)
+{
+    const int seconds = 600;
+    fake_chip_t chip;
+    sy6970_shadow_t sh;
+    sy6970_adc_t adc;
+    sy6970_adc_stats_t st;
+    uint32_t wait;
+    int wakeups = 0;
+    chip_reset(&chip);
+    chip.regs[0x02] = 0x3C;
+    sy6970_shadow_init(&sh, fake_read, fake_write, &chip, SY6970_SNAPSHOT_MAX_AGE_MS * 1000);
+    sy6970_adc_init(&adc, 0);
+    sy6970_adc_add(&adc, SY6970_ADC_VBAT, 10000000);
+
+    int64_t t = 0;
+    while (t < (int64_t)seconds * 1000000) {
+        sy6970_adc_poll(&adc, &sh, t, &wait);
+        wakeups++;
+        t += wait;
+    }
+    sy6970_adc_get_stats(&adc, t, &st);
+    uint64_t elapsed = (uint64_t)t;
+    uint32_t per_min = (uint32_t)((uint64_t)st.conversions * 60000000ULL / elapsed);
+    uint32_t saved = sy6970_adc_saved_ua(st.conversions, elapsed);
+    printf("home screen ADC: %lu conversions/min (continuous: 60), ~%lu uA saved, %d wake-ups in %d s\n",
+           (unsigned long)per_min, (unsigned long)saved, wakeups, seconds);
+    CHECK(per_min == 6);
+    CHECK(saved > 0 && saved == sy6970_adc_saved_ua(0, elapsed) * 54 / 60);
+    CHECK(wakeups <= 2 * seconds / 10 + 2);
+    CHECK(adc.stats.errors == 0);
+}
+
+int main(void)
+{
+    test_status_snapshot();
+    test_config_cache();
+    test_input_limit_rewrite();
+    test_transactions_per_second();
+    test_int_events();
+    test_idle_wakeups();
+    test_adc_modes();
+    test_adc_home_screen();
+
+    if (s_failures) {
+        printf("%d check(s) failed\n", s_failures);
+        return 1;
+    }
+    printf("sy6970 host tests passed\n");
+    return 0;
+}
@@ -1,10 +1,13 @@
 #include "esp_heap_caps.h"
 #include "lvgl_mgr.h"
 #include "hal_mgr.h"
+#include "refresh_gov.h"
+#include "video_plane.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
+#include "freertos/queue.h"
 #include "esp_timer.h"
 #include <string.h>
 
@@ -14,10 +17,31 @@ static SemaphoreHandle_t lvgl_mux = NULL;
 static SemaphoreHandle_t s_vsync_sem = NULL;
 static lv_display_t *lv_disp = NULL;
 static lv_indev_t *lv_touch = NULL;
-static rm690b0_rotation_t s_cur_rot = RM690B0_ROTATION_0;
+static TaskHandle_t s_lvgl_task = NULL;
+static volatile bool s_touch_pending = false;
+static lvgl_mgr_input_stats_t s_input_stats = {0};
+static volatile bool s_panel_on = true;
+static refresh_gov_t s_refresh;
+static QueueHandle_t s_async_q = NULL;
+static video_plane_rect_t s_plane;
+static volatile bool s_plane_on = false;
+
+#define LVGL_ASYNC_QUEUE_LEN 8
+
+typedef struct {
+    lvgl_mgr_async_fn fn;
+    void *arg;
+} lvgl_async_call_t;
 
 // --- LVGL Callbacks ---
 
+// Called from the HAL touch task when a new sample is ready. Wakes the LVGL task,
+// which then runs lv_indev_read() on its own thread (indev is in event mode).
+static void lvgl_touch_ready_cb(void *arg) {
+    s_touch_pending = true;
+    if (s_lvgl_task) xTaskNotifyGive(s_lvgl_task);
+}
+
 static void lvgl_vsync_cb(void *arg) {
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
     if (s_vsync_sem) xSemaphoreGiveFromISR(s_vsync_sem, &xHigherPriorityTaskWoken);
@@ -26,7 +50,9 @@ static void lvgl_vsync_cb(void *arg) {
 
 static void lvgl_power_cb(bool on, void *arg) {
     ESP_LOGI(TAG, "Display Power: %s", on ? "ON" : "OFF");
-    // We could pause/resume LVGL timer here if desired
+    // The LVGL task suspends or resumes rendering on its next pass
+    s_panel_on = on;
+    if (s_lvgl_task) xTaskNotifyGive(s_lvgl_task);
 }
 
 static void lvgl_error_cb(int error_code, void *arg) {
@@ -35,8 +61,6 @@ static void lvgl_error_cb(int error_code, void *arg) {
 
 static void lvgl_rotation_cb(rm690b0_rotation_t rot, void *arg) {
     if (!lv_disp) return;
-    
-    s_cur_rot = rot;
 
     uint16_t w = rm690b0_get_width();
     uint16_t h = rm690b0_get_height();
@@ -44,6 +68,11 @@ static void lvgl_rotation_cb(rm690b0_rotation_t rot, void *arg) {
     ESP_LOGI(TAG, "Rotation changed to %d. Updating LVGL resolution to %dx%d", rot, w, h);
     
     lvgl_mgr_lock();
+    if (s_plane_on) {
+        // Its coordinates no longer mean the same place; the owner falls back to LVGL
+        s_plane_on = false;
+        ESP_LOGI(TAG, "Video plane released by the rotation");
+    }
     lv_display_set_resolution(lv_disp, w, h);
     // Invalidate the whole screen to force a full redraw
     lv_obj_invalidate(lv_screen_active());
@@ -53,6 +82,25 @@ static void lvgl_rotation_cb(rm690b0_rotation_t rot, void *arg) {
 static void lvgl_flush_done_cb(void *user_ctx) {
     lv_display_t *disp = (lv_display_t *)user_ctx;
     lv_display_flush_ready(disp);
+    hal_mgr_power_end(POWER_GOV_WORK_FLUSH);
+}
+
+// Full clock only while LVGL actually draws (RENDER_START is not sent for idle refreshes)
+static void lvgl_render_event_cb(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_RENDER_START) hal_mgr_power_begin(POWER_GOV_WORK_RENDER);
+    else hal_mgr_power_end(POWER_GOV_WORK_RENDER);
+}
+
+// Refresh governor bookkeeping. LVGL resumes its refresh timer on every invalidation, so
+// while the panel is off it is paused again straight away.
+static void lvgl_refr_event_cb(lv_event_t *e) {
+    int64_t now = esp_timer_get_time();
+    if (lv_event_get_code(e) == LV_EVENT_REFR_READY) {
+        refresh_gov_on_refresh(&s_refresh, now);
+        return;
+    }
+    refresh_gov_on_request(&s_refresh, now);
+    if (refresh_gov_mode(&s_refresh) == REFRESH_GOV_SUSPENDED) lv_timer_pause(lv_display_get_refr_timer(lv_disp));
 }
 
 static void lvgl_rounder_cb(lv_event_t *e) {
@@ -74,6 +122,23 @@ static void lvgl_rounder_cb(lv_event_t *e) {
     // If display width is odd, this logic might need adjustment, but 600 is even.
 }
 
+// Windows of a flush clipped around the video plane. Each goes out once the next is known,
+// so only the last one carries the done callback.
+typedef struct {
+    video_plane_rect_t win;
+    uint16_t *px;
+    bool pending;
+} lvgl_plane_batch_t;
+
+static void lvgl_plane_send(void *ctx, const video_plane_rect_t *win, uint16_t *px) {
+    lvgl_plane_batch_t *b = (lvgl_plane_batch_t *)ctx;
+    if (b->pending) hal_mgr_display_flush_async(b->win.x1, b->win.y1, b->win.x2, b->win.y2, b->px, NULL, NULL);
+    lv_draw_sw_rgb565_swap(px, (uint32_t)(win->x2 - win->x1 + 1) * (uint32_t)(win->y2 - win->y1 + 1));
+    b->win = *win;
+    b->px = px;
+    b->pending = true;
+}
+
 static void lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
     static uint32_t last_flush = 0;
     if (esp_log_timestamp() - last_flush > 5000) {
@@ -81,6 +146,21 @@ static void lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px
                  (int)area->x1, (int)area->y1, (int)area->x2, (int)area->y2);
         last_flush = esp_log_timestamp();
     }
+    if (s_plane_on && lv_display_get_color_format(disp) == LV_COLOR_FORMAT_RGB565) {
+        // Leave the video plane alone: send (and swap) only what lies outside it
+        video_plane_rect_t a = { area->x1, area->y1, area->x2, area->y2 };
+        lvgl_plane_batch_t batch = { .pending = false };
+        video_plane_flush(&a, (uint16_t *)px_map, &s_plane, lvgl_plane_send, &batch);
+        if (!batch.pending) {
+            lv_display_flush_ready(disp);
+            return;
+        }
+        hal_mgr_power_begin(POWER_GOV_WORK_FLUSH);
+        hal_mgr_display_flush_async(batch.win.x1, batch.win.y1, batch.win.x2, batch.win.y2, batch.px,
+                                    lvgl_flush_done_cb, disp);
+        return;
+    }
+
     // Swap bytes for RGB565 because the RM690B0 expects Big Endian
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
@@ -107,10 +187,27 @@ static void lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px
     }
     */
 
-    // Map LVGL flush to our HAL flush (Async DMA)
+    // Map LVGL flush to our HAL flush (Async DMA); the clock stays up until the transfer is done
+    hal_mgr_power_begin(POWER_GOV_WORK_FLUSH);
     hal_mgr_display_flush_async(area->x1, area->y1, area->x2, area->y2, px_map, lvgl_flush_done_cb, disp);
 }
 
+// Touch coordinates arrive from hal_mgr already in display space for the current
+// rotation (its per-rotation transform replaces the old fixups here).
+uint8_t lvgl_mgr_touch_get_points(lvgl_mgr_touch_point_t *points, uint8_t max) {
+    cst226se_point_t raw[CST226SE_MAX_POINTS];
+    uint8_t n = hal_mgr_touch_read_points(raw, CST226SE_MAX_POINTS);
+    uint8_t out = 0;
+    for (uint8_t i = 0; i < n && out < max; i++) {
+        if (raw[i].state != CST226SE_POINT_STATE_PRESSED) continue;
+        points[out].id = raw[i].id;
+        points[out].x = (int16_t)raw[i].x;
+        points[out].y = (int16_t)raw[i].y;
+        out++;
+    }
+    return out;
+}
+
 static void lvgl_touch_read_cb(lv_indev_t *indev, lv_indev_data_t *data) {
     static uint32_t call_count = 0;
     call_count++;
@@ -119,28 +216,6 @@ static void lvgl_touch_read_cb(lv_indev_t *indev, lv_indev_data_t *data) {
     bool pressed = hal_mgr_touch_read(&x, &y);
     
     if (pressed) {
-        // --- TOUCH COORDINATE MAPPING (VERIFIED 2026-01-04) ---
-        // Rotation 0 (Landscape): Native driver output is correct.
-        // Rotation 1 (Portrait): X is mirrored, Y is correct.
-        // Rotation 2 (Landscape Inv): X is correct, Y is reversed.
-        // Rotation 3 (Portrait Inv): X is mirrored, Y is correct.
-
-        // Fix for mirrored X in portrait modes (1 and 3)
-        if (s_cur_rot == RM690B0_ROTATION_90 || s_cur_rot == RM690B0_ROTATION_270) {
-             uint16_t w = rm690b0_get_width();
-             if (x < w) {
-                 x = w - 1 - x;
-             }
-        }
-
-        // Fix for reversed Y in rotation 2 only
-        if (s_cur_rot == RM690B0_ROTATION_180) {
-             uint16_t h = rm690b0_get_height();
-             if (y < h) {
-                 y = h - 1 - y;
-             }
-        }
-
         data->point.x = x;
         data->point.y = y;
         data->state = LV_INDEV_STATE_PRESSED;
@@ -153,17 +228,53 @@ static void lvgl_touch_read_cb(lv_indev_t *indev, lv_indev_data_t *data) {
         // data->point.y = last_y;
     }
 
-    // Log every 100 calls (~3 seconds at 30ms) to confirm polling is alive
+    // Log every 100 reads to confirm touch events are arriving
     if (call_count % 100 == 0) {
-        ESP_LOGI(TAG, "LVGL polling touch heartbeat: pressed=%d, x=%d, y=%d", pressed, x, y);
+        ESP_LOGI(TAG, "LVGL touch read heartbeat: pressed=%d, x=%d, y=%d", pressed, x, y);
+    }
+}
+
+// Record sample-to-LVGL latency for a freshly consumed touch sample
+static void lvgl_account_touch_latency(void) {
+    int64_t sample_us = hal_mgr_touch_get_sample_time();
+    if (sample_us <= 0) return;
+    uint32_t latency_us = (uint32_t)(esp_timer_get_time() - sample_us);
+    s_input_stats.indev_reads++;
+    s_input_stats.latency_sum_us += latency_us;
+    if (latency_us > s_input_stats.latency_max_us) s_input_stats.latency_max_us = latency_us;
+}
+
+// Pick the refresh period from touch, animation and panel state (call with the lock held)
+static refresh_gov_mode_t lvgl_refresh_update(void) {
+    lv_timer_t *refr = lv_display_get_refr_timer(lv_disp);
+    refresh_gov_input_t in = {
+        .panel_on = s_panel_on,
+        .touch_down = lv_touch && lv_indev_get_state(lv_touch) == LV_INDEV_STATE_PRESSED,
+        .animating = lv_anim_count_running() > 0 || (lv_touch && lv_indev_get_scroll_obj(lv_touch) != NULL),
+    };
+    uint32_t act = refresh_gov_update(&s_refresh, &in, esp_timer_get_time());
+    refresh_gov_mode_t mode = refresh_gov_mode(&s_refresh);
+    if (!act || !refr) return mode;
+
+    if (act & REFRESH_GOV_ACT_PAUSE) lv_timer_pause(refr);
+    if (act & REFRESH_GOV_ACT_PERIOD) lv_timer_set_period(refr, refresh_gov_period_ms(mode));
+    if (act & REFRESH_GOV_ACT_RESUME) {
+        // Nothing was drawn while the panel was off; redraw everything
+        lv_timer_resume(refr);
+        lv_obj_invalidate(lv_screen_active());
     }
+    ESP_LOGD(TAG, "Refresh mode: %s", refresh_gov_mode_name(mode));
+    return mode;
 }
 
 // --- LVGL Timer Task ---
+// Sleeps until the next LVGL timer is due or a touch sample arrives (task notification).
 static void lvgl_timer_task(void *arg) {
     ESP_LOGI(TAG, "Starting LVGL timer task");
     uint32_t last_heartbeat = 0;
     uint32_t last_tick = esp_log_timestamp();
+    lvgl_mgr_input_stats_t last_stats = {0};
+    refresh_gov_stats_t last_refr = {0};
 
     while (1) {
         uint32_t now = esp_log_timestamp();
@@ -171,20 +282,114 @@ static void lvgl_timer_task(void *arg) {
         last_tick = now;
 
         lvgl_mgr_lock();
+        // Work posted from other tasks (file I/O completions and the like)
+        lvgl_async_call_t call;
+        while (s_async_q && xQueueReceive(s_async_q, &call, 0) == pdTRUE) call.fn(call.arg);
+        // Read on a new sample, and keep reading while LVGL is still running a scroll
+        // throw after release (that momentum is driven by indev reads).
+        bool pending = s_touch_pending;
+        bool throwing = lv_touch && lv_indev_get_scroll_obj(lv_touch) != NULL;
+        if ((pending || throwing) && lv_touch) {
+            s_touch_pending = false;
+            lv_indev_read(lv_touch);
+            if (pending) lvgl_account_touch_latency();
+        }
+        refresh_gov_mode_t mode = lvgl_refresh_update();
+        uint32_t period = refresh_gov_period_ms(mode);
         uint32_t sleep_ms = lv_timer_handler();
+        if (lv_touch && lv_indev_get_scroll_obj(lv_touch) != NULL && sleep_ms > period) {
+            sleep_ms = period;
+        }
+        refresh_gov_stats_t refr;
+        refresh_gov_get_stats(&s_refresh, esp_timer_get_time(), &refr);
         lvgl_mgr_unlock();
         
         if (now - last_heartbeat > 5000) {
-            ESP_LOGI(TAG, "LVGL timer task heartbeat, next sleep: %lu ms", (unsigned long)sleep_ms);
+            lvgl_mgr_input_stats_t st = s_input_stats;
+            uint32_t reads = st.indev_reads - last_stats.indev_reads;
+            uint32_t avg_us = reads ? (uint32_t)((st.latency_sum_us - last_stats.latency_sum_us) / reads) : 0;
+            ESP_LOGI(TAG, "LVGL heartbeat: next sleep %lu ms, wake-ups %lu (touch %lu), reads %lu, latency avg %lu us max %lu us, "
+                     "refresh %s (frames %lu, skipped %lu)",
+                     (unsigned long)sleep_ms,
+                     (unsigned long)(st.wakeups - last_stats.wakeups),
+                     (unsigned long)(st.touch_wakeups - last_stats.touch_wakeups),
+                     (unsigned long)reads, (unsigned long)avg_us, (unsigned long)st.latency_max_us,
+                     refresh_gov_mode_name(mode),
+                     (unsigned long)(refr.frames - last_refr.frames),
+                     (unsigned long)(refr.skipped - last_refr.skipped));
+            // Prediction horizon: sample-to-read delay plus roughly one refresh to render and flush
+            // (touch holds the fast refresh rate)
+            if (reads) hal_mgr_touch_set_latency(avg_us + REFRESH_GOV_ACTIVE_MS * 1000);
+            last_stats = st;
+            last_refr = refr;
+            s_input_stats.latency_max_us = 0;
             last_heartbeat = now;
         }
 
         if (sleep_ms < 1) sleep_ms = 1;
-        if (sleep_ms > 100) sleep_ms = 100; 
-        vTaskDelay(pdMS_TO_TICKS(sleep_ms));
+        if (sleep_ms > refresh_gov_max_sleep_ms(mode)) sleep_ms = refresh_gov_max_sleep_ms(mode);
+        uint32_t notified = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleep_ms));
+        s_input_stats.wakeups++;
+        if (notified) s_input_stats.touch_wakeups++;
     }
 }
 
+void lvgl_mgr_get_input_stats(lvgl_mgr_input_stats_t *stats) {
+    if (stats) *stats = s_input_stats;
+}
+
+refresh_gov_mode_t lvgl_mgr_get_refresh_mode(void) {
+    return refresh_gov_mode(&s_refresh);
+}
+
+void lvgl_mgr_get_refresh_stats(refresh_gov_stats_t *stats) {
+    if (!stats) return;
+    lvgl_mgr_lock();
+    refresh_gov_get_stats(&s_refresh, esp_timer_get_time(), stats);
+    lvgl_mgr_unlock();
+}
+
+esp_err_t lvgl_mgr_run_async(lvgl_mgr_async_fn fn, void *arg) {
+    if (!fn) return ESP_ERR_INVALID_ARG;
+    if (!s_async_q) return ESP_ERR_INVALID_STATE;
+    lvgl_async_call_t call = { .fn = fn, .arg = arg };
+    if (xQueueSend(s_async_q, &call, 0) != pdTRUE) return ESP_ERR_NO_MEM;
+    if (s_lvgl_task) xTaskNotifyGive(s_lvgl_task);
+    return ESP_OK;
+}
+
+esp_err_t lvgl_mgr_video_plane_set(const lv_area_t *area) {
+    if (!lv_disp) return ESP_ERR_INVALID_STATE;
+    esp_err_t ret = ESP_OK;
+    lvgl_mgr_lock();
+    if (area) {
+        video_plane_rect_t p = { area->x1, area->y1, area->x2, area->y2 };
+        if (video_plane_valid(&p, lv_display_get_horizontal_resolution(lv_disp),
+                              lv_display_get_vertical_resolution(lv_disp))) {
+            s_plane = p;
+            s_plane_on = true;
+            ESP_LOGI(TAG, "Video plane at %ld,%ld %ldx%ld", (long)p.x1, (long)p.y1,
+                     (long)(p.x2 - p.x1 + 1), (long)(p.y2 - p.y1 + 1));
+        } else {
+            ret = ESP_ERR_INVALID_ARG;
+        }
+    } else if (s_plane_on) {
+        s_plane_on = false;
+        lv_area_t a = { s_plane.x1, s_plane.y1, s_plane.x2, s_plane.y2 };
+        lv_obj_invalidate_area(lv_screen_active(), &a);
+    }
+    lvgl_mgr_unlock();
+    return ret;
+}
+
+esp_err_t lvgl_mgr_video_plane_flush(int32_t x1, int32_t y1, int32_t x2, int32_t y2, const void *px,
+                                     lvgl_mgr_done_cb_t cb, void *ctx) {
+    video_plane_rect_t p = s_plane;
+    if (!s_plane_on || x1 < p.x1 || y1 < p.y1 || x2 > p.x2 || y2 > p.y2) return ESP_ERR_INVALID_STATE;
+    hal_mgr_display_flush_async(x1, y1, x2, y2, px, (hal_mgr_done_cb_t)cb, ctx);
+    return ESP_OK;
+}
+
 void lvgl_mgr_lock(void) {
     if (lvgl_mux) xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
 }
@@ -210,6 +415,7 @@ esp_err_t bsp_init(void) {
 
     // Create VSYNC semaphore
     s_vsync_sem = xSemaphoreCreateBinary();
+    s_async_q = xQueueCreate(LVGL_ASYNC_QUEUE_LEN, sizeof(lvgl_async_call_t));
     
     // Register Callbacks
     hal_mgr_register_display_vsync_callback(lvgl_vsync_cb, NULL);
@@ -226,6 +432,12 @@ esp_err_t bsp_init(void) {
     lv_display_set_default(lv_disp);
     lv_display_set_flush_cb(lv_disp, lvgl_flush_cb);
     lv_display_add_event_cb(lv_disp, lvgl_rounder_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    lv_display_add_event_cb(lv_disp, lvgl_render_event_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(lv_disp, lvgl_render_event_cb, LV_EVENT_RENDER_READY, NULL);
+    // After LVGL's own REFR_REQUEST handler, so a suspended refresh stays paused
+    refresh_gov_init(&s_refresh, esp_timer_get_time());
+    lv_display_add_event_cb(lv_disp, lvgl_refr_event_cb, LV_EVENT_REFR_REQUEST, NULL);
+    lv_display_add_event_cb(lv_disp, lvgl_refr_event_cb, LV_EVENT_REFR_READY, NULL);
     
     // Force RGB565 format for the display. You need an esp32-p4 for RGB888 support.
     lv_display_set_color_format(lv_disp, LV_COLOR_FORMAT_RGB565);
@@ -265,20 +477,17 @@ esp_err_t bsp_init(void) {
         lv_indev_set_read_cb(lv_touch, lvgl_touch_read_cb);
         lv_indev_set_display(lv_touch, lv_disp);
         
-        lv_timer_t * read_timer = lv_indev_get_read_timer(lv_touch);
-        if (read_timer) {
-            lv_timer_set_period(read_timer, 30);
-            ESP_LOGI(TAG, "Touch timer period set to 30ms");
-        } else {
-            ESP_LOGW(TAG, "Failed to get touch read timer!");
-        }
+        // Event-driven input: no read timer, the touch IRQ path triggers lv_indev_read()
+        lv_indev_set_mode(lv_touch, LV_INDEV_MODE_EVENT);
+        hal_mgr_register_touch_ready_callback(lvgl_touch_ready_cb, NULL);
+        ESP_LOGI(TAG, "Touch input in event mode");
     } else {
         ESP_LOGE(TAG, "Failed to create LVGL input device!");
     }
 
     // Start LVGL Task
     // Increased stack to 32KB for GIF decoding and file operations
-    xTaskCreatePinnedToCore(lvgl_timer_task, "lvgl_task", 32768, NULL, 5, NULL, 1);
+    xTaskCreatePinnedToCore(lvgl_timer_task, "lvgl_task", 32768, NULL, 5, &s_lvgl_task, 1);
 
     ESP_LOGI(TAG, "LVGL Manager Initialized");
     return ESP_OK;
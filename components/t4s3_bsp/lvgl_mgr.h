@@ -3,11 +3,33 @@
 
 #include "esp_err.h"
 #include "lvgl.h"
+#include "refresh_gov.h"
+#include "video_plane.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Touch input statistics (cumulative since boot)
+ */
+typedef struct {
+    uint32_t wakeups;        // LVGL task wake-ups (timer expiry or notification)
+    uint32_t touch_wakeups;  // Wake-ups caused by a touch sample notification
+    uint32_t indev_reads;    // lv_indev_read() calls that consumed a sample
+    uint64_t latency_sum_us; // Sum of sample-to-read latency
+    uint32_t latency_max_us; // Worst sample-to-read latency in the current 5 s window
+} lvgl_mgr_input_stats_t;
+
+/**
+ * @brief One touch contact in display (LVGL) coordinates
+ */
+typedef struct {
+    uint8_t id;              // Controller tracking ID, stable while the finger is down
+    int16_t x;
+    int16_t y;
+} lvgl_mgr_touch_point_t;
+
 /**
  * @brief Initialize the BSP (Board Support Package)
  * This will initialize the HAL, setup LVGL, and start the LVGL timer task.
@@ -25,6 +47,60 @@ void lvgl_mgr_lock(void);
  */
 void lvgl_mgr_unlock(void);
 
+typedef void (*lvgl_mgr_async_fn)(void *arg);
+
+/**
+ * @brief Run `fn` on the LVGL task (with the LVGL lock held) on its next pass, waking it.
+ * Safe from any task; never blocks.
+ * @return ESP_ERR_NO_MEM if the queue is full
+ */
+esp_err_t lvgl_mgr_run_async(lvgl_mgr_async_fn fn, void *arg);
+
+/**
+ * @brief Get touch input wake-up and latency statistics
+ */
+void lvgl_mgr_get_input_stats(lvgl_mgr_input_stats_t *stats);
+
+/**
+ * @brief Current display refresh mode (active / normal / idle / suspended while the panel
+ * is off). The refresh period follows touch, animations and how often content changes.
+ */
+refresh_gov_mode_t lvgl_mgr_get_refresh_mode(void);
+
+/**
+ * @brief Time spent in each refresh mode, frames drawn, and frames skipped compared with a
+ * fixed 33 ms refresh (merged at a lower rate or dropped while the panel was off)
+ */
+void lvgl_mgr_get_refresh_stats(refresh_gov_stats_t *stats);
+
+/**
+ * @brief Get all fingers currently in contact, mapped to display coordinates.
+ * Intended for multi-touch gestures from LVGL event handlers; the pointer indev only
+ * carries the primary point.
+ * @return Number of points written (0 when released)
+ */
+uint8_t lvgl_mgr_touch_get_points(lvgl_mgr_touch_point_t *points, uint8_t max);
+
+typedef void (*lvgl_mgr_done_cb_t)(void *ctx);
+
+/**
+ * @brief Reserve a screen area for video written straight to the panel with
+ * lvgl_mgr_video_plane_flush(). LVGL keeps drawing everything else but never sends pixels
+ * inside it, so nothing LVGL draws there is visible. Cleared when the display rotates.
+ * @param area Display coordinates; even start and size, and at least as wide as the screen
+ * on either side of it. NULL releases the plane and redraws the area.
+ * @return ESP_ERR_INVALID_ARG if the area cannot be used
+ */
+esp_err_t lvgl_mgr_video_plane_set(const lv_area_t *area);
+
+/**
+ * @brief Send big-endian RGB565 pixels for part of the video plane to the panel (async DMA).
+ * `cb` runs on the panel task once `px` may be reused. Safe from any task.
+ * @return ESP_ERR_INVALID_STATE if the plane is gone or does not contain the area
+ */
+esp_err_t lvgl_mgr_video_plane_flush(int32_t x1, int32_t y1, int32_t x2, int32_t y2, const void *px,
+                                     lvgl_mgr_done_cb_t cb, void *ctx);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,101 @@
+#include "refresh_gov.h"
+#include <string.h>
+
+#define SLOT_US     (REFRESH_GOV_NORMAL_MS * 1000)
+
+void refresh_gov_init(refresh_gov_t *g, int64_t now_us) {
+    memset(g, 0, sizeof(*g));
+    g->mode = REFRESH_GOV_NORMAL;
+    g->mode_since_us = now_us;
+    g->busy_until_us = now_us + REFRESH_GOV_IDLE_AFTER_MS * 1000;
+    g->last_refresh_us = now_us;
+    g->start_us = now_us;
+}
+
+static refresh_gov_mode_t wanted_mode(refresh_gov_t *g, const refresh_gov_input_t *in, int64_t now_us) {
+    if (!in->panel_on) return REFRESH_GOV_SUSPENDED;
+    // The full redraw on resume is busy content; don't drop straight to IDLE
+    if (g->mode == REFRESH_GOV_SUSPENDED) g->busy_until_us = now_us + REFRESH_GOV_IDLE_AFTER_MS * 1000;
+    if (in->touch_down || in->animating) g->active_until_us = now_us + REFRESH_GOV_ACTIVE_HOLD_MS * 1000;
+    if (now_us < g->active_until_us) return REFRESH_GOV_ACTIVE;
+    if (now_us < g->busy_until_us) return REFRESH_GOV_NORMAL;
+    return REFRESH_GOV_IDLE;
+}
+
+uint32_t refresh_gov_update(refresh_gov_t *g, const refresh_gov_input_t *in, int64_t now_us) {
+    refresh_gov_mode_t next = wanted_mode(g, in, now_us);
+    if (next == g->mode) return 0;
+
+    uint32_t act;
+    if (next == REFRESH_GOV_SUSPENDED) {
+        act = REFRESH_GOV_ACT_PAUSE;
+    } else if (g->mode == REFRESH_GOV_SUSPENDED) {
+        act = REFRESH_GOV_ACT_PERIOD | REFRESH_GOV_ACT_RESUME;
+        g->stats.resumes++;
+        g->streak = 0;
+    } else {
+        act = REFRESH_GOV_ACT_PERIOD;
+    }
+    g->stats.mode_us[g->mode] += (uint64_t)(now_us - g->mode_since_us);
+    g->stats.mode_changes++;
+    g->mode = next;
+    g->mode_since_us = now_us;
+    return act;
+}
+
+void refresh_gov_on_request(refresh_gov_t *g, int64_t now_us) {
+    if (g->pending_slots == 0 || now_us >= g->slot_start_us + SLOT_US) {
+        g->pending_slots++;
+        g->slot_start_us = now_us;
+    }
+}
+
+void refresh_gov_on_refresh(refresh_gov_t *g, int64_t now_us) {
+    g->stats.frames++;
+    if (g->pending_slots > 1) g->stats.skipped += g->pending_slots - 1;
+    g->pending_slots = 0;
+
+    // Back-to-back: the timer period was the only thing holding this refresh back
+    int64_t gap = now_us - g->last_refresh_us;
+    g->last_refresh_us = now_us;
+    if (gap > (int64_t)refresh_gov_period_ms(g->mode) * 1000 + SLOT_US) {
+        g->streak = 0;
+        return;
+    }
+    if (g->streak < UINT8_MAX) g->streak++;
+    if (g->streak >= REFRESH_GOV_BUSY_FRAMES) g->busy_until_us = now_us + REFRESH_GOV_IDLE_AFTER_MS * 1000;
+}
+
+refresh_gov_mode_t refresh_gov_mode(const refresh_gov_t *g) {
+    return g->mode;
+}
+
+uint32_t refresh_gov_period_ms(refresh_gov_mode_t mode) {
+    switch (mode) {
+        case REFRESH_GOV_ACTIVE: return REFRESH_GOV_ACTIVE_MS;
+        case REFRESH_GOV_NORMAL: return REFRESH_GOV_NORMAL_MS;
+        default:                 return REFRESH_GOV_IDLE_MS;
+    }
+}
+
+uint32_t refresh_gov_max_sleep_ms(refresh_gov_mode_t mode) {
+    return (mode == REFRESH_GOV_IDLE || mode == REFRESH_GOV_SUSPENDED) ? 1000 : 100;
+}
+
+void refresh_gov_get_stats(const refresh_gov_t *g, int64_t now_us, refresh_gov_stats_t *out) {
+    *out = g->stats;
+    out->mode_us[g->mode] += (uint64_t)(now_us - g->mode_since_us);
+    // Requests still waiting: all but one of them will be merged
+    if (g->pending_slots > 1) out->skipped += g->pending_slots - 1;
+    out->elapsed_us = (uint64_t)(now_us - g->start_us);
+}
+
+const char *refresh_gov_mode_name(refresh_gov_mode_t mode) {
+    switch (mode) {
+        case REFRESH_GOV_ACTIVE:    return "active";
+        case REFRESH_GOV_NORMAL:    return "normal";
+        case REFRESH_GOV_IDLE:      return "idle";
+        case REFRESH_GOV_SUSPENDED: return "suspended";
+        default:                    return "?";
+    }
+}
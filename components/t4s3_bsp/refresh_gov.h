@@ -0,0 +1,109 @@
+#ifndef REFRESH_GOV_H
+#define REFRESH_GOV_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// LVGL refresh-rate policy. LVGL's refresh timer already sleeps until something is
+// invalidated; its period caps how often bursts of invalidations are drawn. This picks that
+// period from what the UI is doing:
+//   - ACTIVE while a finger is down or animations / scroll throws run, held briefly after
+//     they stop so a fling's tail is still smooth
+//   - NORMAL while content keeps changing on its own (video, progress bars)
+//   - IDLE when only occasional redraws happen (the status-bar clock); an isolated redraw
+//     still goes out at once, bursts are merged
+//   - SUSPENDED while the panel is off (DISPOFF): nothing is drawn or flushed, and the whole
+//     screen is redrawn when it comes back
+// The caller turns the returned REFRESH_GOV_ACT_* flags into lv_timer calls. Times are
+// passed in; no LVGL or IDF dependencies so the policy can be exercised on the host.
+
+typedef enum {
+    REFRESH_GOV_ACTIVE = 0,
+    REFRESH_GOV_NORMAL,
+    REFRESH_GOV_IDLE,
+    REFRESH_GOV_SUSPENDED,
+    REFRESH_GOV_MODE_COUNT
+} refresh_gov_mode_t;
+
+// Actions for the caller
+#define REFRESH_GOV_ACT_PERIOD  (1u << 0)   // apply refresh_gov_period_ms() to the refresh timer
+#define REFRESH_GOV_ACT_PAUSE   (1u << 1)   // pause the refresh timer (and keep it paused)
+#define REFRESH_GOV_ACT_RESUME  (1u << 2)   // resume it and invalidate the whole screen
+
+#ifndef REFRESH_GOV_ACTIVE_MS
+#define REFRESH_GOV_ACTIVE_MS       16      // ~60 fps
+#endif
+#ifndef REFRESH_GOV_NORMAL_MS
+#define REFRESH_GOV_NORMAL_MS       33      // the old fixed LV_DEF_REFR_PERIOD
+#endif
+#ifndef REFRESH_GOV_IDLE_MS
+#define REFRESH_GOV_IDLE_MS         250
+#endif
+#ifndef REFRESH_GOV_ACTIVE_HOLD_MS
+#define REFRESH_GOV_ACTIVE_HOLD_MS  300     // stay ACTIVE after the last touch / animation
+#endif
+#ifndef REFRESH_GOV_IDLE_AFTER_MS
+#define REFRESH_GOV_IDLE_AFTER_MS   1000    // drop to IDLE after this long without busy redraws
+#endif
+#ifndef REFRESH_GOV_BUSY_FRAMES
+#define REFRESH_GOV_BUSY_FRAMES     2       // back-to-back refreshes that mark content as busy
+#endif
+
+typedef struct {
+    bool panel_on;
+    bool touch_down;
+    bool animating;         // LVGL animations or a scroll throw in progress
+} refresh_gov_input_t;
+
+typedef struct {
+    uint64_t mode_us[REFRESH_GOV_MODE_COUNT];
+    uint32_t frames;        // refreshes run
+    uint32_t skipped;       // frames the old fixed 33 ms refresh would have drawn on top
+                            // (merged at a lower rate, or dropped while suspended)
+    uint32_t mode_changes;
+    uint32_t resumes;       // panel came back on
+    uint64_t elapsed_us;    // since init
+} refresh_gov_stats_t;
+
+typedef struct {
+    refresh_gov_mode_t mode;
+    int64_t mode_since_us;
+    int64_t active_until_us;
+    int64_t busy_until_us;
+    int64_t last_refresh_us;
+    uint8_t streak;         // back-to-back refreshes so far
+    int64_t slot_start_us;  // first request not yet drawn opens a NORMAL_MS slot
+    uint32_t pending_slots; // slots with requests since the last refresh
+    int64_t start_us;
+    refresh_gov_stats_t stats;
+} refresh_gov_t;
+
+void refresh_gov_init(refresh_gov_t *g, int64_t now_us);
+
+/**
+ * @brief Re-evaluate the mode from the current UI state; call before each LVGL timer run.
+ * @return REFRESH_GOV_ACT_* flags for the caller to apply (0 when nothing changed)
+ */
+uint32_t refresh_gov_update(refresh_gov_t *g, const refresh_gov_input_t *in, int64_t now_us);
+
+// Something was invalidated (LV_EVENT_REFR_REQUEST)
+void refresh_gov_on_request(refresh_gov_t *g, int64_t now_us);
+// A refresh ran (LV_EVENT_REFR_READY)
+void refresh_gov_on_refresh(refresh_gov_t *g, int64_t now_us);
+
+refresh_gov_mode_t refresh_gov_mode(const refresh_gov_t *g);
+uint32_t refresh_gov_period_ms(refresh_gov_mode_t mode);
+// Longest the LVGL task may sleep in `mode` when no timer or touch wakes it earlier
+uint32_t refresh_gov_max_sleep_ms(refresh_gov_mode_t mode);
+void refresh_gov_get_stats(const refresh_gov_t *g, int64_t now_us, refresh_gov_stats_t *out);
+const char *refresh_gov_mode_name(refresh_gov_mode_t mode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // REFRESH_GOV_H
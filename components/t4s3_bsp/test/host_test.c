@@ -0,0 +1,368 @@
+// Host-side test for the BSP's refresh-rate governor: replays a day of usage (panel off
+// overnight, browsing sessions, a dashboard with a ticking clock, video) through both the
+// old fixed 33 ms refresh and the governor, checks touch and clock latency and that
+// nothing is drawn while the panel is off, and reports the CPU time each one spends. The
+// video plane's flush clipping is checked against a model of the panel's memory.
+//
+// gcc -std=gnu11 -O2 -Wall -I components/t4s3_bsp -o /tmp/t4s3_bsp_host_test components/t4s3_bsp/test/host_test.c components/t4s3_bsp/refresh_gov.c components/t4s3_bsp/video_plane.c
+// /tmp/t4s3_bsp_host_test
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "refresh_gov.h"
+#include "video_plane.h"
+
+static int s_failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); s_failures++; } \
+} while (0)
+
+// --- Recorded day ---
+// Rough CPU costs on the S3: one LVGL task wake-up (timer handler walk at the power
+// governor's 40 MHz idle clock), and drawing + flushing an invalidated area (boosted).
+#define WAKE_US         250
+#define CLOCK_US        1500    // status-bar clock label
+#define SCROLL_US       7000    // scrolling list / screen transition
+#define VIDEO_US        9000    // video frame blit (decode excluded)
+#define FULL_US         12000   // full-screen redraw
+#define UI_TIMER_MS     500     // the UI's own periodic lv_timer (stats refresh)
+#define OLD_MAX_SLEEP_MS 100    // the old fixed wake-up cap in lvgl_timer_task
+
+typedef enum { DAY_OFF, DAY_GLANCE, DAY_BROWSE, DAY_VIDEO } day_activity_t;
+
+static const struct { uint32_t from_min, to_min; day_activity_t what; } s_day[] = {
+    {0,             7 * 60,         DAY_OFF},
+    {7 * 60,        7 * 60 + 30,    DAY_BROWSE},
+    {7 * 60 + 30,   9 * 60,         DAY_GLANCE},
+    {9 * 60,        12 * 60,        DAY_OFF},
+    {12 * 60,       12 * 60 + 30,   DAY_BROWSE},
+    {12 * 60 + 30,  18 * 60,        DAY_GLANCE},
+    {18 * 60,       19 * 60,        DAY_BROWSE},
+    {19 * 60,       19 * 60 + 30,   DAY_VIDEO},
+    {19 * 60 + 30,  23 * 60,        DAY_GLANCE},
+    {23 * 60,       24 * 60,        DAY_OFF},
+};
+
+typedef struct {
+    bool panel_on;
+    bool touch_down;
+    bool animating;
+    uint32_t dirty_us;      // cost of what was invalidated at this millisecond (0 = nothing)
+} day_state_t;
+
+// UI state at millisecond `t`. Browsing repeats a 20 s cycle: a 1.2 s drag and its 0.6 s
+// throw, reading, then a tap that opens a screen with a 0.3 s transition.
+static day_state_t day_at(uint64_t t) {
+    day_state_t st = {0};
+    day_activity_t what = DAY_OFF;
+    for (size_t i = 0; i < sizeof(s_day) / sizeof(s_day[0]); i++) {
+        if (t >= s_day[i].from_min * 60000ULL && t < s_day[i].to_min * 60000ULL) what = s_day[i].what;
+    }
+    st.panel_on = what != DAY_OFF;
+    if (t % 1000 == 0) st.dirty_us = CLOCK_US;  // the clock ticks whether or not anyone looks
+    if (what == DAY_BROWSE) {
+        uint32_t c = t % 20000;
+        st.touch_down = c < 1200 || (c >= 6000 && c < 6100);
+        st.animating = (c >= 1200 && c < 1800) || (c >= 6100 && c < 6400);
+        if (st.touch_down || st.animating) st.dirty_us = SCROLL_US;
+    } else if (what == DAY_VIDEO) {
+        if (t % 33 == 0) st.dirty_us = VIDEO_US;
+    }
+    return st;
+}
+
+typedef struct {
+    uint64_t cpu_us;
+    uint64_t interactive_cpu_us;    // spent while a finger was down or an animation ran
+    uint32_t wakeups;
+    uint32_t renders;
+    uint32_t interactive_renders;
+    uint32_t renders_while_off;
+    uint32_t max_clock_latency_ms;
+    uint32_t max_touch_latency_ms;  // interaction change to the frame that shows it
+} day_result_t;
+
+// Fixed 33 ms refresh period and 100 ms wake-up cap when `g` is NULL, otherwise the governor.
+// LVGL's refresh timer runs once something is invalid and at most once per period.
+static day_result_t day_run(refresh_gov_t *g) {
+    day_result_t r = {0};
+    const uint64_t day_ms = 24ULL * 3600 * 1000;
+    uint32_t period = REFRESH_GOV_NORMAL_MS;
+    uint32_t max_sleep = OLD_MAX_SLEEP_MS;
+    bool suspended = false;
+    uint32_t dirty_us = 0;
+    int64_t last_refr = -1000, last_wake = 0;
+    int64_t clock_since = -1, touch_since = -1;
+
+    if (g) refresh_gov_init(g, 0);
+    for (uint64_t t = 0; t < day_ms; t++) {
+        day_state_t st = day_at(t);
+        bool interactive = st.touch_down || st.animating;
+        if (g) {
+            refresh_gov_input_t in = {st.panel_on, st.touch_down, st.animating};
+            uint32_t act = refresh_gov_update(g, &in, (int64_t)t * 1000);
+            if (act & REFRESH_GOV_ACT_PAUSE) suspended = true;
+            if (act & REFRESH_GOV_ACT_RESUME) {
+                suspended = false;
+                dirty_us = FULL_US;
+                refresh_gov_on_request(g, (int64_t)t * 1000);
+            }
+            if (act & REFRESH_GOV_ACT_PERIOD) period = refresh_gov_period_ms(refresh_gov_mode(g));
+            max_sleep = refresh_gov_max_sleep_ms(refresh_gov_mode(g));
+        }
+        if (st.dirty_us) {
+            if (st.dirty_us > dirty_us) dirty_us = st.dirty_us;
+            if (g) refresh_gov_on_request(g, (int64_t)t * 1000);
+            if (st.dirty_us == CLOCK_US && st.panel_on && clock_since < 0) clock_since = (int64_t)t;
+            if (interactive && touch_since < 0) touch_since = (int64_t)t;
+        }
+
+        bool refresh = dirty_us && !suspended && (int64_t)t >= last_refr + period;
+        if (refresh || t % UI_TIMER_MS == 0 || (int64_t)t - last_wake >= max_sleep) {
+            r.wakeups++;
+            r.cpu_us += WAKE_US;
+            if (interactive) r.interactive_cpu_us += WAKE_US;
+            last_wake = (int64_t)t;
+        }
+        if (!refresh) continue;
+
+        r.renders++;
+        r.cpu_us += dirty_us;
+        if (interactive) {
+            r.interactive_renders++;
+            r.interactive_cpu_us += dirty_us;
+        }
+        if (!st.panel_on) r.renders_while_off++;
+        if (clock_since >= 0 && t - clock_since > r.max_clock_latency_ms) r.max_clock_latency_ms = (uint32_t)(t - clock_since);
+        if (touch_since >= 0 && t - touch_since > r.max_touch_latency_ms) r.max_touch_latency_ms = (uint32_t)(t - touch_since);
+        dirty_us = 0;
+        clock_since = touch_since = -1;
+        last_refr = (int64_t)t;
+        if (g) refresh_gov_on_refresh(g, (int64_t)t * 1000);
+    }
+    return r;
+}
+
+static void test_day_of_usage(void) {
+    refresh_gov_t g;
+    refresh_gov_stats_t st;
+    const int64_t day_us = 24LL * 3600 * 1000000;
+
+    day_result_t fixed = day_run(NULL);
+    day_result_t gov = day_run(&g);
+    refresh_gov_get_stats(&g, day_us, &st);
+
+    uint64_t mode_sum = 0;
+    for (int m = 0; m < REFRESH_GOV_MODE_COUNT; m++) mode_sum += st.mode_us[m];
+    CHECK(mode_sum == st.elapsed_us);
+    CHECK(st.elapsed_us == (uint64_t)day_us);
+    CHECK(st.frames == gov.renders);
+    // Panel off 11 of 24 hours: nothing is drawn or flushed, one full redraw per resume
+    CHECK(gov.renders_while_off == 0);
+    CHECK(fixed.renders_while_off >= 11 * 3600);
+    CHECK(st.mode_us[REFRESH_GOV_SUSPENDED] == 11ULL * 3600 * 1000000);
+    CHECK(st.resumes == 2);
+    // Every frame the fixed refresh drew is either drawn or accounted as skipped
+    CHECK(st.frames + st.skipped >= fixed.renders - fixed.interactive_renders);
+    // Interaction at the fast rate; the clock is not held to the IDLE period (an isolated
+    // redraw goes out at once)
+    CHECK(gov.max_touch_latency_ms <= REFRESH_GOV_ACTIVE_MS);
+    CHECK(fixed.max_touch_latency_ms <= REFRESH_GOV_NORMAL_MS);
+    CHECK(gov.interactive_renders > fixed.interactive_renders * 3 / 2);
+    CHECK(gov.max_clock_latency_ms <= REFRESH_GOV_NORMAL_MS);
+    CHECK(st.mode_us[REFRESH_GOV_IDLE] > st.mode_us[REFRESH_GOV_NORMAL]);
+    // Twice the frame rate while interacting costs more, the rest of the day (video frames
+    // cost the same either way) pays for it
+    uint64_t fixed_rest = fixed.cpu_us - fixed.interactive_cpu_us;
+    uint64_t gov_rest = gov.cpu_us - gov.interactive_cpu_us;
+    CHECK(gov_rest * 4 < fixed_rest * 3);
+    CHECK(gov.cpu_us < fixed.cpu_us);
+
+    printf("refresh governor (day): fixed %u wake-ups %u frames %.1f s CPU; adaptive %u wake-ups %u frames "
+           "%.1f s CPU (-%.0f%%), %u frames skipped\n",
+           (unsigned)fixed.wakeups, (unsigned)fixed.renders, fixed.cpu_us / 1e6,
+           (unsigned)gov.wakeups, (unsigned)gov.renders, gov.cpu_us / 1e6,
+           100.0 - 100.0 * gov.cpu_us / fixed.cpu_us, (unsigned)st.skipped);
+    printf("refresh governor (day): outside interaction %.1f s -> %.1f s (-%.0f%%); interaction %u -> %u frames, "
+           "%.1f s -> %.1f s\n",
+           fixed_rest / 1e6, gov_rest / 1e6, 100.0 - 100.0 * gov_rest / fixed_rest,
+           (unsigned)fixed.interactive_renders, (unsigned)gov.interactive_renders,
+           fixed.interactive_cpu_us / 1e6, gov.interactive_cpu_us / 1e6);
+    printf("refresh governor (day): active %.0f s, normal %.0f s, idle %.0f s, suspended %.0f s; "
+           "touch latency max %u ms (fixed %u ms), clock latency max %u ms\n",
+           st.mode_us[REFRESH_GOV_ACTIVE] / 1e6, st.mode_us[REFRESH_GOV_NORMAL] / 1e6,
+           st.mode_us[REFRESH_GOV_IDLE] / 1e6, st.mode_us[REFRESH_GOV_SUSPENDED] / 1e6,
+           (unsigned)gov.max_touch_latency_ms, (unsigned)fixed.max_touch_latency_ms,
+           (unsigned)gov.max_clock_latency_ms);
+}
+
+static void test_transitions(void) {
+    refresh_gov_t g;
+    refresh_gov_stats_t st;
+    refresh_gov_input_t on = {true, false, false};
+    refresh_gov_input_t touch = {true, true, false};
+    refresh_gov_input_t off = {false, false, false};
+    const int64_t ms = 1000;
+
+    refresh_gov_init(&g, 0);
+    CHECK(refresh_gov_mode(&g) == REFRESH_GOV_NORMAL);
+    CHECK(refresh_gov_update(&g, &on, 10 * ms) == 0);
+    // No busy redraws: IDLE once the initial window has passed
+    CHECK(refresh_gov_update(&g, &on, REFRESH_GOV_IDLE_AFTER_MS * ms) == REFRESH_GOV_ACT_PERIOD);
+    CHECK(refresh_gov_mode(&g) == REFRESH_GOV_IDLE);
+    // Touch: fast period, held after release, then back down
+    CHECK(refresh_gov_update(&g, &touch, 2000 * ms) == REFRESH_GOV_ACT_PERIOD);
+    CHECK(refresh_gov_mode(&g) == REFRESH_GOV_ACTIVE);
+    CHECK(refresh_gov_update(&g, &on, 2100 * ms) == 0);
+    CHECK(refresh_gov_update(&g, &on, (2000 + REFRESH_GOV_ACTIVE_HOLD_MS) * ms) == REFRESH_GOV_ACT_PERIOD);
+    CHECK(refresh_gov_mode(&g) == REFRESH_GOV_IDLE);
+    // A clock tick once a second is not busy content
+    for (int s = 3; s < 6; s++) {
+        refresh_gov_on_request(&g, s * 1000 * ms);
+        refresh_gov_on_refresh(&g, s * 1000 * ms);
+    }
+    CHECK(refresh_gov_update(&g, &on, 6000 * ms) == 0);
+    // Requests every frame held back by the IDLE period: merged, and the content is busy
+    for (int64_t t = 6000; t < 6600; t += 33) {
+        refresh_gov_on_request(&g, t * ms);
+        if ((t - 6000) % 250 < 33) refresh_gov_on_refresh(&g, t * ms);
+    }
+    refresh_gov_get_stats(&g, 6600 * ms, &st);
+    CHECK(st.skipped >= 2 * (REFRESH_GOV_IDLE_MS / REFRESH_GOV_NORMAL_MS - 1));
+    CHECK(refresh_gov_update(&g, &on, 6600 * ms) == REFRESH_GOV_ACT_PERIOD);
+    CHECK(refresh_gov_mode(&g) == REFRESH_GOV_NORMAL);
+    // Panel off: pause, requests only pile up; back on: resume with a full redraw
+    CHECK(refresh_gov_update(&g, &off, 7000 * ms) == REFRESH_GOV_ACT_PAUSE);
+    for (int s = 8; s <= 12; s++) refresh_gov_on_request(&g, s * 1000 * ms);
+    CHECK(refresh_gov_update(&g, &off, 12000 * ms) == 0);
+    uint32_t skipped_before = st.skipped;
+    refresh_gov_get_stats(&g, 12000 * ms, &st);
+    CHECK(st.skipped >= skipped_before + 4);
+    CHECK(refresh_gov_update(&g, &on, 13000 * ms) == (REFRESH_GOV_ACT_PERIOD | REFRESH_GOV_ACT_RESUME));
+    CHECK(refresh_gov_mode(&g) == REFRESH_GOV_NORMAL);
+    refresh_gov_get_stats(&g, 13000 * ms, &st);
+    CHECK(st.resumes == 1);
+    CHECK(st.mode_us[REFRESH_GOV_SUSPENDED] == 6000 * ms);
+}
+
+// --- Video plane ---
+
+#define SCREEN_W    600
+#define SCREEN_H    446
+#define PANEL_UNSET 0xFFFF
+
+static uint16_t s_panel[SCREEN_H][SCREEN_W];
+
+typedef struct {
+    uint32_t windows;
+    uint32_t pixels;
+    uint32_t misaligned;
+    uint32_t bad_order;     // window above the previous one
+    int32_t last_y;
+} panel_log_t;
+
+static uint16_t pixel_at(int32_t x, int32_t y) {
+    return (uint16_t)((x * 7 + y * 613) % 0xFFFF);
+}
+
+static void panel_send(void *ctx, const video_plane_rect_t *win, uint16_t *px) {
+    panel_log_t *log = (panel_log_t *)ctx;
+    int32_t w = win->x2 - win->x1 + 1, h = win->y2 - win->y1 + 1;
+    if ((win->x1 | win->y1 | w | h) & 1) log->misaligned++;
+    if (win->y1 < log->last_y) log->bad_order++;
+    log->last_y = win->y1;
+    for (int32_t y = 0; y < h; y++) {
+        for (int32_t x = 0; x < w; x++) s_panel[win->y1 + y][win->x1 + x] = px[y * w + x];
+    }
+    log->windows++;
+    log->pixels += (uint32_t)(w * h);
+}
+
+// Flush `area` with the plane reserved; every pixel outside the plane arrives, none inside
+static panel_log_t plane_flush_check(const video_plane_rect_t *area, const video_plane_rect_t *plane) {
+    static uint16_t buf[SCREEN_W * SCREEN_H];
+    int32_t aw = area->x2 - area->x1 + 1;
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        for (int32_t x = area->x1; x <= area->x2; x++) buf[(y - area->y1) * aw + x - area->x1] = pixel_at(x, y);
+    }
+    memset(s_panel, 0xFF, sizeof(s_panel));
+    panel_log_t log = {0};
+    CHECK(video_plane_flush(area, buf, plane, panel_send, &log) == log.windows);
+    uint32_t wrong = 0;
+    for (int32_t y = 0; y < SCREEN_H; y++) {
+        for (int32_t x = 0; x < SCREEN_W; x++) {
+            bool in_area = x >= area->x1 && x <= area->x2 && y >= area->y1 && y <= area->y2;
+            bool in_plane = x >= plane->x1 && x <= plane->x2 && y >= plane->y1 && y <= plane->y2;
+            uint16_t want = in_area && !in_plane ? pixel_at(x, y) : PANEL_UNSET;
+            if (s_panel[y][x] != want) wrong++;
+        }
+    }
+    CHECK(wrong == 0);
+    CHECK(log.misaligned == 0 && log.bad_order == 0);
+    return log;
+}
+
+static void test_video_plane(void) {
+    // The play view's 300x300 video, and a full-width strip
+    video_plane_rect_t plane = {30, 50, 329, 349};
+    video_plane_rect_t strip = {0, 100, SCREEN_W - 1, 299};
+    CHECK(video_plane_valid(&plane, SCREEN_W, SCREEN_H));
+    CHECK(video_plane_valid(&strip, SCREEN_W, SCREEN_H));
+    video_plane_rect_t odd = {31, 50, 330, 349}, narrow = {400, 50, 499, 149}, off = {400, 300, 699, 599};
+    CHECK(!video_plane_valid(&odd, SCREEN_W, SCREEN_H));
+    CHECK(!video_plane_valid(&narrow, SCREEN_W, SCREEN_H));  // 100 wide, 400 to its left
+    CHECK(!video_plane_valid(&off, SCREEN_W, SCREEN_H));
+
+    // Clear of the plane: one window, as without it
+    video_plane_rect_t label = {400, 60, 589, 89};
+    panel_log_t log = plane_flush_check(&label, &plane);
+    CHECK(log.windows == 1);
+    // Inside it: nothing
+    video_plane_rect_t inside = {100, 100, 199, 199};
+    CHECK(plane_flush_check(&inside, &plane).windows == 0);
+    // The whole screen: above, one column either side, below
+    video_plane_rect_t full = {0, 0, SCREEN_W - 1, SCREEN_H - 1};
+    log = plane_flush_check(&full, &plane);
+    CHECK(log.windows == 4 && log.pixels == SCREEN_W * SCREEN_H - 300 * 300);
+    CHECK(plane_flush_check(&full, &strip).windows == 2);
+    // Overlapping one side only, in both directions
+    video_plane_rect_t left = {0, 40, 39, 99}, right = {320, 300, 599, 445};
+    CHECK(plane_flush_check(&left, &plane).windows == 1 + 1);
+    CHECK(plane_flush_check(&right, &plane).windows == 1 + 1);
+
+    // Areas as the rounder leaves them, against planes at either edge and in the middle
+    const video_plane_rect_t planes[] = {plane, strip, {0, 0, 299, 445}, {300, 146, 599, 445}, {150, 72, 449, 371}};
+    srand(44);
+    uint32_t windows = 0, areas = 0;
+    for (size_t p = 0; p < sizeof(planes) / sizeof(planes[0]); p++) {
+        CHECK(video_plane_valid(&planes[p], SCREEN_W, SCREEN_H));
+        for (int i = 0; i < 300; i++) {
+            video_plane_rect_t a;
+            a.x1 = (rand() % (SCREEN_W / 2)) * 2;
+            a.y1 = (rand() % (SCREEN_H / 2)) * 2;
+            a.x2 = a.x1 + (rand() % ((SCREEN_W - a.x1) / 2)) * 2 + 1;
+            a.y2 = a.y1 + (rand() % ((SCREEN_H - a.y1) / 2)) * 2 + 1;
+            uint32_t n = plane_flush_check(&a, &planes[p]).windows;
+            CHECK(n <= 4);
+            windows += n;
+            areas++;
+        }
+    }
+    printf("video plane: %u random flushes clipped into %u windows, all pixels outside the plane sent, none inside\n",
+           (unsigned)areas, (unsigned)windows);
+}
+
+int main(void) {
+    test_transitions();
+    test_day_of_usage();
+    test_video_plane();
+
+    if (s_failures) {
+        printf("%d check(s) failed\n", s_failures);
+        return 1;
+    }
+    printf("t4s3_bsp host tests passed\n");
+    return 0;
+}
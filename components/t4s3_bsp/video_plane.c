@@ -0,0 +1,70 @@
+#include "video_plane.h"
+#include <string.h>
+
+bool video_plane_valid(const video_plane_rect_t *plane, int32_t screen_w, int32_t screen_h) {
+    if (plane->x1 < 0 || plane->y1 < 0 || plane->x2 >= screen_w || plane->y2 >= screen_h) return false;
+    if (plane->x2 < plane->x1 || plane->y2 < plane->y1) return false;
+    int32_t w = plane->x2 - plane->x1 + 1;
+    int32_t h = plane->y2 - plane->y1 + 1;
+    if ((plane->x1 | plane->y1 | w | h) & 1) return false;
+    return w >= plane->x1 && w >= screen_w - 1 - plane->x2;
+}
+
+uint32_t video_plane_flush(const video_plane_rect_t *area, uint16_t *px, const video_plane_rect_t *plane,
+                           video_plane_send_fn send, void *ctx) {
+    if (plane->x1 > area->x2 || plane->x2 < area->x1 || plane->y1 > area->y2 || plane->y2 < area->y1) {
+        send(ctx, area, px);
+        return 1;
+    }
+
+    uint32_t sent = 0;
+    int32_t aw = area->x2 - area->x1 + 1;
+    video_plane_rect_t win;
+    if (area->y1 < plane->y1) {
+        win = (video_plane_rect_t){area->x1, area->y1, area->x2, plane->y1 - 1};
+        send(ctx, &win, px);
+        sent++;
+    }
+
+    int32_t by1 = area->y1 > plane->y1 ? area->y1 : plane->y1;
+    int32_t by2 = area->y2 < plane->y2 ? area->y2 : plane->y2;
+    int32_t lw = plane->x1 > area->x1 ? plane->x1 - area->x1 : 0;
+    int32_t rw = area->x2 > plane->x2 ? area->x2 - plane->x2 : 0;
+    if (by1 <= by2 && (lw || rw)) {
+        size_t n = (size_t)(by2 - by1 + 1);
+        uint16_t *band = px + (size_t)(by1 - area->y1) * aw;
+        // Each row's left and right parts moved up to follow the rows before, over the
+        // plane's pixels: one side alone is then packed
+        for (size_t k = 0; k < n; k++) {
+            uint16_t *row = band + k * aw;
+            uint16_t *out = band + k * (size_t)(lw + rw);
+            memmove(out, row, (size_t)lw * 2);
+            memmove(out + lw, row + aw - rw, (size_t)rw * 2);
+        }
+        uint16_t *left = band, *right = band;
+        if (lw && rw) {
+            // Both: the right parts go to the free space after them (the plane is at least
+            // as wide as either side), then the left parts close up
+            right = band + n * (size_t)(lw + rw);
+            for (size_t k = 0; k < n; k++) memcpy(right + k * rw, band + k * (size_t)(lw + rw) + lw, (size_t)rw * 2);
+            for (size_t k = 1; k < n; k++) memmove(band + k * lw, band + k * (size_t)(lw + rw), (size_t)lw * 2);
+        }
+        if (lw) {
+            win = (video_plane_rect_t){area->x1, by1, plane->x1 - 1, by2};
+            send(ctx, &win, left);
+            sent++;
+        }
+        if (rw) {
+            win = (video_plane_rect_t){plane->x2 + 1, by1, area->x2, by2};
+            send(ctx, &win, right);
+            sent++;
+        }
+    }
+
+    if (area->y2 > plane->y2) {
+        win = (video_plane_rect_t){area->x1, plane->y2 + 1, area->x2, area->y2};
+        send(ctx, &win, px + (size_t)(plane->y2 + 1 - area->y1) * aw);
+        sent++;
+    }
+    return sent;
+}
@@ -0,0 +1,49 @@
+#ifndef VIDEO_PLANE_H
+#define VIDEO_PLANE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A screen rectangle that video writes straight to the panel, bypassing LVGL. LVGL keeps
+// drawing the rest of the screen; when one of its flushes overlaps the plane, only what lies
+// outside it is sent:
+//   - rows above and below the plane as one window each
+//   - the columns beside it as one window each side, packed in place in the flushed buffer
+//     (the plane's own pixels there are never sent, so their space is free)
+// so an overlapping flush takes at most four windows. The RM690B0 takes windows with even
+// start and even size in both directions; the LVGL rounder and an even plane keep them
+// that way. No LVGL or IDF dependencies so it can be checked on the host.
+
+typedef struct {
+    int32_t x1, y1, x2, y2;     // inclusive, as lv_area_t
+} video_plane_rect_t;
+
+/**
+ * @brief One window to send; `px` points at its pixels, rows packed
+ */
+typedef void (*video_plane_send_fn)(void *ctx, const video_plane_rect_t *win, uint16_t *px);
+
+/**
+ * @brief Whether `plane` can be used on a `screen_w` x `screen_h` display: on screen, even
+ * start and size, and at least as wide as the screen on either side of it (the in-place
+ * packing needs that room)
+ */
+bool video_plane_valid(const video_plane_rect_t *plane, int32_t screen_w, int32_t screen_h);
+
+/**
+ * @brief Send the part of a flushed area outside `plane`, in order from the top
+ * @param px The area's pixels, rows of its width; the rows beside the plane are rearranged
+ * @return Windows sent (0 when the area lies inside the plane)
+ */
+uint32_t video_plane_flush(const video_plane_rect_t *area, uint16_t *px, const video_plane_rect_t *plane,
+                           video_plane_send_fn send, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VIDEO_PLANE_H
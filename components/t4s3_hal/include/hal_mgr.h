@@ -5,6 +5,10 @@
 #include "esp_err.h"
 #include "cst226se.h"
 #include "rm690b0.h"
+#include "touch_filter.h"
+#include "i2c_sched.h"
+#include "pmic_telem.h"
+#include "power_gov.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -14,6 +18,7 @@ typedef void (*hal_mgr_usb_event_cb_t)(bool plugged, void *user_ctx);
 typedef void (*hal_mgr_charge_event_cb_t)(bool charging, void *user_ctx);
 typedef void (*hal_mgr_battery_event_cb_t)(bool present, void *user_ctx);
 typedef void (*hal_mgr_rotation_cb_t)(rm690b0_rotation_t rot, void *user_ctx);
+typedef void (*hal_mgr_touch_ready_cb_t)(void *user_ctx);
 
 esp_err_t hal_mgr_init(void);
 void hal_mgr_set_rotation(rm690b0_rotation_t rot);
@@ -26,6 +31,12 @@ void hal_mgr_register_rotation_callback(hal_mgr_rotation_cb_t cb, void *user_ctx
 
 // User test hooks for display/touch
 void hal_mgr_register_touch_callback(cst226se_event_callback_t cb, void *user_ctx);
+
+/**
+ * @brief Register a notifier called from the touch task whenever a new touch sample
+ * (press, move or release) is available. Used by the BSP to drive LVGL input in event mode.
+ */
+void hal_mgr_register_touch_ready_callback(hal_mgr_touch_ready_cb_t cb, void *user_ctx);
 void hal_mgr_register_display_vsync_callback(rm690b0_vsync_cb_t cb, void *user_ctx);
 void hal_mgr_register_display_power_callback(rm690b0_power_cb_t cb, void *user_ctx);
 void hal_mgr_register_display_error_callback(rm690b0_error_cb_t cb, void *user_ctx);
@@ -57,10 +68,82 @@ bool hal_mgr_display_is_busy(void);
 /**
  * @brief Read the latest touch state.
  * This is the primary function used by LVGL's read_cb.
+ * The position is in display coordinates for the current rotation, smoothed and
+ * predicted ahead by the touch filter.
  * @return true if pressed, false otherwise
  */
 bool hal_mgr_touch_read(int16_t *x, int16_t *y);
 
+/**
+ * @brief Copy every tracked point of the latest touch sample (ID, state, position).
+ * Coordinates are in display space for the current rotation but unfiltered, so
+ * multi-finger gestures see consistent geometry.
+ * @return Number of points copied (0 when released)
+ */
+uint8_t hal_mgr_touch_read_points(cst226se_point_t *points, uint8_t max);
+
+/**
+ * @brief Timestamp (esp_timer_get_time, us) at which the latest touch sample was taken.
+ * Used to measure touch-to-LVGL latency.
+ */
+int64_t hal_mgr_touch_get_sample_time(void);
+
+/**
+ * @brief Replace the touch transform and filter/prediction settings for one rotation.
+ * Takes effect on the next touch sample if that rotation is active.
+ */
+void hal_mgr_touch_set_filter_config(rm690b0_rotation_t rot, const touch_filter_config_t *cfg);
+void hal_mgr_touch_get_filter_config(rm690b0_rotation_t rot, touch_filter_config_t *cfg);
+
+/**
+ * @brief Set the measured sample-to-display latency the touch prediction should hide.
+ */
+void hal_mgr_touch_set_latency(uint32_t latency_us);
+
+/**
+ * @brief Group several SY6970 register accesses into one scheduled burst on the shared
+ * I2C bus. Touch reads still pre-empt the burst between transfers, and while a finger
+ * is down the burst is held to the gaps between touch samples. Calls may nest.
+ */
+void hal_mgr_pmic_burst_begin(void);
+void hal_mgr_pmic_burst_end(void);
+
+/**
+ * @brief Per-device wait times and bus utilization since the HAL started.
+ */
+void hal_mgr_i2c_get_stats(i2c_sched_stats_t *stats);
+
+/**
+ * @brief Min/max/mean of a PMIC channel over the last `window_s` seconds
+ * @param res Bucket resolution to answer from (coarser = longer history)
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if no sample falls in the window,
+ *         ESP_ERR_INVALID_STATE if the history could not be allocated
+ */
+esp_err_t hal_mgr_telemetry_query(pmic_telem_res_t res, pmic_telem_ch_t ch, uint32_t window_s,
+                                  pmic_telem_stats_t *out);
+
+/**
+ * @brief Closed buckets newer than `*cursor`, oldest first, for incremental charts
+ * @param cursor Bucket index last read; start at -1. Advanced to the newest bucket returned.
+ * @param max Returns at most the `max` newest buckets; empty buckets have count == 0
+ * @return Number of entries written to `out`
+ */
+size_t hal_mgr_telemetry_read(pmic_telem_res_t res, pmic_telem_ch_t ch, int64_t *cursor,
+                              pmic_telem_stats_t *out, size_t max);
+
+/**
+ * @brief Mark CPU-heavy work (render, flush, decode) so the CPU runs at full clock for it.
+ * Calls nest; every begin needs a matching end. Outside such work the CPU idles at the
+ * power profile's minimum clock and, on battery, may light-sleep.
+ */
+void hal_mgr_power_begin(power_gov_work_t work);
+void hal_mgr_power_end(power_gov_work_t work);
+
+/**
+ * @brief Time spent boosted / idle / with light sleep enabled, lock counts and duty cycle
+ */
+void hal_mgr_power_get_stats(power_gov_stats_t *stats);
+
 /**
  * @brief Show rainbow test pattern for 1 second
  */
@@ -0,0 +1,107 @@
+#ifndef I2C_SCHED_H
+#define I2C_SCHED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Arbitration policy for the I2C bus shared by the CST226SE and the SY6970.
+//   - touch is always granted first; a PMIC burst yields between transactions when touch waits
+//   - while a finger is down, PMIC work only runs in the gap right after a touch read,
+//     so it never lands on top of the next sample
+//   - a deferred PMIC burst is still granted after max_defer_us (no starvation)
+// Times are passed in by the caller; no IDF dependencies so the policy can be
+// exercised on the host against a simulated bus.
+
+typedef enum {
+    I2C_SCHED_DEV_TOUCH = 0,
+    I2C_SCHED_DEV_PMIC,
+    I2C_SCHED_DEV_COUNT
+} i2c_sched_dev_t;
+
+#define I2C_SCHED_NONE (-1)
+
+typedef struct {
+    uint32_t window_us;     // PMIC slot opened by the end of a touch read while a finger is down
+    uint32_t max_defer_us;  // longest a PMIC request is held back for touch
+} i2c_sched_config_t;
+
+typedef struct {
+    uint32_t grants;
+    uint32_t deferrals;     // requests held back by the touch policy
+    uint32_t yields;        // bursts that handed the bus to touch mid-way
+    uint64_t wait_sum_us;   // request -> grant
+    uint32_t wait_max_us;
+    uint64_t busy_us;       // time the device owned the bus
+} i2c_sched_dev_stats_t;
+
+typedef struct {
+    i2c_sched_dev_stats_t dev[I2C_SCHED_DEV_COUNT];
+    uint64_t elapsed_us;    // since init
+    uint32_t util_permille; // busy share of elapsed time
+} i2c_sched_stats_t;
+
+typedef struct {
+    i2c_sched_config_t cfg;
+    int owner;                              // device holding the bus, or I2C_SCHED_NONE
+    int64_t owner_since;
+    bool forced;                            // PMIC granted by max_defer_us: only yields to a waiting touch
+    bool force_pending;                     // a forced burst yielded to touch and resumes without a new defer
+    bool waiting[I2C_SCHED_DEV_COUNT];
+    bool deferred[I2C_SCHED_DEV_COUNT];     // current wait already counted as a deferral
+    int64_t wait_since[I2C_SCHED_DEV_COUNT];
+    bool touch_active;                      // finger down: touch is sampled periodically
+    int64_t touch_done_us;                  // end of the last touch transaction
+    int64_t start_us;
+    i2c_sched_dev_stats_t stats[I2C_SCHED_DEV_COUNT];
+} i2c_sched_t;
+
+void i2c_sched_config_default(i2c_sched_config_t *cfg);
+void i2c_sched_init(i2c_sched_t *s, const i2c_sched_config_t *cfg, int64_t now_us);
+
+/**
+ * @brief Ask for the bus. Repeat calls while waiting are fine (e.g. after a timeout).
+ * @return true if `dev` now owns the bus
+ */
+bool i2c_sched_request(i2c_sched_t *s, i2c_sched_dev_t dev, int64_t now_us);
+
+/**
+ * @brief Give the bus back and hand it to the best eligible waiter.
+ * @return The device that was granted the bus (wake it), or I2C_SCHED_NONE
+ */
+int i2c_sched_release(i2c_sched_t *s, i2c_sched_dev_t dev, int64_t now_us);
+
+/**
+ * @brief True when the owner of a burst should hand the bus back between transactions
+ * (touch is waiting, or the post-touch slot has closed while a finger is down).
+ */
+bool i2c_sched_should_yield(const i2c_sched_t *s, i2c_sched_dev_t dev, int64_t now_us);
+
+/**
+ * @brief Release mid-burst and queue `dev` again.
+ * @return The device that was granted the bus (wake it), or I2C_SCHED_NONE
+ */
+int i2c_sched_yield(i2c_sched_t *s, i2c_sched_dev_t dev, int64_t now_us);
+
+/**
+ * @brief Finger down/up. Lifting the finger may release a deferred PMIC request.
+ * @return The device that was granted the bus (wake it), or I2C_SCHED_NONE
+ */
+int i2c_sched_set_touch_active(i2c_sched_t *s, bool active, int64_t now_us);
+
+/**
+ * @brief Microseconds after which a waiting device should call i2c_sched_request() again,
+ * or -1 if it will be granted by a release (no timeout needed).
+ */
+int64_t i2c_sched_wait_hint_us(const i2c_sched_t *s, i2c_sched_dev_t dev, int64_t now_us);
+
+void i2c_sched_get_stats(const i2c_sched_t *s, int64_t now_us, i2c_sched_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // I2C_SCHED_H
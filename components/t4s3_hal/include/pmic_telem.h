@@ -0,0 +1,131 @@
+#ifndef PMIC_TELEM_H
+#define PMIC_TELEM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// PMIC telemetry history: battery voltage, VBUS voltage and charge current kept at three
+// resolutions, each in its own ring of buckets (min / max / sum / count per channel).
+//   - mean over any window: running sums, one subtraction
+//   - min/max over any window: per-ring sparse table updated on append (O(log n)), queried
+//     as two overlapping power-of-two ranges (O(1))
+// Buckets nobody sampled stay empty and are skipped by queries.
+// The caller provides the memory (PSRAM on target); no IDF dependencies so it can be
+// benchmarked on the host.
+//
+// Closed 1 min buckets can be delta-encoded into a compact record stream for the SD card.
+
+typedef enum {
+    PMIC_TELEM_VBAT = 0,    // mV
+    PMIC_TELEM_VBUS,        // mV (0 = no VBUS)
+    PMIC_TELEM_ICHG,        // mA
+    PMIC_TELEM_CH_COUNT
+} pmic_telem_ch_t;
+
+typedef enum {
+    PMIC_TELEM_RES_1S = 0,
+    PMIC_TELEM_RES_1MIN,
+    PMIC_TELEM_RES_15MIN,
+    PMIC_TELEM_RES_COUNT
+} pmic_telem_res_t;
+
+// Retention per resolution
+#ifndef PMIC_TELEM_1S_BUCKETS
+#define PMIC_TELEM_1S_BUCKETS       1800    // 30 minutes
+#endif
+#ifndef PMIC_TELEM_1MIN_BUCKETS
+#define PMIC_TELEM_1MIN_BUCKETS     1440    // 1 day
+#endif
+#ifndef PMIC_TELEM_15MIN_BUCKETS
+#define PMIC_TELEM_15MIN_BUCKETS    672     // 1 week
+#endif
+
+typedef struct {
+    int16_t min;
+    int16_t max;
+    int32_t mean;
+    uint32_t count;         // samples in the window (0 = no data, other fields undefined)
+} pmic_telem_stats_t;
+
+typedef struct {
+    uint32_t period_s;
+    uint32_t capacity;      // buckets retained
+    uint8_t levels;         // sparse table levels (floor(log2(capacity)) + 1)
+    int16_t *minmax;        // [levels][capacity][channel][min, max]
+    int64_t *psum;          // [capacity + 1][channel] running sum at the end of each bucket
+    uint32_t *pcount;       // [capacity + 1] running sample count
+    int64_t closed;         // absolute index of the newest closed bucket, -1 if none
+    int64_t first;          // absolute index of the first bucket ever closed
+    // Open bucket
+    int64_t open_idx;       // absolute index (time / period), -1 before the first sample
+    int16_t open_min[PMIC_TELEM_CH_COUNT];
+    int16_t open_max[PMIC_TELEM_CH_COUNT];
+    int64_t open_sum[PMIC_TELEM_CH_COUNT];
+    uint32_t open_count;
+    int64_t total_sum[PMIC_TELEM_CH_COUNT];     // over every closed bucket
+    uint32_t total_count;
+} pmic_telem_ring_t;
+
+typedef struct {
+    pmic_telem_ring_t ring[PMIC_TELEM_RES_COUNT];
+} pmic_telem_t;
+
+// Bytes of memory pmic_telem_init() needs
+size_t pmic_telem_mem_size(void);
+bool pmic_telem_init(pmic_telem_t *t, void *mem, size_t size);
+
+// Add one sample; `t_s` must not go backwards
+void pmic_telem_append(pmic_telem_t *t, uint32_t t_s, const int16_t v[PMIC_TELEM_CH_COUNT]);
+
+/**
+ * @brief Min/max/mean of `ch` over buckets covering [from_s, to_s] at resolution `res`,
+ * including the open bucket. Windows reaching past the retained history are clipped.
+ * @return false if no sample falls in the window
+ */
+bool pmic_telem_query(const pmic_telem_t *t, pmic_telem_res_t res, pmic_telem_ch_t ch,
+                      uint32_t from_s, uint32_t to_s, pmic_telem_stats_t *out);
+
+// Absolute index (time / period) of the newest closed bucket, -1 if none
+int64_t pmic_telem_newest(const pmic_telem_t *t, pmic_telem_res_t res);
+uint32_t pmic_telem_period_s(pmic_telem_res_t res);
+
+// One closed bucket; false if it is no longer retained. count == 0 for an empty bucket.
+bool pmic_telem_bucket(const pmic_telem_t *t, pmic_telem_res_t res, pmic_telem_ch_t ch, int64_t idx,
+                       pmic_telem_stats_t *out);
+
+// --- On-disk record stream ---
+// A stream starts with an 8-byte header ("PMT1", u32 LE wall-clock time of t = 0, 0 if
+// unknown) followed by one record per non-empty 1 min bucket:
+//   varint  buckets since the previous record (1 for back-to-back minutes)
+//   per channel: zigzag varint (mean - previous mean), varint (mean - min), varint (max - mean)
+// A steady minute costs 10 bytes.
+#define PMIC_TELEM_HDR_SIZE     8
+#define PMIC_TELEM_REC_MAX      (5 + PMIC_TELEM_CH_COUNT * 9)
+
+typedef struct {
+    int64_t last_idx;       // bucket index of the previous record
+    int32_t last_mean[PMIC_TELEM_CH_COUNT];
+} pmic_telem_codec_t;
+
+typedef struct {
+    int64_t idx;            // 1 min bucket index
+    pmic_telem_stats_t ch[PMIC_TELEM_CH_COUNT];
+} pmic_telem_record_t;
+
+size_t pmic_telem_write_header(uint8_t *buf, uint32_t epoch_s);
+bool pmic_telem_read_header(const uint8_t *buf, size_t len, uint32_t *epoch_s);
+void pmic_telem_codec_init(pmic_telem_codec_t *c, int64_t start_idx);
+size_t pmic_telem_encode(pmic_telem_codec_t *c, const pmic_telem_record_t *rec, uint8_t *buf);
+// Returns bytes consumed, 0 on a truncated or malformed record
+size_t pmic_telem_decode(pmic_telem_codec_t *c, const uint8_t *buf, size_t len, pmic_telem_record_t *rec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PMIC_TELEM_H
@@ -0,0 +1,122 @@
+#ifndef POWER_GOV_H
+#define POWER_GOV_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// System power policy: the CPU runs at the profile's minimum clock (or light-sleeps) unless
+// rendering, flushing or decoding is in progress, which holds a max-frequency lock.
+//   - the lock is kept for linger_us after the last work ends, so back-to-back frames
+//     share one acquisition instead of switching clocks every few milliseconds
+//   - USB and battery power use separate profiles; on USB light sleep stays off so the
+//     USB-Serial-JTAG console keeps working
+// The caller turns the returned POWER_GOV_ACT_* flags into esp_pm calls. Times are passed
+// in; no IDF dependencies so the policy can be exercised on the host.
+
+typedef enum {
+    POWER_GOV_SRC_BATTERY = 0,
+    POWER_GOV_SRC_USB,
+    POWER_GOV_SRC_COUNT
+} power_gov_src_t;
+
+typedef enum {
+    POWER_GOV_WORK_RENDER = 0,  // LVGL drawing
+    POWER_GOV_WORK_FLUSH,       // pixels on their way to the panel
+    POWER_GOV_WORK_DECODE,      // JPEG / video frames
+    POWER_GOV_WORK_COUNT
+} power_gov_work_t;
+
+typedef enum {
+    POWER_GOV_STATE_BOOST = 0,  // max-frequency lock held
+    POWER_GOV_STATE_IDLE,       // minimum clock, light sleep not allowed
+    POWER_GOV_STATE_SLEEP,      // minimum clock, automatic light sleep allowed
+    POWER_GOV_STATE_COUNT
+} power_gov_state_t;
+
+// Actions for the caller
+#define POWER_GOV_ACT_LOCK      (1u << 0)   // acquire the max-frequency lock
+#define POWER_GOV_ACT_UNLOCK    (1u << 1)   // release it
+#define POWER_GOV_ACT_CONFIGURE (1u << 2)   // profile changed: reapply clocks / light sleep
+
+// Default profiles. Battery trades some render speed for a lower peak current; its linger
+// just covers the gap between 30 fps frames. USB renders at full clock and lingers longer.
+#ifndef POWER_GOV_BATT_MAX_MHZ
+#define POWER_GOV_BATT_MAX_MHZ      160
+#endif
+#ifndef POWER_GOV_BATT_MIN_MHZ
+#define POWER_GOV_BATT_MIN_MHZ      40
+#endif
+#ifndef POWER_GOV_BATT_LINGER_MS
+#define POWER_GOV_BATT_LINGER_MS    40
+#endif
+#ifndef POWER_GOV_USB_MAX_MHZ
+#define POWER_GOV_USB_MAX_MHZ       240
+#endif
+#ifndef POWER_GOV_USB_MIN_MHZ
+#define POWER_GOV_USB_MIN_MHZ       80
+#endif
+#ifndef POWER_GOV_USB_LINGER_MS
+#define POWER_GOV_USB_LINGER_MS     200
+#endif
+
+typedef struct {
+    uint16_t max_mhz;       // while work is running
+    uint16_t min_mhz;       // otherwise
+    bool light_sleep;       // automatic light sleep when idle
+    uint32_t linger_us;     // keep the lock this long after the last work ends
+} power_gov_profile_t;
+
+typedef struct {
+    uint64_t state_us[POWER_GOV_STATE_COUNT];
+    uint64_t src_us[POWER_GOV_SRC_COUNT];
+    uint64_t work_us[POWER_GOV_WORK_COUNT];     // time each kind of work was in progress
+    uint32_t locks;             // lock acquisitions
+    uint32_t coalesced;         // work that started while the lock was still lingering
+    uint32_t profile_changes;
+    uint64_t elapsed_us;        // since init
+    uint32_t duty_permille;     // boost share of elapsed time
+} power_gov_stats_t;
+
+typedef struct {
+    power_gov_profile_t profile[POWER_GOV_SRC_COUNT];
+    power_gov_src_t src;
+    uint16_t active[POWER_GOV_WORK_COUNT];      // nesting per kind of work
+    int64_t work_since[POWER_GOV_WORK_COUNT];
+    bool locked;
+    int64_t idle_since_us;      // last work ended (linger start)
+    power_gov_state_t state;
+    int64_t state_since_us;
+    int64_t src_since_us;
+    int64_t start_us;
+    power_gov_stats_t stats;
+} power_gov_t;
+
+void power_gov_profile_default(power_gov_src_t src, power_gov_profile_t *p);
+void power_gov_init(power_gov_t *g, power_gov_src_t src, int64_t now_us);
+
+// Switch profile; POWER_GOV_ACT_CONFIGURE when it changed
+uint32_t power_gov_set_source(power_gov_t *g, power_gov_src_t src, int64_t now_us);
+
+// Work starts / ends (nestable per kind)
+uint32_t power_gov_begin(power_gov_t *g, power_gov_work_t work, int64_t now_us);
+uint32_t power_gov_end(power_gov_t *g, power_gov_work_t work, int64_t now_us);
+
+/**
+ * @brief Ends a linger that has expired. `*wait_us` is how long until the next call is
+ * due (UINT32_MAX when nothing is pending).
+ */
+uint32_t power_gov_poll(power_gov_t *g, int64_t now_us, uint32_t *wait_us);
+
+const power_gov_profile_t *power_gov_profile(const power_gov_t *g);
+void power_gov_get_stats(const power_gov_t *g, int64_t now_us, power_gov_stats_t *out);
+const char *power_gov_state_name(power_gov_state_t state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POWER_GOV_H
@@ -0,0 +1,80 @@
+#ifndef TOUCH_FILTER_H
+#define TOUCH_FILTER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Touch filter pipeline: raw controller coordinates -> display coordinates.
+//   1. one fixed-point affine transform per rotation (swap/mirror/offset in a single step)
+//   2. jitter filter (deadband, then 1-euro: heavy smoothing at rest, little lag while moving)
+//   3. short-horizon prediction over the measured sample-to-photon latency
+// No IDF dependencies so it can be validated on the host against recorded traces.
+
+// Native CST226SE sensor space (portrait)
+#define TOUCH_NATIVE_W 450
+#define TOUCH_NATIVE_H 600
+
+#define TOUCH_XFORM_ONE (1 << 16)
+
+/**
+ * @brief out = M * raw + offset, Q16.16. width/height clamp the result to the display.
+ */
+typedef struct {
+    int32_t xx, xy;
+    int32_t yx, yy;
+    int32_t ox, oy;
+    uint16_t width;
+    uint16_t height;
+} touch_xform_t;
+
+typedef struct {
+    touch_xform_t xform;
+    uint8_t jitter_px;          // deadband at rest: moves within this many px of the last accepted sample are noise
+    float min_cutoff_hz;        // smoothing when the finger rests (lower = steadier)
+    float beta;                 // cutoff increase per px/s of speed (higher = less lag)
+    float d_cutoff_hz;          // smoothing of the velocity estimate
+    float predict_gain;         // fraction of the measured latency to extrapolate (0 = off)
+    float predict_min_speed;    // px/s below which no prediction is applied
+    uint16_t predict_max_px;    // cap on the extrapolated distance
+} touch_filter_config_t;
+
+typedef struct {
+    touch_filter_config_t cfg;
+    uint32_t latency_us;        // measured sample-to-photon latency
+    bool active;
+    int64_t last_us;
+    int16_t anchor_x, anchor_y; // last sample that left the deadband
+    float x, y;                 // filtered position
+    float vx, vy;               // filtered velocity, px/s
+} touch_filter_t;
+
+/**
+ * @brief Default transform for a display rotation (0..3, same numbering as rm690b0).
+ */
+void touch_xform_default(int rotation, touch_xform_t *xform);
+void touch_xform_apply(const touch_xform_t *xform, uint16_t x, uint16_t y, int16_t *out_x, int16_t *out_y);
+
+/**
+ * @brief Default filter and prediction settings for a rotation, including its transform.
+ */
+void touch_filter_config_default(int rotation, touch_filter_config_t *cfg);
+
+void touch_filter_init(touch_filter_t *f, const touch_filter_config_t *cfg);
+void touch_filter_reset(touch_filter_t *f);
+void touch_filter_set_latency(touch_filter_t *f, uint32_t latency_us);
+
+/**
+ * @brief Filter one pressed sample that is already in display coordinates.
+ * Call touch_filter_reset() on release so the next press starts unfiltered.
+ */
+void touch_filter_update(touch_filter_t *f, int64_t t_us, int16_t x, int16_t y, int16_t *out_x, int16_t *out_y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TOUCH_FILTER_H
@@ -3,27 +3,169 @@
 #include "rm690b0.h"
 #include "sd_card.h"
 #include "hal_mgr.h"
+#include "touch_filter.h"
+#include "i2c_sched.h"
+#include "power_gov.h"
 #include "wifi_mgr.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_pm.h"
+#include "esp_sleep.h"
 #include "driver/gpio.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "iot_button.h"
 #include "button_gpio.h"
 #include "nvs_flash.h"
 #include "nvs.h"
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 static const char *TAG = "hal_mgr";
 
+// While a finger is down the controller is polled at this period so moves and the
+// release are tracked even when no further IRQ edge arrives.
+#define HAL_TOUCH_POLL_MS 10
+
 // --- Internal State ---
 static cst226se_data_t s_latest_touch = {0};
+static portMUX_TYPE s_touch_lock = portMUX_INITIALIZER_UNLOCKED;  // Guards multi-point copies of s_latest_touch
+static int64_t s_latest_touch_us = 0;   // When the sample in s_latest_touch was taken
+static int64_t s_sample_start_us = 0;
+
+// Touch filter pipeline (transform, jitter filter, prediction). Only the touch task
+// runs the filter; settings changed from other tasks are picked up on the next sample.
+static touch_filter_config_t s_filter_cfg[4];
+static touch_filter_t s_touch_filter;
+static volatile bool s_filter_dirty = true;
+static volatile uint32_t s_touch_latency_us = 30000;
+
+// --- Shared I2C bus scheduling ---
+// CST226SE and SY6970 share the bus created by sy6970_init(). Both drivers call a hook
+// around their transfers; the policy in i2c_sched.c decides who goes next. Callers of the
+// same device are serialized by a recursive mutex so a PMIC burst nests its register reads.
+#define HAL_I2C_RETRY_MS 50     // upper bound on a wait, in case a wake-up is missed
+
+static i2c_sched_t s_i2c;
+static portMUX_TYPE s_i2c_lock = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t s_i2c_grant[I2C_SCHED_DEV_COUNT];     // given when a waiter is handed the bus
+static SemaphoreHandle_t s_i2c_dev_mutex[I2C_SCHED_DEV_COUNT];
+static uint8_t s_i2c_depth[I2C_SCHED_DEV_COUNT];               // nesting of the current holder
+static bool s_i2c_ready = false;
+
+static void hal_i2c_wake(int dev) {
+	if (dev != I2C_SCHED_NONE) xSemaphoreGive(s_i2c_grant[dev]);
+}
+
+static void hal_i2c_wait_grant(i2c_sched_dev_t dev, bool granted) {
+	while (!granted) {
+		taskENTER_CRITICAL(&s_i2c_lock);
+		int64_t hint_us = i2c_sched_wait_hint_us(&s_i2c, dev, esp_timer_get_time());
+		taskEXIT_CRITICAL(&s_i2c_lock);
+		uint32_t wait_ms = HAL_I2C_RETRY_MS;
+		if (hint_us >= 0 && hint_us / 1000 < wait_ms) wait_ms = (uint32_t)(hint_us / 1000);
+		xSemaphoreTake(s_i2c_grant[dev], pdMS_TO_TICKS(wait_ms) + 1);
+
+		taskENTER_CRITICAL(&s_i2c_lock);
+		granted = i2c_sched_request(&s_i2c, dev, esp_timer_get_time());
+		taskEXIT_CRITICAL(&s_i2c_lock);
+	}
+}
+
+static void hal_i2c_acquire(i2c_sched_dev_t dev) {
+	xSemaphoreTakeRecursive(s_i2c_dev_mutex[dev], portMAX_DELAY);
+	if (s_i2c_depth[dev]++ > 0) return;
+	taskENTER_CRITICAL(&s_i2c_lock);
+	bool granted = i2c_sched_request(&s_i2c, dev, esp_timer_get_time());
+	taskEXIT_CRITICAL(&s_i2c_lock);
+	hal_i2c_wait_grant(dev, granted);
+}
+
+static void hal_i2c_release(i2c_sched_dev_t dev) {
+	int next = I2C_SCHED_NONE;
+	bool granted = true;
+	int64_t now = esp_timer_get_time();
+	taskENTER_CRITICAL(&s_i2c_lock);
+	if (--s_i2c_depth[dev] == 0) {
+		next = i2c_sched_release(&s_i2c, dev, now);
+	} else if (i2c_sched_should_yield(&s_i2c, dev, now)) {
+		// Between two transfers of a burst: let touch in, then carry on
+		next = i2c_sched_yield(&s_i2c, dev, now);
+		granted = next == (int)dev;
+	}
+	taskEXIT_CRITICAL(&s_i2c_lock);
+	if (next != (int)dev) hal_i2c_wake(next);
+	if (!granted) hal_i2c_wait_grant(dev, false);
+	xSemaphoreGiveRecursive(s_i2c_dev_mutex[dev]);
+}
+
+static void hal_i2c_touch_hook(bool acquire, void *user_ctx) {
+	if (acquire) hal_i2c_acquire(I2C_SCHED_DEV_TOUCH);
+	else hal_i2c_release(I2C_SCHED_DEV_TOUCH);
+}
+
+static void hal_i2c_pmic_hook(bool acquire, void *user_ctx) {
+	if (acquire) hal_i2c_acquire(I2C_SCHED_DEV_PMIC);
+	else hal_i2c_release(I2C_SCHED_DEV_PMIC);
+}
+
+static void hal_i2c_set_touch_active(bool active) {
+	if (!s_i2c_ready) return;
+	taskENTER_CRITICAL(&s_i2c_lock);
+	int next = i2c_sched_set_touch_active(&s_i2c, active, esp_timer_get_time());
+	taskEXIT_CRITICAL(&s_i2c_lock);
+	hal_i2c_wake(next);
+}
+
+static esp_err_t hal_i2c_sched_init(void) {
+	i2c_sched_config_t cfg;
+	i2c_sched_config_default(&cfg);
+	i2c_sched_init(&s_i2c, &cfg, esp_timer_get_time());
+	for (int d = 0; d < I2C_SCHED_DEV_COUNT; d++) {
+		s_i2c_grant[d] = xSemaphoreCreateBinary();
+		s_i2c_dev_mutex[d] = xSemaphoreCreateRecursiveMutex();
+		if (!s_i2c_grant[d] || !s_i2c_dev_mutex[d]) return ESP_ERR_NO_MEM;
+	}
+	s_i2c_ready = true;
+	sy6970_set_bus_hook(hal_i2c_pmic_hook, NULL);
+	cst226se_set_bus_hook(hal_i2c_touch_hook, NULL);
+	return ESP_OK;
+}
+
+// The driver lock is taken before the bus (sy6970_burst_begin does both) so PMIC
+// callers always lock in the same order
+void hal_mgr_pmic_burst_begin(void) {
+	sy6970_burst_begin();
+}
+
+void hal_mgr_pmic_burst_end(void) {
+	sy6970_burst_end();
+}
+
+void hal_mgr_i2c_get_stats(i2c_sched_stats_t *stats) {
+	if (!stats) return;
+	taskENTER_CRITICAL(&s_i2c_lock);
+	i2c_sched_get_stats(&s_i2c, esp_timer_get_time(), stats);
+	taskEXIT_CRITICAL(&s_i2c_lock);
+}
 
 // --- Touch event task ---
+// Sleeps on the CST226SE IRQ while idle (no periodic wake-ups) and only polls while pressed.
 static void hal_mgr_touch_task(void *arg) {
 	cst226se_data_t data;
 	while (1) {
-		if (cst226se_wait_event(1000)) {
+		bool pressed = s_latest_touch.pressed;
+		bool irq = cst226se_wait_event(pressed ? HAL_TOUCH_POLL_MS : CST226SE_WAIT_FOREVER);
+		if (irq || pressed) {
+			s_sample_start_us = esp_timer_get_time();
 			cst226se_read(&data);
+			// While a finger is down PMIC traffic is held to the gaps between samples
+			if (s_latest_touch.pressed != pressed) hal_i2c_set_touch_active(s_latest_touch.pressed);
 		}
 	}
 }
@@ -33,20 +175,63 @@ static cst226se_event_callback_t s_user_touch_cb = NULL;
 static void *s_user_touch_ctx = NULL;
 static rm690b0_vsync_cb_t s_user_vsync_cb = NULL;
 static void *s_user_vsync_ctx = NULL;
+static hal_mgr_touch_ready_cb_t s_touch_ready_cb = NULL;
+static void *s_touch_ready_ctx = NULL;
 
 void hal_mgr_register_touch_callback(cst226se_event_callback_t cb, void *user_ctx) {
 	s_user_touch_cb = cb;
 	s_user_touch_ctx = user_ctx;
 }
+void hal_mgr_register_touch_ready_callback(hal_mgr_touch_ready_cb_t cb, void *user_ctx) {
+	s_touch_ready_cb = cb;
+	s_touch_ready_ctx = user_ctx;
+}
 void hal_mgr_register_display_vsync_callback(rm690b0_vsync_cb_t cb, void *user_ctx) {
 	s_user_vsync_cb = cb;
 	s_user_vsync_ctx = user_ctx;
 }
 
+// Pick up a rotation change or new filter settings (touch task only)
+static void hal_mgr_touch_filter_sync(void) {
+	if (s_filter_dirty) {
+		touch_filter_config_t cfg;
+		taskENTER_CRITICAL(&s_touch_lock);
+		cfg = s_filter_cfg[rm690b0_get_rotation() & 3];
+		s_filter_dirty = false;
+		taskEXIT_CRITICAL(&s_touch_lock);
+		touch_filter_init(&s_touch_filter, &cfg);
+	}
+	touch_filter_set_latency(&s_touch_filter, s_touch_latency_us);
+}
+
 // Internal touch event handler (calls user if set)
+// The driver reports native sensor coordinates; every point goes through the rotation
+// transform, and the primary point is additionally smoothed and predicted ahead.
 static void hal_mgr_touch_event_handler(const cst226se_data_t *data, void *user_ctx) {
-	s_latest_touch = *data;
-	if (s_user_touch_cb) s_user_touch_cb(data, s_user_touch_ctx);
+	cst226se_data_t out = *data;
+	hal_mgr_touch_filter_sync();
+	if (data->pressed) {
+		const touch_xform_t *xf = &s_touch_filter.cfg.xform;
+		int16_t x, y;
+		for (uint8_t i = 0; i < out.count; i++) {
+			touch_xform_apply(xf, data->points[i].x, data->points[i].y, &x, &y);
+			out.points[i].x = (uint16_t)x;
+			out.points[i].y = (uint16_t)y;
+		}
+		touch_xform_apply(xf, data->x, data->y, &x, &y);
+		touch_filter_update(&s_touch_filter, s_sample_start_us, x, y, &x, &y);
+		out.x = (uint16_t)x;
+		out.y = (uint16_t)y;
+	} else {
+		touch_filter_reset(&s_touch_filter);
+	}
+
+	taskENTER_CRITICAL(&s_touch_lock);
+	s_latest_touch = out;
+	s_latest_touch_us = s_sample_start_us;
+	taskEXIT_CRITICAL(&s_touch_lock);
+	if (s_user_touch_cb) s_user_touch_cb(&out, s_user_touch_ctx);
+	if (s_touch_ready_cb) s_touch_ready_cb(s_touch_ready_ctx);
 }
 
 // --- GFX Stack Integration ---
@@ -70,6 +255,39 @@ bool hal_mgr_touch_read(int16_t *x, int16_t *y) {
 	return s_latest_touch.pressed;
 }
 
+uint8_t hal_mgr_touch_read_points(cst226se_point_t *points, uint8_t max) {
+	if (!points || max == 0) return 0;
+	taskENTER_CRITICAL(&s_touch_lock);
+	uint8_t n = s_latest_touch.pressed ? s_latest_touch.count : 0;
+	if (n > max) n = max;
+	memcpy(points, s_latest_touch.points, n * sizeof(cst226se_point_t));
+	taskEXIT_CRITICAL(&s_touch_lock);
+	return n;
+}
+
+int64_t hal_mgr_touch_get_sample_time(void) {
+	return s_latest_touch_us;
+}
+
+void hal_mgr_touch_set_filter_config(rm690b0_rotation_t rot, const touch_filter_config_t *cfg) {
+	if (!cfg) return;
+	taskENTER_CRITICAL(&s_touch_lock);
+	s_filter_cfg[rot & 3] = *cfg;
+	s_filter_dirty = true;
+	taskEXIT_CRITICAL(&s_touch_lock);
+}
+
+void hal_mgr_touch_get_filter_config(rm690b0_rotation_t rot, touch_filter_config_t *cfg) {
+	if (!cfg) return;
+	taskENTER_CRITICAL(&s_touch_lock);
+	*cfg = s_filter_cfg[rot & 3];
+	taskEXIT_CRITICAL(&s_touch_lock);
+}
+
+void hal_mgr_touch_set_latency(uint32_t latency_us) {
+	s_touch_latency_us = latency_us;
+}
+
 // Internal VSYNC event handler (calls user if set)
 static void hal_mgr_vsync_handler(void *user_ctx) {
 	if (s_user_vsync_cb) s_user_vsync_cb(s_user_vsync_ctx);
@@ -126,6 +344,7 @@ void hal_mgr_set_rotation(rm690b0_rotation_t rot) {
     // 2. Update hardware rotation
 	rm690b0_set_rotation(rot);
 	cst226se_set_rotation((cst226se_rotation_t)rot);
+	s_filter_dirty = true;  // Touch task switches to this rotation's transform
 
     // 3. Notify upper layers (LVGL)
     if (s_rot_cb) s_rot_cb(rot, s_rot_ctx);
@@ -135,27 +354,335 @@ rm690b0_rotation_t hal_mgr_get_rotation(void) {
 	return rm690b0_get_rotation();
 }
 
+// --- PMIC telemetry history ---
+// Every ADC sample goes into a multi-resolution ring in PSRAM. Closed 1 min buckets are
+// delta-encoded into a small RAM buffer and appended to the SD card in batches.
+#define HAL_TELEM_DIR       "/sdcard/pmic"
+#define HAL_TELEM_BUF_SIZE  512     // ~50 minutes of records between SD writes
+
+static pmic_telem_t s_telem;
+static bool s_telem_ready = false;
+static SemaphoreHandle_t s_telem_lock = NULL;
+static pmic_telem_codec_t s_telem_codec;
+static int64_t s_telem_saved = -1;      // newest 1 min bucket handed to the encoder
+static uint8_t s_telem_buf[HAL_TELEM_BUF_SIZE];
+static size_t s_telem_len = 0;
+static char s_telem_path[40] = "";      // chosen on the first write
+
+static esp_err_t hal_telem_init(void) {
+    size_t size = pmic_telem_mem_size();
+    void *mem = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (!mem) {
+        ESP_LOGE(TAG, "No PSRAM for PMIC telemetry (%u bytes)", (unsigned)size);
+        return ESP_ERR_NO_MEM;
+    }
+    s_telem_lock = xSemaphoreCreateMutex();
+    if (!s_telem_lock || !pmic_telem_init(&s_telem, mem, size)) {
+        heap_caps_free(mem);
+        return ESP_ERR_NO_MEM;
+    }
+    s_telem_ready = true;
+    ESP_LOGI(TAG, "PMIC telemetry: %u KB history in PSRAM", (unsigned)(size / 1024));
+    return ESP_OK;
+}
+
+// This boot's file: named after the wall-clock time once SNTP has run, else the first free
+// bootN.bin, so boots without a clock keep each other's history
+static bool hal_telem_pick_path(char *path, size_t size, time_t now, bool clock_set) {
+    if (clock_set) {
+        snprintf(path, size, HAL_TELEM_DIR "/%08lx.bin", (unsigned long)now);
+        return true;
+    }
+    struct stat st;
+    for (unsigned n = 0; n < 10000; n++) {
+        snprintf(path, size, HAL_TELEM_DIR "/boot%u.bin", n);
+        if (stat(path, &st) != 0) return true;
+    }
+    return false;
+}
+
+// Appends the buffered records to this boot's file; kept in RAM while no card is mounted.
+// Only the telemetry task touches the buffer and codec, so this runs without s_telem_lock.
+static void hal_telem_flush(void) {
+    if (s_telem_len == 0 || !sd_card_is_mounted()) return;
+    time_t now = time(NULL);
+    struct tm tm_now;
+    localtime_r(&now, &tm_now);
+    bool clock_set = tm_now.tm_year + 1900 > 2020;    // SNTP has run
+    // The file is this boot's only once it holds a header
+    bool new_file = s_telem_path[0] == '\0';
+    char path[sizeof(s_telem_path)];
+    if (new_file) {
+        mkdir(HAL_TELEM_DIR, 0775);
+        if (!hal_telem_pick_path(path, sizeof(path), now, clock_set)) {
+            ESP_LOGW(TAG, "No free telemetry file name in " HAL_TELEM_DIR);
+            return;
+        }
+    } else {
+        strcpy(path, s_telem_path);
+    }
+    FILE *f = fopen(path, new_file ? "wb" : "ab");
+    if (!f) {
+        ESP_LOGW(TAG, "Cannot open %s", path);
+        return;
+    }
+    long start;
+    if (new_file) {
+        // Wall-clock time of uptime 0, so readers can place the bucket indices
+        uint8_t hdr[PMIC_TELEM_HDR_SIZE];
+        uint32_t epoch = clock_set ? (uint32_t)(now - esp_timer_get_time() / 1000000) : 0;
+        size_t len = pmic_telem_write_header(hdr, epoch);
+        start = fwrite(hdr, 1, len, f) == len ? (long)len : -1;
+    } else {
+        start = fseek(f, 0, SEEK_END) == 0 ? ftell(f) : -1;
+    }
+    bool ok = start >= 0 && fwrite(s_telem_buf, 1, s_telem_len, f) == s_telem_len && fflush(f) == 0;
+    // A partial record would garble every one after it: cut it off, so the next flush
+    // writes the whole buffer again
+    bool kept = ok || (!new_file && (start < 0 || ftruncate(fileno(f), start) == 0));
+    fclose(f);
+    if (ok) {
+        if (new_file) strcpy(s_telem_path, path);
+        s_telem_len = 0;
+        return;
+    }
+    ESP_LOGW(TAG, "Short write to %s", path);
+    if (kept) return;
+    remove(path);
+    if (!new_file) {
+        // The records on the card are gone and the buffered ones follow them: start a new
+        // file with the records to come
+        s_telem_path[0] = '\0';
+        s_telem_len = 0;
+        pmic_telem_codec_init(&s_telem_codec, s_telem_codec.last_idx);
+    }
+}
+
+// Encodes the 1 min buckets closed up to `newest` (empty ones cost nothing on disk); false
+// when the buffer filled first, s_telem_saved being the last one done. Holds s_telem_lock.
+static bool hal_telem_encode(int64_t newest) {
+    for (int64_t idx = s_telem_saved + 1; idx <= newest; idx++) {
+        pmic_telem_record_t rec = { .idx = idx };
+        for (int ch = 0; ch < PMIC_TELEM_CH_COUNT; ch++) {
+            pmic_telem_bucket(&s_telem, PMIC_TELEM_RES_1MIN, (pmic_telem_ch_t)ch, idx, &rec.ch[ch]);
+        }
+        if (rec.ch[0].count == 0) continue;
+        if (s_telem_len + PMIC_TELEM_REC_MAX > sizeof(s_telem_buf)) {
+            s_telem_saved = idx - 1;
+            return false;
+        }
+        s_telem_len += pmic_telem_encode(&s_telem_codec, &rec, s_telem_buf + s_telem_len);
+    }
+    s_telem_saved = newest;
+    return true;
+}
+
+static void hal_telem_append(const sy6970_adc_values_t *adc) {
+    if (!s_telem_ready) return;
+    int16_t v[PMIC_TELEM_CH_COUNT] = {
+        [PMIC_TELEM_VBAT] = (int16_t)adc->vbat_mv,
+        [PMIC_TELEM_VBUS] = (int16_t)adc->vbus_mv,
+        [PMIC_TELEM_ICHG] = (int16_t)adc->ichg_ma,
+    };
+    xSemaphoreTake(s_telem_lock, portMAX_DELAY);
+    int64_t quarter = pmic_telem_newest(&s_telem, PMIC_TELEM_RES_15MIN);
+    pmic_telem_append(&s_telem, (uint32_t)(adc->t_us / 1000000), v);
+
+    // Encode 1 min buckets that just closed
+    int64_t newest = pmic_telem_newest(&s_telem, PMIC_TELEM_RES_1MIN);
+    if (s_telem_saved < 0 && newest >= 0) {
+        s_telem_saved = newest - 1;
+        pmic_telem_codec_init(&s_telem_codec, s_telem_saved);
+    }
+    bool done = hal_telem_encode(newest);
+    bool quarter_closed = pmic_telem_newest(&s_telem, PMIC_TELEM_RES_15MIN) != quarter;
+    xSemaphoreGive(s_telem_lock);
+
+    // SD writes happen off the lock: the stats timer queries under it from the LVGL task
+    if (!done) {
+        hal_telem_flush();
+        xSemaphoreTake(s_telem_lock, portMAX_DELAY);
+        if (!hal_telem_encode(newest)) s_telem_saved = newest;    // no card: the rest stays in PSRAM only
+        xSemaphoreGive(s_telem_lock);
+    }
+    if (quarter_closed) hal_telem_flush();
+}
+
+esp_err_t hal_mgr_telemetry_query(pmic_telem_res_t res, pmic_telem_ch_t ch, uint32_t window_s,
+                                  pmic_telem_stats_t *out) {
+    if (!out || res >= PMIC_TELEM_RES_COUNT || ch >= PMIC_TELEM_CH_COUNT) return ESP_ERR_INVALID_ARG;
+    if (!s_telem_ready) return ESP_ERR_INVALID_STATE;
+    uint32_t now_s = (uint32_t)(esp_timer_get_time() / 1000000);
+    uint32_t from_s = window_s < now_s ? now_s - window_s : 0;
+    xSemaphoreTake(s_telem_lock, portMAX_DELAY);
+    bool found = pmic_telem_query(&s_telem, res, ch, from_s, now_s, out);
+    xSemaphoreGive(s_telem_lock);
+    return found ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+size_t hal_mgr_telemetry_read(pmic_telem_res_t res, pmic_telem_ch_t ch, int64_t *cursor,
+                              pmic_telem_stats_t *out, size_t max) {
+    if (!cursor || !out || res >= PMIC_TELEM_RES_COUNT || ch >= PMIC_TELEM_CH_COUNT || !s_telem_ready) return 0;
+    size_t n = 0;
+    xSemaphoreTake(s_telem_lock, portMAX_DELAY);
+    int64_t newest = pmic_telem_newest(&s_telem, res);
+    int64_t idx = *cursor + 1;
+    if (newest - idx + 1 > (int64_t)max) idx = newest - (int64_t)max + 1;   // only the latest `max`
+    for (; idx <= newest; idx++) {
+        if (!pmic_telem_bucket(&s_telem, res, ch, idx, &out[n])) out[n].count = 0;
+        n++;
+    }
+    if (newest > *cursor) *cursor = newest;
+    xSemaphoreGive(s_telem_lock);
+    return n;
+}
+
+// --- Power governor ---
+// Rendering, flushing and decoding hold a max-frequency PM lock; otherwise the CPU idles at
+// the profile's minimum clock and, on battery, light-sleeps until touch, the charger INT or
+// a timer wakes it. Without CONFIG_PM_ENABLE only the policy and its statistics run.
+static power_gov_t s_gov;
+static SemaphoreHandle_t s_gov_lock = NULL;
+static esp_pm_lock_handle_t s_pm_boost = NULL;
+static esp_timer_handle_t s_gov_timer = NULL;   // ends the linger after the last work
+
+static void hal_power_configure(void) {
+    const power_gov_profile_t *p = power_gov_profile(&s_gov);
+    esp_pm_config_t cfg = {
+        .max_freq_mhz = p->max_mhz,
+        .min_freq_mhz = p->min_mhz,
+        .light_sleep_enable = p->light_sleep,
+    };
+    esp_err_t ret = esp_pm_configure(&cfg);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "esp_pm_configure failed: %s", esp_err_to_name(ret));
+        return;
+    }
+    ESP_LOGI(TAG, "Power profile: %s, %u-%u MHz, light sleep %s",
+             s_gov.src == POWER_GOV_SRC_USB ? "USB" : "battery", p->min_mhz, p->max_mhz,
+             p->light_sleep ? "on" : "off");
+}
+
+// Carries out the governor's actions; s_gov_lock must be held
+static void hal_power_run(uint32_t act, int64_t now_us) {
+    uint32_t wait_us;
+    act |= power_gov_poll(&s_gov, now_us, &wait_us);
+    if (!s_pm_boost) return;
+    if (act & POWER_GOV_ACT_CONFIGURE) hal_power_configure();
+    if (act & POWER_GOV_ACT_UNLOCK) esp_pm_lock_release(s_pm_boost);
+    if (act & POWER_GOV_ACT_LOCK) esp_pm_lock_acquire(s_pm_boost);
+    esp_timer_stop(s_gov_timer);
+    if (wait_us != UINT32_MAX) esp_timer_start_once(s_gov_timer, wait_us);
+}
+
+static void hal_power_timer_cb(void *arg) {
+    xSemaphoreTake(s_gov_lock, portMAX_DELAY);
+    hal_power_run(0, esp_timer_get_time());
+    xSemaphoreGive(s_gov_lock);
+}
+
+static void hal_power_set_source(bool usb) {
+    if (!s_gov_lock) return;
+    xSemaphoreTake(s_gov_lock, portMAX_DELAY);
+    int64_t now = esp_timer_get_time();
+    hal_power_run(power_gov_set_source(&s_gov, usb ? POWER_GOV_SRC_USB : POWER_GOV_SRC_BATTERY, now), now);
+    xSemaphoreGive(s_gov_lock);
+}
+
+static esp_err_t hal_power_init(bool usb) {
+    s_gov_lock = xSemaphoreCreateMutex();
+    if (!s_gov_lock) return ESP_ERR_NO_MEM;
+    power_gov_init(&s_gov, usb ? POWER_GOV_SRC_USB : POWER_GOV_SRC_BATTERY, esp_timer_get_time());
+
+    esp_err_t ret = esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "hal_boost", &s_pm_boost);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Power management unavailable (%s), clocks stay fixed", esp_err_to_name(ret));
+        s_pm_boost = NULL;
+        return ret;
+    }
+    const esp_timer_create_args_t timer_args = {
+        .callback = hal_power_timer_cb,
+        .name = "power_gov",
+    };
+    ret = esp_timer_create(&timer_args, &s_gov_timer);
+    if (ret != ESP_OK) {
+        esp_pm_lock_delete(s_pm_boost);
+        s_pm_boost = NULL;
+        return ret;
+    }
+
+    // Light sleep ends on touch, the charger INT, the BOOT button or a timer
+    if (cst226se_enable_wakeup() != ESP_OK) ESP_LOGW(TAG, "Touch IRQ cannot wake light sleep");
+    if (sy6970_enable_wakeup() != ESP_OK) ESP_LOGW(TAG, "PMIC INT cannot wake light sleep");
+    esp_sleep_enable_gpio_wakeup();
+    hal_power_configure();
+    return ESP_OK;
+}
+
+void hal_mgr_power_begin(power_gov_work_t work) {
+    if (!s_gov_lock) return;
+    xSemaphoreTake(s_gov_lock, portMAX_DELAY);
+    int64_t now = esp_timer_get_time();
+    hal_power_run(power_gov_begin(&s_gov, work, now), now);
+    xSemaphoreGive(s_gov_lock);
+}
+
+void hal_mgr_power_end(power_gov_work_t work) {
+    if (!s_gov_lock) return;
+    xSemaphoreTake(s_gov_lock, portMAX_DELAY);
+    int64_t now = esp_timer_get_time();
+    hal_power_run(power_gov_end(&s_gov, work, now), now);
+    xSemaphoreGive(s_gov_lock);
+}
+
+void hal_mgr_power_get_stats(power_gov_stats_t *stats) {
+    if (!stats) return;
+    memset(stats, 0, sizeof(*stats));
+    if (!s_gov_lock) return;
+    xSemaphoreTake(s_gov_lock, portMAX_DELAY);
+    power_gov_get_stats(&s_gov, esp_timer_get_time(), stats);
+    xSemaphoreGive(s_gov_lock);
+}
+
 // --- Polling task for status changes ---
+#define HAL_PMIC_LOG_MS 10000   // battery / bus statistics log period
+
 static void hal_mgr_status_task(void *arg) {
     // STAT LED is hardware-controlled by SY6970 (enabled by default in sy6970_init)
     // No software intervention needed - LED reflects charge/fault state automatically
 
-	bool last_usb = false, last_charge = false, last_batt = false;
-	static int charge_stable_count = 0;
-	static bool last_reported_charge = false;
-	const int debounce_ticks = 5; // e.g., 5*200ms = 1s
-    int log_counter = 0;
-    uint8_t last_faults = 0xFF; // Initialize to invalid value to force first log
+    // Sleeps until the charger pulses INT; the monitor only wakes us early for the slow
+    // ADC poll, the charge debounce and while a fault is latched
+    uint8_t last_faults = 0;
     bool first_read = true;
+    bool irq = false;
+    sy6970_shadow_stats_t last_pmic = {0};
+    sy6970_monitor_stats_t last_mon = {0};
+    sy6970_adc_stats_t last_adc = {0};
+    power_gov_stats_t last_gov = {0};
+    int64_t last_log_us = 0;
+
+    // Battery, VBUS and charge current for the log and the telemetry history; views that
+    // need fresher values register their own demand (and fill the 1 s history while open)
+    sy6970_adc_request(SY6970_ADC_VBAT | SY6970_ADC_VBUS | SY6970_ADC_ICHG, HAL_PMIC_LOG_MS);
 
 	while (1) {
+		uint32_t wait_ms = 0;
+		uint32_t events = sy6970_poll_events(irq, &wait_ms);
+
+		// Everything below is served from the snapshot the monitor just took
+		hal_mgr_pmic_burst_begin();
 		bool usb = sy6970_is_vbus_connected();
 		bool batt = sy6970_is_power_good();
+		uint8_t faults = sy6970_get_faults();
+		sy6970_charge_status_t chg_status = sy6970_get_charge_status();
+		hal_mgr_pmic_burst_end();
+		sy6970_adc_values_t adc = {0};
+		sy6970_get_adc_values(&adc);
+		if (events & SY6970_EVT_ADC) hal_telem_append(&adc);
 
-        uint8_t faults = sy6970_get_faults();
-        
         // Log fault changes immediately (skip confusing initial log)
-        if (faults != last_faults && !first_read) {
+        if ((events & SY6970_EVT_FAULT) && !first_read) {
             if (faults == 0) {
                 ESP_LOGI(TAG, "*** FAULT CLEARED *** (was: 0x%02X [%s])", 
                          last_faults, sy6970_decode_faults(last_faults));
@@ -166,19 +693,25 @@ static void hal_mgr_status_task(void *arg) {
                          last_faults, faults, sy6970_decode_faults(faults));
             }
         }
-        if (first_read) {
+        if (first_read && events) {
             first_read = false;
             if (faults != 0) {
                 ESP_LOGW(TAG, "*** FAULT ON STARTUP *** 0x%02X: %s", faults, sy6970_decode_faults(faults));
             }
         }
-        last_faults = faults;
-
-        // Periodic logging (approx every 1s)
-        if (++log_counter >= 4) {
-            uint16_t vbat = sy6970_get_battery_voltage();
-            bool chg = (sy6970_get_charge_status() == SY6970_CHG_FAST_CHARGE || 
-                        sy6970_get_charge_status() == SY6970_CHG_PRE_CHARGE);
+        if (events & SY6970_EVT_FAULT) last_faults = faults;
+
+		if (s_usb_cb && (events & SY6970_EVT_VBUS)) s_usb_cb(usb, s_usb_ctx);
+		if (s_charge_cb && (events & SY6970_EVT_CHARGE))
+			s_charge_cb(chg_status != SY6970_CHG_NOT_CHARGING, s_charge_ctx);
+		if (s_batt_cb && (events & SY6970_EVT_POWER_GOOD)) s_batt_cb(batt, s_batt_ctx);
+		if (events & SY6970_EVT_VBUS) hal_power_set_source(usb);
+
+        // Periodic logging on a fresh battery sample
+        int64_t now_us = esp_timer_get_time();
+        if ((events & SY6970_EVT_ADC) && now_us - last_log_us >= (int64_t)HAL_PMIC_LOG_MS * 1000) {
+            uint16_t vbat = adc.vbat_mv;
+            bool chg = (chg_status == SY6970_CHG_FAST_CHARGE || chg_status == SY6970_CHG_PRE_CHARGE);
             
             // Show detailed fault info if faults present
             if (faults != 0) {
@@ -188,28 +721,62 @@ static void hal_mgr_status_task(void *arg) {
                 ESP_LOGI(TAG, "Bat: %dmV %s%s Faults:0x%02X", vbat, usb ? "USB" : "", 
                          chg ? " (Chg)" : "", faults);
             }
-            log_counter = 0;
+
+            // Shared bus health
+            i2c_sched_stats_t st;
+            hal_mgr_i2c_get_stats(&st);
+            const i2c_sched_dev_stats_t *t = &st.dev[I2C_SCHED_DEV_TOUCH];
+            const i2c_sched_dev_stats_t *p = &st.dev[I2C_SCHED_DEV_PMIC];
+            ESP_LOGI(TAG, "I2C: bus %lu.%lu%%, touch wait avg %lu us max %lu us, "
+                     "pmic wait avg %lu us max %lu us (deferred %lu, yielded %lu)",
+                     (unsigned long)(st.util_permille / 10), (unsigned long)(st.util_permille % 10),
+                     (unsigned long)(t->grants ? t->wait_sum_us / t->grants : 0), (unsigned long)t->wait_max_us,
+                     (unsigned long)(p->grants ? p->wait_sum_us / p->grants : 0), (unsigned long)p->wait_max_us,
+                     (unsigned long)p->deferrals, (unsigned long)p->yields);
+
+            sy6970_shadow_stats_t pmic;
+            sy6970_monitor_stats_t mon;
+            sy6970_get_shadow_stats(&pmic);
+            sy6970_get_monitor_stats(&mon);
+            ESP_LOGI(TAG, "PMIC: %lu transactions (%lu snapshots, %lu cache hits, %lu errors), "
+                     "%lu INT, %lu status reads since last report",
+                     (unsigned long)(pmic.transactions - last_pmic.transactions),
+                     (unsigned long)(pmic.bursts - last_pmic.bursts),
+                     (unsigned long)(pmic.hits - last_pmic.hits),
+                     (unsigned long)(pmic.errors - last_pmic.errors),
+                     (unsigned long)(mon.interrupts - last_mon.interrupts),
+                     (unsigned long)(mon.reads - last_mon.reads));
+            last_pmic = pmic;
+            last_mon = mon;
+
+            sy6970_adc_stats_t adc_st;
+            sy6970_get_adc_stats(&adc_st);
+            uint32_t conv = adc_st.conversions - last_adc.conversions;
+            uint64_t elapsed_us = last_log_us ? (uint64_t)(now_us - last_log_us) : (uint64_t)now_us;
+            ESP_LOGI(TAG, "ADC: %lu conversions/min, ~%lu uA saved vs continuous",
+                     (unsigned long)(elapsed_us ? (uint64_t)conv * 60000000ULL / elapsed_us : 0),
+                     (unsigned long)sy6970_adc_saved_ua(conv, elapsed_us));
+            last_adc = adc_st;
+
+            power_gov_stats_t gov;
+            hal_mgr_power_get_stats(&gov);
+            uint64_t gov_ms = (gov.elapsed_us - last_gov.elapsed_us) / 1000;
+            uint64_t boost_ms = (gov.state_us[POWER_GOV_STATE_BOOST] - last_gov.state_us[POWER_GOV_STATE_BOOST]) / 1000;
+            ESP_LOGI(TAG, "Power: %s, duty %lu.%lu%%, boost %lu ms, idle %lu ms, sleep-enabled %lu ms, "
+                     "%lu locks (%lu coalesced)",
+                     usb ? "USB" : "battery",
+                     (unsigned long)(gov_ms ? boost_ms * 100 / gov_ms : 0),
+                     (unsigned long)(gov_ms ? boost_ms * 1000 / gov_ms % 10 : 0),
+                     (unsigned long)boost_ms,
+                     (unsigned long)((gov.state_us[POWER_GOV_STATE_IDLE] - last_gov.state_us[POWER_GOV_STATE_IDLE]) / 1000),
+                     (unsigned long)((gov.state_us[POWER_GOV_STATE_SLEEP] - last_gov.state_us[POWER_GOV_STATE_SLEEP]) / 1000),
+                     (unsigned long)(gov.locks - last_gov.locks),
+                     (unsigned long)(gov.coalesced - last_gov.coalesced));
+            last_gov = gov;
+            last_log_us = now_us;
         }
 
-		if (s_usb_cb && usb != last_usb) s_usb_cb(usb, s_usb_ctx);
-
-		bool charging = (sy6970_get_charge_status() != SY6970_CHG_NOT_CHARGING);
-		if (charging != last_charge) {
-			charge_stable_count++;
-			if (charge_stable_count >= debounce_ticks) {
-				if (s_charge_cb && charging != last_reported_charge)
-					s_charge_cb(charging, s_charge_ctx);
-				last_reported_charge = charging;
-				last_charge = charging;
-				charge_stable_count = 0;
-			}
-		} else {
-			charge_stable_count = 0;
-		}
-		if (s_batt_cb && batt != last_batt) s_batt_cb(batt, s_batt_ctx);
-		last_usb = usb;
-		last_batt = batt;
-		vTaskDelay(pdMS_TO_TICKS(250));
+		irq = sy6970_wait_event(wait_ms);
 	}
 }
 
@@ -251,6 +818,13 @@ esp_err_t hal_mgr_init(void) {
 		return ret;
 	}
 
+	// Install GPIO ISR service once for all components (before the button, which would
+	// otherwise install an IRAM-only service for its power-save interrupt)
+	esp_err_t isr_ret = gpio_install_isr_service(0);
+	if (isr_ret != ESP_OK && isr_ret != ESP_ERR_INVALID_STATE) {
+		ESP_LOGE(TAG, "Failed to install GPIO ISR service: %s", esp_err_to_name(isr_ret));
+	}
+
     // Button (GPIO 0 - Boot)
     button_config_t btn_cfg = {
         .long_press_time = 1500,
@@ -259,6 +833,7 @@ esp_err_t hal_mgr_init(void) {
     button_gpio_config_t btn_gpio_cfg = {
         .gpio_num = 0,
         .active_level = 0,
+        .enable_power_save = true, // No 5 ms scan timer while idle; the press wakes light sleep
     };
     button_handle_t btn_handle = NULL;
     esp_err_t btn_ret = iot_button_new_gpio_device(&btn_cfg, &btn_gpio_cfg, &btn_handle);
@@ -275,11 +850,6 @@ esp_err_t hal_mgr_init(void) {
 		return ret;
 	}
 
-	// Install GPIO ISR service once for all components
-	esp_err_t isr_ret = gpio_install_isr_service(0);
-	if (isr_ret != ESP_OK && isr_ret != ESP_ERR_INVALID_STATE) {
-		ESP_LOGE(TAG, "Failed to install GPIO ISR service: %s", esp_err_to_name(isr_ret));
-	}
 	
 	// Load brightness from NVS and set it
 	uint8_t brightness = hal_mgr_get_brightness();
@@ -291,6 +861,19 @@ esp_err_t hal_mgr_init(void) {
 		ESP_LOGE(TAG, "Failed to initialize touch driver");
 		return ret;
 	}
+	for (int r = 0; r < 4; r++) {
+		touch_filter_config_default(r, &s_filter_cfg[r]);
+	}
+	cst226se_set_raw_output(true);
+	ret = hal_i2c_sched_init();
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "Failed to set up I2C scheduling");
+		return ret;
+	}
+	// PMIC status is event driven; on failure the driver falls back to polling
+	sy6970_enable_int();
+	// Clocks and light sleep follow the power source; the status task tracks USB changes
+	hal_power_init(sy6970_is_vbus_connected());
 	cst226se_register_callback(hal_mgr_touch_event_handler, NULL);
 
 	// Set orientation from NVS (or default to Rotation 0 if not found)
@@ -308,7 +891,10 @@ esp_err_t hal_mgr_init(void) {
 		return ESP_FAIL;
 	}
 
-	// PMIC status polling
+	// PMIC history (non-fatal: the views fall back to live values)
+	hal_telem_init();
+
+	// PMIC status events
 	if (xTaskCreate(hal_mgr_status_task, "hal_mgr_status", 4096, NULL, 5, NULL) != pdPASS) {
 		ESP_LOGE(TAG, "Failed to create status task");
 		return ESP_FAIL;
@@ -0,0 +1,118 @@
+#include "i2c_sched.h"
+#include <string.h>
+
+void i2c_sched_config_default(i2c_sched_config_t *cfg) {
+    // Touch is sampled every 10 ms while pressed; a 3 ms slot fits a full PMIC
+    // status burst (~10 register reads at 400 kHz) with margin before the next sample.
+    cfg->window_us = 3000;
+    cfg->max_defer_us = 200000;
+}
+
+void i2c_sched_init(i2c_sched_t *s, const i2c_sched_config_t *cfg, int64_t now_us) {
+    memset(s, 0, sizeof(*s));
+    s->cfg = *cfg;
+    s->owner = I2C_SCHED_NONE;
+    s->start_us = now_us;
+}
+
+static bool pmic_defer_expired(const i2c_sched_t *s, int64_t now_us) {
+    return now_us - s->wait_since[I2C_SCHED_DEV_PMIC] >= s->cfg.max_defer_us;
+}
+
+static bool in_touch_window(const i2c_sched_t *s, int64_t now_us) {
+    return now_us - s->touch_done_us < s->cfg.window_us;
+}
+
+static bool eligible(const i2c_sched_t *s, i2c_sched_dev_t dev, int64_t now_us) {
+    if (s->owner != I2C_SCHED_NONE) return false;
+    if (dev == I2C_SCHED_DEV_TOUCH) return true;
+    if (s->waiting[I2C_SCHED_DEV_TOUCH]) return false;
+    return !s->touch_active || in_touch_window(s, now_us) || s->force_pending || pmic_defer_expired(s, now_us);
+}
+
+static void grant(i2c_sched_t *s, i2c_sched_dev_t dev, int64_t now_us) {
+    i2c_sched_dev_stats_t *st = &s->stats[dev];
+    uint32_t wait = (uint32_t)(now_us - s->wait_since[dev]);
+    s->owner = dev;
+    s->owner_since = now_us;
+    s->forced = dev == I2C_SCHED_DEV_PMIC && s->touch_active && !in_touch_window(s, now_us);
+    if (dev == I2C_SCHED_DEV_PMIC) s->force_pending = false;
+    s->waiting[dev] = false;
+    s->deferred[dev] = false;
+    st->grants++;
+    st->wait_sum_us += wait;
+    if (wait > st->wait_max_us) st->wait_max_us = wait;
+}
+
+// Hand a free bus to the best eligible waiter: touch first, then PMIC
+static int grant_next(i2c_sched_t *s, int64_t now_us) {
+    for (int d = 0; d < I2C_SCHED_DEV_COUNT; d++) {
+        if (s->waiting[d] && eligible(s, (i2c_sched_dev_t)d, now_us)) {
+            grant(s, (i2c_sched_dev_t)d, now_us);
+            return d;
+        }
+    }
+    return I2C_SCHED_NONE;
+}
+
+bool i2c_sched_request(i2c_sched_t *s, i2c_sched_dev_t dev, int64_t now_us) {
+    if (s->owner == (int)dev) return true;
+    if (!s->waiting[dev]) {
+        s->waiting[dev] = true;
+        s->wait_since[dev] = now_us;
+    }
+    if (eligible(s, dev, now_us)) {
+        grant(s, dev, now_us);
+        return true;
+    }
+    if (dev == I2C_SCHED_DEV_PMIC && !s->deferred[dev] && (s->touch_active || s->waiting[I2C_SCHED_DEV_TOUCH])) {
+        s->deferred[dev] = true;
+        s->stats[dev].deferrals++;
+    }
+    return false;
+}
+
+int i2c_sched_release(i2c_sched_t *s, i2c_sched_dev_t dev, int64_t now_us) {
+    if (s->owner != (int)dev) return I2C_SCHED_NONE;
+    s->stats[dev].busy_us += (uint64_t)(now_us - s->owner_since);
+    if (dev == I2C_SCHED_DEV_TOUCH) s->touch_done_us = now_us;
+    s->owner = I2C_SCHED_NONE;
+    s->forced = false;
+    return grant_next(s, now_us);
+}
+
+bool i2c_sched_should_yield(const i2c_sched_t *s, i2c_sched_dev_t dev, int64_t now_us) {
+    if (dev != I2C_SCHED_DEV_PMIC || s->owner != (int)dev) return false;
+    if (s->waiting[I2C_SCHED_DEV_TOUCH]) return true;
+    return s->touch_active && !s->forced && !in_touch_window(s, now_us);
+}
+
+int i2c_sched_yield(i2c_sched_t *s, i2c_sched_dev_t dev, int64_t now_us) {
+    if (s->owner != (int)dev) return I2C_SCHED_NONE;
+    s->stats[dev].yields++;
+    bool forced = s->forced;
+    int next = i2c_sched_release(s, dev, now_us);
+    // A burst that already waited out max_defer_us only steps aside for touch
+    s->force_pending = forced;
+    if (!i2c_sched_request(s, dev, now_us)) return next;
+    return dev;
+}
+
+int i2c_sched_set_touch_active(i2c_sched_t *s, bool active, int64_t now_us) {
+    s->touch_active = active;
+    return s->owner == I2C_SCHED_NONE ? grant_next(s, now_us) : I2C_SCHED_NONE;
+}
+
+int64_t i2c_sched_wait_hint_us(const i2c_sched_t *s, i2c_sched_dev_t dev, int64_t now_us) {
+    if (!s->waiting[dev] || dev != I2C_SCHED_DEV_PMIC || !s->touch_active) return -1;
+    int64_t left = s->cfg.max_defer_us - (now_us - s->wait_since[dev]);
+    return left > 0 ? left : 0;
+}
+
+void i2c_sched_get_stats(const i2c_sched_t *s, int64_t now_us, i2c_sched_stats_t *out) {
+    uint64_t busy = 0;
+    memcpy(out->dev, s->stats, sizeof(out->dev));
+    for (int d = 0; d < I2C_SCHED_DEV_COUNT; d++) busy += s->stats[d].busy_us;
+    out->elapsed_us = (uint64_t)(now_us - s->start_us);
+    out->util_permille = out->elapsed_us ? (uint32_t)(busy * 1000 / out->elapsed_us) : 0;
+}
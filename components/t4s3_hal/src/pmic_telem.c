@@ -0,0 +1,306 @@
+#include "pmic_telem.h"
+#include <string.h>
+
+#define CH PMIC_TELEM_CH_COUNT
+
+static const uint32_t s_period_s[PMIC_TELEM_RES_COUNT] = {1, 60, 900};
+static const uint32_t s_capacity[PMIC_TELEM_RES_COUNT] = {
+    PMIC_TELEM_1S_BUCKETS, PMIC_TELEM_1MIN_BUCKETS, PMIC_TELEM_15MIN_BUCKETS,
+};
+
+static uint8_t floor_log2(uint32_t n) {
+    return (uint8_t)(31 - __builtin_clz(n));
+}
+
+static size_t ring_sum_bytes(uint32_t cap) {
+    return (size_t)(cap + 1) * CH * sizeof(int64_t);
+}
+
+static size_t ring_count_bytes(uint32_t cap) {
+    return (size_t)(cap + 1) * sizeof(uint32_t);
+}
+
+static size_t ring_minmax_bytes(uint32_t cap) {
+    return (size_t)(floor_log2(cap) + 1) * cap * CH * 2 * sizeof(int16_t);
+}
+
+size_t pmic_telem_mem_size(void) {
+    size_t total = 0;
+    for (int r = 0; r < PMIC_TELEM_RES_COUNT; r++) {
+        total += ring_sum_bytes(s_capacity[r]) + ring_count_bytes(s_capacity[r]) + ring_minmax_bytes(s_capacity[r]);
+    }
+    return total;
+}
+
+bool pmic_telem_init(pmic_telem_t *t, void *mem, size_t size) {
+    if (!mem || size < pmic_telem_mem_size()) return false;
+    memset(t, 0, sizeof(*t));
+    // 64-bit sums first so every array stays naturally aligned
+    uint8_t *p = mem;
+    for (int r = 0; r < PMIC_TELEM_RES_COUNT; r++) {
+        t->ring[r].psum = (int64_t *)p;
+        p += ring_sum_bytes(s_capacity[r]);
+    }
+    for (int r = 0; r < PMIC_TELEM_RES_COUNT; r++) {
+        pmic_telem_ring_t *ring = &t->ring[r];
+        ring->period_s = s_period_s[r];
+        ring->capacity = s_capacity[r];
+        ring->levels = floor_log2(ring->capacity) + 1;
+        ring->pcount = (uint32_t *)p;
+        p += ring_count_bytes(ring->capacity);
+        ring->minmax = (int16_t *)p;
+        p += ring_minmax_bytes(ring->capacity);
+        ring->closed = -1;
+        ring->first = -1;
+        ring->open_idx = -1;
+    }
+    return true;
+}
+
+static int16_t *mm(const pmic_telem_ring_t *ring, int level, int64_t idx) {
+    return &ring->minmax[((size_t)level * ring->capacity + (size_t)(idx % ring->capacity)) * CH * 2];
+}
+
+// Write bucket `idx` (the one after `closed`) and its sparse-table column
+static void ring_close(pmic_telem_ring_t *ring, int64_t idx, const int16_t *min, const int16_t *max,
+                       const int64_t *sum, uint32_t count) {
+    int16_t *e = mm(ring, 0, idx);
+    for (int c = 0; c < CH; c++) {
+        e[c * 2] = count ? min[c] : INT16_MAX;
+        e[c * 2 + 1] = count ? max[c] : INT16_MIN;
+        ring->total_sum[c] += count ? sum[c] : 0;
+    }
+    // Level k at idx covers (idx - 2^k, idx]: combine the two halves written earlier
+    for (int k = 1; k < ring->levels; k++) {
+        int64_t half = (int64_t)1 << (k - 1);
+        int16_t *dst = mm(ring, k, idx);
+        const int16_t *a = mm(ring, k - 1, idx);
+        if (idx - half < 0) {
+            memcpy(dst, a, CH * 2 * sizeof(int16_t));
+            continue;
+        }
+        const int16_t *b = mm(ring, k - 1, idx - half);
+        for (int c = 0; c < CH; c++) {
+            dst[c * 2] = a[c * 2] < b[c * 2] ? a[c * 2] : b[c * 2];
+            dst[c * 2 + 1] = a[c * 2 + 1] > b[c * 2 + 1] ? a[c * 2 + 1] : b[c * 2 + 1];
+        }
+    }
+    ring->total_count += count;
+    size_t p = (size_t)(idx % (ring->capacity + 1));
+    memcpy(&ring->psum[p * CH], ring->total_sum, sizeof(ring->total_sum));
+    ring->pcount[p] = ring->total_count;
+    if (ring->first < 0) ring->first = idx;
+    ring->closed = idx;
+}
+
+static void ring_close_open(pmic_telem_ring_t *ring) {
+    int64_t idx = ring->open_idx;
+    if (ring->closed >= 0) {
+        // Unsampled buckets in between are closed empty; past a full ring only the last
+        // capacity + 1 matter (the running sums need the one before the oldest)
+        int64_t gap = ring->closed + 1;
+        if (idx - gap > (int64_t)ring->capacity + 1) gap = idx - ring->capacity - 1;
+        for (; gap < idx; gap++) ring_close(ring, gap, NULL, NULL, NULL, 0);
+    }
+    ring_close(ring, idx, ring->open_min, ring->open_max, ring->open_sum, ring->open_count);
+}
+
+void pmic_telem_append(pmic_telem_t *t, uint32_t t_s, const int16_t v[PMIC_TELEM_CH_COUNT]) {
+    for (int r = 0; r < PMIC_TELEM_RES_COUNT; r++) {
+        pmic_telem_ring_t *ring = &t->ring[r];
+        int64_t idx = t_s / ring->period_s;
+        if (ring->open_idx >= 0 && idx > ring->open_idx) {
+            ring_close_open(ring);
+            ring->open_count = 0;
+        }
+        if (ring->open_count == 0) {
+            ring->open_idx = idx;
+            for (int c = 0; c < CH; c++) {
+                ring->open_min[c] = v[c];
+                ring->open_max[c] = v[c];
+                ring->open_sum[c] = 0;
+            }
+        }
+        for (int c = 0; c < CH; c++) {
+            if (v[c] < ring->open_min[c]) ring->open_min[c] = v[c];
+            if (v[c] > ring->open_max[c]) ring->open_max[c] = v[c];
+            ring->open_sum[c] += v[c];
+        }
+        ring->open_count++;
+    }
+}
+
+static int64_t oldest_retained(const pmic_telem_ring_t *ring) {
+    int64_t oldest = ring->closed - ring->capacity + 1;
+    return oldest > ring->first ? oldest : ring->first;
+}
+
+// Running totals at the end of bucket idx (zero before the first bucket)
+static void prefix(const pmic_telem_ring_t *ring, int64_t idx, pmic_telem_ch_t ch, int64_t *sum, uint32_t *count) {
+    if (idx < ring->first) {
+        *sum = 0;
+        *count = 0;
+        return;
+    }
+    size_t p = (size_t)(idx % (ring->capacity + 1));
+    *sum = ring->psum[p * CH + ch];
+    *count = ring->pcount[p];
+}
+
+// Closed buckets [lo, hi], both retained: O(1)
+static void range_closed(const pmic_telem_ring_t *ring, pmic_telem_ch_t ch, int64_t lo, int64_t hi,
+                         int16_t *min, int16_t *max, int64_t *sum, uint32_t *count) {
+    int k = floor_log2((uint32_t)(hi - lo + 1));
+    const int16_t *a = mm(ring, k, hi);
+    const int16_t *b = mm(ring, k, lo + ((int64_t)1 << k) - 1);
+    *min = a[ch * 2] < b[ch * 2] ? a[ch * 2] : b[ch * 2];
+    *max = a[ch * 2 + 1] > b[ch * 2 + 1] ? a[ch * 2 + 1] : b[ch * 2 + 1];
+    int64_t s_hi, s_lo;
+    uint32_t c_hi, c_lo;
+    prefix(ring, hi, ch, &s_hi, &c_hi);
+    prefix(ring, lo - 1, ch, &s_lo, &c_lo);
+    *sum = s_hi - s_lo;
+    *count = c_hi - c_lo;
+}
+
+static void finish(pmic_telem_stats_t *out, int16_t min, int16_t max, int64_t sum, uint32_t count) {
+    out->min = min;
+    out->max = max;
+    out->count = count;
+    out->mean = count ? (int32_t)(sum / (int64_t)count) : 0;
+}
+
+bool pmic_telem_query(const pmic_telem_t *t, pmic_telem_res_t res, pmic_telem_ch_t ch,
+                      uint32_t from_s, uint32_t to_s, pmic_telem_stats_t *out) {
+    const pmic_telem_ring_t *ring = &t->ring[res];
+    int64_t lo = from_s / ring->period_s;
+    int64_t hi = to_s / ring->period_s;
+    int16_t min = INT16_MAX, max = INT16_MIN;
+    int64_t sum = 0;
+    uint32_t count = 0;
+
+    if (ring->closed >= 0) {
+        int64_t clo = lo > oldest_retained(ring) ? lo : oldest_retained(ring);
+        int64_t chi = hi < ring->closed ? hi : ring->closed;
+        if (clo <= chi) range_closed(ring, ch, clo, chi, &min, &max, &sum, &count);
+    }
+    if (ring->open_count && ring->open_idx >= lo && ring->open_idx <= hi) {
+        if (ring->open_min[ch] < min) min = ring->open_min[ch];
+        if (ring->open_max[ch] > max) max = ring->open_max[ch];
+        sum += ring->open_sum[ch];
+        count += ring->open_count;
+    }
+    finish(out, min, max, sum, count);
+    return count > 0;
+}
+
+int64_t pmic_telem_newest(const pmic_telem_t *t, pmic_telem_res_t res) {
+    return t->ring[res].closed;
+}
+
+uint32_t pmic_telem_period_s(pmic_telem_res_t res) {
+    return s_period_s[res];
+}
+
+bool pmic_telem_bucket(const pmic_telem_t *t, pmic_telem_res_t res, pmic_telem_ch_t ch, int64_t idx,
+                       pmic_telem_stats_t *out) {
+    const pmic_telem_ring_t *ring = &t->ring[res];
+    if (ring->closed < 0 || idx > ring->closed || idx < oldest_retained(ring)) return false;
+    const int16_t *e = mm(ring, 0, idx);
+    int64_t s_hi, s_lo;
+    uint32_t c_hi, c_lo;
+    prefix(ring, idx, ch, &s_hi, &c_hi);
+    prefix(ring, idx - 1, ch, &s_lo, &c_lo);
+    finish(out, e[ch * 2], e[ch * 2 + 1], s_hi - s_lo, c_hi - c_lo);
+    return true;
+}
+
+// --- Record stream ---
+
+static size_t put_varint(uint8_t *buf, uint64_t v) {
+    size_t n = 0;
+    do {
+        uint8_t b = v & 0x7F;
+        v >>= 7;
+        buf[n++] = b | (v ? 0x80 : 0);
+    } while (v);
+    return n;
+}
+
+static size_t get_varint(const uint8_t *buf, size_t len, uint64_t *v) {
+    uint64_t out = 0;
+    for (size_t n = 0; n < len && n < 10; n++) {
+        out |= (uint64_t)(buf[n] & 0x7F) << (7 * n);
+        if (!(buf[n] & 0x80)) {
+            *v = out;
+            return n + 1;
+        }
+    }
+    return 0;
+}
+
+static uint32_t zigzag(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static int32_t unzigzag(uint32_t v) {
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+size_t pmic_telem_write_header(uint8_t *buf, uint32_t epoch_s) {
+    memcpy(buf, "PMT1", 4);
+    for (int i = 0; i < 4; i++) buf[4 + i] = (uint8_t)(epoch_s >> (8 * i));
+    return PMIC_TELEM_HDR_SIZE;
+}
+
+bool pmic_telem_read_header(const uint8_t *buf, size_t len, uint32_t *epoch_s) {
+    if (len < PMIC_TELEM_HDR_SIZE || memcmp(buf, "PMT1", 4) != 0) return false;
+    *epoch_s = 0;
+    for (int i = 0; i < 4; i++) *epoch_s |= (uint32_t)buf[4 + i] << (8 * i);
+    return true;
+}
+
+void pmic_telem_codec_init(pmic_telem_codec_t *c, int64_t start_idx) {
+    memset(c, 0, sizeof(*c));
+    c->last_idx = start_idx;
+}
+
+size_t pmic_telem_encode(pmic_telem_codec_t *c, const pmic_telem_record_t *rec, uint8_t *buf) {
+    size_t n = put_varint(buf, (uint64_t)(rec->idx - c->last_idx));
+    for (int ch = 0; ch < CH; ch++) {
+        const pmic_telem_stats_t *s = &rec->ch[ch];
+        // Truncated means of small negative sums can fall outside [min, max]
+        int32_t mean = s->mean < s->min ? s->min : (s->mean > s->max ? s->max : s->mean);
+        n += put_varint(buf + n, zigzag(mean - c->last_mean[ch]));
+        n += put_varint(buf + n, (uint32_t)(mean - s->min));
+        n += put_varint(buf + n, (uint32_t)(s->max - mean));
+        c->last_mean[ch] = mean;
+    }
+    c->last_idx = rec->idx;
+    return n;
+}
+
+size_t pmic_telem_decode(pmic_telem_codec_t *c, const uint8_t *buf, size_t len, pmic_telem_record_t *rec) {
+    uint64_t v;
+    size_t n = get_varint(buf, len, &v), used;
+    if (!n) return 0;
+    rec->idx = c->last_idx + (int64_t)v;
+    int32_t means[CH];
+    for (int ch = 0; ch < CH; ch++) {
+        pmic_telem_stats_t *s = &rec->ch[ch];
+        if (!(used = get_varint(buf + n, len - n, &v))) return 0;
+        n += used;
+        means[ch] = c->last_mean[ch] + unzigzag((uint32_t)v);
+        s->mean = means[ch];
+        if (!(used = get_varint(buf + n, len - n, &v))) return 0;
+        n += used;
+        s->min = (int16_t)(s->mean - (int32_t)v);
+        if (!(used = get_varint(buf + n, len - n, &v))) return 0;
+        n += used;
+        s->max = (int16_t)(s->mean + (int32_t)v);
+        s->count = 1;   // sample counts are not stored
+    }
+    memcpy(c->last_mean, means, sizeof(means));
+    c->last_idx = rec->idx;
+    return n;
+}
@@ -0,0 +1,120 @@
+#include "power_gov.h"
+#include <string.h>
+
+void power_gov_profile_default(power_gov_src_t src, power_gov_profile_t *p) {
+    if (src == POWER_GOV_SRC_USB) {
+        p->max_mhz = POWER_GOV_USB_MAX_MHZ;
+        p->min_mhz = POWER_GOV_USB_MIN_MHZ;
+        p->light_sleep = false;
+        p->linger_us = POWER_GOV_USB_LINGER_MS * 1000;
+    } else {
+        p->max_mhz = POWER_GOV_BATT_MAX_MHZ;
+        p->min_mhz = POWER_GOV_BATT_MIN_MHZ;
+        p->light_sleep = true;
+        p->linger_us = POWER_GOV_BATT_LINGER_MS * 1000;
+    }
+}
+
+void power_gov_init(power_gov_t *g, power_gov_src_t src, int64_t now_us) {
+    memset(g, 0, sizeof(*g));
+    for (int s = 0; s < POWER_GOV_SRC_COUNT; s++) {
+        power_gov_profile_default((power_gov_src_t)s, &g->profile[s]);
+    }
+    g->src = src;
+    g->state = g->profile[src].light_sleep ? POWER_GOV_STATE_SLEEP : POWER_GOV_STATE_IDLE;
+    g->state_since_us = now_us;
+    g->src_since_us = now_us;
+    g->start_us = now_us;
+}
+
+static bool busy(const power_gov_t *g) {
+    for (int w = 0; w < POWER_GOV_WORK_COUNT; w++) {
+        if (g->active[w]) return true;
+    }
+    return false;
+}
+
+// Close the time accounted to the current state and move to the one implied by the lock
+static void update_state(power_gov_t *g, int64_t now_us) {
+    power_gov_state_t next = g->locked ? POWER_GOV_STATE_BOOST
+                           : g->profile[g->src].light_sleep ? POWER_GOV_STATE_SLEEP
+                           : POWER_GOV_STATE_IDLE;
+    if (next == g->state) return;
+    g->stats.state_us[g->state] += (uint64_t)(now_us - g->state_since_us);
+    g->state = next;
+    g->state_since_us = now_us;
+}
+
+uint32_t power_gov_set_source(power_gov_t *g, power_gov_src_t src, int64_t now_us) {
+    if (src >= POWER_GOV_SRC_COUNT || src == g->src) return 0;
+    g->stats.src_us[g->src] += (uint64_t)(now_us - g->src_since_us);
+    g->src = src;
+    g->src_since_us = now_us;
+    g->stats.profile_changes++;
+    update_state(g, now_us);
+    return POWER_GOV_ACT_CONFIGURE;
+}
+
+uint32_t power_gov_begin(power_gov_t *g, power_gov_work_t work, int64_t now_us) {
+    if (work >= POWER_GOV_WORK_COUNT) return 0;
+    bool was_busy = busy(g);
+    if (g->active[work]++ == 0) g->work_since[work] = now_us;
+    if (g->locked) {
+        if (!was_busy) g->stats.coalesced++;
+        return 0;
+    }
+    g->locked = true;
+    g->stats.locks++;
+    update_state(g, now_us);
+    return POWER_GOV_ACT_LOCK;
+}
+
+uint32_t power_gov_end(power_gov_t *g, power_gov_work_t work, int64_t now_us) {
+    if (work >= POWER_GOV_WORK_COUNT || g->active[work] == 0) return 0;
+    if (--g->active[work] == 0) g->stats.work_us[work] += (uint64_t)(now_us - g->work_since[work]);
+    if (busy(g)) return 0;
+    g->idle_since_us = now_us;
+    return power_gov_poll(g, now_us, NULL);
+}
+
+uint32_t power_gov_poll(power_gov_t *g, int64_t now_us, uint32_t *wait_us) {
+    uint32_t act = 0;
+    uint32_t wait = UINT32_MAX;
+    if (g->locked && !busy(g)) {
+        int64_t due = g->idle_since_us + g->profile[g->src].linger_us;
+        if (now_us >= due) {
+            g->locked = false;
+            update_state(g, now_us);
+            act = POWER_GOV_ACT_UNLOCK;
+        } else {
+            wait = (uint32_t)(due - now_us);
+        }
+    }
+    if (wait_us) *wait_us = wait;
+    return act;
+}
+
+const power_gov_profile_t *power_gov_profile(const power_gov_t *g) {
+    return &g->profile[g->src];
+}
+
+void power_gov_get_stats(const power_gov_t *g, int64_t now_us, power_gov_stats_t *out) {
+    *out = g->stats;
+    out->state_us[g->state] += (uint64_t)(now_us - g->state_since_us);
+    out->src_us[g->src] += (uint64_t)(now_us - g->src_since_us);
+    for (int w = 0; w < POWER_GOV_WORK_COUNT; w++) {
+        if (g->active[w]) out->work_us[w] += (uint64_t)(now_us - g->work_since[w]);
+    }
+    out->elapsed_us = (uint64_t)(now_us - g->start_us);
+    out->duty_permille = out->elapsed_us
+        ? (uint32_t)(out->state_us[POWER_GOV_STATE_BOOST] * 1000 / out->elapsed_us) : 0;
+}
+
+const char *power_gov_state_name(power_gov_state_t state) {
+    switch (state) {
+        case POWER_GOV_STATE_BOOST: return "boost";
+        case POWER_GOV_STATE_IDLE:  return "idle";
+        case POWER_GOV_STATE_SLEEP: return "sleep";
+        default:                    return "?";
+    }
+}
@@ -0,0 +1,139 @@
+#include "touch_filter.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ONE TOUCH_XFORM_ONE
+
+// Composite of the CST226SE swap/mirror stage and the LVGL-side fixups (verified 2026-01-04),
+// expressed directly on the native 450x600 sensor coordinates.
+static const touch_xform_t s_default_xform[4] = {
+    // 0: Landscape       x' = y,        y' = 449 - x
+    { .xx = 0,    .xy = ONE,  .yx = -ONE, .yy = 0,    .ox = 0,                         .oy = (TOUCH_NATIVE_W - 1) * ONE, .width = TOUCH_NATIVE_H, .height = TOUCH_NATIVE_W },
+    // 1: Portrait        x' = x,        y' = y
+    { .xx = ONE,  .xy = 0,    .yx = 0,    .yy = ONE,  .ox = 0,                         .oy = 0,                          .width = TOUCH_NATIVE_W, .height = TOUCH_NATIVE_H },
+    // 2: Landscape inv.  x' = 599 - y,  y' = x
+    { .xx = 0,    .xy = -ONE, .yx = ONE,  .yy = 0,    .ox = (TOUCH_NATIVE_H - 1) * ONE, .oy = 0,                          .width = TOUCH_NATIVE_H, .height = TOUCH_NATIVE_W },
+    // 3: Portrait inv.   x' = 449 - x,  y' = 599 - y
+    { .xx = -ONE, .xy = 0,    .yx = 0,    .yy = -ONE, .ox = (TOUCH_NATIVE_W - 1) * ONE, .oy = (TOUCH_NATIVE_H - 1) * ONE, .width = TOUCH_NATIVE_W, .height = TOUCH_NATIVE_H },
+};
+
+void touch_xform_default(int rotation, touch_xform_t *xform) {
+    *xform = s_default_xform[rotation & 3];
+}
+
+static int16_t clamp_axis(int32_t v, uint16_t limit) {
+    if (v < 0) return 0;
+    if (limit && v > limit - 1) return (int16_t)(limit - 1);
+    return (int16_t)v;
+}
+
+void touch_xform_apply(const touch_xform_t *t, uint16_t x, uint16_t y, int16_t *out_x, int16_t *out_y) {
+    int32_t fx = t->xx * x + t->xy * y + t->ox;
+    int32_t fy = t->yx * x + t->yy * y + t->oy;
+    *out_x = clamp_axis((fx + ONE / 2) >> 16, t->width);
+    *out_y = clamp_axis((fy + ONE / 2) >> 16, t->height);
+}
+
+void touch_filter_config_default(int rotation, touch_filter_config_t *cfg) {
+    memset(cfg, 0, sizeof(*cfg));
+    touch_xform_default(rotation, &cfg->xform);
+    cfg->jitter_px = 3;
+    cfg->min_cutoff_hz = 1.5f;
+    cfg->beta = 0.02f;
+    cfg->d_cutoff_hz = 4.0f;
+    cfg->predict_gain = 0.8f;
+    cfg->predict_min_speed = 60.0f;
+    cfg->predict_max_px = 40;
+}
+
+void touch_filter_init(touch_filter_t *f, const touch_filter_config_t *cfg) {
+    memset(f, 0, sizeof(*f));
+    f->cfg = *cfg;
+    f->latency_us = 30000;
+}
+
+void touch_filter_reset(touch_filter_t *f) {
+    f->active = false;
+    f->vx = 0.0f;
+    f->vy = 0.0f;
+}
+
+void touch_filter_set_latency(touch_filter_t *f, uint32_t latency_us) {
+    f->latency_us = latency_us;
+}
+
+// Smoothing factor of a first-order low-pass at `cutoff` for a step of `dt`
+static float lp_alpha(float cutoff_hz, float dt) {
+    float tau = 1.0f / (2.0f * 3.14159265f * cutoff_hz);
+    return 1.0f / (1.0f + tau / dt);
+}
+
+void touch_filter_update(touch_filter_t *f, int64_t t_us, int16_t x, int16_t y, int16_t *out_x, int16_t *out_y) {
+    const touch_filter_config_t *c = &f->cfg;
+
+    if (!f->active || t_us <= f->last_us) {
+        // First sample of a press (or a duplicate timestamp): no history to filter against
+        if (!f->active) {
+            f->x = x;
+            f->y = y;
+            f->anchor_x = x;
+            f->anchor_y = y;
+            f->vx = 0.0f;
+            f->vy = 0.0f;
+            f->active = true;
+        }
+        f->last_us = t_us;
+        *out_x = (int16_t)lrintf(f->x);
+        *out_y = (int16_t)lrintf(f->y);
+        return;
+    }
+
+    float dt = (float)(t_us - f->last_us) * 1e-6f;
+    if (dt > 0.1f) dt = 0.1f;   // a stalled sampler should not look like a slow drag
+    f->last_us = t_us;
+
+    // Deadband: sensor noise around a resting finger never reaches the filter.
+    // Once the finger is moving every sample passes, so slow scrolls do not stair-step.
+    float step = 0.0f;
+    bool moving = f->vx * f->vx + f->vy * f->vy >= c->predict_min_speed * c->predict_min_speed;
+    if (moving || abs(x - f->anchor_x) > c->jitter_px || abs(y - f->anchor_y) > c->jitter_px) {
+        step = hypotf((float)(x - f->anchor_x), (float)(y - f->anchor_y));
+        f->anchor_x = x;
+        f->anchor_y = y;
+    }
+    x = f->anchor_x;
+    y = f->anchor_y;
+
+    // Velocity from the raw step, smoothed
+    float a_d = lp_alpha(c->d_cutoff_hz, dt);
+    f->vx += a_d * (((float)x - f->x) / dt - f->vx);
+    f->vy += a_d * (((float)y - f->y) / dt - f->vy);
+    float speed = sqrtf(f->vx * f->vx + f->vy * f->vy);
+
+    // Position, with the cutoff rising with speed
+    float a = lp_alpha(c->min_cutoff_hz + c->beta * speed, dt);
+    f->x += a * ((float)x - f->x);
+    f->y += a * ((float)y - f->y);
+
+    float px = f->x;
+    float py = f->y;
+    if (c->predict_gain > 0.0f && speed >= c->predict_min_speed) {
+        // Scale back when this sample barely moved so a stopping finger is not overshot
+        float inst = step / dt;
+        float horizon = c->predict_gain * (float)f->latency_us * 1e-6f;
+        if (inst < speed) horizon *= inst / speed;
+        float ex = f->vx * horizon;
+        float ey = f->vy * horizon;
+        float dist = sqrtf(ex * ex + ey * ey);
+        if (dist > c->predict_max_px) {
+            ex *= c->predict_max_px / dist;
+            ey *= c->predict_max_px / dist;
+        }
+        px += ex;
+        py += ey;
+    }
+
+    *out_x = clamp_axis((int32_t)lrintf(px), c->xform.width);
+    *out_y = clamp_axis((int32_t)lrintf(py), c->xform.height);
+}
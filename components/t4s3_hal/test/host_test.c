@@ -0,0 +1,702 @@
+// Host-side test for the HAL's pure modules:
+//  - touch filter pipeline: checks the per-rotation fixed-point transform against the old
+//    two-stage mapping and scores the jitter filter and latency prediction on the traces
+//    in touch_traces.h
+//  - I2C scheduler: runs touch sampling and PMIC bursts over a simulated 400 kHz bus and
+//    checks touch latency, PMIC starvation bounds and utilization accounting
+//  - PMIC telemetry: checks windowed queries against a brute-force scan, round-trips the
+//    SD record stream, and benchmarks append/query cost and bytes per day
+//  - power governor: replays ten minutes of UI activity, checks the frequency lock stays
+//    balanced and coalesces back-to-back frames, and reports duty cycle and state times
+//
+// gcc -std=gnu11 -O2 -Wall -I components/t4s3_hal/include -o /tmp/t4s3_hal_host_test components/t4s3_hal/test/host_test.c components/t4s3_hal/src/touch_filter.c components/t4s3_hal/src/i2c_sched.c components/t4s3_hal/src/pmic_telem.c components/t4s3_hal/src/power_gov.c -lm
+// /tmp/t4s3_hal_host_test
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "i2c_sched.h"
+#include "pmic_telem.h"
+#include "power_gov.h"
+#include "touch_filter.h"
+#include "touch_traces.h"
+
+static int s_failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); s_failures++; } \
+} while (0)
+
+// Old mapping: cst226se_set_rotation() swap/clamp/mirror followed by lvgl_touch_read_cb() fixups
+static void legacy_map(int rot, int x, int y, int *ox, int *oy) {
+    static const struct { int swap, mx, my, xmax, ymax; } r[4] = {
+        {1, 0, 1, 599, 449}, {0, 1, 0, 449, 599}, {1, 1, 1, 599, 449}, {0, 0, 1, 449, 599},
+    };
+    int tx = x, ty = y;
+    if (r[rot].swap) { int t = tx; tx = ty; ty = t; }
+    if (tx > r[rot].xmax) tx = r[rot].xmax;
+    if (ty > r[rot].ymax) ty = r[rot].ymax;
+    if (r[rot].mx) tx = r[rot].xmax - tx;
+    if (r[rot].my) ty = r[rot].ymax - ty;
+
+    int disp_w = (rot & 1) ? 450 : 600;
+    int disp_h = (rot & 1) ? 600 : 450;
+    if ((rot == 1 || rot == 3) && tx < disp_w) tx = disp_w - 1 - tx;
+    if (rot == 2 && ty < disp_h) ty = disp_h - 1 - ty;
+    *ox = tx;
+    *oy = ty;
+}
+
+static void test_xform_matches_legacy(void) {
+    for (int rot = 0; rot < 4; rot++) {
+        touch_xform_t t;
+        touch_xform_default(rot, &t);
+        int mismatches = 0;
+        for (int x = 0; x < TOUCH_NATIVE_W; x++) {
+            for (int y = 0; y < TOUCH_NATIVE_H; y++) {
+                int lx, ly;
+                int16_t nx, ny;
+                legacy_map(rot, x, y, &lx, &ly);
+                touch_xform_apply(&t, x, y, &nx, &ny);
+                if (lx != nx || ly != ny) mismatches++;
+            }
+        }
+        CHECK(mismatches == 0);
+    }
+}
+
+typedef struct {
+    float raw_rms;          // stationary jitter
+    float out_rms;
+    float raw_err;          // mean distance to where the finger is when the frame is shown
+    float out_err;
+    float overshoot;        // furthest output beyond the stop point
+    int settle_ms;          // time after the stop until output stays within 2 px
+} score_t;
+
+// Run a trace through transform + filter for rotation `rot`; moving samples are scored
+// against the ideal path `latency_us` ahead (the sample-to-photon delay being hidden).
+static score_t run(const touch_trace_sample_t *tr, size_t n, int rot, uint32_t latency_us, bool predict) {
+    touch_filter_config_t cfg;
+    touch_filter_t f;
+    score_t s = {0};
+    touch_filter_config_default(rot, &cfg);
+    if (!predict) cfg.predict_gain = 0.0f;
+    touch_filter_init(&f, &cfg);
+    touch_filter_set_latency(&f, latency_us);
+
+    float mean_rx = 0, mean_ry = 0, mean_ox = 0, mean_oy = 0;
+    int16_t ox[512], oy[512], rx[512], ry[512];
+    int moving = 0;
+    for (size_t i = 0; i < n; i++) {
+        touch_xform_apply(&cfg.xform, tr[i].raw_x, tr[i].raw_y, &rx[i], &ry[i]);
+        touch_filter_update(&f, tr[i].t_us, rx[i], ry[i], &ox[i], &oy[i]);
+        mean_rx += rx[i]; mean_ry += ry[i]; mean_ox += ox[i]; mean_oy += oy[i];
+
+        // Ideal position at t + latency (interpolated along the trace)
+        int64_t t_show = tr[i].t_us + latency_us;
+        size_t j = i;
+        while (j + 1 < n && tr[j + 1].t_us <= t_show) j++;
+        int16_t ix, iy;
+        touch_xform_apply(&cfg.xform, (uint16_t)lrintf(tr[j].ideal_x), (uint16_t)lrintf(tr[j].ideal_y), &ix, &iy);
+        bool is_moving = i > 5 && j + 1 < n &&
+                         (tr[j].ideal_x != tr[i].ideal_x || tr[j].ideal_y != tr[i].ideal_y);
+        if (is_moving) {
+            s.raw_err += hypotf(rx[i] - ix, ry[i] - iy);
+            s.out_err += hypotf(ox[i] - ix, oy[i] - iy);
+            moving++;
+        }
+    }
+    if (moving) {
+        s.raw_err /= moving;
+        s.out_err /= moving;
+    }
+
+    mean_rx /= n; mean_ry /= n; mean_ox /= n; mean_oy /= n;
+    for (size_t i = 0; i < n; i++) {
+        s.raw_rms += (rx[i] - mean_rx) * (rx[i] - mean_rx) + (ry[i] - mean_ry) * (ry[i] - mean_ry);
+        s.out_rms += (ox[i] - mean_ox) * (ox[i] - mean_ox) + (oy[i] - mean_oy) * (oy[i] - mean_oy);
+    }
+    s.raw_rms = sqrtf(s.raw_rms / n);
+    s.out_rms = sqrtf(s.out_rms / n);
+
+    // Stop behaviour: distance from the final resting point after the ideal path stops
+    size_t stop = n - 1;
+    while (stop > 0 && tr[stop - 1].ideal_x == tr[n - 1].ideal_x && tr[stop - 1].ideal_y == tr[n - 1].ideal_y) stop--;
+    int16_t end_x, end_y;
+    touch_xform_apply(&cfg.xform, (uint16_t)tr[n - 1].ideal_x, (uint16_t)tr[n - 1].ideal_y, &end_x, &end_y);
+    s.settle_ms = -1;
+    for (size_t i = stop; i < n; i++) {
+        float d = hypotf(ox[i] - end_x, oy[i] - end_y);
+        if (d > s.overshoot) s.overshoot = d;
+    }
+    for (size_t i = n; i-- > stop;) {
+        if (hypotf(ox[i] - end_x, oy[i] - end_y) > 2.0f) {
+            s.settle_ms = (int)((tr[i].t_us - tr[stop].t_us) / 1000) + 10;
+            break;
+        }
+    }
+    if (s.settle_ms < 0) s.settle_ms = 0;
+    return s;
+}
+
+static void test_rest_jitter(void) {
+    for (int rot = 0; rot < 4; rot++) {
+        score_t s = run(trace_rest, TRACE_LEN(trace_rest), rot, 30000, true);
+        CHECK(s.out_rms < 0.5f * s.raw_rms);
+        if (rot == 0) printf("rest: jitter rms %.2f px -> %.2f px\n", s.raw_rms, s.out_rms);
+    }
+}
+
+static void test_drag_prediction(void) {
+    for (int rot = 0; rot < 4; rot++) {
+        score_t plain = run(trace_drag_stop, TRACE_LEN(trace_drag_stop), rot, 30000, false);
+        score_t pred = run(trace_drag_stop, TRACE_LEN(trace_drag_stop), rot, 30000, true);
+        // Prediction must beat both the raw feed and the smoothed-only feed
+        CHECK(pred.out_err < 0.5f * pred.raw_err);
+        CHECK(pred.out_err < plain.out_err);
+        // ...without flinging past the stop or ringing
+        CHECK(pred.overshoot <= 40.0f);
+        CHECK(pred.settle_ms <= 200);
+        if (rot == 0) {
+            printf("drag 800 px/s, 30 ms latency: lag %.1f px raw, %.1f px smoothed, %.1f px predicted; "
+                   "overshoot %.1f px, settle %d ms\n",
+                   pred.raw_err, plain.out_err, pred.out_err, pred.overshoot, pred.settle_ms);
+        }
+    }
+
+    score_t slow = run(trace_slow_scroll, TRACE_LEN(trace_slow_scroll), 1, 30000, true);
+    CHECK(slow.out_err < slow.raw_err);
+    CHECK(slow.settle_ms <= 200);
+    printf("scroll 250 px/s: lag %.1f px raw, %.1f px predicted, settle %d ms\n",
+           slow.raw_err, slow.out_err, slow.settle_ms);
+}
+
+static void test_reset_between_presses(void) {
+    touch_filter_config_t cfg;
+    touch_filter_t f;
+    int16_t x, y;
+    touch_filter_config_default(0, &cfg);
+    touch_filter_init(&f, &cfg);
+    touch_filter_update(&f, 0, 100, 100, &x, &y);
+    touch_filter_update(&f, 10000, 110, 100, &x, &y);
+    touch_filter_reset(&f);
+    // A new press far away must not be dragged from the old position
+    touch_filter_update(&f, 500000, 500, 400, &x, &y);
+    CHECK(x == 500 && y == 400);
+}
+
+// --- I2C scheduler on a simulated bus ---
+
+// Transfer times at 400 kHz (9 bits per byte plus start/stop and driver overhead)
+#define SIM_TOUCH_TXN_US    260     // 7-byte CST226SE frame read
+#define SIM_PMIC_TXN_US     115     // single SY6970 register read
+
+typedef struct {
+    uint32_t period_us;
+    uint32_t phase_us;
+    int txns;
+} sim_burst_src_t;
+
+typedef struct {
+    bool fifo;                  // baseline: first come first served, bursts run to completion
+    i2c_sched_config_t cfg;
+    int64_t press_us, lift_us;  // finger down interval
+    uint32_t touch_period_us;
+    uint32_t touch_txn_us;
+    int64_t duration_us;
+} sim_setup_t;
+
+typedef struct {
+    uint32_t touch_samples;
+    uint32_t touch_wait_max_us;
+    uint32_t touch_late;        // samples that waited at all
+    uint32_t bursts_issued;
+    uint32_t bursts_done;
+    uint32_t burst_latency_max_us;  // arrival -> last transaction done
+    i2c_sched_stats_t stats;
+} sim_result_t;
+
+// Status task every 250 ms (10 reads) and the UI stats timer every 500 ms (8 reads)
+static const sim_burst_src_t s_pmic_srcs[] = {
+    {250000, 0, 10},
+    {500000, 120000, 8},
+};
+
+#define SIM_MAX_BURSTS 64
+
+static sim_result_t sim_run(const sim_setup_t *su) {
+    sim_result_t r;
+    i2c_sched_t s;
+    memset(&r, 0, sizeof(r));
+    i2c_sched_init(&s, &su->cfg, 0);
+
+    int64_t burst_arrival[SIM_MAX_BURSTS];
+    int burst_txns[SIM_MAX_BURSTS];
+    int head = 0, tail = 0;
+    bool burst_running = false;     // head burst is being worked on (PMIC callers are serialized)
+    int64_t pmic_req_us = 0;
+
+    bool touch_pending = false;
+    int64_t touch_req_us = 0;
+    int64_t next_sample = su->press_us;
+
+    int bus_dev = I2C_SCHED_NONE;   // device with a transfer on the wire
+    int64_t bus_end = 0;
+    int fifo_owner = I2C_SCHED_NONE;
+
+    for (int64_t t = 0; t < su->duration_us || head != tail || bus_dev != I2C_SCHED_NONE; t++) {
+        if (t == su->press_us) i2c_sched_set_touch_active(&s, true, t);
+        if (t == su->lift_us) i2c_sched_set_touch_active(&s, false, t);
+
+        // Arrivals
+        if (t >= su->press_us && t < su->lift_us && t >= next_sample && !touch_pending) {
+            touch_pending = true;
+            touch_req_us = t;
+            next_sample += su->touch_period_us;
+            if (!su->fifo) i2c_sched_request(&s, I2C_SCHED_DEV_TOUCH, t);
+        }
+        for (size_t i = 0; t < su->duration_us && i < sizeof(s_pmic_srcs) / sizeof(s_pmic_srcs[0]); i++) {
+            if (t >= s_pmic_srcs[i].phase_us && (t - s_pmic_srcs[i].phase_us) % s_pmic_srcs[i].period_us == 0 &&
+                tail - head < SIM_MAX_BURSTS) {
+                burst_arrival[tail % SIM_MAX_BURSTS] = t;
+                burst_txns[tail % SIM_MAX_BURSTS] = s_pmic_srcs[i].txns;
+                tail++;
+                r.bursts_issued++;
+            }
+        }
+        if (head != tail && !burst_running) {
+            burst_running = true;
+            pmic_req_us = t;
+            if (!su->fifo) i2c_sched_request(&s, I2C_SCHED_DEV_PMIC, t);
+        }
+
+        // Transfer completion
+        if (bus_dev != I2C_SCHED_NONE && t >= bus_end) {
+            if (bus_dev == I2C_SCHED_DEV_TOUCH) {
+                touch_pending = false;
+                if (su->fifo) fifo_owner = I2C_SCHED_NONE;
+                else i2c_sched_release(&s, I2C_SCHED_DEV_TOUCH, t);
+            } else if (--burst_txns[head % SIM_MAX_BURSTS] == 0) {
+                uint32_t lat = (uint32_t)(t - burst_arrival[head % SIM_MAX_BURSTS]);
+                if (lat > r.burst_latency_max_us) r.burst_latency_max_us = lat;
+                r.bursts_done++;
+                head++;
+                burst_running = false;
+                if (su->fifo) fifo_owner = I2C_SCHED_NONE;
+                else i2c_sched_release(&s, I2C_SCHED_DEV_PMIC, t);
+            } else if (!su->fifo && i2c_sched_should_yield(&s, I2C_SCHED_DEV_PMIC, t)) {
+                i2c_sched_yield(&s, I2C_SCHED_DEV_PMIC, t);
+            }
+            bus_dev = I2C_SCHED_NONE;
+        }
+
+        // Deferred PMIC requests retry on their timeout (modelled as polling every tick)
+        if (!su->fifo && burst_running && s.waiting[I2C_SCHED_DEV_PMIC] &&
+            i2c_sched_wait_hint_us(&s, I2C_SCHED_DEV_PMIC, t) == 0) {
+            i2c_sched_request(&s, I2C_SCHED_DEV_PMIC, t);
+        }
+
+        // Start the next transfer for whoever owns the bus
+        if (su->fifo && fifo_owner == I2C_SCHED_NONE) {
+            // Oldest waiter wins
+            bool pmic_wait = burst_running;
+            if (touch_pending && (!pmic_wait || touch_req_us <= pmic_req_us)) fifo_owner = I2C_SCHED_DEV_TOUCH;
+            else if (pmic_wait) fifo_owner = I2C_SCHED_DEV_PMIC;
+        }
+        int owner = su->fifo ? fifo_owner : s.owner;
+        if (bus_dev == I2C_SCHED_NONE && owner == I2C_SCHED_DEV_TOUCH && touch_pending) {
+            uint32_t wait = (uint32_t)(t - touch_req_us);
+            if (wait > r.touch_wait_max_us) r.touch_wait_max_us = wait;
+            if (wait) r.touch_late++;
+            r.touch_samples++;
+            bus_dev = I2C_SCHED_DEV_TOUCH;
+            bus_end = t + su->touch_txn_us;
+        } else if (bus_dev == I2C_SCHED_NONE && owner == I2C_SCHED_DEV_PMIC && burst_running) {
+            bus_dev = I2C_SCHED_DEV_PMIC;
+            bus_end = t + SIM_PMIC_TXN_US;
+        }
+        if (t >= 20 * su->duration_us) break;   // livelock guard
+    }
+    i2c_sched_get_stats(&s, su->duration_us, &r.stats);
+    return r;
+}
+
+static sim_setup_t sim_default(void) {
+    sim_setup_t su = {0};
+    i2c_sched_config_default(&su.cfg);
+    su.press_us = 1000500;     // samples land inside PMIC bursts, not in step with them
+    su.lift_us = 3000000;
+    su.touch_period_us = 10000;
+    su.touch_txn_us = SIM_TOUCH_TXN_US;
+    su.duration_us = 4000000;
+    return su;
+}
+
+static void test_i2c_touch_priority(void) {
+    sim_setup_t su = sim_default();
+    sim_result_t sched = sim_run(&su);
+    su.fifo = true;
+    sim_result_t fifo = sim_run(&su);
+
+    // Touch never waits for more than the PMIC transfer already on the wire, and once
+    // the finger is down PMIC bursts stay out of its way (only the first sample of the
+    // press can land on a burst already under way)
+    CHECK(sched.touch_wait_max_us <= SIM_PMIC_TXN_US);
+    CHECK(sched.touch_late <= 1);
+    CHECK(fifo.touch_wait_max_us > 4 * SIM_PMIC_TXN_US);
+    CHECK(sched.touch_samples == fifo.touch_samples);
+
+    // Every PMIC burst still completes, within one touch period of its arrival
+    CHECK(sched.bursts_done == sched.bursts_issued);
+    CHECK(sched.burst_latency_max_us <= su.touch_period_us + 18 * SIM_PMIC_TXN_US);
+    CHECK(sched.stats.dev[I2C_SCHED_DEV_PMIC].deferrals > 0);
+
+    // Utilization: 200 touch reads + 16 status bursts + 8 UI bursts
+    uint64_t busy = 200ull * SIM_TOUCH_TXN_US + (16 * 10 + 8 * 8) * SIM_PMIC_TXN_US;
+    uint32_t expect = (uint32_t)(busy * 1000 / su.duration_us);
+    CHECK(sched.stats.util_permille + 1 >= expect && sched.stats.util_permille <= expect + 1);
+    CHECK(sched.stats.dev[I2C_SCHED_DEV_TOUCH].grants == 200);
+
+    printf("i2c: touch wait max %u us (%u late) vs %u us fifo (%u late); "
+           "pmic burst latency max %u us, %u deferrals; bus %u.%u%%\n",
+           (unsigned)sched.touch_wait_max_us, (unsigned)sched.touch_late,
+           (unsigned)fifo.touch_wait_max_us, (unsigned)fifo.touch_late,
+           (unsigned)sched.burst_latency_max_us, (unsigned)sched.stats.dev[I2C_SCHED_DEV_PMIC].deferrals,
+           (unsigned)(sched.stats.util_permille / 10), (unsigned)(sched.stats.util_permille % 10));
+}
+
+static void test_i2c_no_starvation(void) {
+    // Touch saturating the bus with no idle slot: every PMIC request must still be
+    // granted within max_defer, and every burst completes
+    sim_setup_t su = sim_default();
+    su.cfg.window_us = 0;
+    su.touch_period_us = 300;
+    sim_result_t r = sim_run(&su);
+    CHECK(r.bursts_done == r.bursts_issued);
+    CHECK(r.stats.dev[I2C_SCHED_DEV_PMIC].wait_max_us <= su.cfg.max_defer_us + su.touch_txn_us);
+    // ...and touch still only ever waits behind one PMIC transfer
+    CHECK(r.touch_wait_max_us <= SIM_PMIC_TXN_US);
+    printf("i2c saturated: pmic grant wait max %u us (max_defer %u us), touch wait max %u us\n",
+           (unsigned)r.stats.dev[I2C_SCHED_DEV_PMIC].wait_max_us, (unsigned)su.cfg.max_defer_us,
+           (unsigned)r.touch_wait_max_us);
+}
+
+// --- PMIC telemetry ---
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Plausible charger trace: battery creeping up while charging, a little ADC noise, USB
+// unplugged for a while every few hours
+static void telem_sample(uint32_t t, int16_t v[PMIC_TELEM_CH_COUNT]) {
+    bool usb = (t / 3600) % 5 != 4;
+    int noise = (int)((t * 2654435761u) >> 29) - 4;     // -4..3
+    v[PMIC_TELEM_VBAT] = (int16_t)(3700 + (t % 20000) / 40 + noise);
+    v[PMIC_TELEM_VBUS] = usb ? (int16_t)(5000 + noise * 25) : 0;
+    v[PMIC_TELEM_ICHG] = usb ? (int16_t)(800 - (t % 20000) / 40 + noise * 10) : 0;
+}
+
+typedef struct {
+    uint32_t t;
+    int16_t v[PMIC_TELEM_CH_COUNT];
+} telem_log_t;
+
+static void test_telem_queries(void) {
+    size_t size = pmic_telem_mem_size();
+    void *mem = malloc(size);
+    pmic_telem_t tm;
+    CHECK(pmic_telem_init(&tm, mem, size));
+
+    // 3 days of samples with gaps: 1 s while a view is open, every 10 s otherwise, and a
+    // two-hour hole (device off)
+    const uint32_t span = 3 * 86400;
+    telem_log_t *log = malloc(sizeof(telem_log_t) * span);
+    int n = 0;
+    for (uint32_t t = 1000; t < span; ) {
+        telem_sample(t, log[n].v);
+        log[n].t = t;
+        pmic_telem_append(&tm, t, log[n].v);
+        n++;
+        if (t > 100000 && t < 107200) t = 107200;
+        else t += ((t / 600) % 3 == 0) ? 1 : 10;
+    }
+    uint32_t last_t = log[n - 1].t;
+
+    srand(1);
+    int mismatches = 0;
+    for (int q = 0; q < 3000; q++) {
+        pmic_telem_res_t res = (pmic_telem_res_t)(q % PMIC_TELEM_RES_COUNT);
+        pmic_telem_ch_t ch = (pmic_telem_ch_t)((q / 3) % PMIC_TELEM_CH_COUNT);
+        uint32_t period = pmic_telem_period_s(res);
+        uint32_t retained = (uint32_t)tm.ring[res].capacity * period;
+        // Windows inside the retained history, including the open bucket
+        uint32_t oldest = (uint32_t)((tm.ring[res].closed - tm.ring[res].capacity + 1) * period);
+        uint32_t to = last_t - (uint32_t)(rand() % (retained / 2));
+        uint32_t from = to - (uint32_t)(rand() % (to - oldest));
+        pmic_telem_stats_t got;
+        bool any = pmic_telem_query(&tm, res, ch, from, to, &got);
+
+        // Brute force over the same buckets
+        int64_t lo = from / period, hi = to / period, sum = 0;
+        int16_t min = INT16_MAX, max = INT16_MIN;
+        uint32_t count = 0;
+        for (int i = 0; i < n; i++) {
+            int64_t idx = log[i].t / period;
+            if (idx < lo || idx > hi) continue;
+            int16_t v = log[i].v[ch];
+            if (v < min) min = v;
+            if (v > max) max = v;
+            sum += v;
+            count++;
+        }
+        bool ok = any == (count > 0) && got.count == count;
+        if (ok && count) ok = got.min == min && got.max == max && got.mean == (int32_t)(sum / count);
+        if (!ok) mismatches++;
+    }
+    CHECK(mismatches == 0);
+
+    // Windows beyond the retained history are clipped, empty windows report nothing
+    pmic_telem_stats_t st;
+    CHECK(pmic_telem_query(&tm, PMIC_TELEM_RES_1S, PMIC_TELEM_VBAT, 0, last_t, &st));
+    CHECK(st.count <= PMIC_TELEM_1S_BUCKETS);
+    CHECK(!pmic_telem_query(&tm, PMIC_TELEM_RES_1MIN, PMIC_TELEM_VBAT, 101000, 106000, &st));
+
+    // Single buckets for the chart
+    int64_t newest = pmic_telem_newest(&tm, PMIC_TELEM_RES_1MIN);
+    CHECK(pmic_telem_bucket(&tm, PMIC_TELEM_RES_1MIN, PMIC_TELEM_VBAT, newest, &st) && st.count > 0);
+    CHECK(!pmic_telem_bucket(&tm, PMIC_TELEM_RES_1MIN, PMIC_TELEM_VBAT, newest + 1, &st));
+    CHECK(!pmic_telem_bucket(&tm, PMIC_TELEM_RES_1MIN, PMIC_TELEM_VBAT, newest - PMIC_TELEM_1MIN_BUCKETS, &st));
+
+    free(log);
+    free(mem);
+}
+
+static void test_telem_benchmark(void) {
+    size_t size = pmic_telem_mem_size();
+    void *mem = malloc(size);
+    pmic_telem_t tm;
+    pmic_telem_init(&tm, mem, size);
+
+    // Append: one day of 1 s samples
+    int16_t v[PMIC_TELEM_CH_COUNT];
+    double t0 = now_ns();
+    for (uint32_t t = 0; t < 86400; t++) {
+        telem_sample(t, v);
+        pmic_telem_append(&tm, t, v);
+    }
+    double append_ns = (now_ns() - t0) / 86400;
+
+    // Query: windows from 2 buckets to the whole ring; cost must not grow with the window
+    double query_ns[2];
+    volatile int32_t sink = 0;
+    for (int w = 0; w < 2; w++) {
+        uint32_t width = w ? PMIC_TELEM_1S_BUCKETS - 1 : 2;
+        pmic_telem_stats_t st;
+        t0 = now_ns();
+        for (int i = 0; i < 200000; i++) {
+            uint32_t to = 86399 - (uint32_t)(i % 64);
+            pmic_telem_query(&tm, PMIC_TELEM_RES_1S, PMIC_TELEM_VBAT, to - width, to, &st);
+            sink += st.mean;
+        }
+        query_ns[w] = (now_ns() - t0) / 200000;
+    }
+    (void)sink;
+
+    // Bytes per day: header + one record per 1 min bucket
+    uint8_t buf[PMIC_TELEM_REC_MAX];
+    pmic_telem_codec_t enc, dec;
+    pmic_telem_codec_init(&enc, 0);
+    pmic_telem_codec_init(&dec, 0);
+    size_t bytes = PMIC_TELEM_HDR_SIZE;
+    int roundtrip_errors = 0;
+    for (int64_t idx = 0; idx <= pmic_telem_newest(&tm, PMIC_TELEM_RES_1MIN); idx++) {
+        pmic_telem_record_t rec = {.idx = idx}, back;
+        for (int c = 0; c < PMIC_TELEM_CH_COUNT; c++) {
+            pmic_telem_bucket(&tm, PMIC_TELEM_RES_1MIN, (pmic_telem_ch_t)c, idx, &rec.ch[c]);
+        }
+        size_t len = pmic_telem_encode(&enc, &rec, buf);
+        bytes += len;
+        if (pmic_telem_decode(&dec, buf, len, &back) != len || back.idx != idx) roundtrip_errors++;
+        for (int c = 0; c < PMIC_TELEM_CH_COUNT; c++) {
+            if (back.ch[c].min != rec.ch[c].min || back.ch[c].max != rec.ch[c].max ||
+                back.ch[c].mean != rec.ch[c].mean) roundtrip_errors++;
+        }
+    }
+    // Truncated input is rejected rather than misread
+    pmic_telem_record_t back;
+    CHECK(pmic_telem_decode(&dec, buf, 1, &back) == 0);
+
+    printf("telemetry: %zu KB ring memory, append %.0f ns/sample, query %.0f ns (2 s window) / "
+           "%.0f ns (%d s window), %zu bytes/day on SD (%.1f per minute)\n",
+           size / 1024, append_ns, query_ns[0], query_ns[1], PMIC_TELEM_1S_BUCKETS - 1, bytes,
+           (double)(bytes - PMIC_TELEM_HDR_SIZE) / 1440);
+    CHECK(roundtrip_errors == 0);
+    CHECK(query_ns[1] < query_ns[0] * 3 + 50);
+    CHECK(bytes < 1440 * 16);
+    free(mem);
+}
+
+// --- Power governor ---
+
+typedef struct {
+    int64_t t_us;
+    bool begin;
+    power_gov_work_t work;
+} gov_event_t;
+
+typedef struct {
+    gov_event_t ev[8192];
+    int n;
+} gov_trace_t;
+
+static void gov_work(gov_trace_t *tr, int64_t start_us, uint32_t dur_us, power_gov_work_t work) {
+    if (tr->n + 2 > (int)(sizeof(tr->ev) / sizeof(tr->ev[0]))) return;
+    tr->ev[tr->n++] = (gov_event_t){start_us, true, work};
+    tr->ev[tr->n++] = (gov_event_t){start_us + dur_us, false, work};
+}
+
+static int gov_event_cmp(const void *a, const void *b) {
+    const gov_event_t *x = a, *y = b;
+    if (x->t_us != y->t_us) return x->t_us < y->t_us ? -1 : 1;
+    return (int)x->begin - (int)y->begin;  // ends first at equal times
+}
+
+// One frame: render, with the first flush starting before rendering finishes
+static void gov_frame(gov_trace_t *tr, int64_t t_us, uint32_t render_us) {
+    gov_work(tr, t_us, render_us, POWER_GOV_WORK_RENDER);
+    gov_work(tr, t_us + render_us / 2, render_us, POWER_GOV_WORK_FLUSH);
+}
+
+// Replays the trace like the firmware does (linger expiry from a one-shot timer) and
+// checks the esp_pm lock the actions would drive never goes out of balance
+static void gov_replay(power_gov_t *g, gov_trace_t *tr, int64_t end_us, int *lock_errors) {
+    qsort(tr->ev, tr->n, sizeof(tr->ev[0]), gov_event_cmp);
+    bool held = false;
+    int64_t timer_due = INT64_MAX;
+    for (int i = 0; i <= tr->n; i++) {
+        int64_t t = i < tr->n ? tr->ev[i].t_us : end_us;
+        uint32_t act = 0, wait;
+        if (timer_due <= t) {
+            act = power_gov_poll(g, timer_due, &wait);
+            timer_due = wait == UINT32_MAX ? INT64_MAX : timer_due + wait;
+        }
+        if (i < tr->n) {
+            act |= tr->ev[i].begin ? power_gov_begin(g, tr->ev[i].work, t) : power_gov_end(g, tr->ev[i].work, t);
+            power_gov_poll(g, t, &wait);
+            if (wait != UINT32_MAX) timer_due = t + wait;
+        }
+        // A linger expiring and new work at the same step: release first, then re-acquire
+        if (act & POWER_GOV_ACT_UNLOCK) { if (!held) (*lock_errors)++; held = false; }
+        if (act & POWER_GOV_ACT_LOCK) { if (held) (*lock_errors)++; held = true; }
+    }
+    if (held) (*lock_errors)++;   // trace ends idle, the lock must be gone
+}
+
+// Ten minutes of the home screen: the status-bar clock every second, a 4 s touch
+// interaction (30 fps) every minute and one photo decode
+static void gov_ui_trace(gov_trace_t *tr, int64_t base_us) {
+    tr->n = 0;
+    for (int s = 0; s < 600; s++) {
+        int64_t t = base_us + (int64_t)s * 1000000;
+        gov_frame(tr, t, 3000);
+        if (s % 60 == 10) {
+            for (int f = 1; f < 120; f++) gov_frame(tr, t + f * 33333, 8000);
+        }
+        if (s == 300) {
+            gov_work(tr, t + 500000, 150000, POWER_GOV_WORK_DECODE);
+            gov_frame(tr, t + 650000, 20000);
+        }
+    }
+}
+
+static void test_power_governor(void) {
+    static gov_trace_t tr;
+    power_gov_t g;
+    power_gov_stats_t st;
+    int lock_errors = 0;
+    const int64_t t0 = 1000000;
+    const int64_t span = 600LL * 1000000;
+
+    power_gov_init(&g, POWER_GOV_SRC_BATTERY, t0);
+    gov_ui_trace(&tr, t0);
+    int works = tr.n / 2;
+    gov_replay(&g, &tr, t0 + span, &lock_errors);
+    power_gov_get_stats(&g, t0 + span, &st);
+    CHECK(lock_errors == 0);
+    CHECK(st.elapsed_us == (uint64_t)span);
+    CHECK(st.state_us[POWER_GOV_STATE_BOOST] + st.state_us[POWER_GOV_STATE_IDLE] +
+          st.state_us[POWER_GOV_STATE_SLEEP] == st.elapsed_us);
+    CHECK(st.state_us[POWER_GOV_STATE_IDLE] == 0);                  // battery: idle time may sleep
+    CHECK(st.work_us[POWER_GOV_WORK_DECODE] == 150000);
+    // One lock per clock tick and per interaction, not per frame
+    CHECK(st.locks <= 600 + 10 + 1);
+    CHECK(st.coalesced >= 10 * 118);
+    CHECK(st.duty_permille < 150);
+
+    // Rough CPU current model (display and radios excluded): 240 MHz awake ~40 mA,
+    // 160 MHz ~30 mA, 40 MHz ~10 mA, light sleep ~2 mA
+    double boost_s = st.state_us[POWER_GOV_STATE_BOOST] / 1e6;
+    double sleep_s = st.state_us[POWER_GOV_STATE_SLEEP] / 1e6;
+    double gov_ma = (boost_s * 30 + sleep_s * 2) / (span / 1e6);
+    printf("power governor (battery): duty %u.%u%%, boost %.1f s, sleep %.1f s, %u locks for %d work items "
+           "(%u coalesced), ~%.1f mA vs ~40 mA at a fixed 240 MHz\n",
+           (unsigned)(st.duty_permille / 10), (unsigned)(st.duty_permille % 10), boost_s, sleep_s,
+           (unsigned)st.locks, works, (unsigned)st.coalesced, gov_ma);
+
+    // Plugging in USB switches profile: no light sleep, longer linger
+    power_gov_init(&g, POWER_GOV_SRC_BATTERY, t0);
+    CHECK(power_gov_set_source(&g, POWER_GOV_SRC_USB, t0) == POWER_GOV_ACT_CONFIGURE);
+    CHECK(power_gov_set_source(&g, POWER_GOV_SRC_USB, t0) == 0);
+    CHECK(power_gov_profile(&g)->max_mhz == POWER_GOV_USB_MAX_MHZ);
+    CHECK(!power_gov_profile(&g)->light_sleep);
+    lock_errors = 0;
+    gov_ui_trace(&tr, t0);
+    gov_replay(&g, &tr, t0 + span, &lock_errors);
+    power_gov_get_stats(&g, t0 + span, &st);
+    CHECK(lock_errors == 0);
+    CHECK(st.state_us[POWER_GOV_STATE_SLEEP] == 0);
+    CHECK(st.src_us[POWER_GOV_SRC_USB] == (uint64_t)span);
+    printf("power governor (USB): duty %u.%u%%, boost %.1f s, idle %.1f s, %u locks\n",
+           (unsigned)(st.duty_permille / 10), (unsigned)(st.duty_permille % 10),
+           st.state_us[POWER_GOV_STATE_BOOST] / 1e6, st.state_us[POWER_GOV_STATE_IDLE] / 1e6,
+           (unsigned)st.locks);
+
+    // Linger: work that resumes inside the window reuses the lock, after it the lock goes
+    uint32_t wait;
+    power_gov_init(&g, POWER_GOV_SRC_BATTERY, 0);
+    CHECK(power_gov_begin(&g, POWER_GOV_WORK_RENDER, 0) == POWER_GOV_ACT_LOCK);
+    CHECK(power_gov_begin(&g, POWER_GOV_WORK_FLUSH, 100) == 0);
+    CHECK(power_gov_end(&g, POWER_GOV_WORK_RENDER, 1000) == 0);
+    CHECK(power_gov_end(&g, POWER_GOV_WORK_FLUSH, 2000) == 0);
+    CHECK(power_gov_poll(&g, 2000, &wait) == 0 && wait == POWER_GOV_BATT_LINGER_MS * 1000);
+    CHECK(power_gov_begin(&g, POWER_GOV_WORK_DECODE, 10000) == 0);
+    CHECK(power_gov_end(&g, POWER_GOV_WORK_DECODE, 11000) == 0);
+    CHECK(power_gov_poll(&g, 11000 + POWER_GOV_BATT_LINGER_MS * 1000, &wait) == POWER_GOV_ACT_UNLOCK);
+    CHECK(wait == UINT32_MAX);
+    CHECK(power_gov_end(&g, POWER_GOV_WORK_DECODE, 40000) == 0);  // unbalanced end is ignored
+}
+
+int main(void) {
+    test_xform_matches_legacy();
+    test_rest_jitter();
+    test_drag_prediction();
+    test_reset_between_presses();
+    test_i2c_touch_priority();
+    test_i2c_no_starvation();
+    test_telem_queries();
+    test_telem_benchmark();
+    test_power_governor();
+
+    if (s_failures) {
+        printf("%d check(s) failed\n", s_failures);
+        return 1;
+    }
+    printf("t4s3_hal host tests passed\n");
+    return 0;
+}
@@ -0,0 +1,431 @@
+// Touch traces for the touch filter host test, in raw CST226SE sensor coordinates.
+// Sampled at the HAL's 10 ms pressed-poll period with +-1 ms scheduling jitter and
+// +-2 px sensor noise. ideal_x/ideal_y is the noise-free finger path used for scoring.
+
+#pragma once
+#include <stdint.h>
+
+typedef struct {
+    int64_t t_us;
+    int16_t raw_x;
+    int16_t raw_y;
+    float ideal_x;
+    float ideal_y;
+} touch_trace_sample_t;
+
+#define TRACE_LEN(t) (sizeof(t) / sizeof((t)[0]))
+
+// Finger resting for 1.5 s at raw (200,300)
+static const touch_trace_sample_t trace_rest[] = {
+    {      0, 201, 299,  200.00f,  300.00f},
+    {  10000, 202, 302,  200.00f,  300.00f},
+    {  20000, 199, 301,  200.00f,  300.00f},
+    {  30000, 200, 300,  200.00f,  300.00f},
+    {  39000, 198, 299,  200.00f,  300.00f},
+    {  50000, 200, 300,  200.00f,  300.00f},
+    {  59000, 201, 300,  200.00f,  300.00f},
+    {  70000, 200, 301,  200.00f,  300.00f},
+    {  80000, 200, 300,  200.00f,  300.00f},
+    {  91000, 202, 301,  200.00f,  300.00f},
+    { 101000, 201, 300,  200.00f,  300.00f},
+    { 111000, 200, 301,  200.00f,  300.00f},
+    { 121000, 200, 301,  200.00f,  300.00f},
+    { 131000, 200, 300,  200.00f,  300.00f},
+    { 142000, 200, 302,  200.00f,  300.00f},
+    { 151000, 200, 299,  200.00f,  300.00f},
+    { 161000, 199, 300,  200.00f,  300.00f},
+    { 170000, 201, 300,  200.00f,  300.00f},
+    { 180000, 200, 300,  200.00f,  300.00f},
+    { 191000, 200, 302,  200.00f,  300.00f},
+    { 201000, 200, 300,  200.00f,  300.00f},
+    { 211000, 198, 298,  200.00f,  300.00f},
+    { 222000, 200, 301,  200.00f,  300.00f},
+    { 232000, 200, 299,  200.00f,  300.00f},
+    { 242000, 198, 298,  200.00f,  300.00f},
+    { 251000, 200, 299,  200.00f,  300.00f},
+    { 260000, 201, 298,  200.00f,  300.00f},
+    { 269000, 201, 298,  200.00f,  300.00f},
+    { 279000, 199, 301,  200.00f,  300.00f},
+    { 289000, 200, 299,  200.00f,  300.00f},
+    { 298000, 200, 300,  200.00f,  300.00f},
+    { 309000, 198, 299,  200.00f,  300.00f},
+    { 319000, 199, 299,  200.00f,  300.00f},
+    { 328000, 200, 300,  200.00f,  300.00f},
+    { 338000, 200, 301,  200.00f,  300.00f},
+    { 348000, 200, 300,  200.00f,  300.00f},
+    { 357000, 202, 299,  200.00f,  300.00f},
+    { 367000, 200, 300,  200.00f,  300.00f},
+    { 378000, 198, 300,  200.00f,  300.00f},
+    { 389000, 200, 302,  200.00f,  300.00f},
+    { 399000, 200, 300,  200.00f,  300.00f},
+    { 408000, 200, 298,  200.00f,  300.00f},
+    { 419000, 200, 301,  200.00f,  300.00f},
+    { 428000, 200, 300,  200.00f,  300.00f},
+    { 438000, 199, 299,  200.00f,  300.00f},
+    { 448000, 202, 301,  200.00f,  300.00f},
+    { 459000, 201, 299,  200.00f,  300.00f},
+    { 469000, 200, 301,  200.00f,  300.00f},
+    { 478000, 201, 300,  200.00f,  300.00f},
+    { 488000, 201, 299,  200.00f,  300.00f},
+    { 498000, 199, 299,  200.00f,  300.00f},
+    { 507000, 201, 298,  200.00f,  300.00f},
+    { 518000, 200, 298,  200.00f,  300.00f},
+    { 527000, 200, 300,  200.00f,  300.00f},
+    { 537000, 200, 299,  200.00f,  300.00f},
+    { 547000, 202, 299,  200.00f,  300.00f},
+    { 557000, 199, 300,  200.00f,  300.00f},
+    { 567000, 200, 298,  200.00f,  300.00f},
+    { 577000, 200, 300,  200.00f,  300.00f},
+    { 587000, 200, 300,  200.00f,  300.00f},
+    { 597000, 200, 301,  200.00f,  300.00f},
+    { 607000, 200, 300,  200.00f,  300.00f},
+    { 618000, 200, 300,  200.00f,  300.00f},
+    { 627000, 199, 302,  200.00f,  300.00f},
+    { 636000, 200, 299,  200.00f,  300.00f},
+    { 645000, 200, 300,  200.00f,  300.00f},
+    { 655000, 198, 300,  200.00f,  300.00f},
+    { 665000, 200, 299,  200.00f,  300.00f},
+    { 675000, 199, 300,  200.00f,  300.00f},
+    { 686000, 200, 299,  200.00f,  300.00f},
+    { 696000, 200, 299,  200.00f,  300.00f},
+    { 706000, 199, 301,  200.00f,  300.00f},
+    { 716000, 201, 298,  200.00f,  300.00f},
+    { 727000, 200, 300,  200.00f,  300.00f},
+    { 737000, 200, 300,  200.00f,  300.00f},
+    { 747000, 200, 301,  200.00f,  300.00f},
+    { 758000, 201, 301,  200.00f,  300.00f},
+    { 767000, 200, 300,  200.00f,  300.00f},
+    { 778000, 200, 300,  200.00f,  300.00f},
+    { 788000, 201, 301,  200.00f,  300.00f},
+    { 798000, 200, 301,  200.00f,  300.00f},
+    { 808000, 200, 300,  200.00f,  300.00f},
+    { 818000, 200, 300,  200.00f,  300.00f},
+    { 829000, 200, 298,  200.00f,  300.00f},
+    { 838000, 200, 299,  200.00f,  300.00f},
+    { 847000, 200, 302,  200.00f,  300.00f},
+    { 857000, 200, 302,  200.00f,  300.00f},
+    { 867000, 199, 300,  200.00f,  300.00f},
+    { 876000, 198, 299,  200.00f,  300.00f},
+    { 886000, 199, 299,  200.00f,  300.00f},
+    { 897000, 200, 299,  200.00f,  300.00f},
+    { 908000, 199, 299,  200.00f,  300.00f},
+    { 918000, 199, 298,  200.00f,  300.00f},
+    { 927000, 201, 300,  200.00f,  300.00f},
+    { 937000, 200, 298,  200.00f,  300.00f},
+    { 946000, 201, 300,  200.00f,  300.00f},
+    { 957000, 200, 302,  200.00f,  300.00f},
+    { 967000, 200, 299,  200.00f,  300.00f},
+    { 977000, 200, 298,  200.00f,  300.00f},
+    { 986000, 200, 300,  200.00f,  300.00f},
+    { 995000, 198, 302,  200.00f,  300.00f},
+    {1005000, 201, 301,  200.00f,  300.00f},
+    {1015000, 201, 300,  200.00f,  300.00f},
+    {1025000, 200, 300,  200.00f,  300.00f},
+    {1035000, 200, 300,  200.00f,  300.00f},
+    {1045000, 202, 300,  200.00f,  300.00f},
+    {1055000, 198, 300,  200.00f,  300.00f},
+    {1065000, 200, 300,  200.00f,  300.00f},
+    {1074000, 200, 302,  200.00f,  300.00f},
+    {1083000, 200, 301,  200.00f,  300.00f},
+    {1094000, 202, 302,  200.00f,  300.00f},
+    {1104000, 199, 300,  200.00f,  300.00f},
+    {1114000, 199, 300,  200.00f,  300.00f},
+    {1124000, 198, 300,  200.00f,  300.00f},
+    {1135000, 201, 301,  200.00f,  300.00f},
+    {1144000, 200, 299,  200.00f,  300.00f},
+    {1154000, 200, 299,  200.00f,  300.00f},
+    {1164000, 198, 300,  200.00f,  300.00f},
+    {1175000, 200, 302,  200.00f,  300.00f},
+    {1184000, 198, 302,  200.00f,  300.00f},
+    {1194000, 201, 300,  200.00f,  300.00f},
+    {1204000, 200, 299,  200.00f,  300.00f},
+    {1213000, 200, 300,  200.00f,  300.00f},
+    {1223000, 198, 299,  200.00f,  300.00f},
+    {1233000, 202, 300,  200.00f,  300.00f},
+    {1243000, 200, 299,  200.00f,  300.00f},
+    {1253000, 200, 301,  200.00f,  300.00f},
+    {1263000, 200, 299,  200.00f,  300.00f},
+    {1274000, 199, 298,  200.00f,  300.00f},
+    {1284000, 200, 300,  200.00f,  300.00f},
+    {1295000, 202, 301,  200.00f,  300.00f},
+    {1305000, 200, 300,  200.00f,  300.00f},
+    {1315000, 199, 300,  200.00f,  300.00f},
+    {1325000, 198, 300,  200.00f,  300.00f},
+    {1335000, 201, 298,  200.00f,  300.00f},
+    {1345000, 200, 300,  200.00f,  300.00f},
+    {1354000, 198, 300,  200.00f,  300.00f},
+    {1364000, 198, 300,  200.00f,  300.00f},
+    {1374000, 199, 298,  200.00f,  300.00f},
+    {1385000, 200, 300,  200.00f,  300.00f},
+    {1395000, 198, 299,  200.00f,  300.00f},
+    {1405000, 200, 301,  200.00f,  300.00f},
+    {1416000, 200, 300,  200.00f,  300.00f},
+    {1426000, 201, 300,  200.00f,  300.00f},
+    {1437000, 198, 299,  200.00f,  300.00f},
+    {1446000, 200, 301,  200.00f,  300.00f},
+    {1456000, 201, 301,  200.00f,  300.00f},
+    {1466000, 198, 300,  200.00f,  300.00f},
+    {1475000, 200, 299,  200.00f,  300.00f},
+    {1486000, 200, 298,  200.00f,  300.00f},
+    {1497000, 200, 300,  200.00f,  300.00f},
+};
+
+// Landscape drag along raw Y at 800 px/s (display X), stopping at raw Y=500 and holding
+static const touch_trace_sample_t trace_drag_stop[] = {
+    {      0, 226, 102,  225.00f,  100.00f},
+    {  10000, 224, 109,  225.00f,  108.00f},
+    {  20000, 223, 116,  225.00f,  116.00f},
+    {  29000, 225, 122,  225.00f,  123.20f},
+    {  38000, 224, 130,  225.00f,  130.40f},
+    {  49000, 225, 138,  225.00f,  139.20f},
+    {  58000, 224, 146,  225.00f,  146.40f},
+    {  68000, 225, 152,  225.00f,  154.40f},
+    {  78000, 224, 162,  225.00f,  162.40f},
+    {  88000, 223, 172,  225.00f,  170.40f},
+    {  97000, 225, 179,  225.00f,  177.60f},
+    { 106000, 223, 186,  225.00f,  184.80f},
+    { 116000, 225, 193,  225.00f,  192.80f},
+    { 125000, 224, 200,  225.00f,  200.00f},
+    { 135000, 225, 208,  225.00f,  208.00f},
+    { 146000, 224, 218,  225.00f,  216.80f},
+    { 157000, 227, 227,  225.00f,  225.60f},
+    { 167000, 223, 233,  225.00f,  233.60f},
+    { 178000, 224, 242,  225.00f,  242.40f},
+    { 188000, 225, 251,  225.00f,  250.40f},
+    { 198000, 224, 259,  225.00f,  258.40f},
+    { 207000, 226, 264,  225.00f,  265.60f},
+    { 217000, 225, 272,  225.00f,  273.60f},
+    { 226000, 227, 281,  225.00f,  280.80f},
+    { 236000, 227, 289,  225.00f,  288.80f},
+    { 247000, 225, 298,  225.00f,  297.60f},
+    { 256000, 226, 305,  225.00f,  304.80f},
+    { 265000, 223, 312,  225.00f,  312.00f},
+    { 276000, 225, 321,  225.00f,  320.80f},
+    { 285000, 225, 328,  225.00f,  328.00f},
+    { 295000, 225, 336,  225.00f,  336.00f},
+    { 304000, 226, 344,  225.00f,  343.20f},
+    { 314000, 227, 351,  225.00f,  351.20f},
+    { 325000, 223, 361,  225.00f,  360.00f},
+    { 335000, 226, 370,  225.00f,  368.00f},
+    { 345000, 225, 377,  225.00f,  376.00f},
+    { 355000, 224, 385,  225.00f,  384.00f},
+    { 365000, 227, 392,  225.00f,  392.00f},
+    { 375000, 227, 400,  225.00f,  400.00f},
+    { 384000, 225, 407,  225.00f,  407.20f},
+    { 394000, 223, 415,  225.00f,  415.20f},
+    { 403000, 224, 421,  225.00f,  422.40f},
+    { 413000, 223, 429,  225.00f,  430.40f},
+    { 424000, 224, 439,  225.00f,  439.20f},
+    { 434000, 225, 448,  225.00f,  447.20f},
+    { 444000, 226, 455,  225.00f,  455.20f},
+    { 453000, 227, 463,  225.00f,  462.40f},
+    { 462000, 225, 470,  225.00f,  469.60f},
+    { 472000, 225, 480,  225.00f,  477.60f},
+    { 482000, 225, 486,  225.00f,  485.60f},
+    { 492000, 225, 496,  225.00f,  493.60f},
+    { 502000, 224, 500,  225.00f,  500.00f},
+    { 512000, 225, 500,  225.00f,  500.00f},
+    { 522000, 225, 501,  225.00f,  500.00f},
+    { 531000, 223, 501,  225.00f,  500.00f},
+    { 541000, 224, 500,  225.00f,  500.00f},
+    { 552000, 226, 502,  225.00f,  500.00f},
+    { 561000, 227, 500,  225.00f,  500.00f},
+    { 570000, 223, 500,  225.00f,  500.00f},
+    { 579000, 223, 500,  225.00f,  500.00f},
+    { 589000, 223, 498,  225.00f,  500.00f},
+    { 600000, 226, 502,  225.00f,  500.00f},
+    { 609000, 225, 500,  225.00f,  500.00f},
+    { 620000, 225, 498,  225.00f,  500.00f},
+    { 630000, 225, 500,  225.00f,  500.00f},
+    { 640000, 224, 500,  225.00f,  500.00f},
+    { 649000, 225, 500,  225.00f,  500.00f},
+    { 660000, 225, 501,  225.00f,  500.00f},
+    { 670000, 225, 499,  225.00f,  500.00f},
+    { 681000, 225, 502,  225.00f,  500.00f},
+    { 691000, 225, 500,  225.00f,  500.00f},
+    { 700000, 226, 500,  225.00f,  500.00f},
+    { 710000, 226, 500,  225.00f,  500.00f},
+    { 720000, 225, 500,  225.00f,  500.00f},
+    { 731000, 225, 500,  225.00f,  500.00f},
+    { 741000, 225, 501,  225.00f,  500.00f},
+    { 751000, 225, 500,  225.00f,  500.00f},
+    { 761000, 225, 499,  225.00f,  500.00f},
+    { 771000, 224, 500,  225.00f,  500.00f},
+    { 782000, 226, 499,  225.00f,  500.00f},
+    { 792000, 226, 500,  225.00f,  500.00f},
+    { 802000, 224, 499,  225.00f,  500.00f},
+    { 811000, 225, 500,  225.00f,  500.00f},
+    { 821000, 225, 498,  225.00f,  500.00f},
+    { 832000, 225, 499,  225.00f,  500.00f},
+    { 842000, 225, 500,  225.00f,  500.00f},
+    { 853000, 226, 500,  225.00f,  500.00f},
+    { 864000, 225, 498,  225.00f,  500.00f},
+    { 874000, 224, 500,  225.00f,  500.00f},
+    { 885000, 227, 499,  225.00f,  500.00f},
+    { 894000, 225, 498,  225.00f,  500.00f},
+};
+
+// Slow portrait scroll along raw Y at -250 px/s, stopping at 200
+static const touch_trace_sample_t trace_slow_scroll[] = {
+    {      0, 220, 500,  220.00f,  500.00f},
+    {   9000, 218, 498,  220.00f,  497.75f},
+    {  20000, 221, 495,  220.00f,  495.00f},
+    {  31000, 222, 491,  220.00f,  492.25f},
+    {  42000, 222, 491,  220.00f,  489.50f},
+    {  53000, 219, 487,  220.00f,  486.75f},
+    {  62000, 220, 485,  220.00f,  484.50f},
+    {  71000, 220, 483,  220.00f,  482.25f},
+    {  81000, 219, 480,  220.00f,  479.75f},
+    {  92000, 221, 479,  220.00f,  477.00f},
+    { 103000, 221, 474,  220.00f,  474.25f},
+    { 113000, 220, 472,  220.00f,  471.75f},
+    { 122000, 221, 470,  220.00f,  469.50f},
+    { 133000, 218, 467,  220.00f,  466.75f},
+    { 142000, 219, 464,  220.00f,  464.50f},
+    { 153000, 222, 460,  220.00f,  461.75f},
+    { 162000, 219, 462,  220.00f,  459.50f},
+    { 172000, 220, 457,  220.00f,  457.00f},
+    { 181000, 218, 453,  220.00f,  454.75f},
+    { 191000, 219, 453,  220.00f,  452.25f},
+    { 201000, 220, 448,  220.00f,  449.75f},
+    { 211000, 221, 447,  220.00f,  447.25f},
+    { 220000, 218, 445,  220.00f,  445.00f},
+    { 229000, 219, 442,  220.00f,  442.75f},
+    { 239000, 219, 439,  220.00f,  440.25f},
+    { 248000, 222, 439,  220.00f,  438.00f},
+    { 258000, 221, 438,  220.00f,  435.50f},
+    { 269000, 220, 432,  220.00f,  432.75f},
+    { 279000, 220, 429,  220.00f,  430.25f},
+    { 288000, 220, 428,  220.00f,  428.00f},
+    { 299000, 221, 425,  220.00f,  425.25f},
+    { 309000, 221, 423,  220.00f,  422.75f},
+    { 318000, 221, 421,  220.00f,  420.50f},
+    { 327000, 219, 419,  220.00f,  418.25f},
+    { 337000, 220, 416,  220.00f,  415.75f},
+    { 347000, 220, 413,  220.00f,  413.25f},
+    { 356000, 219, 411,  220.00f,  411.00f},
+    { 365000, 219, 408,  220.00f,  408.75f},
+    { 376000, 221, 404,  220.00f,  406.00f},
+    { 386000, 220, 403,  220.00f,  403.50f},
+    { 396000, 222, 400,  220.00f,  401.00f},
+    { 407000, 219, 399,  220.00f,  398.25f},
+    { 418000, 220, 395,  220.00f,  395.50f},
+    { 428000, 221, 391,  220.00f,  393.00f},
+    { 439000, 220, 391,  220.00f,  390.25f},
+    { 450000, 219, 388,  220.00f,  387.50f},
+    { 461000, 221, 386,  220.00f,  384.75f},
+    { 470000, 220, 383,  220.00f,  382.50f},
+    { 480000, 218, 380,  220.00f,  380.00f},
+    { 490000, 218, 378,  220.00f,  377.50f},
+    { 501000, 218, 375,  220.00f,  374.75f},
+    { 511000, 220, 373,  220.00f,  372.25f},
+    { 520000, 221, 369,  220.00f,  370.00f},
+    { 530000, 220, 366,  220.00f,  367.50f},
+    { 540000, 220, 365,  220.00f,  365.00f},
+    { 551000, 220, 360,  220.00f,  362.25f},
+    { 560000, 219, 360,  220.00f,  360.00f},
+    { 570000, 220, 358,  220.00f,  357.50f},
+    { 580000, 221, 355,  220.00f,  355.00f},
+    { 591000, 219, 353,  220.00f,  352.25f},
+    { 600000, 218, 351,  220.00f,  350.00f},
+    { 611000, 220, 348,  220.00f,  347.25f},
+    { 621000, 222, 347,  220.00f,  344.75f},
+    { 631000, 222, 340,  220.00f,  342.25f},
+    { 642000, 221, 340,  220.00f,  339.50f},
+    { 651000, 219, 336,  220.00f,  337.25f},
+    { 661000, 220, 335,  220.00f,  334.75f},
+    { 671000, 220, 334,  220.00f,  332.25f},
+    { 680000, 220, 332,  220.00f,  330.00f},
+    { 689000, 221, 330,  220.00f,  327.75f},
+    { 699000, 221, 324,  220.00f,  325.25f},
+    { 709000, 219, 322,  220.00f,  322.75f},
+    { 718000, 219, 320,  220.00f,  320.50f},
+    { 728000, 221, 318,  220.00f,  318.00f},
+    { 737000, 220, 314,  220.00f,  315.75f},
+    { 746000, 221, 314,  220.00f,  313.50f},
+    { 757000, 220, 311,  220.00f,  310.75f},
+    { 767000, 220, 309,  220.00f,  308.25f},
+    { 777000, 219, 305,  220.00f,  305.75f},
+    { 787000, 219, 303,  220.00f,  303.25f},
+    { 798000, 222, 299,  220.00f,  300.50f},
+    { 808000, 221, 297,  220.00f,  298.00f},
+    { 818000, 220, 296,  220.00f,  295.50f},
+    { 827000, 220, 294,  220.00f,  293.25f},
+    { 836000, 219, 292,  220.00f,  291.00f},
+    { 846000, 221, 288,  220.00f,  288.50f},
+    { 856000, 220, 285,  220.00f,  286.00f},
+    { 865000, 220, 283,  220.00f,  283.75f},
+    { 874000, 221, 282,  220.00f,  281.50f},
+    { 884000, 220, 278,  220.00f,  279.00f},
+    { 895000, 222, 276,  220.00f,  276.25f},
+    { 905000, 221, 274,  220.00f,  273.75f},
+    { 915000, 220, 271,  220.00f,  271.25f},
+    { 926000, 220, 268,  220.00f,  268.50f},
+    { 937000, 221, 267,  220.00f,  265.75f},
+    { 947000, 220, 265,  220.00f,  263.25f},
+    { 957000, 220, 262,  220.00f,  260.75f},
+    { 967000, 220, 258,  220.00f,  258.25f},
+    { 976000, 221, 257,  220.00f,  256.00f},
+    { 986000, 220, 254,  220.00f,  253.50f},
+    { 996000, 219, 251,  220.00f,  251.00f},
+    {1006000, 220, 247,  220.00f,  248.50f},
+    {1016000, 220, 244,  220.00f,  246.00f},
+    {1025000, 219, 245,  220.00f,  243.75f},
+    {1035000, 220, 242,  220.00f,  241.25f},
+    {1045000, 222, 239,  220.00f,  238.75f},
+    {1055000, 222, 237,  220.00f,  236.25f},
+    {1066000, 218, 234,  220.00f,  233.50f},
+    {1076000, 220, 230,  220.00f,  231.00f},
+    {1087000, 221, 227,  220.00f,  228.25f},
+    {1098000, 221, 228,  220.00f,  225.50f},
+    {1108000, 220, 223,  220.00f,  223.00f},
+    {1119000, 218, 221,  220.00f,  220.25f},
+    {1128000, 220, 218,  220.00f,  218.00f},
+    {1139000, 220, 213,  220.00f,  215.25f},
+    {1150000, 219, 214,  220.00f,  212.50f},
+    {1160000, 222, 210,  220.00f,  210.00f},
+    {1171000, 219, 205,  220.00f,  207.25f},
+    {1181000, 220, 205,  220.00f,  204.75f},
+    {1190000, 221, 200,  220.00f,  202.50f},
+    {1201000, 221, 200,  220.00f,  200.00f},
+    {1211000, 220, 200,  220.00f,  200.00f},
+    {1220000, 219, 201,  220.00f,  200.00f},
+    {1231000, 219, 199,  220.00f,  200.00f},
+    {1241000, 219, 201,  220.00f,  200.00f},
+    {1251000, 220, 199,  220.00f,  200.00f},
+    {1260000, 222, 200,  220.00f,  200.00f},
+    {1269000, 222, 201,  220.00f,  200.00f},
+    {1279000, 222, 202,  220.00f,  200.00f},
+    {1289000, 218, 200,  220.00f,  200.00f},
+    {1299000, 218, 198,  220.00f,  200.00f},
+    {1308000, 222, 202,  220.00f,  200.00f},
+    {1318000, 221, 199,  220.00f,  200.00f},
+    {1327000, 221, 200,  220.00f,  200.00f},
+    {1337000, 221, 199,  220.00f,  200.00f},
+    {1346000, 220, 200,  220.00f,  200.00f},
+    {1357000, 222, 201,  220.00f,  200.00f},
+    {1366000, 221, 200,  220.00f,  200.00f},
+    {1376000, 221, 201,  220.00f,  200.00f},
+    {1386000, 222, 200,  220.00f,  200.00f},
+    {1396000, 219, 200,  220.00f,  200.00f},
+    {1407000, 218, 201,  220.00f,  200.00f},
+    {1417000, 220, 200,  220.00f,  200.00f},
+    {1427000, 219, 199,  220.00f,  200.00f},
+    {1436000, 220, 201,  220.00f,  200.00f},
+    {1446000, 221, 201,  220.00f,  200.00f},
+    {1455000, 219, 201,  220.00f,  200.00f},
+    {1465000, 221, 200,  220.00f,  200.00f},
+    {1475000, 220, 200,  220.00f,  200.00f},
+    {1484000, 220, 199,  220.00f,  200.00f},
+    {1493000, 220, 199,  220.00f,  200.00f},
+    {1503000, 221, 200,  220.00f,  200.00f},
+    {1514000, 220, 202,  220.00f,  200.00f},
+    {1523000, 222, 198,  220.00f,  200.00f},
+    {1534000, 221, 201,  220.00f,  200.00f},
+    {1544000, 219, 200,  220.00f,  200.00f},
+    {1554000, 219, 202,  220.00f,  200.00f},
+    {1564000, 219, 200,  220.00f,  200.00f},
+    {1574000, 221, 200,  220.00f,  200.00f},
+    {1583000, 221, 201,  220.00f,  200.00f},
+    {1593000, 220, 201,  220.00f,  200.00f},
+};
@@ -0,0 +1,298 @@
+// Re-encode the MJPEG frames of an AVI with restart markers, so the player can decode the
+// top and bottom of each frame on both cores at once (see mjpeg_decoder_set_worker() in
+// components/lv_ui/include/mjpeg_decode.h).
+//
+// The frames are transcoded losslessly, as jpegtran -restart does: their DCT coefficients
+// are kept and only the entropy coding is redone, with a restart marker every `rows` rows
+// of MCUs (1 by default, so the player can cut a frame at any row) and the standard
+// Huffman tables, the same in every frame so the player parses them once. Progressive
+// frames come out baseline. Everything else in the file is copied as it is; the idx1
+// index and the video stream's suggested buffer size are updated for the new sizes.
+// OpenDML files (over 1 GB, or with an indx super index) are not handled.
+//
+// Build and run from the repository root (needs libjpeg-turbo, e.g. libjpeg-turbo8-dev):
+// gcc -std=gnu11 -O2 -Wall -o /tmp/avi_restart tools/avi_restart.c -ljpeg
+// /tmp/avi_restart [-r rows] in.avi out.avi
+
+#include <setjmp.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <jpeglib.h>
+
+typedef struct {
+    uint8_t *p;
+    uint32_t len;
+    uint32_t cap;
+} buf_t;
+
+// A chunk of the movi list: where it was and where it went
+typedef struct {
+    uint32_t old_off;           // from the 'movi' fourcc
+    uint32_t new_off;
+    uint32_t new_size;
+} moved_t;
+
+typedef struct {
+    const uint8_t *in;
+    uint32_t in_len;
+    buf_t out;
+    int rows;
+    moved_t *moved;
+    uint32_t moved_count;
+    uint32_t moved_cap;
+    uint32_t old_movi;          // offset of the 'movi' fourcc, in and out
+    uint32_t new_movi;
+    uint32_t strh_size_at;      // video strh's dwSuggestedBufferSize in the output, 0 if none
+    uint32_t largest;
+    uint32_t frames;
+    uint32_t failed;
+    uint64_t bytes_in;
+    uint64_t bytes_out;
+} avi_job_t;
+
+typedef struct {
+    struct jpeg_error_mgr pub;
+    jmp_buf jump;
+} jpeg_err_t;
+
+static uint32_t rd32(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static void wr32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static void put(buf_t *b, const void *d, uint32_t n) {
+    if (b->len + n > b->cap) {
+        uint32_t cap = b->cap ? b->cap : 1 << 20;
+        while (cap < b->len + n) cap *= 2;
+        if (!(b->p = realloc(b->p, cap))) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+        b->cap = cap;
+    }
+    memcpy(b->p + b->len, d, n);
+    b->len += n;
+}
+
+static void put32(buf_t *b, uint32_t v) {
+    uint8_t le[4];
+    wr32(le, v);
+    put(b, le, 4);
+}
+
+static void jpeg_err_exit(j_common_ptr cinfo) {
+    jpeg_err_t *err = (jpeg_err_t *)cinfo->err;
+    longjmp(err->jump, 1);
+}
+
+// The frame with a restart marker every `rows` MCU rows, or NULL if libjpeg cannot read it
+static uint8_t *add_restarts(const uint8_t *jpg, uint32_t size, int rows, uint32_t *out_size) {
+    struct jpeg_decompress_struct d;
+    struct jpeg_compress_struct c;
+    jpeg_err_t err;
+    unsigned char *out = NULL;
+    unsigned long out_len = 0;
+    d.err = c.err = jpeg_std_error(&err.pub);
+    err.pub.error_exit = jpeg_err_exit;
+    jpeg_create_decompress(&d);
+    jpeg_create_compress(&c);
+    if (setjmp(err.jump)) {
+        // The output buffer is left: libjpeg may have replaced it already
+        jpeg_destroy_compress(&c);
+        jpeg_destroy_decompress(&d);
+        return NULL;
+    }
+    jpeg_mem_src(&d, jpg, size);
+    jpeg_read_header(&d, TRUE);
+    jvirt_barray_ptr *coef = jpeg_read_coefficients(&d);
+    jpeg_mem_dest(&c, &out, &out_len);
+    jpeg_copy_critical_parameters(&d, &c);
+    c.write_JFIF_header = FALSE;
+    c.optimize_coding = FALSE;
+    c.restart_in_rows = rows;
+    jpeg_write_coefficients(&c, coef);
+    jpeg_finish_compress(&c);
+    jpeg_finish_decompress(&d);
+    jpeg_destroy_compress(&c);
+    jpeg_destroy_decompress(&d);
+    *out_size = (uint32_t)out_len;
+    return out;
+}
+
+static bool is_frame_id(const uint8_t *id) {
+    return id[0] >= '0' && id[0] <= '9' && id[1] >= '0' && id[1] <= '9' && id[2] == 'd' &&
+           (id[3] == 'c' || id[3] == 'b');
+}
+
+static void note_moved(avi_job_t *j, uint32_t old_off, uint32_t new_off, uint32_t new_size) {
+    if (j->moved_count == j->moved_cap) {
+        j->moved_cap = j->moved_cap ? j->moved_cap * 2 : 1024;
+        if (!(j->moved = realloc(j->moved, j->moved_cap * sizeof(*j->moved)))) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+    }
+    j->moved[j->moved_count++] = (moved_t){ old_off, new_off, new_size };
+}
+
+static const moved_t *find_moved(const avi_job_t *j, uint32_t old_off) {
+    uint32_t lo = 0, hi = j->moved_count;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if (j->moved[mid].old_off < old_off) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo < j->moved_count && j->moved[lo].old_off == old_off ? &j->moved[lo] : NULL;
+}
+
+// idx1: entries point at chunks by offset from the 'movi' fourcc, or from the start of the
+// file in some writers
+static void copy_idx1(avi_job_t *j, const uint8_t *body, uint32_t size) {
+    uint32_t count = size / 16;
+    bool absolute = count && rd32(body + 8) >= j->old_movi && !find_moved(j, rd32(body + 8));
+    uint32_t missing = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        uint8_t e[16];
+        memcpy(e, body + i * 16, 16);
+        uint32_t off = rd32(e + 8);
+        const moved_t *m = find_moved(j, absolute ? off - j->old_movi : off);
+        if (m) {
+            wr32(e + 8, absolute ? m->new_off + j->new_movi : m->new_off);
+            wr32(e + 12, m->new_size);
+        } else {
+            missing++;
+        }
+        put(&j->out, e, 16);
+    }
+    if (missing) fprintf(stderr, "warning: %u idx1 entries point at no chunk\n", (unsigned)missing);
+}
+
+static void copy_list(avi_job_t *j, uint32_t pos, uint32_t end, bool in_movi);
+
+// One chunk (or list) at `pos` of the input to the output; returns the input's next chunk
+static uint32_t copy_chunk(avi_job_t *j, uint32_t pos, uint32_t end, bool in_movi) {
+    const uint8_t *id = j->in + pos;
+    uint32_t size = rd32(id + 4);
+    if (size > end - pos - 8) size = end - pos - 8;
+    const uint8_t *body = id + 8;
+    uint32_t out_at = j->out.len;
+    bool list = !memcmp(id, "RIFF", 4) || !memcmp(id, "LIST", 4);
+
+    if (list && size >= 4) {
+        put(&j->out, id, 12);
+        bool movi = !memcmp(body, "movi", 4);
+        if (movi) {
+            j->old_movi = pos + 8;
+            j->new_movi = out_at + 8;
+        }
+        // A 'rec ' list in movi may be indexed itself; noted before its chunks, in order
+        uint32_t noted = j->moved_count;
+        if (in_movi) note_moved(j, pos - j->old_movi, out_at - j->new_movi, 0);
+        copy_list(j, pos + 12, pos + 8 + size, in_movi || movi);
+        wr32(j->out.p + out_at + 4, j->out.len - out_at - 8);
+        if (in_movi) j->moved[noted].new_size = j->out.len - out_at - 8;
+    } else if (in_movi && is_frame_id(id) && size >= 2 && body[0] == 0xFF && body[1] == 0xD8) {
+        uint32_t new_size;
+        uint8_t *jpg = add_restarts(body, size, j->rows, &new_size);
+        j->frames++;
+        j->bytes_in += size;
+        if (!jpg) {
+            // Kept as it was; the player decodes it in one part
+            j->failed++;
+            jpg = (uint8_t *)body;
+            new_size = size;
+        }
+        put(&j->out, id, 4);
+        put32(&j->out, new_size);
+        put(&j->out, jpg, new_size);
+        if (jpg != body) free(jpg);
+        j->bytes_out += new_size;
+        if (new_size > j->largest) j->largest = new_size;
+        note_moved(j, pos - j->old_movi, out_at - j->new_movi, new_size);
+    } else {
+        if (!memcmp(id, "indx", 4)) {
+            fprintf(stderr, "OpenDML super index: not handled\n");
+            exit(1);
+        }
+        if (!memcmp(id, "strh", 4) && size >= 40 && !memcmp(body, "vids", 4)) j->strh_size_at = out_at + 8 + 36;
+        put(&j->out, id, 4);
+        put32(&j->out, size);
+        if (!memcmp(id, "idx1", 4)) {
+            copy_idx1(j, body, size);
+        } else {
+            put(&j->out, body, size);
+        }
+        if (in_movi) note_moved(j, pos - j->old_movi, out_at - j->new_movi, size);
+    }
+    if (j->out.len & 1) put(&j->out, "", 1);
+    return pos + 8 + size + (size & 1);
+}
+
+static void copy_list(avi_job_t *j, uint32_t pos, uint32_t end, bool in_movi) {
+    while (pos + 8 <= end) pos = copy_chunk(j, pos, end, in_movi);
+}
+
+int main(int argc, char **argv) {
+    avi_job_t j = { .rows = 1 };
+    int arg = 1;
+    if (argc == 5 && !strcmp(argv[1], "-r")) {
+        j.rows = atoi(argv[2]);
+        arg = 3;
+    }
+    if (argc - arg != 2 || j.rows < 1) {
+        fprintf(stderr, "usage: %s [-r rows] in.avi out.avi\n", argv[0]);
+        return 2;
+    }
+
+    FILE *f = fopen(argv[arg], "rb");
+    if (!f) {
+        perror(argv[arg]);
+        return 1;
+    }
+    buf_t in = {0};
+    uint8_t chunk[65536];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) put(&in, chunk, (uint32_t)n);
+    fclose(f);
+    if (in.len < 12 || memcmp(in.p, "RIFF", 4) || memcmp(in.p + 8, "AVI ", 4)) {
+        fprintf(stderr, "%s: not an AVI file\n", argv[arg]);
+        return 1;
+    }
+    j.in = in.p;
+    j.in_len = in.len;
+    uint32_t riff_end = 8 + rd32(in.p + 4);
+    if (riff_end > in.len) riff_end = in.len;
+    copy_chunk(&j, 0, riff_end, false);
+    if (riff_end + 12 <= in.len && !memcmp(in.p + riff_end + 8, "AVIX", 4)) {
+        fprintf(stderr, "OpenDML AVIX extension: not handled\n");
+        return 1;
+    }
+    // The player sizes its read-ahead by it
+    if (j.strh_size_at && j.largest > rd32(j.out.p + j.strh_size_at)) wr32(j.out.p + j.strh_size_at, j.largest);
+
+    f = fopen(argv[arg + 1], "wb");
+    if (!f || fwrite(j.out.p, 1, j.out.len, f) != j.out.len || fclose(f)) {
+        perror(argv[arg + 1]);
+        return 1;
+    }
+    printf("%u frames, %u kept as they were; %llu -> %llu bytes (%+.1f%%), largest %u, a marker every %d MCU row%s\n",
+           (unsigned)j.frames, (unsigned)j.failed, (unsigned long long)j.bytes_in, (unsigned long long)j.bytes_out,
+           j.bytes_in ? 100.0 * j.bytes_out / j.bytes_in - 100 : 0.0, (unsigned)j.largest, j.rows,
+           j.rows > 1 ? "s" : "");
+    free(in.p);
+    free(j.out.p);
+    free(j.moved);
+    return j.frames ? 0 : 1;
+}
@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+"""Pack images and fonts into an asset bundle for the `storage` flash partition.
+
+The device maps the bundle with esp_partition_mmap() and hands LVGL descriptors that point
+straight into flash (see components/lv_ui/include/asset_bundle.h for the format). Images are
+converted here, once, to LVGL's in-memory pixel formats; fonts are LVGL binary fonts
+(lv_font_conv --format bin) stored as they are.
+
+Usage (the bundle in assets/ is flashed with the app by `idf.py flash`):
+  python tools/pack_assets.py --bg 101010 -o assets/assets.bin docs/img_watermelon.png docs/img_venezuela.png
+  python tools/pack_assets.py -o out.bin icon.png:rgb565a8 name=other.png font_20=font.bin
+
+An input is [name=]path[:format]. The name defaults to "img_" + the file stem for images and
+the stem for fonts. Image formats: rgb565 (alpha blended over --bg, the default),
+rgb565a8 (keeps the alpha channel) and argb8888. Only the standard library is needed.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+MAGIC = b"T4AB"
+VERSION = 1
+HEADER = struct.Struct("<4sHHII")           # magic, version, count, total size, crc32
+ENTRY = struct.Struct("<24sBBHHHII")        # name, type, cf, w, h, stride, offset, size
+ALIGN = 16
+NAME_MAX = 23
+
+TYPE_IMAGE = 1
+TYPE_FONT = 2
+
+# lv_color_format_t values (LVGL 9)
+CF = {"rgb565": 0x12, "rgb565a8": 0x14, "argb8888": 0x10}
+
+
+def read_png(path):
+    """Decode an 8-bit, non-interlaced PNG to rows of (r, g, b, a) tuples."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path}: not a PNG")
+    pos, idat, palette, trns = 8, b"", None, None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            w, h, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            trns = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(ctype)
+    if depth != 8 or interlace or channels is None:
+        raise ValueError(f"{path}: only 8-bit non-interlaced PNGs are supported")
+
+    raw = zlib.decompress(idat)
+    bpp, stride = channels, w * channels
+    rows, prev = [], bytearray(stride)
+    for y in range(h):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else b if pb <= pc else c
+                line[i] = (line[i] + pred) & 0xFF
+        px = []
+        for x in range(w):
+            s = line[x * bpp:(x + 1) * bpp]
+            if ctype == 0:
+                px.append((s[0], s[0], s[0], 255))
+            elif ctype == 2:
+                px.append((s[0], s[1], s[2], 255))
+            elif ctype == 3:
+                r, g, b = palette[s[0]]
+                px.append((r, g, b, trns[s[0]] if trns and s[0] < len(trns) else 255))
+            elif ctype == 4:
+                px.append((s[0], s[0], s[0], s[1]))
+            else:
+                px.append(tuple(s))
+        rows.append(px)
+        prev = line
+    return w, h, rows
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def convert(rows, fmt, bg):
+    """Pixel data in LVGL's in-memory layout (little-endian, as the C-array converter emits)."""
+    out = bytearray()
+    if fmt == "argb8888":
+        for row in rows:
+            for r, g, b, a in row:
+                out += bytes((b, g, r, a))
+        return out
+    alpha = bytearray()
+    for row in rows:
+        for r, g, b, a in row:
+            if fmt == "rgb565":
+                r = (r * a + bg[0] * (255 - a) + 127) // 255
+                g = (g * a + bg[1] * (255 - a) + 127) // 255
+                b = (b * a + bg[2] * (255 - a) + 127) // 255
+            out += struct.pack("<H", rgb565(r, g, b))
+            alpha.append(a)
+    # RGB565A8: the alpha plane follows the color plane
+    return out + alpha if fmt == "rgb565a8" else out
+
+
+def parse_input(spec):
+    name = None
+    if "=" in spec.split(os.sep)[0]:
+        name, spec = spec.split("=", 1)
+    fmt = None
+    base, _, suffix = spec.rpartition(":")
+    if base and suffix in CF:
+        spec, fmt = base, suffix
+    stem = os.path.splitext(os.path.basename(spec))[0]
+    is_font = spec.lower().endswith(".bin")
+    if name is None:
+        name = stem if is_font or stem.startswith("img_") else "img_" + stem
+    if len(name.encode()) > NAME_MAX:
+        raise ValueError(f"{name}: names are at most {NAME_MAX} bytes")
+    return name, spec, fmt, is_font
+
+
+def pack(inputs, default_fmt, bg):
+    entries = []
+    for spec in inputs:
+        name, path, fmt, is_font = parse_input(spec)
+        if is_font:
+            with open(path, "rb") as f:
+                entries.append((name, TYPE_FONT, 0, 0, 0, 0, f.read()))
+            continue
+        fmt = fmt or default_fmt
+        w, h, rows = read_png(path)
+        stride = w * (4 if fmt == "argb8888" else 2)
+        entries.append((name, TYPE_IMAGE, CF[fmt], w, h, stride, convert(rows, fmt, bg)))
+
+    # Sorted by name so the device can binary-search the index
+    entries.sort(key=lambda e: e[0].encode())
+    names = [e[0] for e in entries]
+    if len(set(names)) != len(names):
+        raise ValueError("duplicate asset names")
+
+    offset = HEADER.size + ENTRY.size * len(entries)
+    index, blobs = bytearray(), bytearray()
+    for name, kind, cf, w, h, stride, blob in entries:
+        offset = (offset + ALIGN - 1) // ALIGN * ALIGN
+        pad = offset - (HEADER.size + ENTRY.size * len(entries) + len(blobs))
+        blobs += b"\0" * pad
+        index += ENTRY.pack(name.encode(), kind, cf, w, h, stride, offset, len(blob))
+        blobs += blob
+        offset += len(blob)
+    body = bytes(index + blobs)
+    total = HEADER.size + len(body)
+    return HEADER.pack(MAGIC, VERSION, len(entries), total, zlib.crc32(body)) + body, entries
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("inputs", nargs="+", help="[name=]path[:format]")
+    ap.add_argument("-o", "--output", required=True)
+    ap.add_argument("--format", choices=sorted(CF), default="rgb565", help="default image format")
+    ap.add_argument("--bg", default="000000", help="background for alpha blending into rgb565 (hex RGB)")
+    ap.add_argument("--max-size", type=lambda s: int(s, 0), default=0x600000, help="partition size")
+    args = ap.parse_args()
+
+    bg = bytes.fromhex(args.bg)
+    bundle, entries = pack(args.inputs, args.format, bg)
+    if len(bundle) > args.max_size:
+        sys.exit(f"bundle is {len(bundle)} bytes, the partition holds {args.max_size}")
+    with open(args.output, "wb") as f:
+        f.write(bundle)
+    for name, kind, cf, w, h, _, blob in entries:
+        what = f"{w}x{h} {[k for k, v in CF.items() if v == cf][0]}" if kind == TYPE_IMAGE else "font"
+        print(f"  {name:<24} {what:<18} {len(blob):>8} bytes")
+    print(f"{args.output}: {len(entries)} assets, {len(bundle)} bytes")
+
+
+if __name__ == "__main__":
+    main()